@@ -23,12 +23,14 @@
 
 #include <nsfx/component/i-object.h>
 #include <nsfx/component/object.h>
+#include <nsfx/component/arena-object.h>
 
 #include <nsfx/component/ptr.h>
 
 #include <nsfx/component/i-user.h>
 
 #include <nsfx/component/i-class-factory.h>
+#include <nsfx/component/i-bulk-class-factory.h>
 #include <nsfx/component/class-factory.h>
 
 #include <nsfx/component/i-class-registry.h>
@@ -36,6 +38,10 @@
 
 #include <nsfx/component/i-module.h>
 
+#include <nsfx/component/checkpoint-stream.h>
+#include <nsfx/component/i-checkpointable.h>
+#include <nsfx/component/checkpoint.h>
+
 
 #endif // COMPONENT_H__8C0FC172_57F7_4306_A0F8_16027B30D4A5
 
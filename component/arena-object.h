@@ -0,0 +1,253 @@
+/**
+ * @file
+ *
+ * @brief Component support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef ARENA_OBJECT_H__2B8F0E36_71C4_4A5D_B0D2_95E4C6A31F87
+#define ARENA_OBJECT_H__2B8F0E36_71C4_4A5D_B0D2_95E4C6A31F87
+
+
+#include <nsfx/component/config.h>
+#include <nsfx/component/object.h>
+#include <nsfx/component/ptr.h>
+#include <type_traits> // aligned_storage, alignment_of
+#include <utility>     // forward
+#include <memory>      // unique_ptr
+#include <new>
+
+#if defined(NSFX_COMPONENT_THREAD_SAFE)
+# include <atomic>
+#endif // defined(NSFX_COMPONENT_THREAD_SAFE)
+
+
+NSFX_OPEN_NAMESPACE
+
+
+template<class ObjectImpl>
+class ArenaObject;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ObjectArena
+/**
+ * @ingroup Component
+ * @brief A contiguous block of storage for objects of the same class.
+ *
+ * @tparam ObjectImpl A class that conforms to `ObjectImplConcept`.
+ *
+ * The arena counts the objects that live in it.
+ * The storage of a released object is not reused.
+ * The arena deallocates itself when the last object is released.
+ *
+ * @see `CreateArenaObjects()`.
+ */
+template<class ObjectImpl>
+class ObjectArena/*{{{*/
+{
+    typedef ArenaObject<ObjectImpl>  ObjectType;
+    typedef typename std::aligned_storage<
+                sizeof (ObjectType),
+                std::alignment_of<ObjectType>::value>::type  StorageType;
+
+#if !defined(NSFX_COMPONENT_THREAD_SAFE)
+    typedef refcount_t  RefCountType;
+#else // if defined(NSFX_COMPONENT_THREAD_SAFE)
+    typedef std::atomic<refcount_t>  RefCountType;
+#endif // !defined(NSFX_COMPONENT_THREAD_SAFE)
+
+    explicit ObjectArena(size_t capacity) :
+        storage_(new StorageType[capacity]),
+        capacity_(capacity),
+        // The reference of the creator.
+        refCount_(1)
+    {}
+
+    // Non-copyable.
+    BOOST_DELETED_FUNCTION(ObjectArena(const ObjectArena& ));
+    BOOST_DELETED_FUNCTION(ObjectArena& operator=(const ObjectArena& ));
+
+public:
+    /**
+     * @brief Create objects in a new arena.
+     *
+     * @param[in] n    The number of objects.
+     * @param[in] args The arguments to construct each object.
+     *                 They are passed as *l-values*.
+     *
+     * @throw std::bad_alloc
+     *
+     * If an object cannot be constructed, the objects that have been
+     * constructed are released, and the exception is rethrown.
+     */
+    template<class... Args>
+    static vector<Ptr<ObjectType>> Create(size_t n, Args&&... args)
+    {
+        vector<Ptr<ObjectType>> result;
+        if (n)
+        {
+            result.reserve(n);
+            std::unique_ptr<ObjectArena> p(new ObjectArena(n));
+            ObjectArena* arena = p.release();
+            // Release the reference of the creator at exit.
+            struct Guard
+            {
+                ~Guard(void) { arena_->Release(); }
+                ObjectArena* arena_;
+            } guard = { arena };
+            for (size_t i = 0; i < n; ++i)
+            {
+                void* slot = &arena->storage_[i];
+                ObjectType* o = ::new (slot) ObjectType(arena, args...);
+                ++arena->refCount_;
+                result.emplace_back(o);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Get the number of objects that the arena can hold.
+     */
+    size_t GetCapacity(void) const BOOST_NOEXCEPT
+    {
+        return capacity_;
+    }
+
+private:
+    friend class ArenaObject<ObjectImpl>;
+
+    void Release(void) BOOST_NOEXCEPT
+    {
+        if (!--refCount_)
+        {
+            delete this;
+        }
+    }
+
+private:
+    std::unique_ptr<StorageType[]>  storage_;
+    size_t        capacity_;
+    RefCountType  refCount_; /// The number of live objects, and the creator.
+
+}; // class ObjectArena /*}}}*/
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ArenaObject
+/**
+ * @ingroup Component
+ * @brief A non-aggregable object that lives in an arena.
+ *
+ * @tparam ObjectImpl A class that conforms to `ObjectImplConcept`.
+ *
+ * An `ArenaObject` behaves like an `Object`.
+ * The difference is that, when its reference count reaches `0`, it destroys
+ * itself, and returns its storage to the arena instead of the heap.
+ *
+ * ### When to use?
+ *     When a large number of objects of the same class are created at once,
+ *     e.g., the nodes of a large topology.
+ *     The objects are allocated by a single allocation, and they are stored
+ *     contiguously, which improves the locality.
+ * ### How to use?
+ *     An `ArenaObject` must be created by `CreateArenaObjects()`.
+ *     i.e., `Ptr` shall be used to hold an `ArenaObject`.
+ */
+template<class ObjectImpl>
+class ArenaObject NSFX_FINAL :/*{{{*/
+    private ObjectBase, // Use private inherit as the methods are only used internally.
+    public ObjectImpl
+{
+private:
+    BOOST_CONCEPT_ASSERT((ObjectImplConcept<ObjectImpl>));
+
+    friend class ObjectArena<ObjectImpl>;
+
+    template<class... Args>
+    ArenaObject(ObjectArena<ObjectImpl>* arena, Args&&... args) :
+        ObjectImpl(std::forward<Args>(args)...),
+        arena_(arena)
+    {}
+
+    virtual ~ArenaObject(void) {}
+
+    // Non-copyable.
+    BOOST_DELETED_FUNCTION(ArenaObject(const ArenaObject& ));
+    BOOST_DELETED_FUNCTION(ArenaObject& operator=(const ArenaObject& ));
+
+    // IObject./*{{{*/
+public:
+    virtual refcount_t AddRef(void) BOOST_NOEXCEPT NSFX_FINAL NSFX_OVERRIDE
+    {
+        refcount_t result = InternalAddRef();
+        return result;
+    }
+
+    virtual refcount_t Release(void) NSFX_FINAL NSFX_OVERRIDE
+    {
+        refcount_t result = InternalRelease();
+        if (!result)
+        {
+            ObjectArena<ObjectImpl>* arena = arena_;
+            this->~ArenaObject();
+            arena->Release();
+        }
+        return result;
+    }
+
+    virtual void* QueryInterface(const Uid& iid) NSFX_FINAL NSFX_OVERRIDE
+    {
+        return ObjectImpl::InternalQueryInterface(iid);
+    }
+
+    /*}}}*/
+
+    // Methods.
+    ObjectImpl* GetImpl(void) BOOST_NOEXCEPT
+    {
+        return static_cast<ObjectImpl*>(this);
+    }
+
+private:
+    ObjectArena<ObjectImpl>* arena_;
+
+}; // class ArenaObject /*}}}*/
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Component
+ * @brief Create objects in a contiguous arena.
+ *
+ * @tparam ObjectImpl A class that conforms to `ObjectImplConcept`.
+ *
+ * @param[in] n    The number of objects.
+ * @param[in] args The arguments to construct each object.
+ *
+ * @throw std::bad_alloc
+ *
+ * @see `ObjectArena`.
+ */
+template<class ObjectImpl, class... Args>
+inline vector<Ptr<ArenaObject<ObjectImpl>>>
+CreateArenaObjects(size_t n, Args&&... args)
+{
+    return ObjectArena<ObjectImpl>::Create(n, std::forward<Args>(args)...);
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // ARENA_OBJECT_H__2B8F0E36_71C4_4A5D_B0D2_95E4C6A31F87
+
@@ -0,0 +1,420 @@
+/**
+ * @file
+ *
+ * @brief Component support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef CHECKPOINT_STREAM_H__E2546993_40C1_4C29_B0E4_71C02D870867
+#define CHECKPOINT_STREAM_H__E2546993_40C1_4C29_B0E4_71C02D870867
+
+
+#include <nsfx/component/config.h>
+#include <nsfx/component/exception.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <limits>
+#include <cstring> // memcpy
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CheckpointWriter.
+/**
+ * @ingroup Component
+ * @brief A streaming writer of checkpoints.
+ *
+ * The data is encoded in a compact binary format.
+ * * Integers are encoded as variable-length integers (LEB128).
+ *   Signed integers are zigzag encoded before the encoding.
+ * * Floating-point numbers are encoded as 8-byte little-endian IEEE 754
+ *   numbers.
+ * * Strings are encoded as the length followed by the characters.
+ *
+ * The data is buffered, and written to the output stream when the buffer is
+ * full, or when `Flush()` is called.
+ */
+class CheckpointWriter
+{
+public:
+    /**
+     * @brief Construct a writer.
+     *
+     * @param[in] os         The output stream.
+     * @param[in] bufferSize The size of the buffer.
+     */
+    explicit CheckpointWriter(std::ostream& os, size_t bufferSize = 65536) :
+        os_(os),
+        buffer_(bufferSize < 64 ? 64 : bufferSize),
+        size_(0),
+        numBytes_(0)
+    {}
+
+    /**
+     * @brief Flush the buffered data.
+     *
+     * The errors are ignored.
+     * Users **shall** call `Flush()` to detect the errors.
+     */
+    ~CheckpointWriter(void)
+    {
+        try
+        {
+            Flush();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(CheckpointWriter(const CheckpointWriter& ));
+    BOOST_DELETED_FUNCTION(CheckpointWriter& operator=(const CheckpointWriter& ));
+
+public:
+    void WriteUint64(uint64_t value)
+    {
+        Reserve(10);
+        while (value >= 0x80)
+        {
+            buffer_[size_++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        buffer_[size_++] = static_cast<uint8_t>(value);
+    }
+
+    void WriteInt64(int64_t value)
+    {
+        WriteUint64((static_cast<uint64_t>(value) << 1) ^
+                    static_cast<uint64_t>(value >> 63));
+    }
+
+    void WriteUint32(uint32_t value)
+    {
+        WriteUint64(value);
+    }
+
+    void WriteInt32(int32_t value)
+    {
+        WriteInt64(value);
+    }
+
+    void WriteBool(bool value)
+    {
+        Reserve(1);
+        buffer_[size_++] = value ? 1 : 0;
+    }
+
+    void WriteDouble(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof (bits));
+        Reserve(8);
+        for (size_t i = 0; i < 8; ++i)
+        {
+            buffer_[size_++] = static_cast<uint8_t>(bits >> (8 * i));
+        }
+    }
+
+    void WriteString(const std::string& value)
+    {
+        WriteUint64(value.size());
+        WriteBytes(value.data(), value.size());
+    }
+
+    /**
+     * @brief Write raw bytes.
+     *
+     * The length is not written.
+     */
+    void WriteBytes(const void* data, size_t size)
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        while (size)
+        {
+            if (size_ == buffer_.size())
+            {
+                Flush();
+            }
+            size_t n = buffer_.size() - size_;
+            if (n > size)
+            {
+                n = size;
+            }
+            std::memcpy(&buffer_[size_], p, n);
+            size_ += n;
+            p += n;
+            size -= n;
+        }
+    }
+
+    /**
+     * @brief Write the buffered data to the output stream.
+     *
+     * @throw BadCheckpoint Cannot write the output stream.
+     */
+    void Flush(void)
+    {
+        if (size_)
+        {
+            os_.write(reinterpret_cast<const char*>(&buffer_[0]), size_);
+            numBytes_ += size_;
+            size_ = 0;
+        }
+        os_.flush();
+        if (!os_)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Cannot write the checkpoint."));
+        }
+    }
+
+    /**
+     * @brief Get the number of bytes written, including the buffered bytes.
+     */
+    uint64_t GetNumBytes(void) const BOOST_NOEXCEPT
+    {
+        return numBytes_ + size_;
+    }
+
+private:
+    void Reserve(size_t n)
+    {
+        if (buffer_.size() - size_ < n)
+        {
+            Flush();
+        }
+    }
+
+private:
+    std::ostream&  os_;
+    vector<uint8_t>  buffer_;
+    size_t    size_;
+    uint64_t  numBytes_;
+
+}; // class CheckpointWriter
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CheckpointReader.
+/**
+ * @ingroup Component
+ * @brief A streaming reader of checkpoints.
+ *
+ * It reads the data written by `CheckpointWriter`.
+ *
+ * The reader reads the input stream in blocks, thus it may read beyond the
+ * end of the checkpoint.
+ *
+ * The reader carries a context object provided by the user.
+ * The objects that are re-created during restoration, e.g., the event sinks
+ * of the pending events, can obtain the model from the context.
+ */
+class CheckpointReader
+{
+public:
+    /**
+     * @brief Construct a reader.
+     *
+     * @param[in] is         The input stream.
+     * @param[in] context    The context object.
+     * @param[in] bufferSize The size of the buffer.
+     */
+    explicit CheckpointReader(std::istream& is,
+                              Ptr<IObject> context = nullptr,
+                              size_t bufferSize = 65536) :
+        is_(is),
+        context_(context),
+        buffer_(bufferSize < 64 ? 64 : bufferSize),
+        size_(0),
+        pos_(0)
+    {}
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(CheckpointReader(const CheckpointReader& ));
+    BOOST_DELETED_FUNCTION(CheckpointReader& operator=(const CheckpointReader& ));
+
+public:
+    /**
+     * @throw BadCheckpoint The checkpoint is truncated or corrupted.
+     */
+    uint64_t ReadUint64(void)
+    {
+        uint64_t value = 0;
+        for (size_t shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte = ReadByte();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+            {
+                return value;
+            }
+        }
+        BOOST_THROW_EXCEPTION(
+            BadCheckpoint() <<
+            ErrorMessage("Invalid integer in the checkpoint."));
+    }
+
+    int64_t ReadInt64(void)
+    {
+        uint64_t value = ReadUint64();
+        return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    uint32_t ReadUint32(void)
+    {
+        uint64_t value = ReadUint64();
+        if (value > 0xffffffffULL)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Invalid integer in the checkpoint."));
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    int32_t ReadInt32(void)
+    {
+        int64_t value = ReadInt64();
+        if (value < (std::numeric_limits<int32_t>::min)() ||
+            value > (std::numeric_limits<int32_t>::max)())
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Invalid integer in the checkpoint."));
+        }
+        return static_cast<int32_t>(value);
+    }
+
+    bool ReadBool(void)
+    {
+        uint8_t byte = ReadByte();
+        if (byte > 1)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Invalid boolean in the checkpoint."));
+        }
+        return !!byte;
+    }
+
+    double ReadDouble(void)
+    {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            bits |= static_cast<uint64_t>(ReadByte()) << (8 * i);
+        }
+        double value;
+        std::memcpy(&value, &bits, sizeof (value));
+        return value;
+    }
+
+    std::string ReadString(void)
+    {
+        uint64_t size = ReadUint64();
+        std::string value;
+        while (size)
+        {
+            if (pos_ == size_)
+            {
+                Fill();
+            }
+            size_t n = size_ - pos_;
+            if (n > size)
+            {
+                n = static_cast<size_t>(size);
+            }
+            value.append(reinterpret_cast<const char*>(&buffer_[pos_]), n);
+            pos_ += n;
+            size -= n;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Read raw bytes.
+     */
+    void ReadBytes(void* data, size_t size)
+    {
+        uint8_t* p = static_cast<uint8_t*>(data);
+        while (size)
+        {
+            if (pos_ == size_)
+            {
+                Fill();
+            }
+            size_t n = size_ - pos_;
+            if (n > size)
+            {
+                n = size;
+            }
+            std::memcpy(p, &buffer_[pos_], n);
+            pos_ += n;
+            p += n;
+            size -= n;
+        }
+    }
+
+    /**
+     * @brief Get the context object.
+     */
+    Ptr<IObject> GetContext(void) const
+    {
+        return context_;
+    }
+
+private:
+    uint8_t ReadByte(void)
+    {
+        if (pos_ == size_)
+        {
+            Fill();
+        }
+        return buffer_[pos_++];
+    }
+
+    void Fill(void)
+    {
+        is_.read(reinterpret_cast<char*>(&buffer_[0]), buffer_.size());
+        size_ = static_cast<size_t>(is_.gcount());
+        pos_ = 0;
+        if (!size_)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Unexpected end of the checkpoint."));
+        }
+    }
+
+private:
+    std::istream&  is_;
+    Ptr<IObject>   context_;
+    vector<uint8_t>  buffer_;
+    size_t  size_;
+    size_t  pos_;
+
+}; // class CheckpointReader
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // CHECKPOINT_STREAM_H__E2546993_40C1_4C29_B0E4_71C02D870867
+
@@ -0,0 +1,191 @@
+/**
+ * @file
+ *
+ * @brief Component support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef CHECKPOINT_H__85F2D7D4_4AB3_4982_BCD7_0BBA4C5CEE22
+#define CHECKPOINT_H__85F2D7D4_4AB3_4982_BCD7_0BBA4C5CEE22
+
+
+#include <nsfx/component/config.h>
+#include <nsfx/component/exception.h>
+#include <nsfx/component/i-checkpointable.h>
+#include <nsfx/component/checkpoint-stream.h>
+#include <nsfx/component/ptr.h>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility> // pair
+#include <cstring> // memcmp
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Checkpoint.
+/**
+ * @ingroup Component
+ * @brief A checkpoint of a set of objects.
+ *
+ * The objects are identified by their names.
+ * They are saved and restored in the order they are added.
+ *
+ * # Format
+ * @code
+ * checkpoint := "NSFXCKPT" version count object*
+ * object     := name state sentinel
+ * @endcode
+ * where `version`, `count` and `sentinel` are variable-length integers,
+ * `name` is a string, and `state` is written by the object.
+ * The sentinel detects an object that reads less or more data than it writes.
+ *
+ * @code
+ * Checkpoint checkpoint;
+ * checkpoint.Add("simulator", simulator);
+ * checkpoint.Add("rng", rng);
+ * checkpoint.Save(os);
+ * ...
+ * // Create and wire the objects in the same way.
+ * checkpoint.Restore(is, context);
+ * @endcode
+ */
+class Checkpoint
+{
+public:
+    /**
+     * @brief The version of the format.
+     */
+    static const uint32_t VERSION = 1;
+
+public:
+    /**
+     * @brief Add an object.
+     *
+     * @throw InvalidPointer  The object is `nullptr`.
+     * @throw InvalidArgument The name has been used.
+     */
+    void Add(const std::string& name, Ptr<ICheckpointable> object)
+    {
+        if (!object)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        for (auto it = objects_.cbegin(); it != objects_.cend(); ++it)
+        {
+            if (it->first == name)
+            {
+                BOOST_THROW_EXCEPTION(
+                    InvalidArgument() <<
+                    ErrorMessage("Duplicate object name \"" + name + "\"."));
+            }
+        }
+        objects_.emplace_back(name, std::move(object));
+    }
+
+    /**
+     * @brief Save the states of the objects.
+     *
+     * @throw BadCheckpoint Cannot write the output stream.
+     */
+    void Save(std::ostream& os)
+    {
+        CheckpointWriter writer(os);
+        writer.WriteBytes(GetMagic(), MAGIC_SIZE);
+        writer.WriteUint32(VERSION);
+        writer.WriteUint64(objects_.size());
+        for (auto it = objects_.begin(); it != objects_.end(); ++it)
+        {
+            writer.WriteString(it->first);
+            it->second->SaveCheckpoint(writer);
+            writer.WriteUint32(SENTINEL);
+        }
+        writer.Flush();
+    }
+
+    /**
+     * @brief Restore the states of the objects.
+     *
+     * @param[in] is      The input stream.
+     * @param[in] context The context object that is accessible to the objects
+     *                    via `CheckpointReader::GetContext()`.
+     *
+     * @throw BadCheckpoint The checkpoint is corrupted, or the objects do not
+     *                      match the checkpoint.
+     */
+    void Restore(std::istream& is, Ptr<IObject> context = nullptr)
+    {
+        CheckpointReader reader(is, std::move(context));
+        char magic[MAGIC_SIZE];
+        reader.ReadBytes(magic, MAGIC_SIZE);
+        if (std::memcmp(magic, GetMagic(), MAGIC_SIZE))
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("The stream is not a checkpoint."));
+        }
+        if (reader.ReadUint32() != VERSION)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Unsupported checkpoint version."));
+        }
+        if (reader.ReadUint64() != objects_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("The number of objects does not match."));
+        }
+        for (auto it = objects_.begin(); it != objects_.end(); ++it)
+        {
+            if (reader.ReadString() != it->first)
+            {
+                BOOST_THROW_EXCEPTION(
+                    BadCheckpoint() <<
+                    ErrorMessage("The object \"" + it->first +
+                                 "\" does not match."));
+            }
+            it->second->RestoreCheckpoint(reader);
+            if (reader.ReadUint32() != SENTINEL)
+            {
+                BOOST_THROW_EXCEPTION(
+                    BadCheckpoint() <<
+                    ErrorMessage("The state of the object \"" + it->first +
+                                 "\" is corrupted."));
+            }
+        }
+    }
+
+private:
+    enum
+    {
+        MAGIC_SIZE = 8,
+        SENTINEL = 0x4e534658, // "NSFX"
+    };
+
+    static const char* GetMagic(void) BOOST_NOEXCEPT
+    {
+        return "NSFXCKPT";
+    }
+
+private:
+    vector<std::pair<std::string, Ptr<ICheckpointable>>>  objects_;
+
+}; // class Checkpoint
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // CHECKPOINT_H__85F2D7D4_4AB3_4982_BCD7_0BBA4C5CEE22
+
@@ -19,7 +19,9 @@
 
 #include <nsfx/component/config.h>
 #include <nsfx/component/i-class-factory.h>
+#include <nsfx/component/i-bulk-class-factory.h>
 #include <nsfx/component/object.h>
+#include <nsfx/component/arena-object.h>
 #include <nsfx/component/exception.h>
 #include <memory> // unique_ptr
 
@@ -38,12 +40,16 @@ NSFX_OPEN_NAMESPACE
  * The factory uses `Object` or `AggObject` to make `T` a concrete class
  * according to whether a controller is specified.
  *
+ * The factory also provides `IBulkClassFactory`, which creates `ArenaObject`s
+ * in a contiguous arena.
+ *
  * The specialized class template conforms to `ObjectImplConcept`.
  * Thus, it shall be used in conjunction with `Object` or `AggObject`.
  */
 template<class T>
 class ClassFactory :
-    public IClassFactory
+    public IClassFactory,
+    public IBulkClassFactory
 {
 private:
     BOOST_CONCEPT_ASSERT((ObjectImplConcept<T>));
@@ -55,6 +61,9 @@ public:
     // IClassFactory
     virtual Ptr<IObject> CreateObject(IObject* controller) NSFX_FINAL NSFX_OVERRIDE;
 
+    // IBulkClassFactory
+    virtual vector<Ptr<IObject>> CreateObjects(size_t n) NSFX_FINAL NSFX_OVERRIDE;
+
 private:
     Ptr<IObject> CreateNonAggregable(void);
     Ptr<IObject> CreateAggregable(IObject* controller);
@@ -62,6 +71,7 @@ private:
 private:
     NSFX_INTERFACE_MAP_BEGIN(ClassFactory)
         NSFX_INTERFACE_ENTRY(IClassFactory)
+        NSFX_INTERFACE_ENTRY(IBulkClassFactory)
     NSFX_INTERFACE_MAP_END()
 
 };
@@ -76,6 +86,22 @@ ClassFactory<T>::CreateObject(IObject* controller)
                       : CreateNonAggregable();
 }
 
+template<class T>
+inline vector<Ptr<IObject>>
+ClassFactory<T>::CreateObjects(size_t n)
+{
+    typedef ArenaObject<T>  ObjectClass;
+    vector<Ptr<ObjectClass>> objects = CreateArenaObjects<T>(n);
+    vector<Ptr<IObject>> result;
+    result.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        IObject* o = objects[i].Get();
+        result.emplace_back(o);
+    }
+    return result;
+}
+
 template<class T>
 inline Ptr<IObject>
 ClassFactory<T>::CreateNonAggregable(void)
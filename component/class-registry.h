@@ -456,6 +456,71 @@ inline Ptr<I> CreateObject(const Uid& cid, IObject* controller = nullptr)
     }
 }
 
+/**
+ * @ingroup Component
+ * @brief Create uninitialized objects in bulk.
+ *
+ * @tparam I  The type of interface to query.
+ *            It must conform to `IObjectConcept` and `HasUidConcept`.
+ *
+ * @param[in] cid The UID of the class.
+ * @param[in] n   The number of objects.
+ *
+ * @throw ClassNotRegistered
+ * @throw NoInterface
+ *
+ * If the class factory provides `IBulkClassFactory`, the objects are allocated
+ * in a contiguous arena.
+ * Otherwise, the objects are created one by one.
+ *
+ * @see `IBulkClassFactory::CreateObjects()`.
+ */
+template<class I>
+inline vector<Ptr<I>> CreateObjects(const Uid& cid, size_t n)
+{
+    BOOST_CONCEPT_ASSERT((IObjectConcept<I>));
+    BOOST_CONCEPT_ASSERT((HasUidConcept<I>));
+    IClassRegistry* registry = ClassRegistry::GetInstance();
+    Ptr<IClassFactory> factory = registry->GetClassFactory(cid);
+    Ptr<IBulkClassFactory> bulk;
+    try
+    {
+        bulk = factory;
+    }
+    catch (NoInterface& )
+    {
+        // The objects are created one by one.
+    }
+    vector<Ptr<IObject>> objects;
+    if (bulk)
+    {
+        objects = bulk->CreateObjects(n);
+    }
+    else
+    {
+        objects.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            objects.emplace_back(factory->CreateObject(nullptr));
+        }
+    }
+    try
+    {
+        vector<Ptr<I>> result;
+        result.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            result.emplace_back(objects[i]);
+        }
+        return result;
+    }
+    catch (NoInterface& e)
+    {
+        e << ClassUidErrorInfo(cid);
+        throw;
+    }
+}
+
 
 NSFX_CLOSE_NAMESPACE
 
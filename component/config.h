@@ -25,6 +25,11 @@
  * @brief Support for component-based programming.
  *
  * Depends upon Exception module.
+ *
+ * Define `NSFX_COMPONENT_THREAD_SAFE` to make the reference counts of the
+ * component objects atomic, so smart pointers to a component can be copied and
+ * released in different threads.
+ * The macro **must** be defined consistently in all translation units.
  */
 
 
@@ -103,6 +103,15 @@ struct ClassNotRegistered : ComponentException {};
 struct ClassAlreadyRegistered : ComponentException {};
 
 
+////////////////////////////////////////////////////////////////////////////////
+// Checkpoint.
+/**
+ * @ingroup Exception
+ * @brief A checkpoint is corrupted, or does not match the objects.
+ */
+struct BadCheckpoint : ComponentException {};
+
+
 NSFX_CLOSE_NAMESPACE
 
 
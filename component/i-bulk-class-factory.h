@@ -0,0 +1,67 @@
+/**
+ * @file
+ *
+ * @brief Component support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_BULK_CLASS_FACTORY_H__8E1D3C57_4F2A_4B96_A7C0_3D5B9E2F6A14
+#define I_BULK_CLASS_FACTORY_H__8E1D3C57_4F2A_4B96_A7C0_3D5B9E2F6A14
+
+
+#include <nsfx/component/config.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IBulkClassFactory
+/**
+ * @ingroup Component
+ * @brief The class factory interface that creates objects in bulk.
+ *
+ * A class factory may provide this interface in addition to `IClassFactory`.
+ *
+ * @see `CreateObjects()`.
+ */
+class IBulkClassFactory :
+    virtual public IObject
+{
+public:
+    virtual ~IBulkClassFactory(void) BOOST_NOEXCEPT {}
+
+public:
+    /**
+     * @brief Create non-aggregable objects.
+     *
+     * The objects are allocated in a contiguous arena.
+     * The memory of the arena is deallocated when all of the objects are
+     * released.
+     *
+     * @param[in] n The number of objects.
+     *
+     * @throw std::bad_alloc
+     */
+    virtual vector<Ptr<IObject>> CreateObjects(size_t n) = 0;
+
+}; // class IBulkClassFactory
+
+
+NSFX_DEFINE_CLASS_UID(IBulkClassFactory, "edu.uestc.nsfx.IBulkClassFactory");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_BULK_CLASS_FACTORY_H__8E1D3C57_4F2A_4B96_A7C0_3D5B9E2F6A14
@@ -0,0 +1,97 @@
+/**
+ * @file
+ *
+ * @brief Component support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_CHECKPOINTABLE_H__A1FF2995_26E5_426C_BE42_F7A704971725
+#define I_CHECKPOINTABLE_H__A1FF2995_26E5_426C_BE42_F7A704971725
+
+
+#include <nsfx/component/config.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/uid.h>
+#include <nsfx/component/checkpoint-stream.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ICheckpointable.
+/**
+ * @ingroup Component
+ * @brief An object whose state can be saved to a checkpoint.
+ *
+ * The state is restored into an object that has been created and wired in the
+ * same way as the object that saved the state.
+ * i.e., the checkpoint holds the *state* of an object, not its configuration
+ * and connections.
+ */
+class ICheckpointable :
+    virtual public IObject
+{
+public:
+    virtual ~ICheckpointable(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Save the state of the object.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) = 0;
+
+    /**
+     * @brief Restore the state of the object.
+     *
+     * @throw BadCheckpoint The checkpoint is corrupted, or does not match
+     *                      the object.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) = 0;
+
+};
+
+NSFX_DEFINE_CLASS_UID(ICheckpointable, "edu.uestc.nsfx.ICheckpointable");
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IClassIdentity.
+/**
+ * @ingroup Component
+ * @brief An object that knows its class.
+ *
+ * An object that is re-created when a checkpoint is restored, e.g., the event
+ * sink of a pending event, provides this interface along with
+ * `ICheckpointable`.
+ * The class UID is saved along with the state of the object, and the object
+ * is re-created via `CreateObject()`.
+ */
+class IClassIdentity :
+    virtual public IObject
+{
+public:
+    virtual ~IClassIdentity(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Get the UID of the class that is registered in the class
+     *        registry.
+     */
+    virtual Uid GetClassUid(void) = 0;
+
+};
+
+NSFX_DEFINE_CLASS_UID(IClassIdentity, "edu.uestc.nsfx.IClassIdentity");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_CHECKPOINTABLE_H__A1FF2995_26E5_426C_BE42_F7A704971725
+
@@ -28,6 +28,10 @@
 #include <type_traits> // is_base_of
 #include <functional>
 
+#if defined(NSFX_COMPONENT_THREAD_SAFE)
+# include <atomic>
+#endif // defined(NSFX_COMPONENT_THREAD_SAFE)
+
 
 NSFX_OPEN_NAMESPACE
 
@@ -318,6 +322,7 @@ protected:
     {
     }
 
+#if !defined(NSFX_COMPONENT_THREAD_SAFE)
     refcount_t InternalAddRef(void) BOOST_NOEXCEPT
     {
         refcount_t result = ++refCount_;
@@ -330,6 +335,27 @@ protected:
         return result;
     }
 
+#else // if defined(NSFX_COMPONENT_THREAD_SAFE)
+    refcount_t InternalAddRef(void) BOOST_NOEXCEPT
+    {
+        // A new reference can only be made from an existing reference,
+        // thus no ordering is required.
+        refcount_t result =
+            refCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+        return result;
+    }
+
+    refcount_t InternalRelease(void) BOOST_NOEXCEPT
+    {
+        // The accesses to the object via the released reference must happen
+        // before the object is deallocated by another thread.
+        refcount_t result =
+            refCount_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        return result;
+    }
+
+#endif // !defined(NSFX_COMPONENT_THREAD_SAFE)
+
     // Defined via NSFX_INTERFACE_XXX() macros.
     // void* InternalQueryInterface(const Uid& iid);
 
@@ -349,10 +375,18 @@ protected:
     }
 
 private:
+#if !defined(NSFX_COMPONENT_THREAD_SAFE)
+    typedef refcount_t  RefCountType;
+#else // if defined(NSFX_COMPONENT_THREAD_SAFE)
+    typedef std::atomic<refcount_t>  RefCountType;
+    static_assert(sizeof (RefCountType) <= sizeof (IObject*),
+                  "The atomic reference count is too large.");
+#endif // !defined(NSFX_COMPONENT_THREAD_SAFE)
+
     union
     {
-        refcount_t refCount_;   /// The reference count.
-        IObject*   controller_; /// The controller.
+        RefCountType refCount_;   /// The reference count.
+        IObject*     controller_; /// The controller.
     };
 }; // class ObjectBase /*}}}*/
 
@@ -21,12 +21,137 @@
 #include <nsfx/component/exception.h>
 #include <nsfx/utility/type-identity.h>
 #include <boost/type_index.hpp>
-#include <cstring> // strlen, strcmp
+#include <boost/functional/hash.hpp>
+#include <unordered_set>
+#include <mutex>
+#include <memory>  // unique_ptr
+#include <cstring> // strlen, strcmp, memcpy
 
 
 NSFX_OPEN_NAMESPACE
 
 
+////////////////////////////////////////////////////////////////////////////////
+namespace aux {
+
+/**
+ * @ingroup Component
+ * @brief The pool of the interned UID strings.
+ *
+ * Each distinct UID string is copied into the pool once, and the copy is
+ * shared by all UIDs that are equal.
+ *
+ * The hash value of the string is stored right before the copy.
+ * The hash function does not depend upon the module, so two copies of a
+ * string that are interned in different pools have the same hash value.
+ *
+ * The pool is never destroyed, so the UIDs remain valid during the destruction
+ * of static objects.
+ *
+ * The pool is a static object defined in a header, so each module has its
+ * own pool, e.g., each DLL on Windows.
+ * A separate pool can be constructed to emulate another module, and the UIDs
+ * interned in it are invalid after it is destroyed.
+ */
+class UidPool
+{
+    struct Hash
+    {
+        size_t operator()(const char* s) const BOOST_NOEXCEPT
+        {
+            return UidPool::HashString(s);
+        }
+    };
+
+    struct Equal
+    {
+        bool operator()(const char* lhs, const char* rhs) const BOOST_NOEXCEPT
+        {
+            return !std::strcmp(lhs, rhs);
+        }
+    };
+
+public:
+    UidPool(void) {}
+
+    ~UidPool(void)
+    {
+        for (auto it = strings_.begin(); it != strings_.end(); ++it)
+        {
+            delete[] (*it - sizeof (size_t));
+        }
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(UidPool(const UidPool& ));
+    BOOST_DELETED_FUNCTION(UidPool& operator=(const UidPool& ));
+
+public:
+    static UidPool& GetInstance(void)
+    {
+        static UidPool* pool = new UidPool;
+        return *pool;
+    }
+
+    /**
+     * @brief Get the interned copy of a UID string.
+     *
+     * It is thread-safe.
+     *
+     * @throw std::bad_alloc    Cannot copy the string into the pool.
+     * @throw std::system_error Cannot lock the pool.
+     */
+    const char* Intern(const char* uid)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = strings_.find(uid);
+        if (it == strings_.end())
+        {
+            size_t size = std::strlen(uid) + 1;
+            size_t hash = HashString(uid);
+            // The memory returned by new[] is suitably aligned for size_t.
+            std::unique_ptr<char[]> block(new char[sizeof (size_t) + size]);
+            std::memcpy(block.get(), &hash, sizeof (size_t));
+            std::memcpy(block.get() + sizeof (size_t), uid, size);
+            it = strings_.insert(block.get() + sizeof (size_t)).first;
+            block.release();
+        }
+        return *it;
+    }
+
+    /**
+     * @brief Get the hash value of an interned string.
+     *
+     * @param[in] s A string returned by `Intern()` of any pool.
+     */
+    static size_t GetHash(const char* s) BOOST_NOEXCEPT
+    {
+        return *reinterpret_cast<const size_t*>(s - sizeof (size_t));
+    }
+
+    /**
+     * @brief Compute the FNV-1a hash value of a string.
+     */
+    static size_t HashString(const char* s) BOOST_NOEXCEPT
+    {
+        uint64_t h = 14695981039346656037ULL;
+        for (; *s; ++s)
+        {
+            h ^= static_cast<unsigned char>(*s);
+            h *= 1099511628211ULL;
+        }
+        return static_cast<size_t>(h);
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_set<const char*, Hash, Equal>  strings_;
+};
+
+} /* namespace aux */
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
  * @ingroup Component
@@ -37,6 +162,20 @@ NSFX_OPEN_NAMESPACE
  * e.g., `"edu.uestc.nsfx.IObject"`.
  *
  * The use of string makes debugging much easier.
+ *
+ * The string is interned when a UID is constructed.
+ * Thus two equal UIDs usually have the same address, and they are compared by
+ * the addresses of their strings first.
+ * `uid_of()` constructs the UID of a class only once.
+ *
+ * Two equal UIDs have the same address only if they are constructed in the
+ * same module, since each module (e.g., each DLL on Windows) has its own pool
+ * of interned strings.
+ * A UID also keeps the hash value of its string, which does not depend upon
+ * the module.
+ * If the addresses differ, the hash values are compared, and the strings are
+ * compared only if the hash values are equal.
+ * Thus two different UIDs are usually told apart without comparing strings.
  */
 class Uid
 {
@@ -44,11 +183,30 @@ public:
     /**
      * @brief Construct a UID.
      *
-     * @param[in] uid It **must** be a *string literal* or a string with
-     *                static lifetime.
+     * @param[in] uid A null-terminated string.
+     *
+     * @remarks The string is interned, which takes a lock and a hash lookup.
+     *
+     * @throw std::bad_alloc    Cannot copy the string into the pool.
+     * @throw std::system_error Cannot lock the pool.
+     */
+    Uid(const char* uid) :
+        uid_(aux::UidPool::GetInstance().Intern(uid)),
+        hash_(aux::UidPool::GetHash(uid_))
+    {}
+
+    /**
+     * @brief Construct a UID that is interned in a specific pool.
+     *
+     * @param[in] uid  A null-terminated string.
+     * @param[in] pool The pool, which must outlive the UID.
+     *
+     * @throw std::bad_alloc    Cannot copy the string into the pool.
+     * @throw std::system_error Cannot lock the pool.
      */
-    Uid(const char* uid) BOOST_NOEXCEPT :
-        uid_(uid)
+    Uid(const char* uid, aux::UidPool& pool) :
+        uid_(pool.Intern(uid)),
+        hash_(aux::UidPool::GetHash(uid_))
     {}
 
     operator const char*() const BOOST_NOEXCEPT
@@ -73,18 +231,40 @@ public:
 
 private:
     const char* uid_;
+    size_t hash_; ///< The hash value of the string.
 };
 
 
 ////////////////////////////////////////////////////////////////////////////////
-inline bool operator==(const Uid& lhs, const Uid& rhs) BOOST_NOEXCEPT
+namespace aux {
+
+/**
+ * @ingroup Component
+ * @brief Compare the strings of two UIDs from different modules.
+ *
+ * It is kept out of line, so the inlined comparisons of UIDs stay small.
+ */
+BOOST_NOINLINE inline bool
+UidStringEqual(const char* lhs, const char* rhs) BOOST_NOEXCEPT
+{
+    return !std::strcmp(lhs, rhs);
+}
+
+} /* namespace aux */
+
+BOOST_FORCEINLINE bool operator==(const Uid& lhs, const Uid& rhs) BOOST_NOEXCEPT
 {
-    return !std::strcmp(lhs.uid_, rhs.uid_);
+    // The strings are interned, thus the addresses are usually compared.
+    // The strings are compared only if the UIDs are constructed in different
+    // modules and their hash values are equal.
+    return lhs.uid_ == rhs.uid_ ||
+           (BOOST_UNLIKELY(lhs.hash_ == rhs.hash_) &&
+            aux::UidStringEqual(lhs.uid_, rhs.uid_));
 }
 
-inline bool operator!=(const Uid& lhs, const Uid& rhs) BOOST_NOEXCEPT
+BOOST_FORCEINLINE bool operator!=(const Uid& lhs, const Uid& rhs) BOOST_NOEXCEPT
 {
-    return !!std::strcmp(lhs.uid_, rhs.uid_);
+    return !(lhs == rhs);
 }
 
 inline bool operator==(const Uid& lhs, const char* rhs) BOOST_NOEXCEPT
@@ -116,8 +296,7 @@ operator<<(std::basic_ostream<Char, Traits>& os, const Uid& uid)
 
 inline size_t hash_value(const Uid& uid)
 {
-    size_t length = std::strlen(uid.uid_);
-    return boost::hash_range<const char*>(uid.uid_, uid.uid_ + length);
+    return uid.hash_;
 }
 
 
@@ -145,9 +324,10 @@ public:
     {                                                            \
     public:                                                      \
         BOOST_STATIC_CONSTANT(bool, value = true);               \
-        static ::nsfx::Uid GetUid(void) BOOST_NOEXCEPT           \
+        static ::nsfx::Uid GetUid(void)                          \
         {                                                        \
-            return ::nsfx::Uid(UID);                             \
+            static const ::nsfx::Uid uid(UID);                   \
+            return uid;                                          \
         }                                                        \
     }
 
@@ -175,7 +355,9 @@ NsfxUidTraitsFallback NsfxGetUidTraits(T) BOOST_NOEXCEPT;
  *            It **must not** be a common identifier, not a template specialization.
  *            e.g., `MyClass` is OK, but `MyTemplate<C>` is illegal.
  * @param UID The UID of the class.
- *            It **must** be a string literal or a string with static lifetime.
+ *            It is a null-terminated string, which is copied into the pool
+ *            of interned strings when the UID is first used.
+ *            Thus it only has to be valid at that time.
  */
 # define NSFX_DEFINE_CLASS_UID(T, UID)                           \
     /* Declare a local traits class template. */                 \
@@ -188,9 +370,10 @@ NsfxUidTraitsFallback NsfxGetUidTraits(T) BOOST_NOEXCEPT;
     {                                                            \
     public:                                                      \
         BOOST_STATIC_CONSTANT(bool, value = true);               \
-        static ::nsfx::Uid GetUid(void) BOOST_NOEXCEPT           \
+        static ::nsfx::Uid GetUid(void)                          \
         {                                                        \
-            return ::nsfx::Uid(UID);                             \
+            static const ::nsfx::Uid uid(UID);                   \
+            return uid;                                          \
         }                                                        \
     }
 
@@ -245,7 +428,7 @@ NSFX_OPEN_NAMESPACE
  * {
  * public:
  *     static const bool value = true;
- *     static ::nsfx::Uid GetUid(void) BOOST_NOEXCEPT
+ *     static ::nsfx::Uid GetUid(void)
  *     {
  *         return ::nsfx::Uid(UID);
  *     }
@@ -370,7 +553,7 @@ class UidTraits
     static_assert(TraitsType::value, "UID is not defined!");
 
 public:
-    static Uid GetUid(void) BOOST_NOEXCEPT
+    static Uid GetUid(void)
     {
         return TraitsType::GetUid();
     }
@@ -23,10 +23,14 @@
 #include <nsfx/event/i-event-sink.h>
 #include <nsfx/event/event-sink.h>
 
+#include <nsfx/event/slot-free-list.h>
+
 #include <nsfx/event/i-event.h>
 #include <nsfx/event/event.h>
 
 #include <nsfx/event/portainer.h>
+#include <nsfx/event/typed-event.h>
+#include <nsfx/event/deferred-event.h>
 
 
 #endif // EVENT_H__A144D68C_F756_4043_8212_1E563AE1D32B
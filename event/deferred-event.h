@@ -0,0 +1,325 @@
+/**
+ * @file
+ *
+ * @brief Event support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef DEFERRED_EVENT_H__0C6E5B1D_1B0A_4D8E_9E5A_7F3C2A91D64B
+#define DEFERRED_EVENT_H__0C6E5B1D_1B0A_4D8E_9E5A_7F3C2A91D64B
+
+
+#include <nsfx/event/config.h>
+#include <nsfx/event/event.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/event/exception.h>
+#include <type_traits> // decay
+#include <utility>     // forward
+#include <tuple>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Event
+ * @brief The policy of a deferred event when its queue is full.
+ */
+enum DeferredEventOverflow
+{
+    /**
+     * @brief Drop the newly fired event.
+     */
+    DEFERRED_EVENT_DROP  = 0x00000000,
+
+    /**
+     * @brief Deliver the queued events before queuing the newly fired event.
+     *
+     * The firing component pays for the delivery, which throttles it.
+     * If the sinks fill the queue again during the delivery, the newly fired
+     * event is dropped.
+     */
+    DEFERRED_EVENT_FLUSH = 0x00000001
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+namespace aux {
+
+template<size_t... I>
+struct IndexSequence {};
+
+template<size_t n, size_t... I>
+struct MakeIndexSequence :
+    MakeIndexSequence<n - 1, n - 1, I...>
+{};
+
+template<size_t... I>
+struct MakeIndexSequence<0, I...>
+{
+    typedef IndexSequence<I...>  type;
+};
+
+template<class Proto>
+struct DeferredEventTraits;
+
+template<class... Args>
+struct DeferredEventTraits<void(Args...)>
+{
+    typedef std::tuple<typename std::decay<Args>::type...>  ArgsTuple;
+    typedef typename MakeIndexSequence<sizeof...(Args)>::type  Indices;
+};
+
+} /* namespace aux */
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DeferredEvent.
+/**
+ * @ingroup Event
+ * @brief An event that delivers the fired events in batches.
+ *
+ * @tparam IEventName The type of a user-defined event interface.
+ *                    The prototype of the event sink **must** return `void`.
+ * @tparam capacity   The maximum number of connections.
+ *
+ * `Fire()` copies the arguments into a queue and returns.
+ * `Flush()` delivers the queued events to the sinks in the order they were
+ * fired.
+ * It suits the events whose sinks need not run within the hot path of the
+ * event source, e.g., logging and statistics.
+ *
+ * When the queue becomes non-empty, the flush request sink is fired, so the
+ * event source can arrange a flush.
+ * e.g., it can schedule a flush at the current time point, which happens after
+ * the events that have been scheduled at the current time point.
+ *
+ * The queue is bounded.
+ * When it is full, the newly fired event is dropped or the queue is flushed,
+ * according to the overflow policy.
+ *
+ * If there are no sinks, `Fire()` does nothing.
+ * The events are delivered to the sinks that are connected when the events
+ * are flushed.
+ *
+ * If a sink throws an exception during a flush, the rest of the batch is
+ * discarded.
+ *
+ * The arguments **must** be copyable, and they are passed to the sinks as
+ * *l-values*.
+ *
+ * The queue is not shared among threads, and there is no background worker
+ * that delivers the events.
+ * The sinks run on the simulation thread, in the order of the simulated time,
+ * so the results of a simulation are deterministic.
+ * `NSFX_COMPONENT_THREAD_SAFE` makes the reference counts atomic, but the
+ * states of the sinks and the schedulers are not synchronized, thus the events
+ * cannot be delivered by another thread.
+ */
+template<class IEventName, uint32_t capacity = UINT32_MAX>
+class DeferredEvent :/*{{{*/
+    public Event<IEventName, capacity>
+{
+    typedef Event<IEventName, capacity>          BaseType;
+    typedef IEventName                           IEventType;
+    typedef typename IEventType::Prototype       Prototype;
+    typedef aux::DeferredEventTraits<Prototype>  Traits;
+    typedef typename Traits::ArgsTuple           ArgsTuple;
+    typedef typename Traits::Indices             Indices;
+
+public:
+    DeferredEvent(void) :
+        limit_(4096),
+        overflow_(DEFERRED_EVENT_DROP),
+        numDropped_(0),
+        requested_(false),
+        flushing_(false)
+    {}
+
+    virtual ~DeferredEvent(void) {}
+
+public:
+    /**
+     * @brief Set the maximum number of queued events.
+     *
+     * @throw InvalidArgument The limit is zero.
+     *
+     * The events that have been queued are kept.
+     */
+    void SetQueueLimit(size_t limit)
+    {
+        if (!limit)
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The queue limit of a deferred event "
+                             "must be positive."));
+        }
+        limit_ = limit;
+    }
+
+    size_t GetQueueLimit(void) const BOOST_NOEXCEPT
+    {
+        return limit_;
+    }
+
+    void SetOverflowPolicy(DeferredEventOverflow overflow) BOOST_NOEXCEPT
+    {
+        overflow_ = overflow;
+    }
+
+    DeferredEventOverflow GetOverflowPolicy(void) const BOOST_NOEXCEPT
+    {
+        return overflow_;
+    }
+
+    /**
+     * @brief Set the sink that is fired when a flush is needed.
+     *
+     * It is fired when the queue becomes non-empty, and it is not fired again
+     * until `Flush()` is called.
+     */
+    void SetFlushRequest(Ptr<IEventSink<>> request)
+    {
+        request_ = std::move(request);
+    }
+
+    /**
+     * @brief Get the number of queued events.
+     */
+    size_t GetNumPending(void) const BOOST_NOEXCEPT
+    {
+        return pending_.size();
+    }
+
+    /**
+     * @brief Get the number of events that have been dropped.
+     */
+    uint64_t GetNumDropped(void) const BOOST_NOEXCEPT
+    {
+        return numDropped_;
+    }
+
+    /**
+     * @brief Queue an event.
+     *
+     * @param[in] args Must be copyable.
+     */
+    template<class... Args>
+    void Fire(Args&&... args)
+    {
+        if (!BaseType::GetNumSinks())
+        {
+            return;
+        }
+        if (pending_.size() >= limit_)
+        {
+            // A sink that fires this event during a flush cannot flush.
+            if (overflow_ != DEFERRED_EVENT_FLUSH || flushing_)
+            {
+                ++numDropped_;
+                return;
+            }
+            Deliver();
+            // The sinks may have filled the queue again during the delivery.
+            if (pending_.size() >= limit_)
+            {
+                ++numDropped_;
+                return;
+            }
+        }
+        pending_.emplace_back(std::forward<Args>(args)...);
+        if (!requested_ && request_)
+        {
+            requested_ = true;
+            request_->Fire();
+        }
+    }
+
+    /**
+     * @brief Deliver the queued events.
+     *
+     * The events that are fired by the sinks during the flush are queued,
+     * and they are delivered by the next flush.
+     *
+     * Calling this function during a flush has no effect.
+     */
+    void Flush(void)
+    {
+        // A flush during a flush must not clear the request that is posted
+        // for the events queued during the outer flush.
+        if (!flushing_)
+        {
+            requested_ = false;
+            Deliver();
+        }
+    }
+
+private:
+    void Deliver(void)
+    {
+        if (!flushing_ && pending_.size())
+        {
+            // Reuse the memory of the previous batch.
+            batch_.swap(pending_);
+            BatchGuard guard(this);
+            for (size_t i = 0; i < batch_.size(); ++i)
+            {
+                Apply(batch_[i], Indices());
+            }
+        }
+    }
+
+    template<size_t... I>
+    void Apply(ArgsTuple& args, aux::IndexSequence<I...>)
+    {
+        BaseType::Fire(std::get<I>(args)...);
+    }
+
+    /**
+     * @brief Mark a flush, and clear the batch when the flush ends.
+     */
+    struct BatchGuard
+    {
+        explicit BatchGuard(DeferredEvent* event) BOOST_NOEXCEPT :
+            event_(event)
+        {
+            event_->flushing_ = true;
+        }
+
+        ~BatchGuard(void)
+        {
+            event_->batch_.clear();
+            event_->flushing_ = false;
+        }
+
+        DeferredEvent* event_;
+    };
+
+private:
+    size_t   limit_;
+    DeferredEventOverflow overflow_;
+    uint64_t numDropped_;
+    bool     requested_;
+    bool     flushing_;
+    Ptr<IEventSink<>>  request_;
+    vector<ArgsTuple>  pending_;
+    vector<ArgsTuple>  batch_;
+
+}; // class DeferredEvent /*}}}*/
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // DEFERRED_EVENT_H__0C6E5B1D_1B0A_4D8E_9E5A_7F3C2A91D64B
+
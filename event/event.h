@@ -20,6 +20,7 @@
 #include <nsfx/event/config.h>
 #include <nsfx/event/i-event.h>
 #include <nsfx/event/exception.h>
+#include <nsfx/event/slot-free-list.h>
 #include <nsfx/component/object.h>
 #include <nsfx/component/ptr.h>
 #include <boost/concept_check.hpp>
@@ -97,6 +98,12 @@ public:
  * For `capacity > 1`, it passes the arguments as *l-values*.
  * Therefore, the parameters of the event sink **must** be *l-values*,
  * in order to use `Fire()` for `capacity > 1`.
+ *
+ * The sinks are stored in a contiguous array, and the slots of the
+ * disconnected sinks are kept in a `SlotFreeList`.
+ * Thus `Connect()` and `Disconnect()` are amortized `O(1)`.
+ *
+ * @see `TypedEvent` calls sinks of a concrete functor type directly.
  */
 template<class IEventName, uint32_t capacity = UINT32_MAX>
 class Event :/*{{{*/
@@ -114,8 +121,7 @@ class Event :/*{{{*/
 
 public:
     Event(void) :
-        numSinks_(0),
-        last_(0)
+        numSinks_(0)
     {}
 
     virtual ~Event(void) {}
@@ -148,10 +154,10 @@ public:
             {
                 --numSinks_;
                 sinks_[cookie] = nullptr;
-                while (last_ && !sinks_[last_-1])
-                {
-                    --last_;
-                }
+                free_.Push(static_cast<uint32_t>(cookie));
+                SlotFreeList::Trim(sinks_, [] (const Ptr<IEventSinkType>& s) {
+                    return !s;
+                });
             }
         }
     }
@@ -160,34 +166,24 @@ private:
     cookie_t Insert(Ptr<IEventSinkType>&& sink)
     {
         cookie_t cookie = 0;
-        // If there is a free slot, find and reuse the slot.
-        if (numSinks_ < sinks_.size())
+        uint32_t i = free_.Top(sinks_.size());
+        // If there is a free slot, reuse it.
+        if (i < sinks_.size())
         {
-            for (uint32_t i = 0; i < sinks_.size(); ++i)
-            {
-                // If this is a free slot.
-                if (!sinks_[i])
-                {
-                    sinks_[i] = std::move(sink);
-                    ++numSinks_;
-                    cookie = i + 1;
-                    if (last_ < cookie)
-                    {
-                        last_ = cookie;
-                    }
-                    break;
-                }
-            }
+            free_.Pop();
+            sinks_[i] = std::move(sink);
+            ++numSinks_;
+            cookie = i + 1;
         }
         // If the slots are full, try to extend it.
         else // if (numSinks_ == sinks_.size())
         {
             try
             {
+                free_.Reserve(sinks_.size());
                 sinks_.emplace_back(std::move(sink));
                 ++numSinks_;
                 cookie = numSinks_;
-                last_  = cookie;
             }
             catch (std::bad_alloc& )
             {
@@ -236,7 +232,7 @@ public:
     {
         BOOST_CONCEPT_ASSERT((EventSinkVisitorConcept<Visitor, IEventSinkType>));
 
-        for (size_t i = 0; i < last_; ++i)
+        for (size_t i = 0; i < sinks_.size(); ++i)
         {
             if (sinks_[i])
             {
@@ -247,17 +243,14 @@ public:
 
     void Fire(void)
     {
-        if (last_)
+        size_t i = 0;
+        while (i < sinks_.size())
         {
-            size_t i = 0;
-            while (i < last_)
+            if (sinks_[i])
             {
-                if (sinks_[i])
-                {
-                    sinks_[i]->Fire();
-                }
-                ++i;
+                sinks_[i]->Fire();
             }
+            ++i;
         }
     }
 
@@ -273,17 +266,18 @@ public:
     template<class... Args>
     void Fire(Args&&... args)
     {
-        if (last_)
+        size_t i = 0;
+        while (i + 1 < sinks_.size())
         {
-            size_t i = 0;
-            while (i < last_ - 1)
+            if (sinks_[i])
             {
-                if (sinks_[i])
-                {
-                    sinks_[i]->Fire(args...);
-                }
-                ++i;
+                sinks_[i]->Fire(args...);
             }
+            ++i;
+        }
+        // The last sink is non-null.
+        if (i < sinks_.size())
+        {
             sinks_[i]->Fire(std::forward<Args>(args)...);
         }
     }
@@ -302,8 +296,8 @@ public:
 
 private:
     uint32_t numSinks_;
-    uint32_t last_; // The cookie of the last non-null sink.
-    vector<Ptr<IEventSinkType>> sinks_;
+    vector<Ptr<IEventSinkType>> sinks_; // The last sink is non-null.
+    SlotFreeList free_;
 
 }; // class Event /*}}}*/
 
@@ -435,18 +429,19 @@ NSFX_CLOSE_NAMESPACE
 template<BOOST_PP_ENUM_PARAMS(BOOST_PP_ITERATION(), class A)>
 void Fire(BOOST_PP_ENUM_BINARY_PARAMS(BOOST_PP_ITERATION(), A, &&a))
 {
-    if (last_)
+    size_t i = 0;
+    while (i + 1 < sinks_.size())
     {
-        size_t i = 0;
-        while (i < last_ - 1)
+        if (sinks_[i])
         {
-            if (sinks_[i])
-            {
-                // sinks_[i]->Fire(a0, a1, ...);
-                sinks_[i]->Fire(BOOST_PP_ENUM_PARAMS(BOOST_PP_ITERATION(), a));
-            }
-            ++i;
+            // sinks_[i]->Fire(a0, a1, ...);
+            sinks_[i]->Fire(BOOST_PP_ENUM_PARAMS(BOOST_PP_ITERATION(), a));
         }
+        ++i;
+    }
+    // The last sink is non-null.
+    if (i < sinks_.size())
+    {
         // sinks_[i]->Fire(std::forward<A0>(a0), std::forward<A1>(a1), ...);
         sinks_[i]->Fire(BOOST_PP_ENUM(BOOST_PP_ITERATION(), NSFX_PP_FORWARD, ));
     }
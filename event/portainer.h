@@ -20,6 +20,7 @@
 #include <nsfx/event/config.h>
 #include <nsfx/event/i-event.h>
 #include <nsfx/event/exception.h>
+#include <nsfx/event/slot-free-list.h>
 #include <nsfx/component/object.h>
 #include <nsfx/component/ptr.h>
 #include <boost/concept_check.hpp>
@@ -110,6 +111,9 @@ public:
  * container to remove the information (the port) whose 1-based index matches
  * the cookie value.
  *
+ * The indices of the free slots are kept in a `SlotFreeList`, thus `Add()`
+ * and `Remove()` are amortized `O(1)`.
+ *
  * @tparam T        The type of stored items.
  *                  It **must** satisfy `PortainableItemConcept`.
  *                  The default value of `T` **must** be `false`, and **must** hold
@@ -128,8 +132,7 @@ class Portainer
 
 public:
     Portainer(void) :
-        size_(0),
-        last_(0)
+        size_(0)
     {
     }
 
@@ -164,10 +167,10 @@ public:
             {
                 --size_;
                 items_[cookie] = T();  // default constructible, copy assignable
-                while (last_ && !items_[last_-1])
-                {
-                    --last_;
-                }
+                free_.Push(static_cast<uint32_t>(cookie));
+                SlotFreeList::Trim(items_, [] (const T& item) {
+                    return !item;
+                });
             }
         }
     }
@@ -177,35 +180,25 @@ private:
     cookie_t InternalAdd(T_&& item)
     {
         cookie_t cookie = 0;
-        // If there is a free slot, find and reuse the slot.
-        if (size_ < items_.size())
+        uint32_t i = free_.Top(items_.size());
+        // If there is a free slot, reuse it.
+        if (i < items_.size())
         {
-            // Search for a free slot.
-            for (uint32_t i = 0; i < items_.size(); ++i)
-            {
-                // If this is a free slot.
-                if (!items_[i])  // bool operator!()
-                {
-                    items_[i] = std::forward<T_>(item);
-                    ++size_;
-                    cookie = i + 1;
-                    if (last_ < cookie)
-                    {
-                        last_ = cookie;
-                    }
-                    break;
-                }
-            }
+            BOOST_ASSERT(!items_[i]);
+            items_[i] = std::forward<T_>(item);
+            free_.Pop();
+            ++size_;
+            cookie = i + 1;
         }
         // If the pool is full, try to extend it.
         else // if (size_ == items_.size())
         {
             try
             {
+                free_.Reserve(items_.size());
                 items_.emplace_back(std::forward<T_>(item));
                 ++size_;
                 cookie = size_;
-                last_  = cookie;
             }
             catch (std::bad_alloc& )
             {
@@ -247,7 +240,7 @@ public:
     {
         BOOST_CONCEPT_ASSERT((PortainableItemVisitorConcept<Visitor, T>));
 
-        for (size_t i = 0; i < last_; ++i)
+        for (size_t i = 0; i < items_.size(); ++i)
         {
             if (!!items_[i])
             {
@@ -258,8 +251,8 @@ public:
 
 private:
     uint32_t  size_;
-    uint32_t  last_; // The cookie of the last non-null item.
-    vector<T> items_;
+    vector<T> items_; // The last item is non-null.
+    SlotFreeList free_;
 
 };/*}}}*/
 
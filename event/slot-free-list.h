@@ -0,0 +1,145 @@
+/**
+ * @file
+ *
+ * @brief Event support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef SLOT_FREE_LIST_H__84ED9E9E_9066_4E86_9CB4_4FD2FAFE0387
+#define SLOT_FREE_LIST_H__84ED9E9E_9066_4E86_9CB4_4FD2FAFE0387
+
+
+#include <nsfx/event/config.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Event
+ * @brief The free-list of the slots of a vector-based container.
+ *
+ * A container (e.g., `Event`, `TypedEvent` and `Portainer`) stores its items
+ * in a vector of slots, and uses the 1-based index of a slot as the cookie of
+ * the item.
+ * The free-list keeps the indices of the free slots, and the most recently
+ * freed slot is reused first.
+ *
+ * The container trims the trailing free slots via `Trim()` when an item is
+ * removed, and the stale indices of the trimmed slots are dropped from the
+ * free-list by `Top()`.
+ * Each slot is trimmed at most once after it is freed, thus adding and
+ * removing items are amortized `O(1)`.
+ *
+ * The free-list reserves an entry for every slot via `Reserve()`, so `Push()`
+ * never allocates memory, and an item can be removed in a `noexcept` context.
+ *
+ * @code
+ * // Add an item.
+ * uint32_t i = free_.Top(slots_.size());
+ * if (i < slots_.size())
+ * {
+ *     free_.Pop();
+ *     // Store the item in slots_[i].
+ * }
+ * else
+ * {
+ *     free_.Reserve(slots_.size());
+ *     // Append the item to slots_.
+ * }
+ *
+ * // Remove an item.
+ * // Clear slots_[i].
+ * free_.Push(i);
+ * SlotFreeList::Trim(slots_, IsFree);
+ * @endcode
+ */
+class SlotFreeList
+{
+public:
+    /**
+     * @brief Get the most recently freed slot.
+     *
+     * @param[in] numSlots The number of slots.
+     *
+     * @return The index of the slot.
+     *         If there is no free slot, `numSlots` is returned.
+     */
+    uint32_t Top(size_t numSlots) BOOST_NOEXCEPT
+    {
+        // Drop the indices of the trimmed slots.
+        while (free_.size() && free_.back() >= numSlots)
+        {
+            free_.pop_back();
+        }
+        return free_.size() ? free_.back() : static_cast<uint32_t>(numSlots);
+    }
+
+    /**
+     * @brief Remove the slot returned by `Top()` from the free-list.
+     */
+    void Pop(void) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(free_.size());
+        free_.pop_back();
+    }
+
+    /**
+     * @brief Reserve a free-list entry for a new slot.
+     *
+     * @param[in] numSlots The number of slots before the new slot is appended.
+     *
+     * @throw std::bad_alloc
+     */
+    void Reserve(size_t numSlots)
+    {
+        if (free_.capacity() <= numSlots)
+        {
+            free_.reserve(2 * numSlots + 1);
+        }
+    }
+
+    /**
+     * @brief Add a slot to the free-list.
+     */
+    void Push(uint32_t index) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(free_.size() < free_.capacity());
+        free_.push_back(index);
+    }
+
+    /**
+     * @brief Trim the trailing free slots.
+     *
+     * @tparam Slot   The type of the slots.
+     * @tparam IsFree A callable object that has a prototype of
+     *                `bool IsFree(const Slot&)`.
+     */
+    template<class Slot, class IsFree>
+    static void Trim(vector<Slot>& slots, IsFree&& isFree) BOOST_NOEXCEPT
+    {
+        while (slots.size() && isFree(slots.back()))
+        {
+            slots.pop_back();
+        }
+    }
+
+private:
+    vector<uint32_t> free_; // The indices of the free slots.
+
+}; // class SlotFreeList
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // SLOT_FREE_LIST_H__84ED9E9E_9066_4E86_9CB4_4FD2FAFE0387
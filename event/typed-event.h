@@ -0,0 +1,564 @@
+/**
+ * @file
+ *
+ * @brief Event support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef TYPED_EVENT_H__5FC754F6_9600_4B66_8694_0C3B6AEF927C
+#define TYPED_EVENT_H__5FC754F6_9600_4B66_8694_0C3B6AEF927C
+
+
+#include <nsfx/event/config.h>
+#include <nsfx/event/i-event.h>
+#include <nsfx/event/exception.h>
+#include <nsfx/event/slot-free-list.h>
+#include <type_traits> // decay, aligned_storage
+#include <utility>     // move, forward
+#include <new>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// TypedEventSink.
+/**
+ * @ingroup Event
+ * @brief A type-erased functor that is stored inline.
+ *
+ * @tparam Proto The prototype of the functor.
+ *
+ * A functor is stored inline if its size is no greater than `CAPACITY`,
+ * its alignment requirement is satisfied by the inline storage, and it is
+ * nothrow move constructible.
+ * Otherwise, it is allocated on the heap.
+ *
+ * The functor is called via a function pointer, instead of a virtual
+ * function of an event sink interface.
+ *
+ * The arguments are passed to the functor as *l-values*.
+ */
+template<class Proto>
+class TypedEventSink;
+
+template<class Ret, class... Args>
+class TypedEventSink<Ret(Args...)>
+{
+public:
+    /**
+     * @brief The size of the inline storage.
+     */
+    static const size_t CAPACITY = 4 * sizeof(void*);
+
+private:
+    typedef typename std::aligned_storage<CAPACITY>::type  StorageType;
+
+    /**
+     * @brief The function that calls a stored functor.
+     */
+    typedef Ret (*Invoker)(void* p, Args&... args);
+
+    /**
+     * @brief The operations to move and destroy a stored functor.
+     */
+    struct Ops
+    {
+        void (*move_)(void* dst, void* src);
+        void (*destroy_)(void* p);
+    };
+
+    /**
+     * @brief The operations on a functor that is stored inline.
+     */
+    template<class F>
+    struct InlineModel
+    {
+        static Ret Invoke(void* p, Args&... args)
+        {
+            return (*static_cast<F*>(p))(args...);
+        }
+
+        static void Move(void* dst, void* src) BOOST_NOEXCEPT
+        {
+            ::new (dst) F(std::move(*static_cast<F*>(src)));
+            static_cast<F*>(src)->~F();
+        }
+
+        static void Destroy(void* p) BOOST_NOEXCEPT
+        {
+            static_cast<F*>(p)->~F();
+        }
+
+        static const Ops ops_;
+    };
+
+    /**
+     * @brief The operations on a functor that is allocated on the heap.
+     *
+     * The inline storage holds a pointer to the functor.
+     */
+    template<class F>
+    struct HeapModel
+    {
+        static Ret Invoke(void* p, Args&... args)
+        {
+            return (**static_cast<F**>(p))(args...);
+        }
+
+        static void Move(void* dst, void* src) BOOST_NOEXCEPT
+        {
+            *static_cast<F**>(dst) = *static_cast<F**>(src);
+        }
+
+        static void Destroy(void* p) BOOST_NOEXCEPT
+        {
+            delete *static_cast<F**>(p);
+        }
+
+        static const Ops ops_;
+    };
+
+    template<class F>
+    struct IsInline :
+        std::integral_constant<bool,
+            sizeof (F) <= CAPACITY &&
+            std::alignment_of<StorageType>::value %
+                std::alignment_of<F>::value == 0 &&
+            std::is_nothrow_move_constructible<F>::value>
+    {};
+
+public:
+    TypedEventSink(void) BOOST_NOEXCEPT :
+        invoke_(nullptr),
+        ops_(nullptr)
+    {}
+
+    /**
+     * @brief Store a functor.
+     *
+     * @tparam F A functor type of signature `Proto`.
+     */
+    template<class F>
+    TypedEventSink(F&& f,
+                   typename std::enable_if<!std::is_same<
+                       typename std::decay<F>::type, TypedEventSink
+                   >::value>::type* = nullptr) :
+        invoke_(nullptr),
+        ops_(nullptr)
+    {
+        typedef typename std::decay<F>::type  Decayed;
+        Store(std::forward<F>(f), IsInline<Decayed>());
+    }
+
+    TypedEventSink(TypedEventSink&& rhs) BOOST_NOEXCEPT :
+        invoke_(rhs.invoke_),
+        ops_(rhs.ops_)
+    {
+        if (ops_)
+        {
+            ops_->move_(&storage_, &rhs.storage_);
+            rhs.invoke_ = nullptr;
+            rhs.ops_ = nullptr;
+        }
+    }
+
+    TypedEventSink& operator=(TypedEventSink&& rhs) BOOST_NOEXCEPT
+    {
+        if (this != &rhs)
+        {
+            Clear();
+            if (rhs.ops_)
+            {
+                rhs.ops_->move_(&storage_, &rhs.storage_);
+                invoke_ = rhs.invoke_;
+                ops_ = rhs.ops_;
+                rhs.invoke_ = nullptr;
+                rhs.ops_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~TypedEventSink(void)
+    {
+        Clear();
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(TypedEventSink(const TypedEventSink& ));
+    BOOST_DELETED_FUNCTION(TypedEventSink& operator=(const TypedEventSink& ));
+
+public:
+    bool IsEmpty(void) const BOOST_NOEXCEPT
+    {
+        return !ops_;
+    }
+
+    Ret operator()(Args&... args)
+    {
+        BOOST_ASSERT(invoke_);
+        return invoke_(&storage_, args...);
+    }
+
+    void Clear(void) BOOST_NOEXCEPT
+    {
+        if (ops_)
+        {
+            const Ops* ops = ops_;
+            invoke_ = nullptr;
+            ops_ = nullptr;
+            ops->destroy_(&storage_);
+        }
+    }
+
+private:
+    template<class F>
+    void Store(F&& f, std::true_type /* inline */)
+    {
+        typedef typename std::decay<F>::type  Decayed;
+        ::new (&storage_) Decayed(std::forward<F>(f));
+        invoke_ = &InlineModel<Decayed>::Invoke;
+        ops_ = &InlineModel<Decayed>::ops_;
+    }
+
+    template<class F>
+    void Store(F&& f, std::false_type /* inline */)
+    {
+        typedef typename std::decay<F>::type  Decayed;
+        *reinterpret_cast<Decayed**>(&storage_) = new Decayed(std::forward<F>(f));
+        invoke_ = &HeapModel<Decayed>::Invoke;
+        ops_ = &HeapModel<Decayed>::ops_;
+    }
+
+private:
+    StorageType  storage_;
+    /**
+     * @brief The function that calls the functor.
+     *
+     * It is stored in the object, so a call does not load the table of
+     * operations.
+     */
+    Invoker      invoke_;
+    const Ops*   ops_;
+
+}; // class TypedEventSink
+
+
+template<class Ret, class... Args>
+template<class F>
+const typename TypedEventSink<Ret(Args...)>::Ops
+TypedEventSink<Ret(Args...)>::InlineModel<F>::ops_ = {
+    &TypedEventSink<Ret(Args...)>::InlineModel<F>::Move,
+    &TypedEventSink<Ret(Args...)>::InlineModel<F>::Destroy
+};
+
+template<class Ret, class... Args>
+template<class F>
+const typename TypedEventSink<Ret(Args...)>::Ops
+TypedEventSink<Ret(Args...)>::HeapModel<F>::ops_ = {
+    &TypedEventSink<Ret(Args...)>::HeapModel<F>::Move,
+    &TypedEventSink<Ret(Args...)>::HeapModel<F>::Destroy
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// TypedEvent.
+/**
+ * @ingroup Event
+ * @brief An event that fires functors without virtual dispatch.
+ *
+ * @tparam Proto The prototype of the event.
+ * @tparam Sink  The type of the sinks.
+ *               It **must** be nothrow move constructible.
+ *               It should be a concrete functor type.
+ *               By default, the sinks are functors of any type that are
+ *               stored by `TypedEventSink`, which is slower (see below).
+ *
+ * Unlike `Event`, this class is not a component, and it does not implement
+ * `IEvent`.
+ * It is used within a component, when the event source and the event sinks
+ * are known at compile time, e.g., a broadcast channel that notifies its
+ * attached devices.
+ *
+ * The sinks are stored inline in a contiguous array, and the slots of the
+ * disconnected sinks are kept in a `SlotFreeList`.
+ * Thus `Connect()` and `Disconnect()` are amortized `O(1)`.
+ * The trailing free slots are trimmed after the event is fired, if the sinks
+ * are disconnected while the event is being fired.
+ *
+ * # Performance
+ * The fast path is a concrete functor type as `Sink`, e.g., a class that
+ * holds a pointer to the attached device.
+ * The calls to the sinks are direct, and they can be inlined.
+ *
+ * The default `TypedEventSink<Proto>` erases the type of the functors, and
+ * each sink is called via a function pointer.
+ * It is a convenience, not an optimization: it is **not** faster than
+ * `Event<>`, and it can be several times slower when the compiler is able to
+ * devirtualize the sinks of `Event<>`.
+ * Use it only when the sinks have different types.
+ *
+ * The arguments are passed to the sinks as *l-values*.
+ *
+ * A sink can disconnect any sink (including itself) while the event is being
+ * fired, and the disconnected sinks are destroyed after the event is fired.
+ * However, a sink cannot be connected while the event is being fired,
+ * since the array of sinks may be reallocated.
+ *
+ * @code
+ * struct Receiver
+ * {
+ *     void operator()(int n) { device_->Receive(n); }
+ *     Device* device_;
+ * };
+ * TypedEvent<void(int), Receiver> event;
+ * cookie_t cookie = event.Connect(Receiver{device});
+ * event.Fire(1);
+ * event.Disconnect(cookie);
+ * @endcode
+ */
+template<class Proto, class Sink = TypedEventSink<Proto>>
+class TypedEvent;
+
+template<class Ret, class... Args, class Sink>
+class TypedEvent<Ret(Args...), Sink>
+{
+    static_assert(std::is_nothrow_move_constructible<Sink>::value,
+                  "The sink of TypedEvent must be nothrow move constructible.");
+
+    enum State
+    {
+        FREE,
+        ARMED,
+        /**
+         * @brief The sink is disconnected while the event is being fired.
+         */
+        DISARMED,
+    };
+
+    /**
+     * @brief A slot of a sink.
+     */
+    struct Slot
+    {
+        Slot(void) BOOST_NOEXCEPT :
+            state_(FREE)
+        {}
+
+        Slot(Slot&& rhs) BOOST_NOEXCEPT :
+            state_(rhs.state_)
+        {
+            if (state_ != FREE)
+            {
+                ::new (&storage_) Sink(std::move(rhs.GetSink()));
+            }
+        }
+
+        ~Slot(void)
+        {
+            Clear();
+        }
+
+        Sink& GetSink(void) BOOST_NOEXCEPT
+        {
+            return *reinterpret_cast<Sink*>(&storage_);
+        }
+
+        void Clear(void) BOOST_NOEXCEPT
+        {
+            if (state_ != FREE)
+            {
+                state_ = FREE;
+                GetSink().~Sink();
+            }
+        }
+
+        typename std::aligned_storage<
+            sizeof (Sink), std::alignment_of<Sink>::value>::type  storage_;
+        State state_;
+    };
+
+public:
+    TypedEvent(void) BOOST_NOEXCEPT :
+        numSinks_(0),
+        firing_(0)
+    {}
+
+    ~TypedEvent(void) {}
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(TypedEvent(const TypedEvent& ));
+    BOOST_DELETED_FUNCTION(TypedEvent& operator=(const TypedEvent& ));
+
+public:
+    /**
+     * @brief Connect a sink.
+     *
+     * @param[in] f A functor that is used to construct a sink.
+     *
+     * @return The cookie of the connection.
+     *
+     * @throw IllegalMethodCall The event is being fired.
+     * @throw ConnectionLimit   Cannot allocate memory for the sink.
+     */
+    template<class F>
+    cookie_t Connect(F&& f)
+    {
+        if (firing_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot connect a sink while the event "
+                             "is being fired."));
+        }
+        uint32_t i = free_.Top(slots_.size());
+        try
+        {
+            if (i < slots_.size())
+            {
+                ::new (&slots_[i].storage_) Sink(std::forward<F>(f));
+                free_.Pop();
+            }
+            else
+            {
+                free_.Reserve(slots_.size());
+                if (disarmed_.capacity() <= slots_.size())
+                {
+                    disarmed_.reserve(2 * slots_.size() + 1);
+                }
+                slots_.emplace_back();
+                try
+                {
+                    ::new (&slots_[i].storage_) Sink(std::forward<F>(f));
+                }
+                catch (...)
+                {
+                    slots_.pop_back();
+                    throw;
+                }
+            }
+        }
+        catch (std::bad_alloc& )
+        {
+            BOOST_THROW_EXCEPTION(ConnectionLimit());
+        }
+        slots_[i].state_ = ARMED;
+        ++numSinks_;
+        return i + 1;
+    }
+
+    void Disconnect(cookie_t cookie) BOOST_NOEXCEPT
+    {
+        if (--cookie < slots_.size())
+        {
+            Slot& slot = slots_[cookie];
+            if (slot.state_ == ARMED)
+            {
+                --numSinks_;
+                free_.Push(static_cast<uint32_t>(cookie));
+                if (firing_)
+                {
+                    // The sink may be running.
+                    slot.state_ = DISARMED;
+                    disarmed_.push_back(static_cast<uint32_t>(cookie));
+                }
+                else
+                {
+                    slot.Clear();
+                    Trim();
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of sinks.
+     */
+    uint32_t GetNumSinks(void) const BOOST_NOEXCEPT
+    {
+        return numSinks_;
+    }
+
+    /**
+     * @brief Fire the event.
+     *
+     * The sinks are called in an arbitrary order.
+     */
+    void Fire(Args... args)
+    {
+        ++firing_;
+        try
+        {
+            // The array of sinks is not reallocated while the event is being
+            // fired.
+            for (uint32_t i = 0; i < slots_.size(); ++i)
+            {
+                Slot& slot = slots_[i];
+                if (slot.state_ == ARMED)
+                {
+                    slot.GetSink()(args...);
+                }
+            }
+        }
+        catch (...)
+        {
+            EndFiring();
+            throw;
+        }
+        EndFiring();
+    }
+
+private:
+    /**
+     * @brief Destroy the sinks that are disconnected while the event is being
+     *        fired.
+     */
+    void EndFiring(void) BOOST_NOEXCEPT
+    {
+        if (!--firing_ && disarmed_.size())
+        {
+            // The slots are not trimmed while the event is being fired.
+            for (auto it = disarmed_.cbegin(); it != disarmed_.cend(); ++it)
+            {
+                slots_[*it].Clear();
+            }
+            disarmed_.clear();
+            Trim();
+        }
+    }
+
+    void Trim(void) BOOST_NOEXCEPT
+    {
+        SlotFreeList::Trim(slots_, [] (const Slot& slot) {
+            return slot.state_ == FREE;
+        });
+    }
+
+private:
+    uint32_t numSinks_;
+    uint32_t firing_;
+    vector<Slot> slots_; // The last slot is not free.
+    SlotFreeList free_;
+    // The slots that are disconnected while the event is being fired.
+    // A slot is disarmed at most once per firing, so the capacity is reserved
+    // for every slot, and a sink can be disconnected in a `noexcept` context.
+    vector<uint32_t> disarmed_;
+
+}; // class TypedEvent
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // TYPED_EVENT_H__5FC754F6_9600_4B66_8694_0C3B6AEF927C
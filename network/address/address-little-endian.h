@@ -1527,40 +1527,40 @@ public:
 
     ////////////////////////////////////////
 public:
-    template<bool zcAware>
-    void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void Write(Iterator& it) const
     {
         it.Write(data_.b_, NB);
     }
 
-    template<bool zcAware>
-    void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void WriteL(Iterator& it) const
     {
         it.WriteL(data_.b_, NB);
     }
 
-    template<bool zcAware>
-    void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void WriteB(Iterator& it) const
     {
         it.WriteB(data_.b_, NB);
     }
 
-    template<bool readOnly, bool zcAware>
-    void Read(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void Read(Iterator& it)
     {
         it.Read(data_.b_, NB);
         data_.v_[NV-1] &= MSV_MASK;
     }
 
-    template<bool readOnly, bool zcAware>
-    void ReadL(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void ReadL(Iterator& it)
     {
         it.ReadL(data_.b_, NB);
         data_.v_[NV-1] &= MSV_MASK;
     }
 
-    template<bool readOnly, bool zcAware>
-    void ReadB(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void ReadB(Iterator& it)
     {
         it.ReadB(data_.b_, NB);
         data_.v_[NV-1] &= MSV_MASK;
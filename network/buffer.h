@@ -20,10 +20,14 @@
 #include <nsfx/network/config.h>
 
 // Storage.
+#include <nsfx/network/buffer/storage/buffer-storage-pool.h>
+#include <nsfx/network/buffer/storage/buffer-profile.h>
 #include <nsfx/network/buffer/storage/basic-buffer-storage.h>
+#include <nsfx/network/buffer/storage/seg-buffer-storage.h>
 
 // Iterator.
 #include <nsfx/network/buffer/iterator/basic-buffer-iterator.h>
+#include <nsfx/network/buffer/iterator/copy-elements.h>
 
 #include <nsfx/network/buffer/iterator/buffer-iterator.h>
 #include <nsfx/network/buffer/iterator/const-buffer-iterator.h>
@@ -31,6 +35,9 @@
 #include <nsfx/network/buffer/iterator/zc-buffer-iterator.h>
 #include <nsfx/network/buffer/iterator/const-zc-buffer-iterator.h>
 
+#include <nsfx/network/buffer/iterator/seg-buffer-iterator.h>
+#include <nsfx/network/buffer/iterator/const-seg-buffer-iterator.h>
+
 // Buffer.
 #include <nsfx/network/buffer/basic-buffer.h>
 
@@ -43,12 +50,19 @@
 #include <nsfx/network/buffer/fixed-buffer.h>
 #include <nsfx/network/buffer/const-fixed-buffer.h>
 
+#include <nsfx/network/buffer/seg-buffer.h>
+#include <nsfx/network/buffer/const-seg-buffer.h>
+
 // IO.
 #include <nsfx/network/buffer/io/arithmetic-io.h>
 #include <nsfx/network/buffer/io/duration-io.h>
 #include <nsfx/network/buffer/io/time-point-io.h>
 #include <nsfx/network/buffer/io/address-io.h>
 
+// Checksum.
+#include <nsfx/network/buffer/checksum/internet-checksum.h>
+#include <nsfx/network/buffer/checksum/crc32.h>
+
 
 #endif // BUFFER_H__50C89673_2F74_42D3_94EC_993B4FF4E2A8
 
@@ -95,6 +95,20 @@ public:
      */
     BasicBuffer(size_t startSize, size_t zeroSize, size_t endSize);
 
+    /**
+     * @brief Create a buffer with a profile.
+     *
+     * @param[in] zeroSize The size of the zero data.
+     * @param[in] profile  The profile that predicts the headroom and tailroom.
+     *                     It **must** outlive the buffer.
+     *
+     * The buffer reserves the headroom and tailroom predicted by the profile.
+     * The copies of the data made to add headers or trailers are reported to
+     * the profile, so the subsequent buffers of the profile reserve enough
+     * space.
+     */
+    BasicBuffer(size_t zeroSize, BufferProfile& profile);
+
     // Deep copy.
 public:
     /**
@@ -400,6 +414,16 @@ inline Buffer::BasicBuffer(size_t startSize, size_t zeroSize, size_t endSize)
     }
 }
 
+inline Buffer::BasicBuffer(size_t zeroSize, BufferProfile& profile)
+{
+    storage_ = BufferStorage::Allocate(zeroSize, profile);
+    start_   = profile.GetHeadroom();
+    end_     = start_ + zeroSize;
+    storage_->dirtyStart_ = start_;
+    storage_->dirtyEnd_   = end_;
+    std::memset(storage_->bytes_ + start_, 0, zeroSize);
+}
+
 inline Buffer::BasicBuffer(BufferStorage* storage, size_t start, size_t end) BOOST_NOEXCEPT :
     storage_(storage),
     start_(start),
@@ -697,6 +721,8 @@ inline void Buffer::InternalAddAtStart(
                 dataSize);
     if (storage_)
     {
+        BufferStorage::RecordCopy(storage_, newStorage,
+                                  size > start_ ? size - start_ : 0, 0);
         BufferStorage::Release(storage_);
     }
     storage_  = newStorage;
@@ -711,6 +737,7 @@ inline void Buffer::InternalAddAtStart(
 inline void Buffer::InternalAddAtStart(
     size_t size, size_t dataSize, MoveMemoryTag) BOOST_NOEXCEPT
 {
+    BufferStorage::RecordCopy(storage_, storage_, size - start_, 0);
     std::memmove(storage_->bytes_ + size,
                  storage_->bytes_ + start_,
                  dataSize);
@@ -862,6 +889,9 @@ inline void Buffer::InternalAddAtEnd(
                 dataSize);
     if (storage_)
     {
+        size_t postSize = storage_->capacity_ - (start_ + dataSize);
+        BufferStorage::RecordCopy(storage_, newStorage, 0,
+                                  size > postSize ? size - postSize : 0);
         BufferStorage::Release(storage_);
     }
     storage_  = newStorage;
@@ -876,6 +906,8 @@ inline void Buffer::InternalAddAtEnd(
 inline void Buffer::InternalAddAtEnd(
     size_t size, size_t dataSize, MoveMemoryTag) BOOST_NOEXCEPT
 {
+    size_t postSize = storage_->capacity_ - (start_ + dataSize);
+    BufferStorage::RecordCopy(storage_, storage_, 0, size - postSize);
     size_t newStart = storage_->capacity_ - (dataSize + size);
     std::memmove(storage_->bytes_ + newStart,
                  storage_->bytes_ + start_,
@@ -0,0 +1,580 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef CRC32_H__8D41E6B2_37A9_4C05_9F1E_B2D6047A5C93
+#define CRC32_H__8D41E6B2_37A9_4C05_9F1E_B2D6047A5C93
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/const-buffer.h>
+#include <nsfx/network/buffer/const-zc-buffer.h>
+#include <nsfx/network/buffer/const-seg-buffer.h>
+#include <cstring> // memcpy
+#if defined(__SSE4_2__) || (defined(__PCLMUL__) && defined(__SSE4_1__))
+# include <immintrin.h>
+#endif // defined(__SSE4_2__) || (defined(__PCLMUL__) && defined(__SSE4_1__))
+
+
+NSFX_OPEN_NAMESPACE
+
+
+namespace aux {
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CRC kernels.
+// The CRCs are bit-reflected.
+// The kernels operate on the CRC register, i.e., the initial value and the
+// final xor are applied by BasicCrc32.
+
+/**
+ * @brief The lookup tables of slicing-by-8.
+ *
+ * @tparam poly The bit-reflected polynomial.
+ */
+template<uint32_t poly>
+struct CrcTable
+{
+    CrcTable(void) BOOST_NOEXCEPT
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc = i;
+            for (size_t k = 0; k < 8; ++k)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ poly : (crc >> 1);
+            }
+            t_[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            for (size_t k = 1; k < 8; ++k)
+            {
+                uint32_t crc = t_[k - 1][i];
+                t_[k][i] = (crc >> 8) ^ t_[0][crc & 0xff];
+            }
+        }
+    }
+
+    static const CrcTable& Get(void) BOOST_NOEXCEPT
+    {
+        static const CrcTable table;
+        return table;
+    }
+
+    uint32_t t_[8][256];
+};
+
+template<uint32_t poly>
+inline uint32_t
+UpdateCrcBySlicing(uint32_t crc, const uint8_t* data, size_t size) BOOST_NOEXCEPT
+{
+    const uint32_t (&t)[8][256] = CrcTable<poly>::Get().t_;
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        uint32_t lo = crc ^ (static_cast<uint32_t>(data[0])       |
+                             static_cast<uint32_t>(data[1]) <<  8 |
+                             static_cast<uint32_t>(data[2]) << 16 |
+                             static_cast<uint32_t>(data[3]) << 24);
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+              t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+              t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+    }
+    while (size--)
+    {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xff];
+    }
+    return crc;
+}
+
+/**
+ * @brief Update the CRC register.
+ *
+ * @tparam poly The bit-reflected polynomial.
+ */
+template<uint32_t poly>
+struct CrcKernel
+{
+    static uint32_t Update(uint32_t crc, const uint8_t* data, size_t size) BOOST_NOEXCEPT
+    {
+        return UpdateCrcBySlicing<poly>(crc, data, size);
+    }
+};
+
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+/**
+ * @brief CRC-32 via carry-less multiplication.
+ *
+ * The data is folded 64 bytes at a time, then reduced via Barrett reduction.
+ * See Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+ * Instruction", 2009.
+ */
+template<>
+struct CrcKernel<0xedb88320>
+{
+    static uint32_t Update(uint32_t crc, const uint8_t* data, size_t size) BOOST_NOEXCEPT
+    {
+        if (size >= 64)
+        {
+            size_t n = size & ~static_cast<size_t>(15);
+            crc = Fold(crc, data, n);
+            data += n;
+            size -= n;
+        }
+        return UpdateCrcBySlicing<0xedb88320>(crc, data, size);
+    }
+
+    static __m128i Load(const uint8_t* data) BOOST_NOEXCEPT
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    // size >= 64, and size % 16 == 0.
+    static uint32_t Fold(uint32_t crc, const uint8_t* data, size_t size) BOOST_NOEXCEPT
+    {
+        const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+        const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+        const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+        const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+        const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+        __m128i x1, x2, x3, x4, x5, x6, x7, x8;
+        x1 = _mm_xor_si128(Load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+        x2 = Load(data + 16);
+        x3 = Load(data + 32);
+        x4 = Load(data + 48);
+        data += 64;
+        size -= 64;
+        // Fold by 4 x 128 bits.
+        for (; size >= 64; data += 64, size -= 64)
+        {
+            x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+            x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+            x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+            x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), Load(data));
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), Load(data + 16));
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), Load(data + 32));
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), Load(data + 48));
+        }
+        // Fold into 128 bits.
+        x1 = FoldOnce(x1, x2, k3k4);
+        x1 = FoldOnce(x1, x3, k3k4);
+        x1 = FoldOnce(x1, x4, k3k4);
+        for (; size >= 16; data += 16, size -= 16)
+        {
+            x1 = FoldOnce(x1, Load(data), k3k4);
+        }
+        // Fold 128 bits into 64 bits.
+        x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_and_si128(x1, mask);
+        x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+        // Barrett reduction into 32 bits.
+        x2 = _mm_and_si128(x1, mask);
+        x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+        x2 = _mm_and_si128(x2, mask);
+        x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+        return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+    }
+
+    static __m128i FoldOnce(__m128i x, __m128i y, __m128i k) BOOST_NOEXCEPT
+    {
+        __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+        __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+        return _mm_xor_si128(_mm_xor_si128(hi, lo), y);
+    }
+};
+#endif // defined(__PCLMUL__) && defined(__SSE4_1__)
+
+#if defined(__SSE4_2__)
+/**
+ * @brief CRC-32C via the \c crc32 instruction of SSE4.2.
+ */
+template<>
+struct CrcKernel<0x82f63b78>
+{
+    static uint32_t Update(uint32_t crc, const uint8_t* data, size_t size) BOOST_NOEXCEPT
+    {
+# if defined(__x86_64__) || defined(_M_X64)
+        uint64_t crc64 = crc;
+        for (; size >= 8; data += 8, size -= 8)
+        {
+            uint64_t v;
+            std::memcpy(&v, data, 8);
+            crc64 = _mm_crc32_u64(crc64, v);
+        }
+        crc = static_cast<uint32_t>(crc64);
+# endif // defined(__x86_64__) || defined(_M_X64)
+        for (; size >= 4; data += 4, size -= 4)
+        {
+            uint32_t v;
+            std::memcpy(&v, data, 4);
+            crc = _mm_crc32_u32(crc, v);
+        }
+        while (size--)
+        {
+            crc = _mm_crc32_u8(crc, *data++);
+        }
+        return crc;
+    }
+};
+#endif // defined(__SSE4_2__)
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Zeros.
+// The CRC register is a polynomial over GF(2), with x^0 at the most
+// significant bit.
+// Feeding n zero bytes multiplies the register by x^(8n) modulo the
+// polynomial.
+
+/**
+ * @brief Multiply two polynomials modulo the polynomial.
+ */
+template<uint32_t poly>
+inline uint32_t MultiplyModPoly(uint32_t a, uint32_t b) BOOST_NOEXCEPT
+{
+    uint32_t m = static_cast<uint32_t>(1) << 31;
+    uint32_t p = 0;
+    for (;;)
+    {
+        if (a & m)
+        {
+            p ^= b;
+            if (!(a & (m - 1)))
+            {
+                break;
+            }
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ poly : (b >> 1);
+    }
+    return p;
+}
+
+/**
+ * @brief The powers <code>x^(2^k)</code> modulo the polynomial.
+ */
+template<uint32_t poly>
+struct CrcPowerTable
+{
+    CrcPowerTable(void) BOOST_NOEXCEPT
+    {
+        // x^1.
+        uint32_t p = static_cast<uint32_t>(1) << 30;
+        for (size_t k = 0; k < 64; ++k)
+        {
+            t_[k] = p;
+            p = MultiplyModPoly<poly>(p, p);
+        }
+    }
+
+    static const CrcPowerTable& Get(void) BOOST_NOEXCEPT
+    {
+        static const CrcPowerTable table;
+        return table;
+    }
+
+    uint32_t t_[64];
+};
+
+/**
+ * @brief Feed zero bytes to the CRC register.
+ *
+ * It takes <code>O(log(size))</code> time.
+ */
+template<uint32_t poly>
+inline uint32_t UpdateCrcByZeros(uint32_t crc, uint64_t size) BOOST_NOEXCEPT
+{
+    const uint32_t (&t)[64] = CrcPowerTable<poly>::Get().t_;
+    // x^(8 * size) = product of x^(2^k) over the bits of (size << 3).
+    for (size_t k = 3; size; size >>= 1, ++k)
+    {
+        if (size & 1)
+        {
+            crc = MultiplyModPoly<poly>(t[k & 63], crc);
+        }
+    }
+    return crc;
+}
+
+
+} // namespace aux
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BasicCrc32.
+/**
+ * @ingroup Network
+ * @brief A 32-bit CRC.
+ *
+ * @tparam poly The bit-reflected polynomial.
+ *
+ * The initial value and the final xor value are \c 0xffffffff.
+ *
+ * The data can be supplied in pieces of any sizes.
+ *
+ * The zero-compressed area of a buffer is not read.
+ * Instead, the CRC register is multiplied by <code>x^(8n)</code> modulo
+ * the polynomial, where \c n is the number of zero bytes.
+ *
+ * The slicing-by-8 algorithm is used by default.
+ * If the compiler targets PCLMUL and SSE4.1, CRC-32 folds 64 bytes at a time
+ * via carry-less multiplication.
+ * If the compiler targets SSE4.2, CRC-32C uses the \c crc32 instruction.
+ *
+ * ### Example
+ * @code{.cpp}
+ * Crc32 crc;
+ * crc.Update(buffer);
+ * ZcBufferIterator it = buffer.end();
+ * buffer.AddAtEnd(4);
+ * it.WriteL<uint32_t>(crc.GetValue());
+ * @endcode
+ */
+template<uint32_t poly>
+class BasicCrc32
+{
+public:
+    /**
+     * @brief Start a new CRC.
+     */
+    BasicCrc32(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Continue a CRC.
+     *
+     * @param[in] crc The CRC of the preceding data.
+     */
+    explicit BasicCrc32(uint32_t crc) BOOST_NOEXCEPT;
+
+    // Methods.
+public:
+    /**
+     * @brief Add a memory block.
+     */
+    void Update(const uint8_t* data, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add zeros.
+     *
+     * @param[in] size The number of zero bytes.
+     */
+    void UpdateZeros(uint64_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add the data of a buffer.
+     */
+    void Update(const ConstBuffer& buffer) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add the data of a zero-compressed buffer.
+     *
+     * The zero-compressed area is not read.
+     */
+    void Update(const ConstZcBuffer& buffer) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add the data of a segmented buffer.
+     */
+    void Update(const ConstSegBuffer& buffer) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the CRC.
+     */
+    uint32_t GetValue(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Start a new CRC.
+     */
+    void Reset(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Combine the CRCs of two consecutive pieces of data.
+     *
+     * @param[in] crc1  The CRC of the first piece.
+     * @param[in] crc2  The CRC of the second piece.
+     * @param[in] size2 The number of bytes of the second piece.
+     *
+     * @return The CRC of the concatenation of the two pieces.
+     *
+     * It takes <code>O(log(size2))</code> time.
+     */
+    static uint32_t Combine(uint32_t crc1, uint32_t crc2, uint64_t size2) BOOST_NOEXCEPT;
+
+private:
+    /**
+     * @brief The CRC register.
+     */
+    uint32_t crc_;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Typedefs.
+/**
+ * @ingroup Network
+ * @brief CRC-32 (IEEE 802.3).
+ */
+typedef BasicCrc32<0xedb88320>  Crc32;
+
+/**
+ * @ingroup Network
+ * @brief CRC-32C (Castagnoli).
+ */
+typedef BasicCrc32<0x82f63b78>  Crc32c;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Free functions.
+/**
+ * @ingroup Network
+ * @brief Compute the CRC-32 of a buffer.
+ *
+ * @tparam BufferType \c ConstBuffer, \c ConstZcBuffer, \c ConstSegBuffer,
+ *                    or a type that is convertible to one of them.
+ */
+template<class BufferType>
+inline uint32_t ComputeCrc32(const BufferType& buffer) BOOST_NOEXCEPT
+{
+    Crc32 crc;
+    crc.Update(buffer);
+    return crc.GetValue();
+}
+
+/**
+ * @ingroup Network
+ * @brief Compute the CRC-32C of a buffer.
+ *
+ * @tparam BufferType \c ConstBuffer, \c ConstZcBuffer, \c ConstSegBuffer,
+ *                    or a type that is convertible to one of them.
+ */
+template<class BufferType>
+inline uint32_t ComputeCrc32c(const BufferType& buffer) BOOST_NOEXCEPT
+{
+    Crc32c crc;
+    crc.Update(buffer);
+    return crc.GetValue();
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+template<uint32_t poly>
+inline BasicCrc32<poly>::BasicCrc32(void) BOOST_NOEXCEPT :
+    crc_(0xffffffff)
+{
+}
+
+template<uint32_t poly>
+inline BasicCrc32<poly>::BasicCrc32(uint32_t crc) BOOST_NOEXCEPT :
+    crc_(~crc)
+{
+}
+
+template<uint32_t poly>
+inline void
+BasicCrc32<poly>::Update(const uint8_t* data, size_t size) BOOST_NOEXCEPT
+{
+    if (size)
+    {
+        BOOST_ASSERT(data);
+        crc_ = aux::CrcKernel<poly>::Update(crc_, data, size);
+    }
+}
+
+template<uint32_t poly>
+inline void
+BasicCrc32<poly>::UpdateZeros(uint64_t size) BOOST_NOEXCEPT
+{
+    crc_ = aux::UpdateCrcByZeros<poly>(crc_, size);
+}
+
+template<uint32_t poly>
+inline void
+BasicCrc32<poly>::Update(const ConstBuffer& buffer) BOOST_NOEXCEPT
+{
+    if (buffer.GetSize())
+    {
+        Update(buffer.GetStorage()->bytes_ + buffer.GetStart(),
+               buffer.GetSize());
+    }
+}
+
+template<uint32_t poly>
+inline void
+BasicCrc32<poly>::Update(const ConstZcBuffer& buffer) BOOST_NOEXCEPT
+{
+    size_t headerSize  = buffer.GetZeroStart() - buffer.GetStart();
+    size_t zeroSize    = buffer.GetZeroEnd()   - buffer.GetZeroStart();
+    size_t trailerSize = buffer.GetEnd()       - buffer.GetZeroEnd();
+    if (headerSize || trailerSize)
+    {
+        // The trailer is stored right after the header.
+        const uint8_t* data = buffer.GetStorage()->bytes_ + buffer.GetStart();
+        Update(data, headerSize);
+        UpdateZeros(zeroSize);
+        Update(data + headerSize, trailerSize);
+    }
+    else
+    {
+        UpdateZeros(zeroSize);
+    }
+}
+
+template<uint32_t poly>
+inline void
+BasicCrc32<poly>::Update(const ConstSegBuffer& buffer) BOOST_NOEXCEPT
+{
+    size_t numSegs = buffer.GetNumSegments();
+    for (size_t i = 0; i < numSegs; ++i)
+    {
+        Update(buffer.GetSegment(i));
+    }
+}
+
+template<uint32_t poly>
+inline uint32_t BasicCrc32<poly>::GetValue(void) const BOOST_NOEXCEPT
+{
+    return ~crc_;
+}
+
+template<uint32_t poly>
+inline void BasicCrc32<poly>::Reset(void) BOOST_NOEXCEPT
+{
+    crc_ = 0xffffffff;
+}
+
+template<uint32_t poly>
+inline uint32_t
+BasicCrc32<poly>::Combine(uint32_t crc1, uint32_t crc2, uint64_t size2) BOOST_NOEXCEPT
+{
+    // The initial value and the final xor cancel out.
+    return aux::UpdateCrcByZeros<poly>(crc1, size2) ^ crc2;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // CRC32_H__8D41E6B2_37A9_4C05_9F1E_B2D6047A5C93
+
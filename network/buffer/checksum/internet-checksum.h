@@ -0,0 +1,345 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef INTERNET_CHECKSUM_H__2C7F9A14_D835_4B6E_A1F0_5E83B96D27C1
+#define INTERNET_CHECKSUM_H__2C7F9A14_D835_4B6E_A1F0_5E83B96D27C1
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/const-buffer.h>
+#include <nsfx/network/buffer/const-zc-buffer.h>
+#include <nsfx/network/buffer/const-seg-buffer.h>
+#include <nsfx/utility/endian.h>
+#include <cstring> // memcpy
+
+
+NSFX_OPEN_NAMESPACE
+
+
+namespace aux {
+
+
+/**
+ * @brief Fold a ones' complement sum into 16 bits.
+ */
+inline uint16_t FoldSum(uint64_t sum) BOOST_NOEXCEPT
+{
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return static_cast<uint16_t>(sum);
+}
+
+/**
+ * @brief Compute the ones' complement sum of the 16-bit words of a memory block.
+ *
+ * @return The sum in native byte order, which is not folded.
+ *
+ * The 32-bit words are summed in native byte order, which yields the same
+ * folded result as summing the 16-bit words (RFC 1071).
+ * If the size is odd, the last byte is padded with a zero.
+ */
+inline uint64_t SumWords(const uint8_t* data, size_t size) BOOST_NOEXCEPT
+{
+    uint64_t sum = 0;
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        uint64_t v;
+        std::memcpy(&v, data, 8);
+        sum += (v & 0xffffffff) + (v >> 32);
+    }
+    if (size >= 4)
+    {
+        uint32_t v;
+        std::memcpy(&v, data, 4);
+        sum += v;
+        data += 4;
+        size -= 4;
+    }
+    if (size >= 2)
+    {
+        uint16_t v;
+        std::memcpy(&v, data, 2);
+        sum += v;
+        data += 2;
+        size -= 2;
+    }
+    if (size)
+    {
+        uint8_t b[2] = { *data, 0 };
+        uint16_t v;
+        std::memcpy(&v, b, 2);
+        sum += v;
+    }
+    return sum;
+}
+
+
+} // namespace aux
+
+
+////////////////////////////////////////////////////////////////////////////////
+// InternetChecksum.
+/**
+ * @ingroup Network
+ * @brief The Internet checksum (RFC 1071).
+ *
+ * The checksum is the 16-bit ones' complement of the ones' complement sum
+ * of the 16-bit words of the data.
+ * It is used by IPv4, ICMP, UDP and TCP.
+ *
+ * The data can be supplied in pieces of any sizes, e.g., a pseudo-header
+ * followed by a buffer.
+ *
+ * The zero-compressed area of a buffer is not read, since zeros do not
+ * contribute to the sum.
+ *
+ * ### Example
+ * @code{.cpp}
+ * InternetChecksum checksum;
+ * checksum.Update(pseudoHeader, sizeof (pseudoHeader));
+ * checksum.Update(buffer);
+ * ZcBufferIterator it = buffer.begin() + 6;
+ * it.WriteB<uint16_t>(checksum.GetValue());
+ * @endcode
+ */
+class InternetChecksum
+{
+public:
+    InternetChecksum(void) BOOST_NOEXCEPT;
+
+    // Methods.
+public:
+    /**
+     * @brief Add a memory block.
+     */
+    void Update(const uint8_t* data, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add zeros.
+     *
+     * @param[in] size The number of zero bytes.
+     */
+    void UpdateZeros(size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add the data of a buffer.
+     */
+    void Update(const ConstBuffer& buffer) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add the data of a zero-compressed buffer.
+     *
+     * The zero-compressed area is not read.
+     */
+    void Update(const ConstZcBuffer& buffer) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Add the data of a segmented buffer.
+     */
+    void Update(const ConstSegBuffer& buffer) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the checksum.
+     *
+     * @return The checksum as a big endian 16-bit integer.
+     *         i.e., it shall be written via \c WriteB().
+     *
+     * If the data contains a correct checksum, the result is \c 0.
+     */
+    uint16_t GetValue(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Start a new checksum.
+     */
+    void Reset(void) BOOST_NOEXCEPT;
+
+private:
+    /**
+     * @brief The ones' complement sum in native byte order.
+     */
+    uint64_t sum_;
+
+    /**
+     * @brief The number of bytes is odd.
+     *
+     * The next byte is the low byte of a 16-bit word.
+     */
+    bool odd_;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Free functions.
+/**
+ * @ingroup Network
+ * @brief Compute the Internet checksum of a buffer.
+ *
+ * @tparam BufferType \c ConstBuffer, \c ConstZcBuffer, \c ConstSegBuffer,
+ *                    or a type that is convertible to one of them.
+ *
+ * @return The checksum as a big endian 16-bit integer.
+ */
+template<class BufferType>
+inline uint16_t ComputeInternetChecksum(const BufferType& buffer) BOOST_NOEXCEPT
+{
+    InternetChecksum checksum;
+    checksum.Update(buffer);
+    return checksum.GetValue();
+}
+
+/**
+ * @ingroup Network
+ * @brief Update a checksum when a 16-bit word of the data changes (RFC 1624).
+ *
+ * @param[in] checksum The checksum.
+ * @param[in] oldValue The old value of the word, read via \c ReadB().
+ * @param[in] newValue The new value of the word.
+ *
+ * @return The new checksum.
+ *
+ * The word **must** be aligned to a 16-bit boundary from the start of
+ * the checksummed data.
+ */
+inline uint16_t UpdateInternetChecksum(uint16_t checksum, uint16_t oldValue,
+                                       uint16_t newValue) BOOST_NOEXCEPT
+{
+    // HC' = ~(~HC + ~m + m')
+    uint64_t sum = static_cast<uint16_t>(~checksum);
+    sum += static_cast<uint16_t>(~oldValue);
+    sum += newValue;
+    return static_cast<uint16_t>(~aux::FoldSum(sum));
+}
+
+/**
+ * @ingroup Network
+ * @brief Update a checksum when a 32-bit word of the data changes (RFC 1624).
+ *
+ * e.g., an IPv4 address is rewritten.
+ *
+ * @param[in] checksum The checksum.
+ * @param[in] oldValue The old value of the word, read via \c ReadB().
+ * @param[in] newValue The new value of the word.
+ *
+ * @return The new checksum.
+ *
+ * The word **must** be aligned to a 16-bit boundary from the start of
+ * the checksummed data.
+ */
+inline uint16_t UpdateInternetChecksum32(uint16_t checksum, uint32_t oldValue,
+                                         uint32_t newValue) BOOST_NOEXCEPT
+{
+    uint64_t sum = static_cast<uint16_t>(~checksum);
+    sum += static_cast<uint16_t>(~oldValue);
+    sum += static_cast<uint16_t>(~oldValue >> 16);
+    sum += newValue & 0xffff;
+    sum += newValue >> 16;
+    return static_cast<uint16_t>(~aux::FoldSum(sum));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline InternetChecksum::InternetChecksum(void) BOOST_NOEXCEPT :
+    sum_(0),
+    odd_(false)
+{
+}
+
+inline void
+InternetChecksum::Update(const uint8_t* data, size_t size) BOOST_NOEXCEPT
+{
+    if (size)
+    {
+        BOOST_ASSERT(data);
+        uint64_t sum = aux::SumWords(data, size);
+        // The words of the data straddle the words of the checksum.
+        // Swapping the bytes of the sum is the same as swapping the bytes
+        // of each word.
+        if (odd_)
+        {
+            sum = aux::ReorderBytes(aux::FoldSum(sum));
+        }
+        // Fold to avoid overflow.
+        sum_ = aux::FoldSum(sum_) + aux::FoldSum(sum);
+        odd_ ^= (size & 1) != 0;
+    }
+}
+
+inline void
+InternetChecksum::UpdateZeros(size_t size) BOOST_NOEXCEPT
+{
+    odd_ ^= (size & 1) != 0;
+}
+
+inline void
+InternetChecksum::Update(const ConstBuffer& buffer) BOOST_NOEXCEPT
+{
+    if (buffer.GetSize())
+    {
+        Update(buffer.GetStorage()->bytes_ + buffer.GetStart(),
+               buffer.GetSize());
+    }
+}
+
+inline void
+InternetChecksum::Update(const ConstZcBuffer& buffer) BOOST_NOEXCEPT
+{
+    size_t headerSize  = buffer.GetZeroStart() - buffer.GetStart();
+    size_t zeroSize    = buffer.GetZeroEnd()   - buffer.GetZeroStart();
+    size_t trailerSize = buffer.GetEnd()       - buffer.GetZeroEnd();
+    if (headerSize || trailerSize)
+    {
+        // The trailer is stored right after the header.
+        const uint8_t* data = buffer.GetStorage()->bytes_ + buffer.GetStart();
+        Update(data, headerSize);
+        UpdateZeros(zeroSize);
+        Update(data + headerSize, trailerSize);
+    }
+    else
+    {
+        UpdateZeros(zeroSize);
+    }
+}
+
+inline void
+InternetChecksum::Update(const ConstSegBuffer& buffer) BOOST_NOEXCEPT
+{
+    size_t numSegs = buffer.GetNumSegments();
+    for (size_t i = 0; i < numSegs; ++i)
+    {
+        Update(buffer.GetSegment(i));
+    }
+}
+
+inline uint16_t InternetChecksum::GetValue(void) const BOOST_NOEXCEPT
+{
+    uint16_t sum = aux::FoldSum(sum_);
+    return static_cast<uint16_t>(~NativeToBigEndian(sum));
+}
+
+inline void InternetChecksum::Reset(void) BOOST_NOEXCEPT
+{
+    sum_ = 0;
+    odd_ = false;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // INTERNET_CHECKSUM_H__2C7F9A14_D835_4B6E_A1F0_5E83B96D27C1
+
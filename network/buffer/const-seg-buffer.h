@@ -0,0 +1,285 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef CONST_SEG_BUFFER_H__5C93E1B8_0F4A_4D67_A3B2_7E18D6F40C95
+#define CONST_SEG_BUFFER_H__5C93E1B8_0F4A_4D67_A3B2_7E18D6F40C95
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/seg-buffer.h>
+#include <boost/core/swap.hpp>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ConstSegBuffer.
+/**
+ * @ingroup Network
+ * @brief A read-only buffer that consists of a chain of segments.
+ *
+ * This is a specialization of <code>BasicSegBuffer<></code>.
+ */
+template<>
+class BasicSegBuffer</*readOnly*/true>
+{
+public:
+    typedef BasicSegBuffer<true>    ConstSegBuffer;
+    typedef ConstSegBufferIterator  iterator;
+    typedef ConstSegBufferIterator  const_iterator;
+
+    // Xtructors.
+public:
+    /**
+     * @brief Create a buffer.
+     *
+     * @param[in] buffer A buffer.
+     *
+     * A \c SegBuffer can be converted implicitly to a \c ConstSegBuffer.
+     */
+    BasicSegBuffer(const SegBuffer& buffer) BOOST_NOEXCEPT;
+
+    // Copyable.
+public:
+    /**
+     * @brief Make a shallow copy of the buffer.
+     */
+    BasicSegBuffer(const ConstSegBuffer& rhs) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Make a shallow copy of the buffer.
+     */
+    ConstSegBuffer& operator=(const ConstSegBuffer& rhs) BOOST_NOEXCEPT;
+
+    // Movable.
+public:
+    /**
+     * @brief Move a buffer.
+     */
+    BasicSegBuffer(ConstSegBuffer&& rhs) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Move a buffer.
+     */
+    ConstSegBuffer& operator=(ConstSegBuffer&& rhs) BOOST_NOEXCEPT;
+
+    // Methods.
+public:
+    /**
+     * @brief Get the size of the represented data.
+     */
+    size_t GetSize(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the number of segments.
+     */
+    size_t GetNumSegments(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get a segment.
+     */
+    ConstBuffer GetSegment(size_t index) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Copy data to a memory block.
+     * @return The number of bytes copied.
+     */
+    size_t CopyTo(uint8_t* dst, size_t size) const BOOST_NOEXCEPT;
+
+    // Fragmentation.
+public:
+    /**
+     * @brief Make a fragment of the buffer.
+     *
+     * @param[in] start The start of the fragment.
+     * @param[in] size  The size of the fragment.
+     *
+     * The fragment shares the segments of the buffer.
+     */
+    ConstSegBuffer MakeFragment(size_t start, size_t size) const;
+
+    // Linearization.
+public:
+    /**
+     * @brief Make a continuous buffer.
+     *
+     * If the buffer consists of a single segment, the segment is returned.
+     * Otherwise, the data is copied to a new buffer.
+     */
+    ConstBuffer MakeRealBuffer(void) const;
+
+    // Iterator.
+public:
+    /**
+     * @brief Get an iterator that points to the first byte of the data.
+     */
+    ConstSegBufferIterator begin(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get an iterator that points one byte after the last byte of the data area.
+     */
+    ConstSegBufferIterator end(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get a const iterator that points to the first byte of the data.
+     */
+    ConstSegBufferIterator cbegin(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get a const iterator that points one byte after the last byte of the data area.
+     */
+    ConstSegBufferIterator cend(void) const BOOST_NOEXCEPT;
+
+    // Swappable.
+public:
+    void swap(ConstSegBuffer& rhs) BOOST_NOEXCEPT;
+
+    // Properties.
+private:
+    friend class BasicSegBuffer</*readOnly*/false>;
+
+    /**
+     * @brief The buffer.
+     */
+    SegBuffer buffer_;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Typedef.
+typedef BasicSegBuffer</*readOnly*/true>  ConstSegBuffer;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ConstSegBuffer.
+inline ConstSegBuffer::BasicSegBuffer(const SegBuffer& buffer) BOOST_NOEXCEPT :
+    buffer_(buffer)
+{
+}
+
+inline ConstSegBuffer::BasicSegBuffer(const ConstSegBuffer& rhs) BOOST_NOEXCEPT :
+    buffer_(rhs.buffer_)
+{
+}
+
+inline ConstSegBuffer&
+ConstSegBuffer::operator=(const ConstSegBuffer& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        buffer_ = rhs.buffer_;
+    }
+    return *this;
+}
+
+inline ConstSegBuffer::BasicSegBuffer(ConstSegBuffer&& rhs) BOOST_NOEXCEPT :
+    buffer_(std::move(rhs.buffer_))
+{
+}
+
+inline ConstSegBuffer&
+ConstSegBuffer::operator=(ConstSegBuffer&& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        buffer_ = std::move(rhs.buffer_);
+    }
+    return *this;
+}
+
+inline size_t ConstSegBuffer::GetSize(void) const BOOST_NOEXCEPT
+{
+    return buffer_.GetSize();
+}
+
+inline size_t ConstSegBuffer::GetNumSegments(void) const BOOST_NOEXCEPT
+{
+    return buffer_.GetNumSegments();
+}
+
+inline ConstBuffer ConstSegBuffer::GetSegment(size_t index) const BOOST_NOEXCEPT
+{
+    return buffer_.GetSegment(index);
+}
+
+inline size_t ConstSegBuffer::CopyTo(uint8_t* dst, size_t size) const BOOST_NOEXCEPT
+{
+    return buffer_.CopyTo(dst, size);
+}
+
+inline ConstSegBuffer
+ConstSegBuffer::MakeFragment(size_t start, size_t size) const
+{
+    return buffer_.MakeFragment(start, size);
+}
+
+inline ConstBuffer ConstSegBuffer::MakeRealBuffer(void) const
+{
+    return buffer_.MakeRealBuffer();
+}
+
+inline ConstSegBufferIterator ConstSegBuffer::begin(void) BOOST_NOEXCEPT
+{
+    return buffer_.cbegin();
+}
+
+inline ConstSegBufferIterator ConstSegBuffer::end(void) BOOST_NOEXCEPT
+{
+    return buffer_.cend();
+}
+
+inline ConstSegBufferIterator ConstSegBuffer::cbegin(void) const BOOST_NOEXCEPT
+{
+    return buffer_.cbegin();
+}
+
+inline ConstSegBufferIterator ConstSegBuffer::cend(void) const BOOST_NOEXCEPT
+{
+    return buffer_.cend();
+}
+
+inline void ConstSegBuffer::swap(ConstSegBuffer& rhs) BOOST_NOEXCEPT
+{
+    boost::swap(buffer_, rhs.buffer_);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void swap(ConstSegBuffer& lhs, ConstSegBuffer& rhs) BOOST_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SegBuffer.
+inline void SegBuffer::AddAtStart(const ConstSegBuffer& src)
+{
+    AddAtStart(src.buffer_);
+}
+
+inline void SegBuffer::AddAtEnd(const ConstSegBuffer& src)
+{
+    AddAtEnd(src.buffer_);
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // CONST_SEG_BUFFER_H__5C93E1B8_0F4A_4D67_A3B2_7E18D6F40C95
+
@@ -27,47 +27,53 @@ NSFX_OPEN_NAMESPACE
 
 ////////////////////////////////////////////////////////////////////////////////
 // Address
-template<bool zcAware, size_t bits>
-void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const Address<bits>& addr)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it,
+      const Address<bits>& addr)
 {
     addr.Write(it);
 }
 
-template<bool zcAware, size_t bits>
-void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-            const Address<bits>& addr)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it,
+       const Address<bits>& addr)
 {
     addr.WriteL(it);
 }
 
-template<bool zcAware, size_t bits>
-void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-            const Address<bits>& addr)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it,
+       const Address<bits>& addr)
 {
     addr.WriteB(it);
 }
 
 ////////////////////////////////////////
-template<bool readOnly, bool zcAware, size_t bits>
-void Read(BasicBufferIterator<readOnly, zcAware>& it,
-          Address<bits>* addr)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it,
+     Address<bits>* addr)
 {
     BOOST_ASSERT(addr);
     addr->Read(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits>
-void ReadL(BasicBufferIterator<readOnly, zcAware>& it,
-           Address<bits>* addr)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it,
+      Address<bits>* addr)
 {
     BOOST_ASSERT(addr);
     addr->ReadL(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits>
-void ReadB(BasicBufferIterator<readOnly, zcAware>& it,
-           Address<bits>* addr)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it,
+      Address<bits>* addr)
 {
     BOOST_ASSERT(addr);
     addr->ReadB(it);
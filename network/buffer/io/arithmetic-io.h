@@ -27,47 +27,53 @@ NSFX_OPEN_NAMESPACE
 
 ////////////////////////////////////////////////////////////////////////////////
 // Integers & floating points.
-template<class T, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-Write(BasicBufferIterator</*readOnly*/false, zcAware>& it, T v)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it, T v)
 {
     it.template Write<T>(v);
 }
 
-template<class T, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it, T v)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it, T v)
 {
     it.template WriteL<T>(v);
 }
 
-template<class T, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it, T v)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it, T v)
 {
     it.template WriteB<T>(v);
 }
 
 ////////////////////////////////////////
-template<class T, bool readOnly, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-Read(BasicBufferIterator<readOnly, zcAware>& it, T* v)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it, T* v)
 {
     BOOST_ASSERT(v);
     *v = it.template Read<T>();
 }
 
-template<class T, bool readOnly, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-ReadL(BasicBufferIterator<readOnly, zcAware>& it, T* v)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it, T* v)
 {
     BOOST_ASSERT(v);
     *v = it.template ReadL<T>();
 }
 
-template<class T, bool readOnly, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-ReadB(BasicBufferIterator<readOnly, zcAware>& it, T* v)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it, T* v)
 {
     BOOST_ASSERT(v);
     *v = it.template ReadB<T>();
@@ -76,129 +82,105 @@ ReadB(BasicBufferIterator<readOnly, zcAware>& it, T* v)
 
 ////////////////////////////////////////////////////////////////////////////////
 // Fixed-size array of integers & floating points.
-template<class T, bool zcAware, size_t n>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-Write(BasicBufferIterator</*readOnly*/false, zcAware>& it, const T (&ar)[n])
+template<class T, class Iterator, size_t n>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it, const T (&ar)[n])
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        it.template Write<T>(ar[i]);
-    }
+    it.template WriteArray<T>(ar, n);
 }
 
-template<class T, bool zcAware, size_t n>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it, const T (&ar)[n])
+template<class T, class Iterator, size_t n>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it, const T (&ar)[n])
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        it.template WriteL<T>(ar[i]);
-    }
+    it.template WriteArrayL<T>(ar, n);
 }
 
-template<class T, bool zcAware, size_t n>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it, const T (&ar)[n])
+template<class T, class Iterator, size_t n>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it, const T (&ar)[n])
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        it.template WriteB<T>(ar[i]);
-    }
+    it.template WriteArrayB<T>(ar, n);
 }
 
 ////////////////////////////////////////
-template<class T, bool readOnly, bool zcAware, size_t n>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-Read(BasicBufferIterator<readOnly, zcAware>& it, T (*ar)[n])
+template<class T, class Iterator, size_t n>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it, T (*ar)[n])
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        (*ar)[i] = it.template Read<T>();
-    }
+    it.template ReadArray<T>(*ar, n);
 }
 
-template<class T, bool readOnly, bool zcAware, size_t n>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-ReadL(BasicBufferIterator<readOnly, zcAware>& it, T (*ar)[n])
+template<class T, class Iterator, size_t n>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it, T (*ar)[n])
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        (*ar)[i] = it.template ReadL<T>();
-    }
+    it.template ReadArrayL<T>(*ar, n);
 }
 
-template<class T, bool readOnly, bool zcAware, size_t n>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-ReadB(BasicBufferIterator<readOnly, zcAware>& it, T (*ar)[n])
+template<class T, class Iterator, size_t n>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it, T (*ar)[n])
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        (*ar)[i] = it.template ReadB<T>();
-    }
+    it.template ReadArrayB<T>(*ar, n);
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
 // Array of integers & floating points.
-template<class T, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-Write(BasicBufferIterator</*readOnly*/false, zcAware>& it, const T* ar, size_t n)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it, const T* ar, size_t n)
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        it.template Write<T>(ar[i]);
-    }
+    it.template WriteArray<T>(ar, n);
 }
 
-template<class T, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it, const T* ar, size_t n)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it, const T* ar, size_t n)
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        it.template WriteL<T>(ar[i]);
-    }
+    it.template WriteArrayL<T>(ar, n);
 }
 
-template<class T, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it, const T* ar, size_t n)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it, const T* ar, size_t n)
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        it.template WriteB<T>(ar[i]);
-    }
+    it.template WriteArrayB<T>(ar, n);
 }
 
 ////////////////////////////////////////
-template<class T, bool readOnly, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-Read(BasicBufferIterator<readOnly, zcAware>& it, T* ar, size_t n)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it, T* ar, size_t n)
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        ar[i] = it.template Read<T>();
-    }
+    it.template ReadArray<T>(ar, n);
 }
 
-template<class T, bool readOnly, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-ReadL(BasicBufferIterator<readOnly, zcAware>& it, T* ar, size_t n)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it, T* ar, size_t n)
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        ar[i] = it.template ReadL<T>();
-    }
+    it.template ReadArrayL<T>(ar, n);
 }
 
-template<class T, bool readOnly, bool zcAware>
-typename std::enable_if<std::is_arithmetic<T>::value, void>::type
-ReadB(BasicBufferIterator<readOnly, zcAware>& it, T* ar, size_t n)
+template<class T, class Iterator>
+typename std::enable_if<std::is_arithmetic<T>::value &&
+                        is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it, T* ar, size_t n)
 {
-    for (size_t i = 0; i < n; ++i)
-    {
-        ar[i] = it.template ReadB<T>();
-    }
+    it.template ReadArrayB<T>(ar, n);
 }
 
 
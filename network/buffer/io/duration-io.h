@@ -27,49 +27,55 @@ NSFX_OPEN_NAMESPACE
 
 ////////////////////////////////////////////////////////////////////////////////
 // Duration
-template<bool zcAware, class Res>
-void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const chrono::Duration<Res>& dt)
+template<class Iterator, class Res>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it,
+      const chrono::Duration<Res>& dt)
 {
     it.template Write<chrono::count_t>(dt.GetCount());
 }
 
-template<bool zcAware, class Res>
-void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-            const chrono::Duration<Res>& dt)
+template<class Iterator, class Res>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it,
+       const chrono::Duration<Res>& dt)
 {
     it.template WriteL<chrono::count_t>(dt.GetCount());
 }
 
-template<bool zcAware, class Res>
-void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-            const chrono::Duration<Res>& dt)
+template<class Iterator, class Res>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it,
+       const chrono::Duration<Res>& dt)
 {
     it.template WriteB<chrono::count_t>(dt.GetCount());
 }
 
 ////////////////////////////////////////
-template<bool readOnly, bool zcAware, class Res>
-void Read(BasicBufferIterator<readOnly, zcAware>& it,
-          chrono::Duration<Res>* dt)
+template<class Iterator, class Res>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it,
+     chrono::Duration<Res>* dt)
 {
     BOOST_ASSERT(dt);
     chrono::count_t count = it.template Read<chrono::count_t>();
     *dt = chrono::Duration<Res>(count);
 }
 
-template<bool readOnly, bool zcAware, class Res>
-void ReadL(BasicBufferIterator<readOnly, zcAware>& it,
-           chrono::Duration<Res>* dt)
+template<class Iterator, class Res>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it,
+      chrono::Duration<Res>* dt)
 {
     BOOST_ASSERT(dt);
     chrono::count_t count = it.template ReadL<chrono::count_t>();
     *dt = chrono::Duration<Res>(count);
 }
 
-template<bool readOnly, bool zcAware, class Res>
-void ReadB(BasicBufferIterator<readOnly, zcAware>& it,
-           chrono::Duration<Res>* dt)
+template<class Iterator, class Res>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it,
+      chrono::Duration<Res>* dt)
 {
     BOOST_ASSERT(dt);
     chrono::count_t count = it.template ReadB<chrono::count_t>();
@@ -27,49 +27,55 @@ NSFX_OPEN_NAMESPACE
 
 ////////////////////////////////////////////////////////////////////////////////
 // TimePoint
-template<bool zcAware, class Clock, class Duration>
-void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const chrono::TimePoint<Clock, Duration>& t0)
+template<class Iterator, class Clock, class Duration>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it,
+      const chrono::TimePoint<Clock, Duration>& t0)
 {
     it.template Write<chrono::count_t>(t0.GetDuration().GetCount());
 }
 
-template<bool zcAware, class Clock, class Duration>
-void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-            const chrono::TimePoint<Clock, Duration>& t0)
+template<class Iterator, class Clock, class Duration>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it,
+       const chrono::TimePoint<Clock, Duration>& t0)
 {
     it.template WriteL<chrono::count_t>(t0.GetDuration().GetCount());
 }
 
-template<bool zcAware, class Clock, class Duration>
-void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-            const chrono::TimePoint<Clock, Duration>& t0)
+template<class Iterator, class Clock, class Duration>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it,
+       const chrono::TimePoint<Clock, Duration>& t0)
 {
     it.template WriteB<chrono::count_t>(t0.GetDuration().GetCount());
 }
 
 ////////////////////////////////////////
-template<bool readOnly, bool zcAware, class Clock, class Duration>
-void Read(BasicBufferIterator<readOnly, zcAware>& it,
-          chrono::TimePoint<Clock, Duration>* t0)
+template<class Iterator, class Clock, class Duration>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it,
+     chrono::TimePoint<Clock, Duration>* t0)
 {
     BOOST_ASSERT(t0);
     chrono::count_t count = it.template Read<chrono::count_t>();
     *t0 = chrono::TimePoint<Clock, Duration>(Duration(count));
 }
 
-template<bool readOnly, bool zcAware, class Clock, class Duration>
-void ReadL(BasicBufferIterator<readOnly, zcAware>& it,
-           chrono::TimePoint<Clock, Duration>* t0)
+template<class Iterator, class Clock, class Duration>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it,
+      chrono::TimePoint<Clock, Duration>* t0)
 {
     BOOST_ASSERT(t0);
     chrono::count_t count = it.template ReadL<chrono::count_t>();
     *t0 = chrono::TimePoint<Clock, Duration>(Duration(count));
 }
 
-template<bool readOnly, bool zcAware, class Clock, class Duration>
-void ReadB(BasicBufferIterator<readOnly, zcAware>& it,
-           chrono::TimePoint<Clock, Duration>* t0)
+template<class Iterator, class Clock, class Duration>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it,
+      chrono::TimePoint<Clock, Duration>* t0)
 {
     BOOST_ASSERT(t0);
     chrono::count_t count = it.template ReadB<chrono::count_t>();
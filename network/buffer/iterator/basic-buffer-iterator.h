@@ -18,6 +18,7 @@
 
 
 #include <nsfx/network/config.h>
+#include <type_traits> // true_type, false_type
 
 
 NSFX_OPEN_NAMESPACE
@@ -47,14 +48,14 @@ NSFX_OPEN_NAMESPACE
  * class MyData
  * {
  * public:
- *   template<bool readOnly, bool zcAware>
- *   MyData(BasicBufferIterator<readOnly, zcAware>& iterator);
+ *   template<class Iterator>
+ *   MyData(Iterator& iterator);
  *
- *   template<bool readOnly, bool zcAware>
- *   Read(BasicBufferIterator<readOnly, zcAware>& iterator);
+ *   template<class Iterator>
+ *   void Read(Iterator& iterator);
  *
- *   template<bool readOnly, bool zcAware>
- *   Write(BasicBufferIterator<readOnly, zcAware>& iterator) const;
+ *   template<class Iterator>
+ *   void Write(Iterator& iterator) const;
  * };
  * @endcode
  *
@@ -62,12 +63,14 @@ NSFX_OPEN_NAMESPACE
  * e.g.,
  * @code{.cpp}
  * class MyData { ... };
- * template<class MyData, bool readOnly, bool zcAware>
- * MyData Read(BasicBufferIterator<readOnly, zcAware> &iterator);
+ * template<class Iterator>
+ * typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ * Read(Iterator& iterator, MyData* data);
  *
  * class MyData { ... };
- * template<bool readOnly, bool zcAware>
- * Write(BasicBufferIterator<readOnly, zcAware>& iterator, const MyData& data);
+ * template<class Iterator>
+ * typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+ * Write(Iterator& iterator, const MyData& data);
  * @endcode
  *
  * A buffer iterator is not associated with a buffer.
@@ -88,6 +91,10 @@ NSFX_OPEN_NAMESPACE
  * * WriteL<T>(const uint8_t* data, size_t n)
  * * WriteB<T>(const uint8_t* data, size_t n)
  *
+ * * WriteArray<T>(const T* data, size_t n)
+ * * WriteArrayL<T>(const T* data, size_t n)
+ * * WriteArrayB<T>(const T* data, size_t n)
+ *
  * * Fill(uint8_t v, size_t n)
  *
  * * T Read<T>()
@@ -97,11 +104,44 @@ NSFX_OPEN_NAMESPACE
  * * Read<T>(uint8_t* data, size_t n)
  * * ReadL<T>(uint8_t* data, size_t n)
  * * ReadB<T>(uint8_t* data, size_t n)
+ *
+ * * ReadArray<T>(T* data, size_t n)
+ * * ReadArrayL<T>(T* data, size_t n)
+ * * ReadArrayB<T>(T* data, size_t n)
  */
 template<bool readOnly, bool zcAware>
 class BasicBufferIterator;
 
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Network
+ * @brief Whether a type is a buffer iterator.
+ *
+ * The buffer I/O helpers (e.g., <code>Write(it, v)</code> and
+ * <code>Read(it, &v)</code>) accept any iterator that satisfies this trait.
+ * An iterator that provides the operations listed in
+ * \c BasicBufferIterator shall specialize this trait.
+ */
+template<class Iterator>
+struct is_buffer_iterator : std::false_type {};
+
+template<bool readOnly, bool zcAware>
+struct is_buffer_iterator<BasicBufferIterator<readOnly, zcAware> > :
+    std::true_type {};
+
+/**
+ * @ingroup Network
+ * @brief Whether a type is a buffer iterator that can write data.
+ */
+template<class Iterator>
+struct is_writable_buffer_iterator : std::false_type {};
+
+template<bool zcAware>
+struct is_writable_buffer_iterator<BasicBufferIterator</*readOnly*/false, zcAware> > :
+    std::true_type {};
+
+
 NSFX_CLOSE_NAMESPACE
 
 
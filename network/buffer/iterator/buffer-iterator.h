@@ -19,6 +19,7 @@
 
 #include <nsfx/network/config.h>
 #include <nsfx/network/buffer/iterator/basic-buffer-iterator.h>
+#include <nsfx/network/buffer/iterator/copy-elements.h>
 #include <nsfx/utility/endian.h>
 #include <nsfx/utility/type-identity.h>
 #include <type_traits> // is_integral, is_floating_point, make_unsigned
@@ -286,6 +287,96 @@ private:
     void InternalRead(uint8_t* bytes, size_t size, size_t offset, InSolidAreaTag, KeepEndianTag) BOOST_NOEXCEPT;
     void InternalRead(uint8_t* bytes, size_t size, size_t offset, InSolidAreaTag, ReverseEndianTag) BOOST_NOEXCEPT;
 
+    // Write arrays.
+public:
+    /**
+     * @brief Write an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void WriteArray(const T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void WriteArrayL(const T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void WriteArrayB(const T* data, size_t n) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void WriteArrayInOrder(const T* data, size_t n, endian_t) BOOST_NOEXCEPT;
+
+    // Read arrays.
+public:
+    /**
+     * @brief Read an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArray(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void ReadArrayInOrder(T* data, size_t n, endian_t) BOOST_NOEXCEPT;
+
     // Boundary check.
 private:
     bool CanMoveForward(size_t numBytes) const BOOST_NOEXCEPT;
@@ -1024,6 +1115,79 @@ BufferIterator::InternalRead(uint8_t* bytes, size_t size, size_t offset, InSolid
     }
 }
 
+template<class T>
+inline void
+BufferIterator::WriteArray(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, native_endian);
+}
+
+template<class T>
+inline void
+BufferIterator::WriteArrayL(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, little_endian);
+}
+
+template<class T>
+inline void
+BufferIterator::WriteArrayB(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, big_endian);
+}
+
+template<class T>
+inline void
+BufferIterator::ReadArray(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, native_endian);
+}
+
+template<class T>
+inline void
+BufferIterator::ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, little_endian);
+}
+
+template<class T>
+inline void
+BufferIterator::ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, big_endian);
+}
+
+template<class T, class endian_t>
+inline void
+BufferIterator::WriteArrayInOrder(const T* data, size_t n, endian_t) BOOST_NOEXCEPT
+{
+    static_assert(std::is_integral<T>::value ||
+                  std::is_floating_point<T>::value,
+                  "Invalid data type.");
+    BOOST_ASSERT(data || !n);
+    WritableCheck(n * sizeof (T));
+    typedef typename byte_order_f<endian_t>::type  O;
+    aux::CopyElements<sizeof (T)>(bytes_ + cursor_,
+                                  reinterpret_cast<const uint8_t*>(data),
+                                  n, O());
+    cursor_ += n * sizeof (T);
+}
+
+template<class T, class endian_t>
+inline void
+BufferIterator::ReadArrayInOrder(T* data, size_t n, endian_t) BOOST_NOEXCEPT
+{
+    static_assert(std::is_integral<T>::value ||
+                  std::is_floating_point<T>::value,
+                  "Invalid data type.");
+    BOOST_ASSERT(data || !n);
+    ReadableCheck(n * sizeof (T));
+    typedef typename byte_order_f<endian_t>::type  O;
+    aux::CopyElements<sizeof (T)>(reinterpret_cast<uint8_t*>(data),
+                                  bytes_ + cursor_, n, O());
+    cursor_ += n * sizeof (T);
+}
+
 inline bool
 BufferIterator::CanMoveForward(size_t numBytes) const BOOST_NOEXCEPT
 {
@@ -0,0 +1,442 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef CONST_SEG_BUFFER_ITERATOR_H__F2A75C0E_9D34_4B18_8E6C_5B30D9A12E47
+#define CONST_SEG_BUFFER_ITERATOR_H__F2A75C0E_9D34_4B18_8E6C_5B30D9A12E47
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/iterator/seg-buffer-iterator.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Network
+ * @brief The iterator for reading segmented buffer data.
+ *
+ * A specialization of <code>BasicSegBufferIterator<></code>.
+ */
+template<>
+class BasicSegBufferIterator</*readOnly=*/true>
+{
+public:
+    typedef BasicSegBufferIterator<true>  ConstSegBufferIterator;
+
+    // Xtructors.
+public:
+    BasicSegBufferIterator(void) BOOST_NOEXCEPT;
+
+    BasicSegBufferIterator(Buffer* segs, size_t numSegs,
+                           size_t size, size_t cursor) BOOST_NOEXCEPT;
+
+    // Copyable.
+public:
+    BasicSegBufferIterator(const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+    BasicSegBufferIterator& operator=(const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+    // Implicit conversion from SegBufferIterator.
+public:
+    BasicSegBufferIterator(const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    BasicSegBufferIterator& operator=(const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+public:
+    size_t GetStart(void) const BOOST_NOEXCEPT;
+    size_t GetEnd(void) const BOOST_NOEXCEPT;
+    size_t GetCursor(void) const BOOST_NOEXCEPT;
+
+    // Move cursor.
+public:
+    /**
+     * @brief Move the iterator toward the end of the data area.
+     */
+    void MoveForward(size_t numBytes) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Move the iterator toward the start of the data area.
+     */
+    void MoveBackward(size_t numBytes) BOOST_NOEXCEPT;
+
+    // Read data.
+public:
+    /**
+     * @brief Read data in native endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    T Read(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read data in little endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    T ReadL(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read data in big endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    T ReadB(void) BOOST_NOEXCEPT;
+
+    // Read bytes.
+public:
+    /**
+     * @brief Read bytes in native endian order.
+     */
+    void Read(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read bytes in little endian order.
+     */
+    void ReadL(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read bytes in big endian order.
+     */
+    void ReadB(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    // Read arrays.
+public:
+    /**
+     * @brief Read an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void ReadArray(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT;
+
+    // Operators.
+public:
+    ConstSegBufferIterator& operator++(void) BOOST_NOEXCEPT;
+    ConstSegBufferIterator  operator++(int) BOOST_NOEXCEPT;
+    ConstSegBufferIterator& operator--(void) BOOST_NOEXCEPT;
+    ConstSegBufferIterator  operator--(int) BOOST_NOEXCEPT;
+    ConstSegBufferIterator& operator+=(size_t numBytes) BOOST_NOEXCEPT;
+    ConstSegBufferIterator& operator-=(size_t numBytes) BOOST_NOEXCEPT;
+
+    friend bool operator> (const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator>=(const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator==(const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator!=(const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator< (const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator<=(const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+    friend ConstSegBufferIterator operator+(const ConstSegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT;
+    friend ConstSegBufferIterator operator-(const ConstSegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT;
+    friend ptrdiff_t operator-(const ConstSegBufferIterator& lhs, const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+private:
+    SegBufferIterator it_;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Typedefs.
+typedef BasicSegBufferIterator</*readOnly=*/true>  ConstSegBufferIterator;
+
+template<>
+struct is_buffer_iterator<ConstSegBufferIterator> : std::true_type {};
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline ConstSegBufferIterator::BasicSegBufferIterator(void) BOOST_NOEXCEPT
+{
+}
+
+inline ConstSegBufferIterator::BasicSegBufferIterator(Buffer* segs,
+                                                      size_t numSegs,
+                                                      size_t size,
+                                                      size_t cursor) BOOST_NOEXCEPT :
+    it_(segs, numSegs, size, cursor)
+{
+}
+
+inline ConstSegBufferIterator::BasicSegBufferIterator(const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT :
+    it_(rhs.it_)
+{
+}
+
+inline ConstSegBufferIterator&
+ConstSegBufferIterator::operator=(const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        it_ = rhs.it_;
+    }
+    return *this;
+}
+
+inline ConstSegBufferIterator::BasicSegBufferIterator(const SegBufferIterator& rhs) BOOST_NOEXCEPT :
+    it_(rhs)
+{
+}
+
+inline ConstSegBufferIterator&
+ConstSegBufferIterator::operator=(const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    it_ = rhs;
+    return *this;
+}
+
+inline size_t
+ConstSegBufferIterator::GetStart(void) const BOOST_NOEXCEPT
+{
+    return it_.GetStart();
+}
+
+inline size_t
+ConstSegBufferIterator::GetEnd(void) const BOOST_NOEXCEPT
+{
+    return it_.GetEnd();
+}
+
+inline size_t
+ConstSegBufferIterator::GetCursor(void) const BOOST_NOEXCEPT
+{
+    return it_.GetCursor();
+}
+
+inline void
+ConstSegBufferIterator::MoveForward(size_t numBytes) BOOST_NOEXCEPT
+{
+    it_.MoveForward(numBytes);
+}
+
+inline void
+ConstSegBufferIterator::MoveBackward(size_t numBytes) BOOST_NOEXCEPT
+{
+    it_.MoveBackward(numBytes);
+}
+
+template<class T>
+inline T
+ConstSegBufferIterator::Read(void) BOOST_NOEXCEPT
+{
+    return it_.Read<T>();
+}
+
+template<class T>
+inline T
+ConstSegBufferIterator::ReadL(void) BOOST_NOEXCEPT
+{
+    return it_.ReadL<T>();
+}
+
+template<class T>
+inline T
+ConstSegBufferIterator::ReadB(void) BOOST_NOEXCEPT
+{
+    return it_.ReadB<T>();
+}
+
+inline void
+ConstSegBufferIterator::Read(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    it_.Read(bytes, size);
+}
+
+inline void
+ConstSegBufferIterator::ReadL(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    it_.ReadL(bytes, size);
+}
+
+inline void
+ConstSegBufferIterator::ReadB(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    it_.ReadB(bytes, size);
+}
+
+template<class T>
+inline void
+ConstSegBufferIterator::ReadArray(T* data, size_t n) BOOST_NOEXCEPT
+{
+    it_.ReadArray<T>(data, n);
+}
+
+template<class T>
+inline void
+ConstSegBufferIterator::ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT
+{
+    it_.ReadArrayL<T>(data, n);
+}
+
+template<class T>
+inline void
+ConstSegBufferIterator::ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT
+{
+    it_.ReadArrayB<T>(data, n);
+}
+
+inline ConstSegBufferIterator&
+ConstSegBufferIterator::operator++(void) BOOST_NOEXCEPT
+{
+    ++it_;
+    return *this;
+}
+
+inline ConstSegBufferIterator
+ConstSegBufferIterator::operator++(int) BOOST_NOEXCEPT
+{
+    BasicSegBufferIterator it = *this;
+    ++it_;
+    return it;
+}
+
+inline ConstSegBufferIterator&
+ConstSegBufferIterator::operator--(void) BOOST_NOEXCEPT
+{
+    --it_;
+    return *this;
+}
+
+inline ConstSegBufferIterator
+ConstSegBufferIterator::operator--(int) BOOST_NOEXCEPT
+{
+    BasicSegBufferIterator it = *this;
+    --it_;
+    return it;
+}
+
+inline ConstSegBufferIterator&
+ConstSegBufferIterator::operator+=(size_t numBytes) BOOST_NOEXCEPT
+{
+    it_ += numBytes;
+    return *this;
+}
+
+inline ConstSegBufferIterator&
+ConstSegBufferIterator::operator-=(size_t numBytes) BOOST_NOEXCEPT
+{
+    it_ -= numBytes;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ConstSegBufferIterator operators.
+inline bool
+operator> (const ConstSegBufferIterator& lhs,
+           const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ > rhs.it_;
+}
+
+inline bool
+operator>=(const ConstSegBufferIterator& lhs,
+           const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ >= rhs.it_;
+}
+
+inline bool
+operator==(const ConstSegBufferIterator& lhs,
+           const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ == rhs.it_;
+}
+
+inline bool
+operator!=(const ConstSegBufferIterator& lhs,
+           const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ != rhs.it_;
+}
+
+inline bool
+operator< (const ConstSegBufferIterator& lhs,
+           const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ < rhs.it_;
+}
+
+inline bool
+operator<=(const ConstSegBufferIterator& lhs,
+           const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ <= rhs.it_;
+}
+
+inline ConstSegBufferIterator
+operator+(const ConstSegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT
+{
+    ConstSegBufferIterator it = lhs;
+    it += numBytes;
+    return it;
+}
+
+inline ConstSegBufferIterator
+operator-(const ConstSegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT
+{
+    ConstSegBufferIterator it = lhs;
+    it -= numBytes;
+    return it;
+}
+
+inline ptrdiff_t
+operator-(const ConstSegBufferIterator& lhs,
+          const ConstSegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    return lhs.it_ - rhs.it_;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // CONST_SEG_BUFFER_ITERATOR_H__F2A75C0E_9D34_4B18_8E6C_5B30D9A12E47
+
@@ -118,6 +118,47 @@ public:
      */
     void ReadB(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
 
+    // Read arrays.
+public:
+    /**
+     * @brief Read an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArray(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT;
+
     // Operators.
 public:
     ConstZcBufferIterator& operator++(void) BOOST_NOEXCEPT;
@@ -260,6 +301,27 @@ ConstZcBufferIterator::ReadB(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
     it_.ReadB(bytes, size);
 }
 
+template<class T>
+inline void
+ConstZcBufferIterator::ReadArray(T* data, size_t n) BOOST_NOEXCEPT
+{
+    it_.ReadArray<T>(data, n);
+}
+
+template<class T>
+inline void
+ConstZcBufferIterator::ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT
+{
+    it_.ReadArrayL<T>(data, n);
+}
+
+template<class T>
+inline void
+ConstZcBufferIterator::ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT
+{
+    it_.ReadArrayB<T>(data, n);
+}
+
 inline ConstZcBufferIterator&
 ConstZcBufferIterator::operator++(void) BOOST_NOEXCEPT
 {
@@ -0,0 +1,182 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef COPY_ELEMENTS_H__E4A17C3B_86D2_4F59_9B0E_72C5D3A18F46
+#define COPY_ELEMENTS_H__E4A17C3B_86D2_4F59_9B0E_72C5D3A18F46
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/utility/endian.h>
+#include <cstring> // memcpy
+#include <type_traits> // integral_constant
+#if defined(__SSSE3__) || defined(__AVX2__)
+# include <immintrin.h>
+#endif // defined(__SSSE3__) || defined(__AVX2__)
+
+
+NSFX_OPEN_NAMESPACE
+
+
+namespace aux {
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CopyElements.
+/**
+ * @brief Copy an array of elements.
+ *
+ * @tparam size The number of bytes of an element.
+ *
+ * @param[out] dst The destination.
+ * @param[in]  src The source.
+ * @param[in]  n   The number of elements.
+ */
+template<size_t size>
+inline void
+CopyElements(uint8_t* dst, const uint8_t* src, size_t n,
+             same_byte_order_t) BOOST_NOEXCEPT
+{
+    if (n)
+    {
+        std::memcpy(dst, src, n * size);
+    }
+}
+
+/**
+ * @brief Copy an array of elements, and reverse the bytes of each element.
+ *
+ * @tparam size The number of bytes of an element.
+ *             It **must** be \c 1, \c 2, \c 4 or \c 8.
+ *
+ * @param[out] dst The destination.
+ * @param[in]  src The source.
+ * @param[in]  n   The number of elements.
+ *
+ * If the compiler targets SSSE3 or AVX2, the bytes are shuffled 16 or 32
+ * bytes at a time via \c pshufb.
+ * The remaining elements are reversed one by one.
+ */
+template<size_t size>
+inline void
+CopyElements(uint8_t* dst, const uint8_t* src, size_t n,
+             reverse_byte_order_t) BOOST_NOEXCEPT;
+
+
+////////////////////////////////////////
+template<size_t size>
+struct ElementTraits;
+
+template<>
+struct ElementTraits<2>
+{
+    typedef uint16_t  type;
+};
+
+template<>
+struct ElementTraits<4>
+{
+    typedef uint32_t  type;
+};
+
+template<>
+struct ElementTraits<8>
+{
+    typedef uint64_t  type;
+};
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+/**
+ * @brief The index of the source byte of the i-th byte in a 16-byte lane,
+ *        when the bytes of each element are reversed.
+ */
+template<size_t size, size_t i>
+struct ReverseIndex :
+    std::integral_constant<char,
+        static_cast<char>(i / size * size + (size - 1 - i % size))>
+{};
+
+/**
+ * @brief The shuffle mask that reverses the bytes of each element
+ *        in a 16-byte lane.
+ */
+template<size_t size>
+inline __m128i
+MakeReverseMask(void) BOOST_NOEXCEPT
+{
+    static_assert(16 % size == 0, "Unsupported size of element.");
+    return _mm_setr_epi8(
+        ReverseIndex<size,  0>::value, ReverseIndex<size,  1>::value,
+        ReverseIndex<size,  2>::value, ReverseIndex<size,  3>::value,
+        ReverseIndex<size,  4>::value, ReverseIndex<size,  5>::value,
+        ReverseIndex<size,  6>::value, ReverseIndex<size,  7>::value,
+        ReverseIndex<size,  8>::value, ReverseIndex<size,  9>::value,
+        ReverseIndex<size, 10>::value, ReverseIndex<size, 11>::value,
+        ReverseIndex<size, 12>::value, ReverseIndex<size, 13>::value,
+        ReverseIndex<size, 14>::value, ReverseIndex<size, 15>::value);
+}
+#endif // defined(__SSSE3__) || defined(__AVX2__)
+
+template<size_t size>
+inline void
+CopyElements(uint8_t* dst, const uint8_t* src, size_t n,
+             reverse_byte_order_t) BOOST_NOEXCEPT
+{
+    typedef typename ElementTraits<size>::type  V;
+    size_t numBytes = n * size;
+    size_t i = 0;
+#if defined(__SSSE3__) || defined(__AVX2__)
+    const __m128i mask = MakeReverseMask<size>();
+# if defined(__AVX2__)
+    const __m256i mask2 = _mm256_broadcastsi128_si256(mask);
+    for (; i + 32 <= numBytes; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_shuffle_epi8(v, mask2));
+    }
+# endif // defined(__AVX2__)
+    for (; i + 16 <= numBytes; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_shuffle_epi8(v, mask));
+    }
+#endif // defined(__SSSE3__) || defined(__AVX2__)
+    for (; i < numBytes; i += size)
+    {
+        V v;
+        std::memcpy(&v, src + i, size);
+        v = ReorderBytes(v);
+        std::memcpy(dst + i, &v, size);
+    }
+}
+
+template<>
+inline void
+CopyElements<1>(uint8_t* dst, const uint8_t* src, size_t n,
+                reverse_byte_order_t) BOOST_NOEXCEPT
+{
+    CopyElements<1>(dst, src, n, same_byte_order_t());
+}
+
+
+} // namespace aux
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // COPY_ELEMENTS_H__E4A17C3B_86D2_4F59_9B0E_72C5D3A18F46
+
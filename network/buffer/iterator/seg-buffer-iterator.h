@@ -0,0 +1,1168 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef SEG_BUFFER_ITERATOR_H__8D1C4F7A_2B63_4E90_B5D7_06A9E3C41F28
+#define SEG_BUFFER_ITERATOR_H__8D1C4F7A_2B63_4E90_B5D7_06A9E3C41F28
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/buffer.h>
+#include <nsfx/network/buffer/iterator/basic-buffer-iterator.h>
+#include <nsfx/network/buffer/iterator/buffer-iterator.h>
+#include <nsfx/utility/endian.h>
+#include <nsfx/utility/type-identity.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BasicSegBufferIterator.
+/**
+ * @ingroup Network
+ * @brief The iterator for accessing segmented buffer data.
+ *
+ * @tparam readOnly Whether the iterator can only read data.
+ */
+template<bool readOnly>
+class BasicSegBufferIterator;
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Network
+ * @brief The iterator for accessing segmented buffer data.
+ *
+ * A specialization of <code>BasicSegBufferIterator<></code>.
+ *
+ * This iterator provides the same set of public interfaces as
+ * \c BufferIterator.
+ * The data that lies within a segment is accessed via a \c BufferIterator
+ * of the segment.
+ * The data that spans two or more segments is assembled byte by byte.
+ *
+ * The cursor is the offset of the byte from the start of the segmented
+ * buffer.
+ */
+template<>
+class BasicSegBufferIterator</*readOnly=*/false>
+{
+public:
+    typedef BasicSegBufferIterator<false>  SegBufferIterator;
+
+    // Xtructors.
+public:
+    BasicSegBufferIterator(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Create an iterator.
+     *
+     * @param[in] segs    The segments.
+     * @param[in] numSegs The number of segments.
+     * @param[in] size    The total size of the segments.
+     * @param[in] cursor  The offset of the iterator.
+     */
+    BasicSegBufferIterator(Buffer* segs, size_t numSegs,
+                           size_t size, size_t cursor) BOOST_NOEXCEPT;
+
+    // Copyable.
+public:
+    BasicSegBufferIterator(const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    BasicSegBufferIterator& operator=(const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+public:
+    size_t GetStart(void) const BOOST_NOEXCEPT;
+    size_t GetEnd(void) const BOOST_NOEXCEPT;
+    size_t GetCursor(void) const BOOST_NOEXCEPT;
+
+    // Move cursor.
+public:
+    /**
+     * @brief Move the iterator toward the end of the data area.
+     */
+    void MoveForward(size_t numBytes) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Move the iterator toward the start of the data area.
+     */
+    void MoveBackward(size_t numBytes) BOOST_NOEXCEPT;
+
+    // Write data.
+public:
+    /**
+     * @brief Write data in native endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    void Write(typename type_identity<T>::type  data) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write data in little endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    void WriteL(typename type_identity<T>::type  data) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write data in big endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    void WriteB(typename type_identity<T>::type  data) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void WriteInOrder(T data, endian_t) BOOST_NOEXCEPT;
+
+    // Write bytes.
+public:
+    /**
+     * @brief Write bytes in native endian order.
+     */
+    void Write(const uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write bytes in little endian order.
+     */
+    void WriteL(const uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write bytes in big endian order.
+     */
+    void WriteB(const uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+private:
+    template<class endian_t>
+    void WriteInOrder(const uint8_t* bytes, size_t size, endian_t) BOOST_NOEXCEPT;
+
+    // Write arrays.
+public:
+    /**
+     * @brief Write an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void WriteArray(const T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void WriteArrayL(const T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void WriteArrayB(const T* data, size_t n) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void WriteArrayInOrder(const T* data, size_t n, endian_t) BOOST_NOEXCEPT;
+
+    // Fill bytes.
+public:
+    /**
+     * @brief Fill.
+     *
+     * @param[in] v    The value used to fill.
+     * @param[in] size The number of bytes to fill.
+     */
+    void Fill(uint8_t v, size_t size) BOOST_NOEXCEPT;
+
+    // Read data.
+public:
+    /**
+     * @brief Read data in native endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    T Read(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read data in little endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    T ReadL(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read data in big endian order.
+     *
+     * @tparam T Must be an integral type.
+     */
+    template<class T>
+    T ReadB(void) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    T ReadInOrder(endian_t) BOOST_NOEXCEPT;
+
+    // Read bytes.
+public:
+    /**
+     * @brief Read bytes in native endian order.
+     */
+    void Read(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read bytes in little endian order.
+     */
+    void ReadL(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read bytes in big endian order.
+     */
+    void ReadB(uint8_t* bytes, size_t size) BOOST_NOEXCEPT;
+
+private:
+    template<class endian_t>
+    void ReadInOrder(uint8_t* bytes, size_t size, endian_t) BOOST_NOEXCEPT;
+
+    // Read arrays.
+public:
+    /**
+     * @brief Read an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void ReadArray(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     * The elements within a segment are copied in bulk.
+     */
+    template<class T>
+    void ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void ReadArrayInOrder(T* data, size_t n, endian_t) BOOST_NOEXCEPT;
+
+    // Access the segment iterators.
+private:
+    /**
+     * @brief Get an iterator of the current segment at the cursor.
+     */
+    BufferIterator GetSegmentIterator(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief The number of bytes from the cursor to the end of the segment.
+     */
+    size_t GetSegmentRemainder(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Move the cursor forward, and skip to the next segment at the
+     *        end of a segment.
+     */
+    void Advance(size_t numBytes) BOOST_NOEXCEPT;
+
+    template<class T>
+    static void WriteTo(BufferIterator& it, T v, native_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static void WriteTo(BufferIterator& it, T v, little_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static void WriteTo(BufferIterator& it, T v, big_endian_t) BOOST_NOEXCEPT;
+
+    template<class T>
+    static T ReadFrom(BufferIterator& it, native_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static T ReadFrom(BufferIterator& it, little_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static T ReadFrom(BufferIterator& it, big_endian_t) BOOST_NOEXCEPT;
+
+    static void WriteTo(BufferIterator& it, const uint8_t* bytes, size_t size, native_endian_t) BOOST_NOEXCEPT;
+    static void WriteTo(BufferIterator& it, const uint8_t* bytes, size_t size, little_endian_t) BOOST_NOEXCEPT;
+    static void WriteTo(BufferIterator& it, const uint8_t* bytes, size_t size, big_endian_t) BOOST_NOEXCEPT;
+
+    static void ReadFrom(BufferIterator& it, uint8_t* bytes, size_t size, native_endian_t) BOOST_NOEXCEPT;
+    static void ReadFrom(BufferIterator& it, uint8_t* bytes, size_t size, little_endian_t) BOOST_NOEXCEPT;
+    static void ReadFrom(BufferIterator& it, uint8_t* bytes, size_t size, big_endian_t) BOOST_NOEXCEPT;
+
+    template<class T>
+    static void WriteArrayTo(BufferIterator& it, const T* data, size_t n, native_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static void WriteArrayTo(BufferIterator& it, const T* data, size_t n, little_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static void WriteArrayTo(BufferIterator& it, const T* data, size_t n, big_endian_t) BOOST_NOEXCEPT;
+
+    template<class T>
+    static void ReadArrayFrom(BufferIterator& it, T* data, size_t n, native_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static void ReadArrayFrom(BufferIterator& it, T* data, size_t n, little_endian_t) BOOST_NOEXCEPT;
+    template<class T>
+    static void ReadArrayFrom(BufferIterator& it, T* data, size_t n, big_endian_t) BOOST_NOEXCEPT;
+
+    // Boundary check.
+private:
+    bool CanMoveForward(size_t numBytes) const BOOST_NOEXCEPT;
+
+    bool CanMoveBackward(size_t numBytes) const BOOST_NOEXCEPT;
+
+    void ForwardCheck(size_t numBytes) const BOOST_NOEXCEPT;
+
+    void BackwardCheck(size_t numBytes) const BOOST_NOEXCEPT;
+
+    void WritableCheck(size_t numBytes) const BOOST_NOEXCEPT;
+
+    void ReadableCheck(size_t numBytes) const BOOST_NOEXCEPT;
+
+    // Operators.
+public:
+    SegBufferIterator& operator++(void) BOOST_NOEXCEPT;
+    SegBufferIterator  operator++(int) BOOST_NOEXCEPT;
+    SegBufferIterator& operator--(void) BOOST_NOEXCEPT;
+    SegBufferIterator  operator--(int) BOOST_NOEXCEPT;
+    SegBufferIterator& operator+=(size_t numBytes) BOOST_NOEXCEPT;
+    SegBufferIterator& operator-=(size_t numBytes) BOOST_NOEXCEPT;
+
+    friend bool operator> (const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator>=(const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator==(const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator!=(const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator< (const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+    friend bool operator<=(const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+    friend SegBufferIterator operator+(const SegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT;
+    friend SegBufferIterator operator-(const SegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT;
+    friend ptrdiff_t operator-(const SegBufferIterator& lhs, const SegBufferIterator& rhs) BOOST_NOEXCEPT;
+
+private:
+    /**
+     * @brief The segments.
+     */
+    Buffer* segs_;
+
+    /**
+     * @brief The number of segments.
+     */
+    size_t numSegs_;
+
+    /**
+     * @brief The total size of the segments.
+     */
+    size_t size_;
+
+    /**
+     * @brief The index of the segment at the cursor.
+     *
+     * It is \c numSegs_ if the cursor is at the end of the data.
+     */
+    size_t index_;
+
+    /**
+     * @brief The offset of the cursor within the segment.
+     */
+    size_t offset_;
+
+    /**
+     * @brief The offset of the cursor from the start of the data.
+     */
+    size_t cursor_;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Typedefs.
+typedef BasicSegBufferIterator</*readOnly=*/false>  SegBufferIterator;
+
+template<>
+struct is_buffer_iterator<SegBufferIterator> : std::true_type {};
+
+template<>
+struct is_writable_buffer_iterator<SegBufferIterator> : std::true_type {};
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline SegBufferIterator::BasicSegBufferIterator(void) BOOST_NOEXCEPT :
+    segs_(nullptr),
+    numSegs_(0),
+    size_(0),
+    index_(0),
+    offset_(0),
+    cursor_(0)
+{
+}
+
+inline SegBufferIterator::BasicSegBufferIterator(Buffer* segs,
+                                                 size_t numSegs,
+                                                 size_t size,
+                                                 size_t cursor) BOOST_NOEXCEPT :
+    segs_(segs),
+    numSegs_(numSegs),
+    size_(size),
+    index_(0),
+    offset_(0),
+    cursor_(0)
+{
+    BOOST_ASSERT(cursor <= size);
+    MoveForward(cursor);
+}
+
+inline SegBufferIterator::BasicSegBufferIterator(const SegBufferIterator& rhs) BOOST_NOEXCEPT :
+    segs_(rhs.segs_),
+    numSegs_(rhs.numSegs_),
+    size_(rhs.size_),
+    index_(rhs.index_),
+    offset_(rhs.offset_),
+    cursor_(rhs.cursor_)
+{
+}
+
+inline SegBufferIterator&
+SegBufferIterator::operator=(const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        segs_    = rhs.segs_;
+        numSegs_ = rhs.numSegs_;
+        size_    = rhs.size_;
+        index_   = rhs.index_;
+        offset_  = rhs.offset_;
+        cursor_  = rhs.cursor_;
+    }
+    return *this;
+}
+
+inline size_t
+SegBufferIterator::GetStart(void) const BOOST_NOEXCEPT
+{
+    return 0;
+}
+
+inline size_t
+SegBufferIterator::GetEnd(void) const BOOST_NOEXCEPT
+{
+    return size_;
+}
+
+inline size_t
+SegBufferIterator::GetCursor(void) const BOOST_NOEXCEPT
+{
+    return cursor_;
+}
+
+inline void
+SegBufferIterator::MoveForward(size_t numBytes) BOOST_NOEXCEPT
+{
+    ForwardCheck(numBytes);
+    while (numBytes)
+    {
+        size_t n = GetSegmentRemainder();
+        if (n > numBytes)
+        {
+            n = numBytes;
+        }
+        Advance(n);
+        numBytes -= n;
+    }
+}
+
+inline void
+SegBufferIterator::MoveBackward(size_t numBytes) BOOST_NOEXCEPT
+{
+    BackwardCheck(numBytes);
+    cursor_ -= numBytes;
+    while (numBytes > offset_)
+    {
+        numBytes -= offset_;
+        --index_;
+        offset_ = segs_[index_].GetSize();
+    }
+    offset_ -= numBytes;
+}
+
+template<class T>
+inline void
+SegBufferIterator::Write(typename type_identity<T>::type data) BOOST_NOEXCEPT
+{
+    WriteInOrder<T>(data, native_endian);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteL(typename type_identity<T>::type data) BOOST_NOEXCEPT
+{
+    WriteInOrder<T>(data, little_endian);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteB(typename type_identity<T>::type data) BOOST_NOEXCEPT
+{
+    WriteInOrder<T>(data, big_endian);
+}
+
+template<class T, class endian_t>
+inline void
+SegBufferIterator::WriteInOrder(T data, endian_t) BOOST_NOEXCEPT
+{
+    WritableCheck(sizeof (T));
+    if (sizeof (T) <= GetSegmentRemainder())
+    {
+        BufferIterator it = GetSegmentIterator();
+        WriteTo<T>(it, data, endian_t());
+        Advance(sizeof (T));
+    }
+    // The data spans two or more segments.
+    else
+    {
+        uint8_t bytes[sizeof (T)];
+        BufferIterator it(bytes, 0, sizeof (T), 0);
+        WriteTo<T>(it, data, endian_t());
+        Write(bytes, sizeof (T));
+    }
+}
+
+inline void
+SegBufferIterator::Write(const uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    WriteInOrder(bytes, size, native_endian);
+}
+
+inline void
+SegBufferIterator::WriteL(const uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    WriteInOrder(bytes, size, little_endian);
+}
+
+inline void
+SegBufferIterator::WriteB(const uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    WriteInOrder(bytes, size, big_endian);
+}
+
+template<class endian_t>
+inline void
+SegBufferIterator::WriteInOrder(const uint8_t* bytes, size_t size, endian_t) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT(bytes);
+    WritableCheck(size);
+    while (size)
+    {
+        size_t n = GetSegmentRemainder();
+        if (n > size)
+        {
+            n = size;
+        }
+        BufferIterator it = GetSegmentIterator();
+        if (endian_traits<endian_t>::is_native)
+        {
+            WriteTo(it, bytes, n, endian_t());
+            bytes += n;
+        }
+        // The segment receives the last bytes in reverse order.
+        else
+        {
+            WriteTo(it, bytes + size - n, n, endian_t());
+        }
+        Advance(n);
+        size -= n;
+    }
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteArray(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, native_endian);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteArrayL(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, little_endian);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteArrayB(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, big_endian);
+}
+
+template<class T, class endian_t>
+inline void
+SegBufferIterator::WriteArrayInOrder(const T* data, size_t n, endian_t) BOOST_NOEXCEPT
+{
+    static_assert(std::is_integral<T>::value ||
+                  std::is_floating_point<T>::value,
+                  "Invalid data type.");
+    BOOST_ASSERT(data || !n);
+    WritableCheck(n * sizeof (T));
+    while (n)
+    {
+        size_t m = GetSegmentRemainder() / sizeof (T);
+        if (m)
+        {
+            if (m > n)
+            {
+                m = n;
+            }
+            BufferIterator it = GetSegmentIterator();
+            WriteArrayTo<T>(it, data, m, endian_t());
+            Advance(m * sizeof (T));
+            data += m;
+            n -= m;
+        }
+        // The element spans two or more segments.
+        else
+        {
+            WriteInOrder<T>(*data, endian_t());
+            ++data;
+            --n;
+        }
+    }
+}
+
+inline void
+SegBufferIterator::Fill(uint8_t v, size_t size) BOOST_NOEXCEPT
+{
+    WritableCheck(size);
+    while (size)
+    {
+        size_t n = GetSegmentRemainder();
+        if (n > size)
+        {
+            n = size;
+        }
+        BufferIterator it = GetSegmentIterator();
+        it.Fill(v, n);
+        Advance(n);
+        size -= n;
+    }
+}
+
+template<class T>
+inline T
+SegBufferIterator::Read(void) BOOST_NOEXCEPT
+{
+    return ReadInOrder<T>(native_endian);
+}
+
+template<class T>
+inline T
+SegBufferIterator::ReadL(void) BOOST_NOEXCEPT
+{
+    return ReadInOrder<T>(little_endian);
+}
+
+template<class T>
+inline T
+SegBufferIterator::ReadB(void) BOOST_NOEXCEPT
+{
+    return ReadInOrder<T>(big_endian);
+}
+
+template<class T, class endian_t>
+inline T
+SegBufferIterator::ReadInOrder(endian_t) BOOST_NOEXCEPT
+{
+    ReadableCheck(sizeof (T));
+    if (sizeof (T) <= GetSegmentRemainder())
+    {
+        BufferIterator it = GetSegmentIterator();
+        T data = ReadFrom<T>(it, endian_t());
+        Advance(sizeof (T));
+        return data;
+    }
+    // The data spans two or more segments.
+    else
+    {
+        uint8_t bytes[sizeof (T)];
+        Read(bytes, sizeof (T));
+        BufferIterator it(bytes, 0, sizeof (T), 0);
+        return ReadFrom<T>(it, endian_t());
+    }
+}
+
+inline void
+SegBufferIterator::Read(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    ReadInOrder(bytes, size, native_endian);
+}
+
+inline void
+SegBufferIterator::ReadL(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    ReadInOrder(bytes, size, little_endian);
+}
+
+inline void
+SegBufferIterator::ReadB(uint8_t* bytes, size_t size) BOOST_NOEXCEPT
+{
+    ReadInOrder(bytes, size, big_endian);
+}
+
+template<class endian_t>
+inline void
+SegBufferIterator::ReadInOrder(uint8_t* bytes, size_t size, endian_t) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT(bytes);
+    ReadableCheck(size);
+    while (size)
+    {
+        size_t n = GetSegmentRemainder();
+        if (n > size)
+        {
+            n = size;
+        }
+        BufferIterator it = GetSegmentIterator();
+        if (endian_traits<endian_t>::is_native)
+        {
+            ReadFrom(it, bytes, n, endian_t());
+            bytes += n;
+        }
+        // The segment provides the last bytes in reverse order.
+        else
+        {
+            ReadFrom(it, bytes + size - n, n, endian_t());
+        }
+        Advance(n);
+        size -= n;
+    }
+}
+
+template<class T>
+inline void
+SegBufferIterator::ReadArray(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, native_endian);
+}
+
+template<class T>
+inline void
+SegBufferIterator::ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, little_endian);
+}
+
+template<class T>
+inline void
+SegBufferIterator::ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, big_endian);
+}
+
+template<class T, class endian_t>
+inline void
+SegBufferIterator::ReadArrayInOrder(T* data, size_t n, endian_t) BOOST_NOEXCEPT
+{
+    static_assert(std::is_integral<T>::value ||
+                  std::is_floating_point<T>::value,
+                  "Invalid data type.");
+    BOOST_ASSERT(data || !n);
+    ReadableCheck(n * sizeof (T));
+    while (n)
+    {
+        size_t m = GetSegmentRemainder() / sizeof (T);
+        if (m)
+        {
+            if (m > n)
+            {
+                m = n;
+            }
+            BufferIterator it = GetSegmentIterator();
+            ReadArrayFrom<T>(it, data, m, endian_t());
+            Advance(m * sizeof (T));
+            data += m;
+            n -= m;
+        }
+        // The element spans two or more segments.
+        else
+        {
+            *data++ = ReadInOrder<T>(endian_t());
+            --n;
+        }
+    }
+}
+
+inline BufferIterator
+SegBufferIterator::GetSegmentIterator(void) const BOOST_NOEXCEPT
+{
+    BOOST_ASSERT(index_ < numSegs_);
+    BufferIterator it = segs_[index_].begin();
+    it += offset_;
+    return it;
+}
+
+inline size_t
+SegBufferIterator::GetSegmentRemainder(void) const BOOST_NOEXCEPT
+{
+    return index_ < numSegs_ ? segs_[index_].GetSize() - offset_ : 0;
+}
+
+inline void
+SegBufferIterator::Advance(size_t numBytes) BOOST_NOEXCEPT
+{
+    offset_ += numBytes;
+    cursor_ += numBytes;
+    if (offset_ == segs_[index_].GetSize())
+    {
+        ++index_;
+        offset_ = 0;
+    }
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteTo(BufferIterator& it, T v, native_endian_t) BOOST_NOEXCEPT
+{
+    it.Write<T>(v);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteTo(BufferIterator& it, T v, little_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteL<T>(v);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteTo(BufferIterator& it, T v, big_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteB<T>(v);
+}
+
+template<class T>
+inline T
+SegBufferIterator::ReadFrom(BufferIterator& it, native_endian_t) BOOST_NOEXCEPT
+{
+    return it.Read<T>();
+}
+
+template<class T>
+inline T
+SegBufferIterator::ReadFrom(BufferIterator& it, little_endian_t) BOOST_NOEXCEPT
+{
+    return it.ReadL<T>();
+}
+
+template<class T>
+inline T
+SegBufferIterator::ReadFrom(BufferIterator& it, big_endian_t) BOOST_NOEXCEPT
+{
+    return it.ReadB<T>();
+}
+
+inline void
+SegBufferIterator::WriteTo(BufferIterator& it, const uint8_t* bytes, size_t size, native_endian_t) BOOST_NOEXCEPT
+{
+    it.Write(bytes, size);
+}
+
+inline void
+SegBufferIterator::WriteTo(BufferIterator& it, const uint8_t* bytes, size_t size, little_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteL(bytes, size);
+}
+
+inline void
+SegBufferIterator::WriteTo(BufferIterator& it, const uint8_t* bytes, size_t size, big_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteB(bytes, size);
+}
+
+inline void
+SegBufferIterator::ReadFrom(BufferIterator& it, uint8_t* bytes, size_t size, native_endian_t) BOOST_NOEXCEPT
+{
+    it.Read(bytes, size);
+}
+
+inline void
+SegBufferIterator::ReadFrom(BufferIterator& it, uint8_t* bytes, size_t size, little_endian_t) BOOST_NOEXCEPT
+{
+    it.ReadL(bytes, size);
+}
+
+inline void
+SegBufferIterator::ReadFrom(BufferIterator& it, uint8_t* bytes, size_t size, big_endian_t) BOOST_NOEXCEPT
+{
+    it.ReadB(bytes, size);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteArrayTo(BufferIterator& it, const T* data, size_t n, native_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteArray<T>(data, n);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteArrayTo(BufferIterator& it, const T* data, size_t n, little_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteArrayL<T>(data, n);
+}
+
+template<class T>
+inline void
+SegBufferIterator::WriteArrayTo(BufferIterator& it, const T* data, size_t n, big_endian_t) BOOST_NOEXCEPT
+{
+    it.WriteArrayB<T>(data, n);
+}
+
+template<class T>
+inline void
+SegBufferIterator::ReadArrayFrom(BufferIterator& it, T* data, size_t n, native_endian_t) BOOST_NOEXCEPT
+{
+    it.ReadArray<T>(data, n);
+}
+
+template<class T>
+inline void
+SegBufferIterator::ReadArrayFrom(BufferIterator& it, T* data, size_t n, little_endian_t) BOOST_NOEXCEPT
+{
+    it.ReadArrayL<T>(data, n);
+}
+
+template<class T>
+inline void
+SegBufferIterator::ReadArrayFrom(BufferIterator& it, T* data, size_t n, big_endian_t) BOOST_NOEXCEPT
+{
+    it.ReadArrayB<T>(data, n);
+}
+
+inline bool
+SegBufferIterator::CanMoveForward(size_t numBytes) const BOOST_NOEXCEPT
+{
+    return cursor_ + numBytes <= size_;
+}
+
+inline bool
+SegBufferIterator::CanMoveBackward(size_t numBytes) const BOOST_NOEXCEPT
+{
+    return cursor_ >= numBytes;
+}
+
+inline void
+SegBufferIterator::ForwardCheck(size_t numBytes) const BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(CanMoveForward(numBytes),
+                     "The buffer iterator cannot move beyond the end of buffer.");
+}
+
+inline void
+SegBufferIterator::BackwardCheck(size_t numBytes) const BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(CanMoveBackward(numBytes),
+                     "The buffer iterator cannot move beyond the start of buffer.");
+}
+
+inline void
+SegBufferIterator::WritableCheck(size_t numBytes) const BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(CanMoveForward(numBytes),
+                     "The buffer iterator cannot write beyond the end of buffer.");
+}
+
+inline void
+SegBufferIterator::ReadableCheck(size_t numBytes) const BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(CanMoveForward(numBytes),
+                     "The buffer iterator cannot read beyond the end of buffer.");
+}
+
+inline SegBufferIterator&
+SegBufferIterator::operator++(void) BOOST_NOEXCEPT
+{
+    MoveForward(1);
+    return *this;
+}
+
+inline SegBufferIterator
+SegBufferIterator::operator++(int) BOOST_NOEXCEPT
+{
+    BasicSegBufferIterator it = *this;
+    MoveForward(1);
+    return it;
+}
+
+inline SegBufferIterator&
+SegBufferIterator::operator--(void) BOOST_NOEXCEPT
+{
+    MoveBackward(1);
+    return *this;
+}
+
+inline SegBufferIterator
+SegBufferIterator::operator--(int) BOOST_NOEXCEPT
+{
+    BasicSegBufferIterator it = *this;
+    MoveBackward(1);
+    return it;
+}
+
+inline SegBufferIterator&
+SegBufferIterator::operator+=(size_t numBytes) BOOST_NOEXCEPT
+{
+    MoveForward(numBytes);
+    return *this;
+}
+
+inline SegBufferIterator&
+SegBufferIterator::operator-=(size_t numBytes) BOOST_NOEXCEPT
+{
+    MoveBackward(numBytes);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SegBufferIterator operators.
+inline bool
+operator> (const SegBufferIterator& lhs,
+           const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ > rhs.cursor_;
+}
+
+inline bool
+operator>=(const SegBufferIterator& lhs,
+           const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ >= rhs.cursor_;
+}
+
+inline bool
+operator==(const SegBufferIterator& lhs,
+           const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ == rhs.cursor_;
+}
+
+inline bool
+operator!=(const SegBufferIterator& lhs,
+           const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ != rhs.cursor_;
+}
+
+inline bool
+operator< (const SegBufferIterator& lhs,
+           const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ < rhs.cursor_;
+}
+
+inline bool
+operator<=(const SegBufferIterator& lhs,
+           const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ <= rhs.cursor_;
+}
+
+inline SegBufferIterator
+operator+(const SegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT
+{
+    SegBufferIterator it = lhs;
+    it.MoveForward(numBytes);
+    return it;
+}
+
+inline SegBufferIterator
+operator-(const SegBufferIterator& lhs, size_t numBytes) BOOST_NOEXCEPT
+{
+    SegBufferIterator it = lhs;
+    it.MoveBackward(numBytes);
+    return it;
+}
+
+inline ptrdiff_t
+operator-(const SegBufferIterator& lhs,
+          const SegBufferIterator& rhs) BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(lhs.segs_ == rhs.segs_,
+                     "Cannot compare unrelated buffer iterators.");
+    return lhs.cursor_ - rhs.cursor_;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // SEG_BUFFER_ITERATOR_H__8D1C4F7A_2B63_4E90_B5D7_06A9E3C41F28
+
@@ -19,6 +19,7 @@
 
 #include <nsfx/network/config.h>
 #include <nsfx/network/buffer/iterator/basic-buffer-iterator.h>
+#include <nsfx/network/buffer/iterator/copy-elements.h>
 #include <nsfx/utility/endian.h>
 #include <nsfx/utility/type-identity.h>
 #include <type_traits> // is_integral, is_floating_point, make_unsigned
@@ -314,6 +315,96 @@ private:
     void InternalRead(uint8_t* bytes, size_t size, CrossZeroAreaTag, KeepEndianTag) BOOST_NOEXCEPT;
     void InternalRead(uint8_t* bytes, size_t size, CrossZeroAreaTag, ReverseEndianTag) BOOST_NOEXCEPT;
 
+    // Write arrays.
+public:
+    /**
+     * @brief Write an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void WriteArray(const T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void WriteArrayL(const T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Write an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[in] data The array.
+     * @param[in] n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void WriteArrayB(const T* data, size_t n) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void WriteArrayInOrder(const T* data, size_t n, endian_t) BOOST_NOEXCEPT;
+
+    // Read arrays.
+public:
+    /**
+     * @brief Read an array of data in native endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArray(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in little endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Read an array of data in big endian order.
+     *
+     * @tparam T Must be an integral or floating point type.
+     *
+     * @param[out] data The array.
+     * @param[in]  n    The number of elements.
+     *
+     * The boundary is checked once for the whole array.
+     */
+    template<class T>
+    void ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT;
+
+private:
+    template<class T, class endian_t>
+    void ReadArrayInOrder(T* data, size_t n, endian_t) BOOST_NOEXCEPT;
+
     // Boundary check.
 private:
     bool CanMoveForward(size_t numBytes) const BOOST_NOEXCEPT;
@@ -1350,6 +1441,105 @@ ZcBufferIterator::InternalRead(uint8_t* bytes, size_t size, CrossZeroAreaTag, Re
     }
 }
 
+template<class T>
+inline void
+ZcBufferIterator::WriteArray(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, native_endian);
+}
+
+template<class T>
+inline void
+ZcBufferIterator::WriteArrayL(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, little_endian);
+}
+
+template<class T>
+inline void
+ZcBufferIterator::WriteArrayB(const T* data, size_t n) BOOST_NOEXCEPT
+{
+    WriteArrayInOrder<T>(data, n, big_endian);
+}
+
+template<class T>
+inline void
+ZcBufferIterator::ReadArray(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, native_endian);
+}
+
+template<class T>
+inline void
+ZcBufferIterator::ReadArrayL(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, little_endian);
+}
+
+template<class T>
+inline void
+ZcBufferIterator::ReadArrayB(T* data, size_t n) BOOST_NOEXCEPT
+{
+    ReadArrayInOrder<T>(data, n, big_endian);
+}
+
+template<class T, class endian_t>
+inline void
+ZcBufferIterator::WriteArrayInOrder(const T* data, size_t n, endian_t) BOOST_NOEXCEPT
+{
+    static_assert(std::is_integral<T>::value ||
+                  std::is_floating_point<T>::value,
+                  "Invalid data type.");
+    BOOST_ASSERT(data || !n);
+    WritableCheck(n * sizeof (T));
+    typedef typename byte_order_f<endian_t>::type  O;
+    aux::CopyElements<sizeof (T)>(bytes_ + CursorToOffset(),
+                                  reinterpret_cast<const uint8_t*>(data),
+                                  n, O());
+    cursor_ += n * sizeof (T);
+}
+
+template<class T, class endian_t>
+inline void
+ZcBufferIterator::ReadArrayInOrder(T* data, size_t n, endian_t) BOOST_NOEXCEPT
+{
+    static_assert(std::is_integral<T>::value ||
+                  std::is_floating_point<T>::value,
+                  "Invalid data type.");
+    BOOST_ASSERT(data || !n);
+    size_t size = n * sizeof (T);
+    ReadableCheck(size);
+    typedef typename byte_order_f<endian_t>::type  O;
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(data);
+    // Read in header area.
+    if (cursor_ + size <= zeroStart_)
+    {
+        aux::CopyElements<sizeof (T)>(bytes, bytes_ + cursor_, n, O());
+        cursor_ += size;
+    }
+    // Read in trailer area.
+    else if (zeroEnd_ <= cursor_)
+    {
+        aux::CopyElements<sizeof (T)>(
+            bytes, bytes_ + cursor_ - (zeroEnd_ - zeroStart_), n, O());
+        cursor_ += size;
+    }
+    // Read in zero-compressed area.
+    else if (zeroStart_ <= cursor_ && cursor_ + size <= zeroEnd_)
+    {
+        std::memset(bytes, 0, size);
+        cursor_ += size;
+    }
+    // Read across zero-compressed area.
+    else
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            data[i] = ReadInOrder<T>(endian_t());
+        }
+    }
+}
+
 inline bool
 ZcBufferIterator::CanMoveForward(size_t numBytes) const BOOST_NOEXCEPT
 {
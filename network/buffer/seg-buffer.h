@@ -0,0 +1,872 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef SEG_BUFFER_H__A47E2D19_6C85_4F3B_9B20_E8D5C1367A0F
+#define SEG_BUFFER_H__A47E2D19_6C85_4F3B_9B20_E8D5C1367A0F
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/buffer.h>
+#include <nsfx/network/buffer/const-buffer.h>
+#include <nsfx/network/buffer/storage/seg-buffer-storage.h>
+#include <nsfx/network/buffer/iterator/seg-buffer-iterator.h>
+#include <nsfx/network/buffer/iterator/const-seg-buffer-iterator.h>
+#include <boost/core/swap.hpp>
+#include <utility> // move
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BasicSegBuffer.
+/**
+ * @ingroup Network
+ * @brief A buffer that consists of a chain of segments.
+ *
+ * @tparam readOnly Whether the buffer can only be read.
+ */
+template<bool readOnly>
+class BasicSegBuffer;
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Network
+ * @brief A resizable buffer that consists of a chain of segments.
+ *
+ * This is a specialization of <code>BasicSegBuffer<></code>.
+ *
+ * \c SegBuffer provides the same set of public interfaces as \c Buffer that
+ * are used by \c Packet, so \c Packet can use \c SegBuffer instead of
+ * \c Buffer.
+ *
+ * Each segment is a \c Buffer, i.e., a slice of a reference counted
+ * storage.
+ * A segmented buffer is concatenated to another one by sharing its segments,
+ * and a fragment of a segmented buffer shares the segments of the buffer.
+ * Thus, concatenation and fragmentation never copy the data.
+ *
+ * When a header (trailer) is added, and the first (last) segment has enough
+ * unused space that is not shared with other buffers, the segment is
+ * expanded.
+ * Otherwise, a new segment is prepended (appended).
+ *
+ * The chain of segments is shared by the copies of a buffer, and it is
+ * copied when a buffer that shares the chain is resized.
+ */
+template<>
+class BasicSegBuffer</*readOnly*/false>
+{
+public:
+    typedef BasicSegBuffer<false>   SegBuffer;
+    typedef BasicSegBuffer<true>    ConstSegBuffer;
+    typedef SegBufferIterator       iterator;
+    typedef ConstSegBufferIterator  const_iterator;
+
+    /**
+     * @brief The unused space of a new segment.
+     *
+     * When a new segment is allocated to hold a header (trailer), it reserves
+     * space for the headers (trailers) that are added later.
+     */
+    BOOST_STATIC_CONSTANT(size_t, SEGMENT_RESERVE = 64);
+
+    // Xtructors.
+public:
+    /**
+     * @brief Create an empty buffer.
+     */
+    BasicSegBuffer(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Create a buffer.
+     *
+     * @param[in] capacity The initial capacity of the buffer.
+     */
+    explicit BasicSegBuffer(size_t capacity);
+
+    /**
+     * @brief Create a buffer.
+     *
+     * @param[in] startSize The size of reserved space at the start of the buffer.
+     * @param[in] zeroSize  The size of the zero data.
+     */
+    BasicSegBuffer(size_t startSize, size_t zeroSize);
+
+    /**
+     * @brief Create a buffer.
+     *
+     * @param[in] startSize The size of reserved space at the start of the buffer.
+     * @param[in] zeroSize  The size of the zero data.
+     * @param[in] endSize   The size of reserved space at the end of the buffer.
+     */
+    BasicSegBuffer(size_t startSize, size_t zeroSize, size_t endSize);
+
+    /**
+     * @brief Create a buffer that consists of a single segment.
+     *
+     * @param[in] segment The segment is shared by the buffer.
+     */
+    explicit BasicSegBuffer(const Buffer& segment);
+
+private:
+    /**
+     * @brief Create a buffer.
+     *
+     * @param[in] storage  The reference count is taken by the buffer.
+     *
+     * @internal
+     */
+    explicit BasicSegBuffer(SegBufferStorage* storage) BOOST_NOEXCEPT;
+
+public:
+    ~BasicSegBuffer(void) BOOST_NOEXCEPT;
+
+    // Copyable.
+public:
+    /**
+     * @brief Make a shallow copy of the buffer.
+     */
+    BasicSegBuffer(const SegBuffer& rhs) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Make a shallow copy of the buffer.
+     */
+    SegBuffer& operator=(const SegBuffer& rhs) BOOST_NOEXCEPT;
+
+    // Movable.
+public:
+    /**
+     * @brief Move a buffer.
+     */
+    BasicSegBuffer(SegBuffer&& rhs) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Move a buffer.
+     */
+    SegBuffer& operator=(SegBuffer&& rhs) BOOST_NOEXCEPT;
+
+    // Acquire/release the chain.
+private:
+    void Acquire(void) BOOST_NOEXCEPT;
+
+    void Release(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Make the chain private to the buffer, and make room for
+     *        the specified number of segments.
+     */
+    void Reserve(size_t numSegs);
+
+    // Methods.
+public:
+    /**
+     * @brief Get the size of the represented data.
+     */
+    size_t GetSize(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the number of segments.
+     */
+    size_t GetNumSegments(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get a segment.
+     */
+    ConstBuffer GetSegment(size_t index) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Copy data to a memory block.
+     * @return The number of bytes copied.
+     */
+    size_t CopyTo(uint8_t* dst, size_t size) const BOOST_NOEXCEPT;
+
+    // Add/remove.
+public:
+    /**
+     * @brief Expand the buffer toward the start.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtStart(size_t size);
+
+    /**
+     * @brief Expand the buffer and copy the specified contents.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtStart(const uint8_t* src, size_t size);
+
+    /**
+     * @brief Prepend the segments of a buffer.
+     *
+     * @param[in] src The buffer itself can be passed in as \c src.
+     *
+     * The data is not copied.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtStart(const SegBuffer& src);
+
+    /**
+     * @brief Prepend the segments of a buffer.
+     *
+     * The data is not copied.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtStart(const ConstSegBuffer& src);
+
+    /**
+     * @brief Prepend a buffer.
+     *
+     * A \c Buffer is shared as a segment, and the other buffers are copied.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    template<bool readOnly, bool copyOnResize, bool zeroArea>
+    void AddAtStart(const BasicBuffer<readOnly, copyOnResize, zeroArea>& src);
+
+    /**
+     * @brief Expand the data area toward the end of the buffer.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtEnd(size_t size);
+
+    /**
+     * @brief Expand the buffer and copy the specified contents.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtEnd(const uint8_t* src, size_t size);
+
+    /**
+     * @brief Append the segments of a buffer.
+     *
+     * @param[in] src The buffer itself can be passed in as \c src.
+     *
+     * The data is not copied.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtEnd(const SegBuffer& src);
+
+    /**
+     * @brief Append the segments of a buffer.
+     *
+     * The data is not copied.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void AddAtEnd(const ConstSegBuffer& src);
+
+    /**
+     * @brief Append a buffer.
+     *
+     * A \c Buffer is shared as a segment, and the other buffers are copied.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    template<bool readOnly, bool copyOnResize, bool zeroArea>
+    void AddAtEnd(const BasicBuffer<readOnly, copyOnResize, zeroArea>& src);
+
+    /**
+     * @brief Shrink the buffer from the start.
+     *
+     * @param[in] size The number of bytes to remove.
+     *                 <p>
+     *                 If it is no less than the size of the buffer, the buffer
+     *                 becomes empty.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void RemoveAtStart(size_t size);
+
+    /**
+     * @brief Shrink the buffer from the end.
+     *
+     * @param[in] size The number of bytes to remove.
+     *                 <p>
+     *                 If it is no less than the size of the buffer, the buffer
+     *                 becomes empty.
+     *
+     * @remarks Invalidates existing iterators of the buffer.
+     */
+    void RemoveAtEnd(size_t size);
+
+private:
+    /**
+     * @brief Insert the segments of a chain.
+     */
+    void Splice(size_t pos, const SegBufferStorage* src);
+
+    /**
+     * @brief Insert a segment.
+     */
+    void Splice(size_t pos, const Buffer& segment);
+
+    /**
+     * @brief Can the segment grow toward the start without a reallocation?
+     */
+    static bool CanAddAtStart(const Buffer& segment, size_t size) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Can the segment grow toward the end without a reallocation?
+     */
+    static bool CanAddAtEnd(const Buffer& segment, size_t size) BOOST_NOEXCEPT;
+
+    // Fragmentation.
+public:
+    /**
+     * @brief Make a fragment of the buffer.
+     *
+     * @param[in] start The start of the fragment.
+     * @param[in] size  The size of the fragment.
+     *
+     * The fragment shares the segments of the buffer.
+     */
+    SegBuffer MakeFragment(size_t start, size_t size) const;
+
+    // Linearization.
+public:
+    /**
+     * @brief Make a continuous buffer.
+     *
+     * If the buffer consists of a single segment, the segment is returned.
+     * Otherwise, the data is copied to a new buffer.
+     */
+    Buffer MakeRealBuffer(void) const;
+
+    // Iterator.
+public:
+    /**
+     * @brief Get an iterator that points to the first byte of the data.
+     */
+    SegBufferIterator begin(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get an iterator that points one byte after the last byte of the data area.
+     */
+    SegBufferIterator end(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get a const iterator that points to the first byte of the data.
+     */
+    ConstSegBufferIterator cbegin(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get a const iterator that points one byte after the last byte of the data area.
+     */
+    ConstSegBufferIterator cend(void) const BOOST_NOEXCEPT;
+
+    // Swappable.
+public:
+    void swap(SegBuffer& rhs) BOOST_NOEXCEPT;
+
+    // Properties.
+private:
+    friend class BasicSegBuffer</*readOnly*/true>;
+
+    /**
+     * @brief The chain of segments.
+     */
+    SegBufferStorage* storage_;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Typedef.
+typedef BasicSegBuffer</*readOnly*/false>  SegBuffer;
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SegBuffer.
+inline SegBuffer::BasicSegBuffer(void) BOOST_NOEXCEPT :
+    storage_(nullptr)
+{
+}
+
+inline SegBuffer::BasicSegBuffer(size_t capacity) :
+    storage_(nullptr)
+{
+    Splice(0, Buffer(capacity));
+}
+
+inline SegBuffer::BasicSegBuffer(size_t startSize, size_t zeroSize) :
+    storage_(nullptr)
+{
+    Splice(0, Buffer(startSize, zeroSize));
+}
+
+inline SegBuffer::BasicSegBuffer(size_t startSize, size_t zeroSize, size_t endSize) :
+    storage_(nullptr)
+{
+    Splice(0, Buffer(startSize, zeroSize, endSize));
+}
+
+inline SegBuffer::BasicSegBuffer(const Buffer& segment) :
+    storage_(nullptr)
+{
+    Splice(0, segment);
+}
+
+inline SegBuffer::BasicSegBuffer(SegBufferStorage* storage) BOOST_NOEXCEPT :
+    storage_(storage)
+{
+}
+
+inline SegBuffer::~BasicSegBuffer(void) BOOST_NOEXCEPT
+{
+    Release();
+}
+
+inline SegBuffer::BasicSegBuffer(const SegBuffer& rhs) BOOST_NOEXCEPT :
+    storage_(rhs.storage_)
+{
+    Acquire();
+}
+
+inline SegBuffer& SegBuffer::operator=(const SegBuffer& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        SegBufferStorage* tmp = storage_;
+        storage_ = rhs.storage_;
+        Acquire();
+        if (tmp)
+        {
+            SegBufferStorage::Release(tmp);
+        }
+    }
+    return *this;
+}
+
+inline SegBuffer::BasicSegBuffer(SegBuffer&& rhs) BOOST_NOEXCEPT :
+    storage_(rhs.storage_)
+{
+    rhs.storage_ = nullptr;
+}
+
+inline SegBuffer& SegBuffer::operator=(SegBuffer&& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        swap(rhs);
+        rhs.Release();
+    }
+    return *this;
+}
+
+inline void SegBuffer::Acquire(void) BOOST_NOEXCEPT
+{
+    if (storage_)
+    {
+        SegBufferStorage::AddRef(storage_);
+    }
+}
+
+inline void SegBuffer::Release(void) BOOST_NOEXCEPT
+{
+    if (storage_)
+    {
+        SegBufferStorage* tmp = storage_;
+        storage_ = nullptr;
+        SegBufferStorage::Release(tmp);
+    }
+}
+
+inline void SegBuffer::Reserve(size_t numSegs)
+{
+    if (!storage_)
+    {
+        storage_ = SegBufferStorage::Allocate(numSegs > 4 ? numSegs : 4);
+        return;
+    }
+    size_t required = storage_->numSegs_ + numSegs;
+    if (storage_->refCount_ > 1 || storage_->capacity_ < required)
+    {
+        size_t capacity = storage_->capacity_;
+        if (capacity < required)
+        {
+            capacity *= 2;
+            if (capacity < required)
+            {
+                capacity = required;
+            }
+        }
+        SegBufferStorage* tmp = SegBufferStorage::Clone(storage_, capacity);
+        SegBufferStorage::Release(storage_);
+        storage_ = tmp;
+    }
+}
+
+inline size_t SegBuffer::GetSize(void) const BOOST_NOEXCEPT
+{
+    return storage_ ? storage_->size_ : 0;
+}
+
+inline size_t SegBuffer::GetNumSegments(void) const BOOST_NOEXCEPT
+{
+    return storage_ ? storage_->numSegs_ : 0;
+}
+
+inline ConstBuffer SegBuffer::GetSegment(size_t index) const BOOST_NOEXCEPT
+{
+    BOOST_ASSERT_MSG(index < GetNumSegments(),
+                     "The index of the segment is out of bound.");
+    return ConstBuffer(storage_->GetSegments()[index]);
+}
+
+inline size_t SegBuffer::CopyTo(uint8_t* dst, size_t size) const BOOST_NOEXCEPT
+{
+    size_t copied = 0;
+    if (storage_ && dst)
+    {
+        const Buffer* segs = storage_->GetSegments();
+        for (size_t i = 0; i < storage_->numSegs_ && copied < size; ++i)
+        {
+            copied += segs[i].CopyTo(dst + copied, size - copied);
+        }
+    }
+    return copied;
+}
+
+inline void SegBuffer::AddAtStart(size_t size)
+{
+    if (!size)
+    {
+        return;
+    }
+    Reserve(1);
+    Buffer* segs = storage_->GetSegments();
+    if (storage_->numSegs_ && CanAddAtStart(segs[0], size))
+    {
+        segs[0].AddAtStart(size);
+        storage_->size_ += size;
+    }
+    else
+    {
+        Buffer segment(size + SEGMENT_RESERVE);
+        segment.AddAtStart(size);
+        storage_->Insert(0, std::move(segment));
+    }
+}
+
+inline void SegBuffer::AddAtStart(const uint8_t* src, size_t size)
+{
+    BOOST_ASSERT_MSG(src, "Invalid pointer.");
+    if (size)
+    {
+        AddAtStart(size);
+        begin().Write(src, size);
+    }
+}
+
+inline void SegBuffer::AddAtStart(const SegBuffer& src)
+{
+    if (src.GetSize())
+    {
+        // Hold the chain, since the buffer itself can be passed in.
+        SegBuffer tmp(src);
+        Splice(0, tmp.storage_);
+    }
+}
+
+template<bool readOnly, bool copyOnResize, bool zeroArea>
+inline void
+SegBuffer::AddAtStart(const BasicBuffer<readOnly, copyOnResize, zeroArea>& src)
+{
+    if (src.GetSize())
+    {
+        // Shallow copy for a Buffer, and deep copy for the others.
+        Splice(0, Buffer(src));
+    }
+}
+
+inline void SegBuffer::AddAtEnd(size_t size)
+{
+    if (!size)
+    {
+        return;
+    }
+    Reserve(1);
+    size_t n = storage_->numSegs_;
+    Buffer* segs = storage_->GetSegments();
+    if (n && CanAddAtEnd(segs[n - 1], size))
+    {
+        segs[n - 1].AddAtEnd(size);
+        storage_->size_ += size;
+    }
+    else
+    {
+        Buffer segment(size_t(0), size_t(0), size + SEGMENT_RESERVE);
+        segment.AddAtEnd(size);
+        storage_->Insert(n, std::move(segment));
+    }
+}
+
+inline void SegBuffer::AddAtEnd(const uint8_t* src, size_t size)
+{
+    BOOST_ASSERT_MSG(src, "Invalid pointer.");
+    if (size)
+    {
+        AddAtEnd(size);
+        SegBufferIterator it = end();
+        it -= size;
+        it.Write(src, size);
+    }
+}
+
+inline void SegBuffer::AddAtEnd(const SegBuffer& src)
+{
+    if (src.GetSize())
+    {
+        // Hold the chain, since the buffer itself can be passed in.
+        SegBuffer tmp(src);
+        Splice(GetNumSegments(), tmp.storage_);
+    }
+}
+
+template<bool readOnly, bool copyOnResize, bool zeroArea>
+inline void
+SegBuffer::AddAtEnd(const BasicBuffer<readOnly, copyOnResize, zeroArea>& src)
+{
+    if (src.GetSize())
+    {
+        // Shallow copy for a Buffer, and deep copy for the others.
+        Splice(GetNumSegments(), Buffer(src));
+    }
+}
+
+inline void SegBuffer::RemoveAtStart(size_t size)
+{
+    if (!size || !storage_)
+    {
+        return;
+    }
+    if (size >= storage_->size_)
+    {
+        Release();
+        return;
+    }
+    Reserve(0);
+    Buffer* segs = storage_->GetSegments();
+    size_t n = 0;
+    while (size >= segs[n].GetSize())
+    {
+        size -= segs[n].GetSize();
+        ++n;
+    }
+    storage_->Erase(0, n);
+    if (size)
+    {
+        segs[0].RemoveAtStart(size);
+        storage_->size_ -= size;
+    }
+}
+
+inline void SegBuffer::RemoveAtEnd(size_t size)
+{
+    if (!size || !storage_)
+    {
+        return;
+    }
+    if (size >= storage_->size_)
+    {
+        Release();
+        return;
+    }
+    Reserve(0);
+    Buffer* segs = storage_->GetSegments();
+    size_t n = storage_->numSegs_;
+    while (size >= segs[n - 1].GetSize())
+    {
+        size -= segs[n - 1].GetSize();
+        --n;
+    }
+    storage_->Erase(n, storage_->numSegs_ - n);
+    if (size)
+    {
+        segs[n - 1].RemoveAtEnd(size);
+        storage_->size_ -= size;
+    }
+}
+
+inline void SegBuffer::Splice(size_t pos, const SegBufferStorage* src)
+{
+    BOOST_ASSERT(src);
+    Reserve(src->numSegs_);
+    const Buffer* segs = src->GetSegments();
+    for (size_t i = 0; i < src->numSegs_; ++i)
+    {
+        // The insertion can remove an empty segment, and shift the position.
+        pos = storage_->Insert(pos, Buffer(segs[i])) + 1;
+    }
+}
+
+inline void SegBuffer::Splice(size_t pos, const Buffer& segment)
+{
+    // An empty segment reserves space for an empty buffer.
+    if (segment.GetSize() || (!GetNumSegments() && segment.GetCapacity()))
+    {
+        Reserve(1);
+        storage_->Insert(pos, Buffer(segment));
+    }
+}
+
+inline bool
+SegBuffer::CanAddAtStart(const Buffer& segment, size_t size) BOOST_NOEXCEPT
+{
+    const Buffer::BufferStorage* storage = segment.GetStorage();
+    BOOST_ASSERT(storage);
+    // The space before the segment is not used by other buffers.
+    return size <= segment.GetStart() &&
+           (storage->refCount_ == 1 ||
+            storage->dirtyStart_ == segment.GetStart());
+}
+
+inline bool
+SegBuffer::CanAddAtEnd(const Buffer& segment, size_t size) BOOST_NOEXCEPT
+{
+    const Buffer::BufferStorage* storage = segment.GetStorage();
+    BOOST_ASSERT(storage);
+    // The space after the segment is not used by other buffers.
+    return size <= storage->capacity_ - segment.GetEnd() &&
+           (storage->refCount_ == 1 ||
+            storage->dirtyEnd_ == segment.GetEnd());
+}
+
+inline SegBuffer SegBuffer::MakeFragment(size_t start, size_t size) const
+{
+    BOOST_ASSERT_MSG(start <= GetSize(),
+                     "Cannot create a fragment, since the start of "
+                     "the fragment is beyond the end of the buffer.");
+    BOOST_ASSERT_MSG(size <= GetSize() - start,
+                     "Cannot create a fragment, since the end of "
+                     "the fragment is beyond the end of the buffer.");
+    if (!size)
+    {
+        return SegBuffer();
+    }
+    if (size == GetSize())
+    {
+        return *this;
+    }
+    const Buffer* segs = storage_->GetSegments();
+    // Skip the segments before the fragment.
+    size_t first = 0;
+    while (start >= segs[first].GetSize())
+    {
+        start -= segs[first].GetSize();
+        ++first;
+    }
+    size_t last = first;
+    size_t covered = segs[first].GetSize() - start;
+    while (covered < size)
+    {
+        ++last;
+        covered += segs[last].GetSize();
+    }
+    SegBuffer fragment(SegBufferStorage::Allocate(last - first + 1));
+    for (size_t i = first; i <= last; ++i)
+    {
+        // Do not use Buffer::MakeFragment(), which does not keep the
+        // dirty area of the storage.
+        fragment.storage_->Insert(i - first, Buffer(segs[i]));
+    }
+    Buffer* fsegs = fragment.storage_->GetSegments();
+    fsegs[0].RemoveAtStart(start);
+    fsegs[last - first].RemoveAtEnd(covered - size);
+    fragment.storage_->size_ = size;
+    return fragment;
+}
+
+inline Buffer SegBuffer::MakeRealBuffer(void) const
+{
+    size_t n = GetNumSegments();
+    if (n == 0)
+    {
+        return Buffer();
+    }
+    const Buffer* segs = storage_->GetSegments();
+    if (n == 1)
+    {
+        return segs[0];
+    }
+    Buffer result(GetSize());
+    for (size_t i = n; i > 0; --i)
+    {
+        result.AddAtStart(segs[i - 1]);
+    }
+    return result;
+}
+
+inline SegBufferIterator SegBuffer::begin(void) BOOST_NOEXCEPT
+{
+    return storage_ ?
+           SegBufferIterator(storage_->GetSegments(), storage_->numSegs_,
+                             storage_->size_, 0) :
+           SegBufferIterator();
+}
+
+inline SegBufferIterator SegBuffer::end(void) BOOST_NOEXCEPT
+{
+    return storage_ ?
+           SegBufferIterator(storage_->GetSegments(), storage_->numSegs_,
+                             storage_->size_, storage_->size_) :
+           SegBufferIterator();
+}
+
+inline ConstSegBufferIterator SegBuffer::cbegin(void) const BOOST_NOEXCEPT
+{
+    return storage_ ?
+           ConstSegBufferIterator(storage_->GetSegments(), storage_->numSegs_,
+                                  storage_->size_, 0) :
+           ConstSegBufferIterator();
+}
+
+inline ConstSegBufferIterator SegBuffer::cend(void) const BOOST_NOEXCEPT
+{
+    return storage_ ?
+           ConstSegBufferIterator(storage_->GetSegments(), storage_->numSegs_,
+                                  storage_->size_, storage_->size_) :
+           ConstSegBufferIterator();
+}
+
+inline void SegBuffer::swap(SegBuffer& rhs) BOOST_NOEXCEPT
+{
+    if (this != &rhs)
+    {
+        boost::swap(storage_, rhs.storage_);
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline void swap(SegBuffer& lhs, SegBuffer& rhs) BOOST_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // SEG_BUFFER_H__A47E2D19_6C85_4F3B_9B20_E8D5C1367A0F
+
@@ -18,6 +18,8 @@
 
 
 #include <nsfx/network/config.h>
+#include <nsfx/network/buffer/storage/buffer-storage-pool.h>
+#include <nsfx/network/buffer/storage/buffer-profile.h>
 
 
 NSFX_OPEN_NAMESPACE
@@ -86,6 +88,27 @@ struct BasicBufferStorage</*trackDirtyArea=*/true>
      */
     size_t dirtyEnd_;
 
+    /**
+     * @brief The profile of the buffer.
+     *
+     * It is \c nullptr if the buffer is not created with a profile.
+     */
+    BufferProfile* profile_;
+
+    /**
+     * @brief The headroom the buffer has needed.
+     *
+     * It is valid only if \c profile_ is not \c nullptr.
+     */
+    uint32_t headroom_;
+
+    /**
+     * @brief The tailroom the buffer has needed.
+     *
+     * It is valid only if \c profile_ is not \c nullptr.
+     */
+    uint32_t tailroom_;
+
     /**
      * @brief The space for storing data (at least 1 byte).
      */
@@ -97,6 +120,8 @@ struct BasicBufferStorage</*trackDirtyArea=*/true>
     /**
      * @brief Allocate a buffer storage.
      *
+     * The storage is allocated from <code>BufferStoragePool<></code>.
+     *
      * @return If the capacity is \c 0, \c nullptr is returned.
      */
     static BasicBufferStorage* Allocate(size_t capacity)
@@ -104,17 +129,71 @@ struct BasicBufferStorage</*trackDirtyArea=*/true>
         BasicBufferStorage* storage = nullptr;
         if (capacity > 0)
         {
-            size_t storageSize = sizeof (BasicBufferStorage) - 1 + capacity;
-            uint8_t* bytes = new uint8_t[storageSize];
-            storage = reinterpret_cast<BasicBufferStorage*>(bytes);
+            void* bytes = BufferStoragePool<BasicBufferStorage>::Allocate(capacity);
+            storage = static_cast<BasicBufferStorage*>(bytes);
             storage->capacity_   = capacity;
             storage->dirtyStart_ = 0;
             storage->dirtyEnd_   = 0;
             storage->refCount_   = 1;
+            storage->profile_    = nullptr;
         }
         return storage;
     }
 
+    /**
+     * @brief Allocate a buffer storage with a profile.
+     *
+     * The storage reserves the headroom and tailroom predicted by the profile.
+     *
+     * @param[in] size    The size of the data.
+     * @param[in] profile The profile.
+     *
+     * @return The capacity is at least \c 1 byte, so the profile is always
+     *         attached to the storage.
+     */
+    static BasicBufferStorage* Allocate(size_t size, BufferProfile& profile)
+    {
+        size_t capacity = profile.headroom_ + size + profile.tailroom_;
+        BasicBufferStorage* storage = Allocate(capacity ? capacity : 1);
+        storage->profile_  = &profile;
+        storage->headroom_ = static_cast<uint32_t>(profile.Clamp(profile.headroom_));
+        storage->tailroom_ = static_cast<uint32_t>(profile.Clamp(profile.tailroom_));
+        ++profile.stats_.numBuffers_;
+        return storage;
+    }
+
+    /**
+     * @brief Record a copy of the data to add a header or a trailer.
+     *
+     * @param[in] from          The storage that holds the data.
+     * @param[in] to            The storage that receives the data.
+     *                          It can be the same as \c from.
+     * @param[in] startShortage The number of bytes the headroom fell short.
+     * @param[in] endShortage   The number of bytes the tailroom fell short.
+     *
+     * If \c from has a profile, \c to inherits the profile, and the profile
+     * learns the headroom and tailroom that have been needed.
+     */
+    static void RecordCopy(const BasicBufferStorage* from,
+                           BasicBufferStorage* to,
+                           size_t startShortage,
+                           size_t endShortage) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(from);
+        BOOST_ASSERT(to);
+        BufferProfile* profile = from->profile_;
+        if (profile)
+        {
+            size_t headroom = profile->Clamp(from->headroom_ + startShortage);
+            size_t tailroom = profile->Clamp(from->tailroom_ + endShortage);
+            to->profile_  = profile;
+            to->headroom_ = static_cast<uint32_t>(headroom);
+            to->tailroom_ = static_cast<uint32_t>(tailroom);
+            ++profile->stats_.numCopies_;
+            profile->Learn(headroom, tailroom);
+        }
+    }
+
     static void AddRef(BasicBufferStorage* storage) BOOST_NOEXCEPT
     {
         BOOST_ASSERT(storage);
@@ -128,8 +207,8 @@ struct BasicBufferStorage</*trackDirtyArea=*/true>
         BOOST_ASSERT(storage->refCount_ > 0);
         if (--storage->refCount_ == 0)
         {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(storage);
-            delete[] bytes;
+            BufferStoragePool<BasicBufferStorage>::Deallocate(
+                storage, storage->capacity_);
         }
     }
 
@@ -177,6 +256,8 @@ struct BasicBufferStorage</*trackDirtyArea=*/false>
     /**
      * @brief Allocate a buffer storage.
      *
+     * The storage is allocated from <code>BufferStoragePool<></code>.
+     *
      * @return If the capacity is \c 0, \c nullptr is returned.
      */
     static BasicBufferStorage* Allocate(size_t capacity)
@@ -184,9 +265,8 @@ struct BasicBufferStorage</*trackDirtyArea=*/false>
         BasicBufferStorage* storage = nullptr;
         if (capacity > 0)
         {
-            size_t storageSize = sizeof (BasicBufferStorage) - 1 + capacity;
-            uint8_t* bytes = new uint8_t[storageSize];
-            storage = reinterpret_cast<BasicBufferStorage*>(bytes);
+            void* bytes = BufferStoragePool<BasicBufferStorage>::Allocate(capacity);
+            storage = static_cast<BasicBufferStorage*>(bytes);
             storage->capacity_   = capacity;
             storage->refCount_   = 1;
         }
@@ -206,8 +286,8 @@ struct BasicBufferStorage</*trackDirtyArea=*/false>
         BOOST_ASSERT(storage->refCount_ > 0);
         if (--storage->refCount_ == 0)
         {
-            uint8_t* bytes = reinterpret_cast<uint8_t*>(storage);
-            delete[] bytes;
+            BufferStoragePool<BasicBufferStorage>::Deallocate(
+                storage, storage->capacity_);
         }
     }
 
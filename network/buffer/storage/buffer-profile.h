@@ -0,0 +1,250 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef BUFFER_PROFILE_H__9B2E5D47_1C83_4A6F_B0D9_3F6A8E21C754
+#define BUFFER_PROFILE_H__9B2E5D47_1C83_4A6F_B0D9_3F6A8E21C754
+
+
+#include <nsfx/network/config.h>
+#include <algorithm> // min
+
+
+NSFX_OPEN_NAMESPACE
+
+
+template<bool trackDirtyArea>
+struct BasicBufferStorage;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BufferProfileStats.
+/**
+ * @ingroup Network
+ * @brief The statistics of a buffer profile.
+ */
+struct BufferProfileStats
+{
+    /**
+     * @brief The number of buffers created with the profile.
+     */
+    uint64_t numBuffers_;
+
+    /**
+     * @brief The number of times the data of the buffers is copied to add
+     *        a header or a trailer.
+     *
+     * The data is copied when the storage is reallocated, or when the data
+     * is moved within the storage.
+     */
+    uint64_t numCopies_;
+
+    /**
+     * @brief The average number of copies per buffer.
+     */
+    double GetCopyRate(void) const BOOST_NOEXCEPT
+    {
+        return numBuffers_ ? static_cast<double>(numCopies_) / numBuffers_ : 0;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BufferProfile.
+/**
+ * @ingroup Network
+ * @brief The learned headroom and tailroom of a class of buffers.
+ *
+ * A profile is used for a class of packets, e.g., the packets of a flow,
+ * or the packets generated by a protocol.
+ * The buffers created with a profile reserve the headroom and tailroom
+ * predicted by the profile.
+ *
+ * The storage of such a buffer records the headroom and tailroom it has
+ * needed.
+ * When a header (trailer) does not fit into the headroom (tailroom), the data
+ * is copied, and the shortage is added to the record.
+ * The profile raises its prediction to the record, so the subsequent buffers
+ * reserve enough space up front, and the copies disappear.
+ *
+ * The prediction never decreases, and it is bounded by the maximum room
+ * of the profile.
+ *
+ * The profile **must** outlive the buffers created with it.
+ */
+class BufferProfile
+{
+    template<bool trackDirtyArea>
+    friend struct BasicBufferStorage;
+
+public:
+    /**
+     * @brief Create a profile without initial headroom or tailroom.
+     *
+     * The maximum room is \c 1024 bytes.
+     */
+    BufferProfile(void) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Create a profile.
+     *
+     * @param[in] headroom The initial headroom.
+     * @param[in] tailroom The initial tailroom.
+     *
+     * The maximum room is \c 1024 bytes.
+     * The initial headroom and tailroom are clamped to the maximum room.
+     */
+    BufferProfile(size_t headroom, size_t tailroom) BOOST_NOEXCEPT;
+
+    /**
+     * @brief Create a profile.
+     *
+     * @param[in] headroom The initial headroom.
+     * @param[in] tailroom The initial tailroom.
+     * @param[in] maxRoom  The maximum headroom and tailroom to learn.
+     *
+     * The initial headroom and tailroom are clamped to the maximum room.
+     */
+    BufferProfile(size_t headroom, size_t tailroom, size_t maxRoom) BOOST_NOEXCEPT;
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(BufferProfile(const BufferProfile&));
+    BOOST_DELETED_FUNCTION(BufferProfile& operator=(const BufferProfile&));
+
+public:
+    /**
+     * @brief Get the predicted headroom.
+     */
+    size_t GetHeadroom(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the predicted tailroom.
+     */
+    size_t GetTailroom(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the maximum headroom and tailroom to learn.
+     */
+    size_t GetMaxRoom(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Get the statistics.
+     */
+    BufferProfileStats GetStats(void) const BOOST_NOEXCEPT;
+
+    /**
+     * @brief Reset the statistics.
+     *
+     * The predictions are kept.
+     */
+    void ResetStats(void) BOOST_NOEXCEPT;
+
+private:
+    /**
+     * @brief Raise the predictions.
+     */
+    void Learn(size_t headroom, size_t tailroom) BOOST_NOEXCEPT;
+
+    size_t Clamp(size_t room) const BOOST_NOEXCEPT;
+
+private:
+    size_t headroom_;
+    size_t tailroom_;
+    size_t maxRoom_;
+    BufferProfileStats stats_;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+inline BufferProfile::BufferProfile(void) BOOST_NOEXCEPT :
+    headroom_(0),
+    tailroom_(0),
+    maxRoom_(1024)
+{
+    ResetStats();
+}
+
+inline BufferProfile::BufferProfile(size_t headroom, size_t tailroom) BOOST_NOEXCEPT :
+    headroom_(headroom),
+    tailroom_(tailroom),
+    maxRoom_(1024)
+{
+    headroom_ = std::min(headroom_, maxRoom_);
+    tailroom_ = std::min(tailroom_, maxRoom_);
+    ResetStats();
+}
+
+inline BufferProfile::BufferProfile(size_t headroom, size_t tailroom,
+                                    size_t maxRoom) BOOST_NOEXCEPT :
+    headroom_(headroom),
+    tailroom_(tailroom),
+    maxRoom_(maxRoom)
+{
+    headroom_ = std::min(headroom_, maxRoom_);
+    tailroom_ = std::min(tailroom_, maxRoom_);
+    ResetStats();
+}
+
+inline size_t BufferProfile::GetHeadroom(void) const BOOST_NOEXCEPT
+{
+    return headroom_;
+}
+
+inline size_t BufferProfile::GetTailroom(void) const BOOST_NOEXCEPT
+{
+    return tailroom_;
+}
+
+inline size_t BufferProfile::GetMaxRoom(void) const BOOST_NOEXCEPT
+{
+    return maxRoom_;
+}
+
+inline BufferProfileStats BufferProfile::GetStats(void) const BOOST_NOEXCEPT
+{
+    return stats_;
+}
+
+inline void BufferProfile::ResetStats(void) BOOST_NOEXCEPT
+{
+    stats_.numBuffers_ = 0;
+    stats_.numCopies_  = 0;
+}
+
+inline void BufferProfile::Learn(size_t headroom, size_t tailroom) BOOST_NOEXCEPT
+{
+    headroom = Clamp(headroom);
+    tailroom = Clamp(tailroom);
+    if (headroom_ < headroom)
+    {
+        headroom_ = headroom;
+    }
+    if (tailroom_ < tailroom)
+    {
+        tailroom_ = tailroom;
+    }
+}
+
+inline size_t BufferProfile::Clamp(size_t room) const BOOST_NOEXCEPT
+{
+    return room < maxRoom_ ? room : maxRoom_;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // BUFFER_PROFILE_H__9B2E5D47_1C83_4A6F_B0D9_3F6A8E21C754
+
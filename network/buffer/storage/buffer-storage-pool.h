@@ -0,0 +1,323 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef BUFFER_STORAGE_POOL_H__6A1F7D2C_93B4_4E05_8C6D_1B27E4F09A53
+#define BUFFER_STORAGE_POOL_H__6A1F7D2C_93B4_4E05_8C6D_1B27E4F09A53
+
+
+#include <nsfx/network/config.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BufferStoragePoolStats.
+/**
+ * @ingroup Network
+ * @brief The statistics of a buffer storage pool.
+ */
+struct BufferStoragePoolStats
+{
+    /**
+     * @brief The number of allocations.
+     */
+    uint64_t numAllocs_;
+
+    /**
+     * @brief The number of allocations that reuse a cached block.
+     */
+    uint64_t numHits_;
+
+    /**
+     * @brief The number of blocks that are cached.
+     */
+    uint64_t numCached_;
+
+    /**
+     * @brief The ratio of the allocations that reuse a cached block.
+     */
+    double GetHitRate(void) const BOOST_NOEXCEPT
+    {
+        return numAllocs_ ? static_cast<double>(numHits_) / numAllocs_ : 0;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// BufferStoragePool.
+/**
+ * @ingroup Network
+ * @brief A per-thread pool of buffer storages.
+ *
+ * @tparam Storage The type of buffer storage.
+ *                 A storage of capacity `n` occupies
+ *                 `sizeof (Storage) - 1 + n` bytes.
+ *
+ * The capacities of the storages are rounded up to a set of size classes,
+ * i.e., 64, 128, 256, 512, 1500 and 9000 bytes.
+ * The released blocks are cached in a free-list of the size class, and they
+ * are reused by the subsequent allocations in the same thread.
+ * The storages whose capacities exceed the largest size class are not pooled.
+ *
+ * A block can be released in a different thread than the one that allocated
+ * it.
+ * It is cached by the releasing thread.
+ *
+ * The number of cached blocks of each size class is bounded, so the cached
+ * memory of each size class does not exceed about `1 MiB`.
+ * The cached blocks are deallocated when the thread exits.
+ *
+ * Define `NSFX_NO_BUFFER_STORAGE_POOL` to allocate the storages on the heap
+ * directly, e.g., to let a memory checker track every storage.
+ */
+template<class Storage>
+class BufferStoragePool
+{
+public:
+    /**
+     * @brief The number of size classes.
+     */
+    static const size_t NUM_CLASSES = 6;
+
+    /**
+     * @brief The maximum number of bytes cached for each size class.
+     */
+    static const size_t MAX_CACHED_BYTES = 1024 * 1024;
+
+    /**
+     * @brief The capacity of a size class.
+     */
+    static size_t GetClassCapacity(size_t c) BOOST_NOEXCEPT
+    {
+        static const size_t capacities[NUM_CLASSES] = {
+            64, 128, 256, 512, 1500, 9000
+        };
+        BOOST_ASSERT(c < NUM_CLASSES);
+        return capacities[c];
+    }
+
+    /**
+     * @brief Get the size class of a capacity.
+     *
+     * @return If the capacity is not pooled, `NUM_CLASSES` is returned.
+     */
+    static size_t GetClass(size_t capacity) BOOST_NOEXCEPT
+    {
+        size_t c = 0;
+        while (c < NUM_CLASSES && GetClassCapacity(c) < capacity)
+        {
+            ++c;
+        }
+        return c;
+    }
+
+    /**
+     * @brief Allocate a block for a storage.
+     *
+     * @throw std::bad_alloc
+     */
+    static void* Allocate(size_t capacity)
+    {
+#if !defined(NSFX_NO_BUFFER_STORAGE_POOL) && \
+    !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+        size_t c = GetClass(capacity);
+        if (c < NUM_CLASSES)
+        {
+            Cache* cache = GetCache();
+            if (cache)
+            {
+                ++cache->numAllocs_;
+                void* block = cache->head_[c];
+                if (block)
+                {
+                    cache->head_[c] = *static_cast<void**>(block);
+                    --cache->count_[c];
+                    ++cache->numHits_;
+                    return block;
+                }
+            }
+            // Round up the capacity even if the cache of this thread has been
+            // destroyed, since the block can be cached by another thread.
+            capacity = GetClassCapacity(c);
+        }
+#endif // !defined(NSFX_NO_BUFFER_STORAGE_POOL) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+        return new uint8_t[GetBlockSize(capacity)];
+    }
+
+    /**
+     * @brief Release a block.
+     *
+     * @param[in] block    The block.
+     * @param[in] capacity The capacity of the storage, which is the same as
+     *                     the one passed to `Allocate()`.
+     */
+    static void Deallocate(void* block, size_t capacity) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(block);
+        size_t c = GetClass(capacity);
+        if (c < NUM_CLASSES)
+        {
+            Cache* cache = GetCache();
+            if (cache && cache->count_[c] < GetMaxCount(c))
+            {
+                *static_cast<void**>(block) = cache->head_[c];
+                cache->head_[c] = block;
+                ++cache->count_[c];
+                return;
+            }
+        }
+        delete[] static_cast<uint8_t*>(block);
+    }
+
+    /**
+     * @brief Get the statistics of the calling thread.
+     */
+    static BufferStoragePoolStats GetStats(void) BOOST_NOEXCEPT
+    {
+        BufferStoragePoolStats stats = { 0, 0, 0 };
+        Cache* cache = GetCache();
+        if (cache)
+        {
+            stats.numAllocs_ = cache->numAllocs_;
+            stats.numHits_   = cache->numHits_;
+            for (size_t c = 0; c < NUM_CLASSES; ++c)
+            {
+                stats.numCached_ += cache->count_[c];
+            }
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Deallocate the cached blocks of the calling thread.
+     *
+     * The statistics are reset.
+     */
+    static void Clear(void) BOOST_NOEXCEPT
+    {
+        Cache* cache = GetCache();
+        if (cache)
+        {
+            cache->Clear();
+        }
+    }
+
+private:
+    static size_t GetBlockSize(size_t capacity) BOOST_NOEXCEPT
+    {
+        return sizeof (Storage) - 1 + capacity;
+    }
+
+    static size_t GetMaxCount(size_t c) BOOST_NOEXCEPT
+    {
+        size_t n = MAX_CACHED_BYTES / GetBlockSize(GetClassCapacity(c));
+        return n < 16 ? 16 : n;
+    }
+
+    /**
+     * @brief The free-lists of a thread.
+     *
+     * The first bytes of a cached block store the pointer to the next block.
+     */
+    struct Cache
+    {
+        Cache(void) BOOST_NOEXCEPT
+        {
+            for (size_t c = 0; c < NUM_CLASSES; ++c)
+            {
+                head_[c]  = nullptr;
+                count_[c] = 0;
+            }
+            numAllocs_ = 0;
+            numHits_   = 0;
+        }
+
+        ~Cache(void)
+        {
+            Clear();
+            // Storages released after this point are not cached.
+            IsDestroyed() = true;
+        }
+
+        void Clear(void) BOOST_NOEXCEPT
+        {
+            for (size_t c = 0; c < NUM_CLASSES; ++c)
+            {
+                while (head_[c])
+                {
+                    void* block = head_[c];
+                    head_[c] = *static_cast<void**>(block);
+                    delete[] static_cast<uint8_t*>(block);
+                }
+                count_[c] = 0;
+            }
+            numAllocs_ = 0;
+            numHits_   = 0;
+        }
+
+        void*    head_[NUM_CLASSES];
+        size_t   count_[NUM_CLASSES];
+        uint64_t numAllocs_;
+        uint64_t numHits_;
+    };
+
+#if !defined(NSFX_NO_BUFFER_STORAGE_POOL) && \
+    !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+    static bool& IsDestroyed(void) BOOST_NOEXCEPT
+    {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    static Cache* GetCache(void) BOOST_NOEXCEPT
+    {
+        if (IsDestroyed())
+        {
+            return nullptr;
+        }
+        static thread_local Cache cache;
+        return &cache;
+    }
+
+#else // defined(NSFX_NO_BUFFER_STORAGE_POOL) || defined(BOOST_NO_CXX11_THREAD_LOCAL)
+    static bool& IsDestroyed(void) BOOST_NOEXCEPT
+    {
+        static bool destroyed = true;
+        return destroyed;
+    }
+
+    static Cache* GetCache(void) BOOST_NOEXCEPT
+    {
+        return nullptr;
+    }
+
+#endif // !defined(NSFX_NO_BUFFER_STORAGE_POOL) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+};
+
+
+template<class Storage>
+const size_t BufferStoragePool<Storage>::NUM_CLASSES;
+
+template<class Storage>
+const size_t BufferStoragePool<Storage>::MAX_CACHED_BYTES;
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // BUFFER_STORAGE_POOL_H__6A1F7D2C_93B4_4E05_8C6D_1B27E4F09A53
+
@@ -0,0 +1,240 @@
+/**
+ * @file
+ *
+ * @brief Buffer for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *            National Key Laboratory of Science and Technology on Communications,
+ *            University of Electronic Science and Technology of China.
+ *            All rights reserved.
+ */
+
+#ifndef SEG_BUFFER_STORAGE_H__3E9B6C21_5A07_4F4D_A2E8_C1D05B7F6934
+#define SEG_BUFFER_STORAGE_H__3E9B6C21_5A07_4F4D_A2E8_C1D05B7F6934
+
+
+#include <nsfx/network/config.h>
+#include <nsfx/network/buffer/buffer.h>
+#include <nsfx/network/buffer/storage/buffer-storage-pool.h>
+#include <type_traits> // alignment_of
+#include <utility>     // move
+#include <new>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SegBufferStorage.
+/**
+ * @ingroup Network
+ * @brief The shared chain of segments of a segmented buffer.
+ *
+ * The chain is an array of buffers, and each buffer is a slice of a
+ * reference counted <code>BasicBufferStorage<></code>.
+ * The segments are placed right after the chain in the same memory block.
+ *
+ * The chain provides a reference counter to support shared ownership.
+ * A chain that is shared by two or more segmented buffers is immutable.
+ *
+ * A chain does not hold empty segments, except that the chain of an empty
+ * buffer can hold a single empty segment that reserves space.
+ */
+struct SegBufferStorage
+{
+    /**
+     * @brief The reference count.
+     *
+     * A reference count is held by each segmented buffer.
+     */
+    refcount_t refCount_;
+
+    /**
+     * @brief The maximum number of segments.
+     */
+    size_t capacity_;
+
+    /**
+     * @brief The number of segments.
+     */
+    size_t numSegs_;
+
+    /**
+     * @brief The total number of bytes of the segments.
+     */
+    size_t size_;
+
+
+    ////////////////////////////////////////
+    // Methods.
+    Buffer* GetSegments(void) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<Buffer*>(this + 1);
+    }
+
+    const Buffer* GetSegments(void) const BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<const Buffer*>(this + 1);
+    }
+
+    /**
+     * @brief Insert a segment.
+     *
+     * @param[in] pos     The index of the new segment.
+     * @param[in] segment The segment.
+     *
+     * @return The index of the inserted segment.
+     *
+     * The chain **must** have room for the segment.
+     *
+     * If the chain holds an empty segment, the empty segment is removed,
+     * and the segment is inserted at index \c 0.
+     */
+    size_t Insert(size_t pos, Buffer&& segment) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(numSegs_ < capacity_);
+        BOOST_ASSERT(pos <= numSegs_);
+        if (!size_ && numSegs_)
+        {
+            Erase(0, numSegs_);
+            pos = 0;
+        }
+        Buffer* segs = GetSegments();
+        if (pos < numSegs_)
+        {
+            ::new (segs + numSegs_) Buffer(std::move(segs[numSegs_ - 1]));
+            for (size_t i = numSegs_ - 1; i > pos; --i)
+            {
+                segs[i] = std::move(segs[i - 1]);
+            }
+            segs[pos] = std::move(segment);
+        }
+        else
+        {
+            ::new (segs + numSegs_) Buffer(std::move(segment));
+        }
+        size_ += segs[pos].GetSize();
+        ++numSegs_;
+        return pos;
+    }
+
+    /**
+     * @brief Remove segments.
+     *
+     * @param[in] pos The index of the first segment to remove.
+     * @param[in] n   The number of segments to remove.
+     */
+    void Erase(size_t pos, size_t n) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(pos + n <= numSegs_);
+        Buffer* segs = GetSegments();
+        for (size_t i = pos; i < pos + n; ++i)
+        {
+            size_ -= segs[i].GetSize();
+        }
+        for (size_t i = pos; i + n < numSegs_; ++i)
+        {
+            segs[i] = std::move(segs[i + n]);
+        }
+        for (size_t i = numSegs_ - n; i < numSegs_; ++i)
+        {
+            segs[i].~Buffer();
+        }
+        numSegs_ -= n;
+    }
+
+
+    ////////////////////////////////////////
+    // Static methods.
+    /**
+     * @brief Allocate an empty chain.
+     *
+     * @param[in] capacity The maximum number of segments.
+     */
+    static SegBufferStorage* Allocate(size_t capacity)
+    {
+        static_assert(sizeof (SegBufferStorage) %
+                      std::alignment_of<Buffer>::value == 0,
+                      "The segments are misaligned.");
+        BOOST_ASSERT(capacity > 0);
+        void* block = BufferStoragePool<SegBufferStorage>::Allocate(
+                          GetPoolCapacity(capacity));
+        SegBufferStorage* storage = static_cast<SegBufferStorage*>(block);
+        storage->refCount_ = 1;
+        storage->capacity_ = capacity;
+        storage->numSegs_  = 0;
+        storage->size_     = 0;
+        return storage;
+    }
+
+    /**
+     * @brief Allocate a chain that shares the segments of another chain.
+     *
+     * @param[in] src      The chain to copy.
+     * @param[in] capacity The maximum number of segments.
+     *                     It **must** be no less than the number of segments
+     *                     of \c src.
+     */
+    static SegBufferStorage* Clone(const SegBufferStorage* src, size_t capacity)
+    {
+        BOOST_ASSERT(src);
+        BOOST_ASSERT(capacity >= src->numSegs_);
+        SegBufferStorage* storage = Allocate(capacity);
+        const Buffer* from = src->GetSegments();
+        Buffer* to = storage->GetSegments();
+        for (size_t i = 0; i < src->numSegs_; ++i)
+        {
+            ::new (to + i) Buffer(from[i]);
+        }
+        storage->numSegs_ = src->numSegs_;
+        storage->size_    = src->size_;
+        return storage;
+    }
+
+    static void AddRef(SegBufferStorage* storage) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(storage);
+        BOOST_ASSERT(storage->refCount_ >= 0);
+        ++storage->refCount_;
+    }
+
+    static void Release(SegBufferStorage* storage) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(storage);
+        BOOST_ASSERT(storage->refCount_ > 0);
+        if (--storage->refCount_ == 0)
+        {
+            Buffer* segs = storage->GetSegments();
+            for (size_t i = 0; i < storage->numSegs_; ++i)
+            {
+                segs[i].~Buffer();
+            }
+            BufferStoragePool<SegBufferStorage>::Deallocate(
+                storage, GetPoolCapacity(storage->capacity_));
+        }
+    }
+
+private:
+    /**
+     * @brief Get the capacity of a chain in terms of the storage pool.
+     *
+     * The pool allocates `sizeof (SegBufferStorage) - 1 + n` bytes for
+     * a capacity of `n`.
+     */
+    static size_t GetPoolCapacity(size_t capacity) BOOST_NOEXCEPT
+    {
+        return capacity * sizeof (Buffer) + 1;
+    }
+
+};
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // SEG_BUFFER_STORAGE_H__3E9B6C21_5A07_4F4D_A2E8_C1D05B7F6934
+
@@ -116,6 +116,20 @@ public:
      */
     BasicBuffer(size_t startSize, size_t zeroSize, size_t endSize);
 
+    /**
+     * @brief Create a buffer with a profile.
+     *
+     * @param[in] zeroSize The size of the zero data.
+     * @param[in] profile  The profile that predicts the headroom and tailroom.
+     *                     It **must** outlive the buffer.
+     *
+     * The buffer reserves the headroom and tailroom predicted by the profile.
+     * The copies of the data made to add headers or trailers are reported to
+     * the profile, so the subsequent buffers of the profile reserve enough
+     * space.
+     */
+    BasicBuffer(size_t zeroSize, BufferProfile& profile);
+
     // Conversions.
 public:
     /**
@@ -434,6 +448,17 @@ inline ZcBuffer::BasicBuffer(size_t startSize, size_t zeroSize, size_t endSize)
     }
 }
 
+inline ZcBuffer::BasicBuffer(size_t zeroSize, BufferProfile& profile)
+{
+    storage_   = BufferStorage::Allocate(0, profile);
+    start_     = profile.GetHeadroom();
+    zeroStart_ = start_;
+    zeroEnd_   = start_ + zeroSize;
+    end_       = start_ + zeroSize;
+    storage_->dirtyStart_ = start_;
+    storage_->dirtyEnd_   = end_ - (zeroEnd_ - zeroStart_);
+}
+
 inline ZcBuffer::BasicBuffer(BufferStorage* storage, size_t start,
                              size_t zeroStart, size_t zeroEnd, size_t end) BOOST_NOEXCEPT :
     storage_(storage),
@@ -795,6 +820,8 @@ inline void ZcBuffer::InternalAddAtStart(
                 dataSize);
     if (storage_)
     {
+        BufferStorage::RecordCopy(storage_, newStorage,
+                                  size > start_ ? size - start_ : 0, 0);
         BufferStorage::Release(storage_);
     }
     storage_  = newStorage;
@@ -811,6 +838,7 @@ inline void ZcBuffer::InternalAddAtStart(
 inline void ZcBuffer::InternalAddAtStart(
     size_t size, size_t dataSize, MoveMemoryTag) BOOST_NOEXCEPT
 {
+    BufferStorage::RecordCopy(storage_, storage_, size - start_, 0);
     std::memmove(storage_->bytes_ + size,
                  storage_->bytes_ + start_,
                  dataSize);
@@ -963,6 +991,9 @@ inline void ZcBuffer::InternalAddAtEnd(
                 dataSize);
     if (storage_)
     {
+        size_t postSize = storage_->capacity_ - (start_ + dataSize);
+        BufferStorage::RecordCopy(storage_, newStorage, 0,
+                                  size > postSize ? size - postSize : 0);
         BufferStorage::Release(storage_);
     }
     storage_  = newStorage;
@@ -979,6 +1010,8 @@ inline void ZcBuffer::InternalAddAtEnd(
 inline void ZcBuffer::InternalAddAtEnd(
     size_t size, size_t dataSize, MoveMemoryTag) BOOST_NOEXCEPT
 {
+    size_t postSize = storage_->capacity_ - (start_ + dataSize);
+    BufferStorage::RecordCopy(storage_, storage_, 0, size - postSize);
     size_t newStart = storage_->capacity_ - (dataSize + size);
     std::memmove(storage_->bytes_ + newStart,
                  storage_->bytes_ + start_,
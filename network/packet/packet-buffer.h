@@ -26,7 +26,8 @@ NSFX_OPEN_NAMESPACE
 
 ////////////////////////////////////////////////////////////////////////////////
 // Types.
-#if !defined(NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER)
+#if !defined(NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER) && \
+    !defined(NSFX_PACKET_USES_SEGMENTED_BUFFER)
 /**
  * @ingroup Network
  * @brief The buffer of a packet.
@@ -34,7 +35,10 @@ NSFX_OPEN_NAMESPACE
  * @remarks By default, this is \c Buffer.
  *          <p>
  *          If \c NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER is defined, this is
- *          \c Buffer.
+ *          \c ZcBuffer.
+ *          <p>
+ *          If \c NSFX_PACKET_USES_SEGMENTED_BUFFER is defined, this is
+ *          \c SegBuffer.
  */
 typedef Buffer  PacketBuffer;
 
@@ -45,7 +49,10 @@ typedef Buffer  PacketBuffer;
  * @remarks By default, this is \c ConstBuffer.
  *          <p>
  *          If \c NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER is defined, this is
- *          \c ConstBuffer.
+ *          \c ConstZcBuffer.
+ *          <p>
+ *          If \c NSFX_PACKET_USES_SEGMENTED_BUFFER is defined, this is
+ *          \c ConstSegBuffer.
  */
 typedef ConstBuffer  ConstPacketBuffer;
 
@@ -56,7 +63,10 @@ typedef ConstBuffer  ConstPacketBuffer;
  * @remarks By default, this is \c BufferIterator.
  *          <p>
  *          If \c NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER is defined, this is
- *          \c BufferIterator.
+ *          \c ZcBufferIterator.
+ *          <p>
+ *          If \c NSFX_PACKET_USES_SEGMENTED_BUFFER is defined, this is
+ *          \c SegBufferIterator.
  */
 typedef BufferIterator  PacketBufferIterator;
 
@@ -67,17 +77,26 @@ typedef BufferIterator  PacketBufferIterator;
  * @remarks By default, this is \c ConstBufferIterator.
  *          <p>
  *          If \c NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER is defined, this is
- *          \c ConstBufferIterator.
+ *          \c ConstZcBufferIterator.
+ *          <p>
+ *          If \c NSFX_PACKET_USES_SEGMENTED_BUFFER is defined, this is
+ *          \c ConstSegBufferIterator.
  */
 typedef ConstBufferIterator  ConstPacketBufferIterator;
 
-#else // defined(NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER)
+#elif defined(NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER)
 typedef ZcBuffer                 PacketBuffer;
 typedef ConstZcBuffer            ConstPacketBuffer;
 typedef ZcBufferIterator         PacketBufferIterator;
 typedef ConstZcBufferIterator    ConstPacketBufferIterator;
 
-#endif // !defined(NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER)
+#else // defined(NSFX_PACKET_USES_SEGMENTED_BUFFER)
+typedef SegBuffer                PacketBuffer;
+typedef ConstSegBuffer           ConstPacketBuffer;
+typedef SegBufferIterator        PacketBufferIterator;
+typedef ConstSegBufferIterator   ConstPacketBufferIterator;
+
+#endif // !defined(NSFX_PACKET_USES_ZERO_COMPRESSED_BUFFER) && !defined(NSFX_PACKET_USES_SEGMENTED_BUFFER)
 
 
 NSFX_CLOSE_NAMESPACE
@@ -159,6 +159,60 @@ struct xoshiro_starstar_scrambler
 };
 
 
+////////////////////////////////////////
+// The jump polynomials.
+// A jump is equivalent to 2^(w*n/2) calls to the generator, where w is the
+// number of bits of UIntType.
+// Bit i of x[j] is the coefficient of the term of degree (w*j + i) of the
+// jump polynomial.
+// It is only defined for the parameters of the published generators.
+template<class UIntType, size_t n, size_t a, size_t b>
+struct xoshiro_jump;
+
+// 2^64 calls for xoshiro128.
+template<>
+struct xoshiro_jump<uint32_t, 4, 9, 11>
+{
+    static const uint32_t (&polynomial(void))[4]
+    {
+        static const uint32_t x[4] = {
+            0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b
+        };
+        return x;
+    }
+};
+
+// 2^128 calls for xoshiro256.
+template<>
+struct xoshiro_jump<uint64_t, 4, 17, 45>
+{
+    static const uint64_t (&polynomial(void))[4]
+    {
+        static const uint64_t x[4] = {
+            0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+            0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+        };
+        return x;
+    }
+};
+
+// 2^256 calls for xoshiro512.
+template<>
+struct xoshiro_jump<uint64_t, 8, 11, 21>
+{
+    static const uint64_t (&polynomial(void))[8]
+    {
+        static const uint64_t x[8] = {
+            0x33ed89b6e7a353f9ULL, 0x760083d7955323beULL,
+            0x2837f2fbb5f22faeULL, 0x4b8c5674d309511cULL,
+            0xb11ac47a7ba28c25ULL, 0xf1be7667092bcc1cULL,
+            0x53851efdb6df0aafULL, 0x1ebbc8b23eaf25dbULL
+        };
+        return x;
+    }
+};
+
+
 } // namespace aux
 } // namespace random
 
@@ -230,6 +284,36 @@ public:
         }
     }
 
+    /**
+     * @brief Advance the state as if the generator is called `2^(w*n/2)`
+     *        times, where `w` is the number of bits of `UIntType`.
+     *
+     * It generates non-overlapping subsequences for parallel computations.
+     * e.g., a generator is copied and jumped for each replication of
+     * a simulation.
+     */
+    void jump(void)
+    {
+        typedef random::aux::xoshiro_jump<UIntType, n, shift_a, rotate_b>  Jump;
+        const UIntType (&poly)[n] = Jump::polynomial();
+        UIntType t[n] = {0};
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t b = 0; b < sizeof (UIntType) * 8; ++b)
+            {
+                if (poly[i] & (static_cast<UIntType>(1) << b))
+                {
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        t[j] ^= s_[j];
+                    }
+                }
+                Transformer::transform(s_);
+            }
+        }
+        std::memcpy(s_, t, sizeof (s_));
+    }
+
     static result_type (min)(void)
     {
         return 0;
@@ -482,6 +566,17 @@ public:
         rng_.discard(z);
     }
 
+    /**
+     * @brief Advance the state as if the generator is called `2^(w*n/2)`
+     *        times.
+     *
+     * @see `xoshiro_engine::jump()`.
+     */
+    void jump(void)
+    {
+        rng_.jump();
+    }
+
     static BOOST_CONSTEXPR result_type (min)(void)
     {
         return 0;
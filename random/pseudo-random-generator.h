@@ -64,7 +64,10 @@
 #include <nsfx/random/engine/xoshiro-engine.h>
 #include <boost/random/mersenne_twister.hpp>
 
-#include <type_traits> // conditional, is_integral, is_floating_point, is_same
+#include <nsfx/component/i-checkpointable.h>
+
+#include <type_traits> // conditional, is_integral, is_floating_point, is_same,
+                        // is_trivially_copyable
 
 
 NSFX_OPEN_NAMESPACE
@@ -134,12 +137,19 @@ struct RandomNumberGeneratorTraits
  * * `IRandomUInt64Generator` (if `StdRng::result_type` is 64-bit unsigned integer)
  * * `IRandomDoubleGenerator` (if `StdRng::result_type` is float or double)
  * * `IRandom`
+ * * `ICheckpointable`
+ *
+ * The state of the engine is saved as raw bytes, thus a checkpoint can only
+ * be restored by the same build on the same platform.
+ * The engine can be checkpointed only if `StdRng` is trivially copyable.
+ * The distribution objects created by the engine are not checkpointed.
  */
 template<class StdRng>
 class PseudoRandomEngine :
     public IPseudoRandomEngine,
     public aux::RandomNumberGeneratorTraits<StdRng>::InterfaceType,
-    public IRandom
+    public IRandom,
+    public ICheckpointable
 {
     typedef PseudoRandomEngine ThisClass;
 
@@ -610,11 +620,63 @@ public:
         return dist_(rng_);
     }
 
+    // ICheckpointable
+public:
+    /**
+     * @throw IllegalMethodCall `StdRng` is not trivially copyable.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
+    {
+        SaveRng(writer, std::is_trivially_copyable<RngType>());
+    }
+
+    /**
+     * @throw BadCheckpoint     The state is saved by a different engine.
+     * @throw IllegalMethodCall `StdRng` is not trivially copyable.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
+    {
+        RestoreRng(reader, std::is_trivially_copyable<RngType>());
+    }
+
+private:
+    void SaveRng(CheckpointWriter& writer, std::true_type)
+    {
+        writer.WriteUint64(sizeof (rng_));
+        writer.WriteBytes(&rng_, sizeof (rng_));
+    }
+
+    void RestoreRng(CheckpointReader& reader, std::true_type)
+    {
+        if (reader.ReadUint64() != sizeof (rng_))
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("The state of the engine does not match."));
+        }
+        reader.ReadBytes(&rng_, sizeof (rng_));
+    }
+
+    void SaveRng(CheckpointWriter& writer, std::false_type)
+    {
+        BOOST_THROW_EXCEPTION(
+            IllegalMethodCall() <<
+            ErrorMessage("Cannot checkpoint the engine."));
+    }
+
+    void RestoreRng(CheckpointReader& reader, std::false_type)
+    {
+        BOOST_THROW_EXCEPTION(
+            IllegalMethodCall() <<
+            ErrorMessage("Cannot checkpoint the engine."));
+    }
+
 private:
     NSFX_INTERFACE_MAP_BEGIN(ThisClass)
         NSFX_INTERFACE_ENTRY(IPseudoRandomEngine)
         NSFX_INTERFACE_ENTRY(InterfaceType)
         NSFX_INTERFACE_ENTRY(IRandom)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
     NSFX_INTERFACE_MAP_END()
 
 private:
@@ -24,14 +24,37 @@
 
 #include <nsfx/simulation/i-event-handle.h>
 #include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-handle-pool.h>
 
 #include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-batch-scheduler.h>
+#include <nsfx/simulation/event-callable.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
+#include <nsfx/simulation/i-event-injector.h>
+#include <nsfx/simulation/event-injection-queue.h>
 #include <nsfx/simulation/list-scheduler.h>
 #include <nsfx/simulation/set-scheduler.h>
 #include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/calendar-scheduler.h>
+#include <nsfx/simulation/dary-heap-scheduler.h>
+#include <nsfx/simulation/i-timer-wheel.h>
+#include <nsfx/simulation/timer-wheel-scheduler.h>
 
 #include <nsfx/simulation/i-simulator.h>
 #include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/i-parallel-simulator.h>
+#include <nsfx/simulation/thread-barrier.h>
+#include <nsfx/simulation/parallel-simulator.h>
+#include <nsfx/simulation/i-state-saver.h>
+#include <nsfx/simulation/i-optimistic-simulator.h>
+#include <nsfx/simulation/optimistic-simulator.h>
+#include <nsfx/simulation/i-event-profiler.h>
+#include <nsfx/simulation/event-profiler.h>
+#include <nsfx/simulation/i-event-tracer.h>
+#include <nsfx/simulation/event-tracer.h>
+
+#include <nsfx/simulation/event-checkpoint.h>
+#include <nsfx/simulation/replication-runner.h>
 
 
 #endif // SIMULATION_H__3558CCE7_4DE5_4B7F_A9CF_44591D238478
@@ -0,0 +1,692 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef CALENDAR_SCHEDULER_H__22FAEB00_7760_4082_A99F_758A2F68DE28
+#define CALENDAR_SCHEDULER_H__22FAEB00_7760_4082_A99F_758A2F68DE28
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
+#include <nsfx/simulation/i-batch-scheduler.h>
+#include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-checkpoint.h>
+#include <nsfx/simulation/event-handle-pool.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/component/class-registry.h>
+#include <algorithm>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CalendarScheduler.
+/**
+ * @ingroup Simulator
+ * @brief An event scheduler based on calendar queue.
+ *
+ * # Uid
+ * @code
+ * "edu.uestc.nsfx.CalendarScheduler"
+ * @endcode
+ *
+ * # Interfaces
+ * * Uses
+ *   + `IClock`
+ * * Provides
+ *   + `IScheduler`
+ *   + `ICallableScheduler`
+ *   + `IBatchScheduler`
+ *   + `ICheckpointable`
+ *
+ * # Algorithm
+ * The calendar queue was proposed by R. Brown in 1988.
+ * The time axis is divided into *years*, and each year is divided into
+ * *days* of equal width.
+ * Each day of a year is mapped to a bucket, and a bucket holds the events
+ * that happen in the same day of any year.
+ *
+ * To find the next event, the scheduler scans the buckets from the current
+ * day, and picks the earliest event in a bucket that happens in the current
+ * year.
+ * If no event is found in a whole year, the scheduler searches the earliest
+ * event in all buckets directly.
+ *
+ * The events in a bucket are sorted by their time points and ids.
+ * Thus the events are fired in the same order as other schedulers.
+ *
+ * The number of buckets is doubled (halved) when the number of events is
+ * twice (half) the number of buckets.
+ * The width of a day is estimated from the average separation of the
+ * earliest events whenever the buckets are resized, or when too many empty
+ * buckets are scanned to find the next events.
+ *
+ * If the width of a day matches the distribution of the events, the cost of
+ * scheduling and removing an event is `O(1)` on average.
+ *
+ * A cancelled event is removed from its bucket immediately.
+ */
+class CalendarScheduler :
+    public IClockUser,
+    public IScheduler,
+    public ICallableScheduler,
+    public IBatchScheduler,
+    public ICheckpointable,
+    private EventHandleOwner
+{
+private:
+    typedef CalendarScheduler  ThisClass;
+    typedef EventHandlePool::HandleType  HandleType;
+    typedef chrono::count_t  count_t;
+
+private:
+    struct LessThan
+    {
+        bool operator()(const HandleType* lhs, const HandleType* rhs) const BOOST_NOEXCEPT
+        {
+            return *lhs < *rhs;
+        }
+    };
+
+    /**
+     * @brief A bucket of events.
+     *
+     * The events are sorted in the ascending order.
+     * The events before `head` have been removed.
+     */
+    struct Bucket
+    {
+        Bucket(void) BOOST_NOEXCEPT :
+            head(0)
+        {}
+
+        bool IsEmpty(void) const BOOST_NOEXCEPT
+        {
+            return head == events.size();
+        }
+
+        HandleType* GetFront(void) const BOOST_NOEXCEPT
+        {
+            return events[head];
+        }
+
+        void PopFront(void)
+        {
+            ++head;
+            if (head == events.size())
+            {
+                events.clear();
+                head = 0;
+            }
+            // Reclaim the space of the removed events.
+            else if (head >= 32 && head * 2 >= events.size())
+            {
+                events.erase(events.begin(), events.begin() + head);
+                head = 0;
+            }
+        }
+
+        void Insert(HandleType* handle)
+        {
+            // Most events are scheduled in the order of time points.
+            // Search backward for the insertion point.
+            auto it = events.end();
+            if (it != events.begin() + head && *handle < **(it - 1))
+            {
+                it = std::upper_bound(events.begin() + head, it - 1,
+                                      handle, LessThan());
+            }
+            events.insert(it, handle);
+        }
+
+        void Remove(HandleType* handle) BOOST_NOEXCEPT
+        {
+            auto it = std::lower_bound(events.begin() + head, events.end(),
+                                       handle, LessThan());
+            BOOST_ASSERT(it != events.end() && *it == handle);
+            events.erase(it);
+            if (head == events.size())
+            {
+                events.clear();
+                head = 0;
+            }
+        }
+
+        size_t head;
+        vector<HandleType*> events;
+    };
+
+private:
+    /**
+     * @brief The minimum number of buckets.
+     */
+    BOOST_STATIC_CONSTANT(size_t, MIN_NUM_BUCKETS = 2);
+
+    /**
+     * @brief The number of events sampled to estimate the width of a day.
+     */
+    BOOST_STATIC_CONSTANT(size_t, NUM_SAMPLES = 25);
+
+    /**
+     * @brief The average number of scanned buckets per removed event that
+     *        triggers the estimation of the width of a day.
+     */
+    BOOST_STATIC_CONSTANT(size_t, MAX_SCANS_PER_EVENT = 4);
+
+public:
+    CalendarScheduler(void) :
+        initialized_(false),
+        nextEventId_(0),
+        buckets_(MIN_NUM_BUCKETS),
+        mask_(MIN_NUM_BUCKETS - 1),
+        width_(Duration(MicroSeconds(1)).GetCount()),
+        numEvents_(0),
+        cursor_(0),
+        cursorTop_(width_),
+        numScanned_(0),
+        numRemoved_(0)
+    {}
+
+    virtual ~CalendarScheduler(void)
+    {
+        for (auto b = buckets_.begin(); b != buckets_.end(); ++b)
+        {
+            for (size_t i = b->head; i < b->events.size(); ++i)
+            {
+                b->events[i]->SetOwner(nullptr);
+                b->events[i]->Release();
+            }
+        }
+    }
+
+    // IClockUser /*{{{*/
+public:
+    virtual void Use(Ptr<IClock> clock) NSFX_OVERRIDE
+    {
+        if (initialized_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the clock after initialization."));
+        }
+        if (!clock)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        clock_ = clock;
+        initialized_ = true;
+    }
+
+    /*}}}*/
+
+    // IScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleNow(Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleAt(clock_->Now(), std::move(sink));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleIn(const Duration& dt,
+                                         Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleAt(clock_->Now() + dt, std::move(sink));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleAt(const TimePoint& t,
+                                         Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(sink));
+    }
+
+    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        return numEvents_;
+    }
+
+    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    {
+        IEventHandle* result = nullptr;
+        HandleType* handle = FindNextEvent();
+        if (handle)
+        {
+            result = handle->GetIntf();
+        }
+        return result;
+    }
+
+    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    {
+        HandleType* event = FindNextEvent();
+        if (event)
+        {
+            // Must remove the event before firing the event.
+            // Otherwise, during firing, new scheduling can corrupt the bucket.
+            buckets_[cursor_].PopFront();
+            event->SetOwner(nullptr);
+            --numEvents_;
+            ++numRemoved_;
+            if (numRemoved_ >= buckets_.size())
+            {
+                // Too many empty buckets are scanned.
+                if (numScanned_ > MAX_SCANS_PER_EVENT * numRemoved_)
+                {
+                    Resize(buckets_.size());
+                }
+                numScanned_ = 0;
+                numRemoved_ = 0;
+            }
+            CheckShrink();
+            try
+            {
+                event->Fire();
+            }
+            catch (...)
+            {
+                pool_.Deallocate(event);
+                throw;
+            }
+            pool_.Deallocate(event);
+        }
+    }
+
+    /*}}}*/
+
+    // ICallableScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now(), std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now() + dt, std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (callable.IsEmpty())
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(callable));
+    }
+
+    /*}}}*/
+
+private:
+    /**
+     * @brief Insert an event.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     */
+    template<class Target>
+    Ptr<IEventHandle> Insert(const TimePoint& t, Target&& target)
+    {
+        if (t < clock_->Now())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("Cannot schedule an event that "
+                             "happens before the current time.") <<
+                CurrentTimeErrorInfo(clock_->Now()) <<
+                ScheduledTimeErrorInfo(t));
+        }
+        HandleType* handle = pool_.Allocate(nextEventId_, t, std::move(target));
+        count_t tc = GetCount(handle);
+        try
+        {
+            buckets_[GetBucketIndex(tc, width_, mask_)].Insert(handle);
+        }
+        catch (std::bad_alloc& )
+        {
+            handle->Cancel();
+            pool_.Deallocate(handle);
+            throw;
+        }
+        ++nextEventId_;
+        handle->SetOwner(this);
+        // The event happens before the current day.
+        if (!numEvents_ || tc < cursorTop_ - width_)
+        {
+            MoveCursor(tc);
+        }
+        ++numEvents_;
+        if (numEvents_ > 2 * buckets_.size())
+        {
+            Resize(2 * buckets_.size());
+        }
+        return handle->GetIntf();
+    }
+
+    // IBatchScheduler /*{{{*/
+public:
+    virtual TimePoint GetNextTimePoint(void) NSFX_OVERRIDE
+    {
+        HandleType* event = FindNextEvent();
+        if (!event)
+        {
+            BOOST_THROW_EXCEPTION(NoScheduledEvent());
+        }
+        return event->GetTimePoint();
+    }
+
+    virtual uint64_t FireAndRemoveNextEvents(const bool& stop) NSFX_OVERRIDE
+    {
+        uint64_t n = 0;
+        HandleType* event = FindNextEvent();
+        if (event)
+        {
+            TimePoint t = event->GetTimePoint();
+            do
+            {
+                ThisClass::FireAndRemoveNextEvent();
+                ++n;
+                event = FindNextEvent();
+            }
+            while (!stop && event && event->GetTimePoint() == t);
+        }
+        return n;
+    }
+
+    /*}}}*/
+
+    // ICheckpointable /*{{{*/
+public:
+    /**
+     * @brief Save the pending events.
+     *
+     * @throw IllegalMethodCall An event cannot be checkpointed.
+     *                          e.g., it is scheduled as a callable.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
+    {
+        vector<EventHandle*> events;
+        events.reserve(numEvents_);
+        for (auto b = buckets_.cbegin(); b != buckets_.cend(); ++b)
+        {
+            events.insert(events.end(),
+                          b->events.begin() + b->head, b->events.end());
+        }
+        SaveEvents(writer, nextEventId_, events);
+    }
+
+    /**
+     * @brief Restore the pending events.
+     *
+     * The events are scheduled with their original ids, so the events that
+     * happen at the same time are fired in the original order.
+     * The clock **must** have been restored, since the events cannot be
+     * scheduled before the current time.
+     *
+     * @throw Uninitialized     The scheduler is not initialized.
+     * @throw IllegalMethodCall There are pending events.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (numEvents_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot restore a checkpoint into a scheduler "
+                             "that has pending events."));
+        }
+        nextEventId_ = RestoreEvents(reader,
+            [this] (const TimePoint& t, event_id_t id, Ptr<IEventSink<>>&& sink) {
+                nextEventId_ = id;
+                Insert(t, std::move(sink));
+            });
+    }
+
+    /*}}}*/
+
+    // EventHandleOwner /*{{{*/
+private:
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        HandleType* event = static_cast<HandleType*>(handle);
+        buckets_[GetBucketIndex(GetCount(event), width_, mask_)].Remove(event);
+        --numEvents_;
+        CheckShrink();
+        pool_.Deallocate(event);
+    }
+
+    /*}}}*/
+
+private:
+    static count_t GetCount(HandleType* handle) BOOST_NOEXCEPT
+    {
+        return handle->GetTimePoint().GetDuration().GetCount();
+    }
+
+    /**
+     * @brief Get the index of the day since the epoch.
+     *
+     * Rounds toward negative infinity.
+     */
+    static count_t GetDay(count_t t, count_t width) BOOST_NOEXCEPT
+    {
+        count_t day = t / width;
+        if (t < 0 && day * width != t)
+        {
+            --day;
+        }
+        return day;
+    }
+
+    static size_t GetBucketIndex(count_t t, count_t width, size_t mask) BOOST_NOEXCEPT
+    {
+        return static_cast<size_t>(GetDay(t, width)) & mask;
+    }
+
+    void CheckShrink(void) BOOST_NOEXCEPT
+    {
+        if (buckets_.size() > MIN_NUM_BUCKETS &&
+            numEvents_ < buckets_.size() / 2)
+        {
+            Resize(buckets_.size() / 2);
+        }
+    }
+
+    /**
+     * @brief Move the cursor to the day of a time point.
+     */
+    void MoveCursor(count_t t) BOOST_NOEXCEPT
+    {
+        count_t day = GetDay(t, width_);
+        cursor_ = static_cast<size_t>(day) & mask_;
+        cursorTop_ = (day + 1) * width_;
+    }
+
+    /**
+     * @brief Find the next event, and move the cursor to its bucket.
+     *
+     * All events happen at or after the beginning of the day pointed by
+     * the cursor.
+     */
+    HandleType* FindNextEvent(void) BOOST_NOEXCEPT
+    {
+        HandleType* next = nullptr;
+        if (numEvents_)
+        {
+            for (size_t i = 0; i < buckets_.size(); ++i)
+            {
+                const Bucket& b = buckets_[cursor_];
+                if (!b.IsEmpty() && GetCount(b.GetFront()) < cursorTop_)
+                {
+                    next = b.GetFront();
+                    break;
+                }
+                cursor_ = (cursor_ + 1) & mask_;
+                cursorTop_ += width_;
+                ++numScanned_;
+            }
+            // Search the buckets directly.
+            if (!next)
+            {
+                for (auto b = buckets_.cbegin(); b != buckets_.cend(); ++b)
+                {
+                    if (!b->IsEmpty() && (!next || *b->GetFront() < *next))
+                    {
+                        next = b->GetFront();
+                    }
+                }
+                MoveCursor(GetCount(next));
+            }
+        }
+        return next;
+    }
+
+    /**
+     * @brief Estimate the width of a day.
+     *
+     * Use the average separation of the earliest events.
+     * The separations that are larger than twice of the average are
+     * discarded, and the width is three times the average of the remaining
+     * separations.
+     */
+    count_t EstimateWidth(void) const
+    {
+        count_t width = width_;
+        size_t n = (std::min)(numEvents_, static_cast<size_t>(NUM_SAMPLES));
+        if (n >= 2)
+        {
+            vector<HandleType*> events;
+            events.reserve(numEvents_);
+            for (auto b = buckets_.cbegin(); b != buckets_.cend(); ++b)
+            {
+                events.insert(events.end(),
+                              b->events.begin() + b->head, b->events.end());
+            }
+            std::partial_sort(events.begin(), events.begin() + n,
+                              events.end(), LessThan());
+            count_t total = GetCount(events[n-1]) - GetCount(events[0]);
+            count_t limit = 2 * total / static_cast<count_t>(n - 1);
+            count_t sum = 0;
+            count_t m = 0;
+            for (size_t i = 1; i < n; ++i)
+            {
+                count_t sep = GetCount(events[i]) - GetCount(events[i-1]);
+                if (sep <= limit)
+                {
+                    sum += sep;
+                    ++m;
+                }
+            }
+            if (sum)
+            {
+                width = 3 * sum / m;
+                if (!width)
+                {
+                    width = 1;
+                }
+            }
+        }
+        return width;
+    }
+
+    /**
+     * @brief Redistribute the events into a number of buckets.
+     *
+     * @param[in] numBuckets It **must** be a power of `2`.
+     *
+     * If there is not enough memory, the buckets are not changed.
+     */
+    void Resize(size_t numBuckets) BOOST_NOEXCEPT
+    {
+        try
+        {
+            count_t width = EstimateWidth();
+            size_t mask = numBuckets - 1;
+            vector<Bucket> buckets(numBuckets);
+            for (auto b = buckets_.cbegin(); b != buckets_.cend(); ++b)
+            {
+                for (size_t i = b->head; i < b->events.size(); ++i)
+                {
+                    HandleType* handle = b->events[i];
+                    size_t index = GetBucketIndex(GetCount(handle), width, mask);
+                    buckets[index].Insert(handle);
+                }
+            }
+            // All events happen at or after the beginning of the current day.
+            count_t t = cursorTop_ - width_;
+            buckets_.swap(buckets);
+            mask_ = mask;
+            width_ = width;
+            MoveCursor(t);
+        }
+        catch (std::bad_alloc& )
+        {
+            // Keep the buckets unchanged.
+        }
+    }
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IClockUser)
+        NSFX_INTERFACE_ENTRY(IScheduler)
+        NSFX_INTERFACE_ENTRY(ICallableScheduler)
+        NSFX_INTERFACE_ENTRY(IBatchScheduler)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    bool  initialized_;
+    Ptr<IClock>  clock_;
+    event_id_t   nextEventId_;
+
+    vector<Bucket>  buckets_;
+    size_t   mask_;      ///< The number of buckets minus 1.
+    count_t  width_;     ///< The width of a day.
+    size_t   numEvents_;
+    size_t   cursor_;    ///< The bucket of the current day.
+    count_t  cursorTop_; ///< The end of the current day.
+
+    // Statistics to tune the width of a day.
+    size_t  numScanned_; ///< The number of scanned empty buckets.
+    size_t  numRemoved_; ///< The number of removed events.
+
+    EventHandlePool  pool_;
+
+}; // class CalendarScheduler
+
+
+NSFX_REGISTER_CLASS(CalendarScheduler, "edu.uestc.nsfx.CalendarScheduler");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // CALENDAR_SCHEDULER_H__22FAEB00_7760_4082_A99F_758A2F68DE28
+
@@ -0,0 +1,473 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef DARY_HEAP_SCHEDULER_H__4315BA7F_94F6_45DF_A501_2970A4952C18
+#define DARY_HEAP_SCHEDULER_H__4315BA7F_94F6_45DF_A501_2970A4952C18
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
+#include <nsfx/simulation/i-batch-scheduler.h>
+#include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-checkpoint.h>
+#include <nsfx/simulation/event-handle-pool.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/component/class-registry.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DaryHeapScheduler.
+/**
+ * @ingroup Simulator
+ * @brief An event scheduler based on a 4-ary heap.
+ *
+ * The heap stores the time point and the id of each event inline, along with
+ * the pointer to the event handle.
+ * The comparisons during sifting read the contiguous storage of the heap only.
+ * However, each move of an event during sifting writes the new position of the
+ * event to its handle, so a cancelled event can be removed from the heap
+ * immediately.
+ *
+ * A 4-ary heap is half as deep as a binary heap, and the children of a node
+ * are adjacent in memory.
+ * Popping an event reads more keys per level, but they are likely to lie in
+ * the same cache line.
+ *
+ * The event handles are recycled via an `EventHandlePool`, and a cancelled
+ * event is removed from the heap immediately, as `HeapScheduler` does.
+ *
+ * # Uid
+ * @code
+ * "edu.uestc.nsfx.DaryHeapScheduler"
+ * @endcode
+ *
+ * # Interfaces
+ * * Uses
+ *   + `IClock`
+ * * Provides
+ *   + `IScheduler`
+ *   + `ICallableScheduler`
+ *   + `IBatchScheduler`
+ *   + `ICheckpointable`
+ */
+class DaryHeapScheduler :
+    public IClockUser,
+    public IScheduler,
+    public ICallableScheduler,
+    public IBatchScheduler,
+    public ICheckpointable,
+    private EventHandleOwner
+{
+private:
+    typedef DaryHeapScheduler  ThisClass;
+    typedef EventHandlePool::HandleType  HandleType;
+
+    /**
+     * @brief The number of children of a node.
+     */
+    static const size_t ARITY = 4;
+
+    /**
+     * @brief An event in the heap.
+     */
+    struct Entry
+    {
+        Entry(const TimePoint& t, event_id_t id, HandleType* handle) BOOST_NOEXCEPT :
+            t_(t),
+            id_(id),
+            handle_(handle)
+        {}
+
+        bool operator<(const Entry& rhs) const BOOST_NOEXCEPT
+        {
+            return (t_ < rhs.t_) || (t_ == rhs.t_ && id_ < rhs.id_);
+        }
+
+        TimePoint   t_;
+        event_id_t  id_;
+        HandleType* handle_;
+    };
+
+public:
+    DaryHeapScheduler(void) BOOST_NOEXCEPT :
+        initialized_(false),
+        nextEventId_(0)
+    {}
+
+    virtual ~DaryHeapScheduler(void)
+    {
+        for (auto it = events_.begin(); it != events_.end(); ++it)
+        {
+            it->handle_->SetOwner(nullptr);
+            it->handle_->Release();
+        }
+    }
+
+    // IClockUser /*{{{*/
+public:
+    virtual void Use(Ptr<IClock> clock) NSFX_OVERRIDE
+    {
+        if (initialized_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the clock after initialization."));
+        }
+        if (!clock)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        clock_ = clock;
+        initialized_ = true;
+    }
+
+    /*}}}*/
+
+    // IScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleNow(Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleAt(clock_->Now(), std::move(sink));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleIn(const Duration& dt,
+                                         Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleAt(clock_->Now() + dt, std::move(sink));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleAt(const TimePoint& t,
+                                         Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(sink));
+    }
+
+    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        return events_.size();
+    }
+
+    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    {
+        IEventHandle* result = nullptr;
+        if (events_.size())
+        {
+            result = events_.front().handle_->GetIntf();
+        }
+        return result;
+    }
+
+    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    {
+        if (events_.size())
+        {
+            HandleType* event = events_.front().handle_;
+            // Must remove the event before firing the event.
+            // Otherwise, during firing, new scheduling can corrupt the heap.
+            RemoveAt(0);
+            event->SetOwner(nullptr);
+            try
+            {
+                event->Fire();
+            }
+            catch (...)
+            {
+                pool_.Deallocate(event);
+                throw;
+            }
+            pool_.Deallocate(event);
+        }
+    }
+
+    /*}}}*/
+
+    // ICallableScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now(), std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now() + dt, std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (callable.IsEmpty())
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(callable));
+    }
+
+    /*}}}*/
+
+private:
+    /**
+     * @brief Insert an event.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     */
+    template<class Target>
+    Ptr<IEventHandle> Insert(const TimePoint& t, Target&& target)
+    {
+        if (t < clock_->Now())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("Cannot schedule an event that "
+                             "happens before the current time.") <<
+                CurrentTimeErrorInfo(clock_->Now()) <<
+                ScheduledTimeErrorInfo(t));
+        }
+        HandleType* handle = pool_.Allocate(nextEventId_, t, std::move(target));
+        try
+        {
+            events_.push_back(Entry(t, nextEventId_, handle));
+        }
+        catch (std::bad_alloc& )
+        {
+            handle->Cancel();
+            pool_.Deallocate(handle);
+            throw;
+        }
+        ++nextEventId_;
+        SiftUp(events_.size() - 1);
+        handle->SetOwner(this);
+        return handle->GetIntf();
+    }
+
+    // IBatchScheduler /*{{{*/
+public:
+    virtual TimePoint GetNextTimePoint(void) NSFX_OVERRIDE
+    {
+        if (events_.empty())
+        {
+            BOOST_THROW_EXCEPTION(NoScheduledEvent());
+        }
+        return events_.front().t_;
+    }
+
+    virtual uint64_t FireAndRemoveNextEvents(const bool& stop) NSFX_OVERRIDE
+    {
+        uint64_t n = 0;
+        if (events_.size())
+        {
+            TimePoint t = events_.front().t_;
+            do
+            {
+                ThisClass::FireAndRemoveNextEvent();
+                ++n;
+            }
+            while (!stop && events_.size() && events_.front().t_ == t);
+        }
+        return n;
+    }
+
+    /*}}}*/
+
+    // ICheckpointable /*{{{*/
+public:
+    /**
+     * @brief Save the pending events.
+     *
+     * @throw IllegalMethodCall An event cannot be checkpointed.
+     *                          e.g., it is scheduled as a callable.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
+    {
+        vector<EventHandle*> events;
+        events.reserve(events_.size());
+        for (auto it = events_.cbegin(); it != events_.cend(); ++it)
+        {
+            events.push_back(it->handle_);
+        }
+        SaveEvents(writer, nextEventId_, events);
+    }
+
+    /**
+     * @brief Restore the pending events.
+     *
+     * The events are scheduled with their original ids, so the events that
+     * happen at the same time are fired in the original order.
+     * The clock **must** have been restored, since the events cannot be
+     * scheduled before the current time.
+     *
+     * @throw Uninitialized     The scheduler is not initialized.
+     * @throw IllegalMethodCall There are pending events.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (events_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot restore a checkpoint into a scheduler "
+                             "that has pending events."));
+        }
+        nextEventId_ = RestoreEvents(reader,
+            [this] (const TimePoint& t, event_id_t id, Ptr<IEventSink<>>&& sink) {
+                nextEventId_ = id;
+                Insert(t, std::move(sink));
+            });
+    }
+
+    /*}}}*/
+
+    // EventHandleOwner /*{{{*/
+private:
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        HandleType* event = static_cast<HandleType*>(handle);
+        BOOST_ASSERT(events_[event->GetIndex()].handle_ == event);
+        RemoveAt(event->GetIndex());
+        pool_.Deallocate(event);
+    }
+
+    /*}}}*/
+
+    // Heap operations. /*{{{*/
+private:
+    /**
+     * @brief Move the event at a slot toward the root.
+     */
+    void SiftUp(size_t i) BOOST_NOEXCEPT
+    {
+        Entry entry = events_[i];
+        while (i > 0)
+        {
+            size_t parent = (i - 1) / ARITY;
+            if (!(entry < events_[parent]))
+            {
+                break;
+            }
+            events_[i] = events_[parent];
+            events_[i].handle_->SetIndex(i);
+            i = parent;
+        }
+        events_[i] = entry;
+        entry.handle_->SetIndex(i);
+    }
+
+    /**
+     * @brief Move the event at a slot toward the leaves.
+     */
+    void SiftDown(size_t i) BOOST_NOEXCEPT
+    {
+        size_t n = events_.size();
+        Entry entry = events_[i];
+        while (true)
+        {
+            size_t first = ARITY * i + 1;
+            if (first >= n)
+            {
+                break;
+            }
+            size_t last = (first + ARITY < n) ? first + ARITY : n;
+            // Find the earliest child.
+            size_t child = first;
+            for (size_t j = first + 1; j < last; ++j)
+            {
+                if (events_[j] < events_[child])
+                {
+                    child = j;
+                }
+            }
+            if (!(events_[child] < entry))
+            {
+                break;
+            }
+            events_[i] = events_[child];
+            events_[i].handle_->SetIndex(i);
+            i = child;
+        }
+        events_[i] = entry;
+        entry.handle_->SetIndex(i);
+    }
+
+    /**
+     * @brief Remove the event at a slot.
+     */
+    void RemoveAt(size_t i) BOOST_NOEXCEPT
+    {
+        Entry last = events_.back();
+        events_.pop_back();
+        if (i < events_.size())
+        {
+            events_[i] = last;
+            if (i > 0 && last < events_[(i - 1) / ARITY])
+            {
+                SiftUp(i);
+            }
+            else
+            {
+                SiftDown(i);
+            }
+        }
+    }
+
+    /*}}}*/
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IClockUser)
+        NSFX_INTERFACE_ENTRY(IScheduler)
+        NSFX_INTERFACE_ENTRY(ICallableScheduler)
+        NSFX_INTERFACE_ENTRY(IBatchScheduler)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    bool  initialized_;
+    Ptr<IClock>  clock_;
+    event_id_t   nextEventId_;
+    vector<Entry>  events_;
+    EventHandlePool  pool_;
+
+}; // class DaryHeapScheduler
+
+
+NSFX_REGISTER_CLASS(DaryHeapScheduler, "edu.uestc.nsfx.DaryHeapScheduler");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // DARY_HEAP_SCHEDULER_H__4315BA7F_94F6_45DF_A501_2970A4952C18
+
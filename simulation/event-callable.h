@@ -0,0 +1,309 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef EVENT_CALLABLE_H__6615A48D_11EE_456F_81B9_14D70D56A71D
+#define EVENT_CALLABLE_H__6615A48D_11EE_456F_81B9_14D70D56A71D
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/event/event-sink.h>
+#include <nsfx/component/ptr.h>
+#include <type_traits>
+#include <typeinfo>
+#include <new>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventCallable.
+/**
+ * @ingroup Simulator
+ * @brief A type-erased callable of an event.
+ *
+ * A small callable is stored inline, i.e., scheduling it does not allocate
+ * memory, and firing it does not dispatch through `IEventSink`.
+ *
+ * A callable is stored inline if its size is no greater than `CAPACITY`,
+ * its alignment requirement is satisfied by the inline storage, and it is
+ * nothrow move constructible.
+ * Otherwise, it is wrapped in an event sink via `CreateEventSink()`,
+ * and the event sink is stored inline.
+ *
+ * The callable is forwarded to the constructor, i.e., it is moved if it is
+ * an rvalue, and copied otherwise.
+ * The `EventCallable` owns the stored callable, and is move-only.
+ * Moving an `EventCallable` move-constructs the stored callable in the new
+ * storage and destroys the old one, and it happens each time the
+ * `EventCallable` is passed on, e.g., from a scheduler to an event handle.
+ * A callable that is wrapped in an event sink is not moved after it is
+ * wrapped; only the pointer to the event sink is moved.
+ */
+class EventCallable
+{
+public:
+    /**
+     * @brief The size of the inline storage.
+     */
+    static const size_t CAPACITY = 4 * sizeof(void*);
+
+private:
+    typedef std::aligned_storage<CAPACITY>::type  StorageType;
+
+    /**
+     * @brief The operations on a stored callable.
+     */
+    struct Ops
+    {
+        void (*invoke_)(void* p);
+        void (*move_)(void* dst, void* src);
+        void (*destroy_)(void* p);
+        const std::type_info& (*type_)(void);
+    };
+
+    /**
+     * @brief A callable that is too large to be stored inline.
+     */
+    struct SinkCallable
+    {
+        template<class F>
+        explicit SinkCallable(F&& f) :
+            sink_(CreateEventSink<IEventSink<>>(
+                      nullptr,
+                      // Store a copy of the callable in the event sink.
+                      typename std::decay<F>::type(std::forward<F>(f))))
+        {}
+
+        SinkCallable(SinkCallable&& rhs) BOOST_NOEXCEPT :
+            sink_(std::move(rhs.sink_))
+        {}
+
+        void operator()(void)
+        {
+            sink_->Fire();
+        }
+
+        Ptr<IEventSink<>>  sink_;
+    };
+
+    /**
+     * @brief The operations on a stored object of type `T`.
+     *
+     * @tparam T The type of the stored object.
+     * @tparam F The type of the callable provided by the user.
+     */
+    template<class T, class F>
+    struct Model
+    {
+        static void Invoke(void* p)
+        {
+            (*static_cast<T*>(p))();
+        }
+
+        static void Move(void* dst, void* src) BOOST_NOEXCEPT
+        {
+            ::new (dst) T(std::move(*static_cast<T*>(src)));
+            static_cast<T*>(src)->~T();
+        }
+
+        static void Destroy(void* p) BOOST_NOEXCEPT
+        {
+            static_cast<T*>(p)->~T();
+        }
+
+        static const std::type_info& Type(void)
+        {
+            return typeid(F);
+        }
+
+        static const Ops ops_;
+    };
+
+    template<class F>
+    struct IsInline :
+        std::integral_constant<bool,
+            sizeof (F) <= CAPACITY &&
+            std::alignment_of<StorageType>::value %
+                std::alignment_of<F>::value == 0 &&
+            std::is_nothrow_move_constructible<F>::value>
+    {};
+
+public:
+    EventCallable(void) BOOST_NOEXCEPT :
+        ops_(nullptr),
+        armed_(false)
+    {}
+
+    /**
+     * @brief Store a callable.
+     *
+     * @tparam F A callable type of signature `void()`.
+     */
+    template<class F>
+    explicit EventCallable(F&& f,
+                           typename std::enable_if<!std::is_same<
+                               typename std::decay<F>::type, EventCallable
+                           >::value>::type* = nullptr) :
+        ops_(nullptr),
+        armed_(false)
+    {
+        typedef typename std::decay<F>::type  Decayed;
+        Store(std::forward<F>(f), IsInline<Decayed>());
+    }
+
+    EventCallable(EventCallable&& rhs) BOOST_NOEXCEPT :
+        ops_(rhs.ops_),
+        armed_(rhs.armed_)
+    {
+        if (ops_)
+        {
+            ops_->move_(&storage_, &rhs.storage_);
+            rhs.ops_ = nullptr;
+            rhs.armed_ = false;
+        }
+    }
+
+    EventCallable& operator=(EventCallable&& rhs) BOOST_NOEXCEPT
+    {
+        if (this != &rhs)
+        {
+            Clear();
+            if (rhs.ops_)
+            {
+                rhs.ops_->move_(&storage_, &rhs.storage_);
+                ops_ = rhs.ops_;
+                armed_ = rhs.armed_;
+                rhs.ops_ = nullptr;
+                rhs.armed_ = false;
+            }
+        }
+        return *this;
+    }
+
+    ~EventCallable(void)
+    {
+        Clear();
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(EventCallable(const EventCallable& ));
+    BOOST_DELETED_FUNCTION(EventCallable& operator=(const EventCallable& ));
+
+public:
+    /**
+     * @brief Is the callable armed?
+     *
+     * A callable is armed after it is stored, and until it is disarmed or
+     * cleared.
+     */
+    bool IsArmed(void) const BOOST_NOEXCEPT
+    {
+        return armed_;
+    }
+
+    /**
+     * @brief Is there a stored callable?
+     */
+    bool IsEmpty(void) const BOOST_NOEXCEPT
+    {
+        return !ops_;
+    }
+
+    /**
+     * @brief Invoke the stored callable.
+     */
+    void Invoke(void)
+    {
+        BOOST_ASSERT(ops_);
+        ops_->invoke_(&storage_);
+    }
+
+    /**
+     * @brief Disarm the callable without destroying it.
+     *
+     * It is used to cancel a callable while it is being invoked.
+     */
+    void Disarm(void) BOOST_NOEXCEPT
+    {
+        armed_ = false;
+    }
+
+    /**
+     * @brief Destroy the stored callable.
+     */
+    void Clear(void) BOOST_NOEXCEPT
+    {
+        if (ops_)
+        {
+            const Ops* ops = ops_;
+            ops_ = nullptr;
+            armed_ = false;
+            ops->destroy_(&storage_);
+        }
+    }
+
+    /**
+     * @brief Get the type of the callable provided by the user.
+     */
+    const std::type_info& GetType(void) const
+    {
+        BOOST_ASSERT(ops_);
+        return ops_->type_();
+    }
+
+private:
+    template<class F>
+    void Store(F&& f, std::true_type /* inline */)
+    {
+        typedef typename std::decay<F>::type  Decayed;
+        ::new (&storage_) Decayed(std::forward<F>(f));
+        ops_ = &Model<Decayed, Decayed>::ops_;
+        armed_ = true;
+    }
+
+    template<class F>
+    void Store(F&& f, std::false_type /* inline */)
+    {
+        typedef typename std::decay<F>::type  Decayed;
+        ::new (&storage_) SinkCallable(std::forward<F>(f));
+        ops_ = &Model<SinkCallable, Decayed>::ops_;
+        armed_ = true;
+    }
+
+private:
+    StorageType  storage_;
+    const Ops*   ops_;
+    bool  armed_;
+
+}; // class EventCallable
+
+
+template<class T, class F>
+const EventCallable::Ops EventCallable::Model<T, F>::ops_ = {
+    &EventCallable::Model<T, F>::Invoke,
+    &EventCallable::Model<T, F>::Move,
+    &EventCallable::Model<T, F>::Destroy,
+    &EventCallable::Model<T, F>::Type
+};
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // EVENT_CALLABLE_H__6615A48D_11EE_456F_81B9_14D70D56A71D
+
@@ -0,0 +1,156 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef EVENT_CHECKPOINT_H__B1E2D47F_FFC8_4D8E_86D7_BC44BB48B13B
+#define EVENT_CHECKPOINT_H__B1E2D47F_FFC8_4D8E_86D7_BC44BB48B13B
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/event-handle.h>
+#include <nsfx/component/i-checkpointable.h>
+#include <nsfx/component/checkpoint-stream.h>
+#include <nsfx/component/class-registry.h>
+#include <nsfx/component/ptr.h>
+#include <algorithm>
+#include <utility> // move
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @ingroup Simulator
+ * @brief Save the pending events of a scheduler.
+ *
+ * @param[in] writer      The checkpoint writer.
+ * @param[in] nextEventId The id of the next event to be scheduled.
+ * @param[in] events      The pending events in any order.
+ *                        They are sorted by their ids.
+ *
+ * The time point, the id, and the event sink of each event are saved.
+ * An event sink **must** provide `IClassIdentity` and `ICheckpointable`,
+ * so it can be re-created via its class UID when the checkpoint is restored.
+ *
+ * @throw IllegalMethodCall An event is fired by a callable, or its event sink
+ *                          cannot be checkpointed.
+ */
+inline void SaveEvents(CheckpointWriter& writer, event_id_t nextEventId,
+                       vector<EventHandle*>& events)
+{
+    std::sort(events.begin(), events.end(),
+              [] (EventHandle* lhs, EventHandle* rhs) {
+                  return lhs->GetId() < rhs->GetId();
+              });
+    writer.WriteUint64(nextEventId);
+    writer.WriteUint64(events.size());
+    // The ids are increasing, and they are delta-encoded.
+    event_id_t id = 0;
+    for (auto it = events.begin(); it != events.end(); ++it)
+    {
+        EventHandle* event = *it;
+        IEventSink<>* sink = event->GetSink();
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot checkpoint an event that is "
+                             "scheduled as a callable."));
+        }
+        Ptr<IClassIdentity> identity;
+        Ptr<ICheckpointable> state;
+        try
+        {
+            identity = sink;
+            state = sink;
+        }
+        catch (NoInterface& )
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot checkpoint an event sink that does not "
+                             "provide IClassIdentity and ICheckpointable."));
+        }
+        writer.WriteInt64(event->GetTimePoint().GetDuration().GetCount());
+        writer.WriteUint64(event->GetId() - id);
+        id = event->GetId();
+        writer.WriteString(static_cast<const char*>(identity->GetClassUid()));
+        state->SaveCheckpoint(writer);
+    }
+}
+
+/**
+ * @ingroup Simulator
+ * @brief Restore the pending events of a scheduler.
+ *
+ * @tparam Insert A functor of signature
+ *                `void(const TimePoint& t, event_id_t id,
+ *                      Ptr<IEventSink<>>&& sink)`.
+ *                It is called for each event in the ascending order of ids.
+ *
+ * @return The id of the next event to be scheduled.
+ *
+ * The event sinks are created via `CreateObject()`, and their states are
+ * restored.
+ *
+ * @throw BadCheckpoint      The checkpoint is corrupted, or the class of an
+ *                           event sink does not provide \c ICheckpointable
+ *                           and \c IEventSink<>.
+ * @throw ClassNotRegistered The class of an event sink is not registered.
+ */
+template<class Insert>
+inline event_id_t RestoreEvents(CheckpointReader& reader, Insert&& insert)
+{
+    event_id_t nextEventId = reader.ReadUint64();
+    uint64_t numEvents = reader.ReadUint64();
+    event_id_t id = 0;
+    for (uint64_t i = 0; i < numEvents; ++i)
+    {
+        TimePoint t(Duration(reader.ReadInt64()));
+        id += reader.ReadUint64();
+        if (id >= nextEventId)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("Invalid event id in the checkpoint."));
+        }
+        std::string cid = reader.ReadString();
+        Ptr<ICheckpointable> state;
+        Ptr<IEventSink<>> sink;
+        try
+        {
+            state = CreateObject<ICheckpointable>(cid.c_str());
+            sink = Ptr<IEventSink<>>(state);
+        }
+        catch (NoInterface& )
+        {
+            BOOST_THROW_EXCEPTION(
+                BadCheckpoint() <<
+                ErrorMessage("The class of an event sink in the checkpoint "
+                             "is not a checkpointable event sink.") <<
+                ClassUidErrorInfo(cid.c_str()));
+        }
+        state->RestoreCheckpoint(reader);
+        insert(t, id, std::move(sink));
+    }
+    return nextEventId;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // EVENT_CHECKPOINT_H__B1E2D47F_FFC8_4D8E_86D7_BC44BB48B13B
+
@@ -0,0 +1,152 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef EVENT_HANDLE_POOL_H__79681017_035E_431B_BBB5_3E68CC4703DF
+#define EVENT_HANDLE_POOL_H__79681017_035E_431B_BBB5_3E68CC4703DF
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/event-handle.h>
+#include <nsfx/component/object.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventHandlePool.
+/**
+ * @ingroup Simulator
+ * @brief A free-list of event handles owned by a scheduler.
+ *
+ * A scheduler allocates an event handle for every scheduled event, and
+ * releases it after the event is fired or cancelled.
+ * In most cases, no one else holds a reference to the event handle,
+ * and the handle can be reused for the next scheduled event.
+ *
+ * The pool holds one reference to each allocated event handle on behalf of
+ * the scheduler.
+ * When the scheduler deallocates an event handle, and the reference count
+ * drops to the reference held by the scheduler, the event handle is kept in
+ * the free-list, instead of being deleted.
+ * Otherwise, the event handle is released, and it is deleted when the last
+ * user releases it.
+ *
+ * Therefore, in a steady state, scheduling an event does not allocate memory
+ * for the event handle.
+ */
+class EventHandlePool
+{
+public:
+    typedef Object<EventHandle>  HandleType;
+
+public:
+    EventHandlePool(void) BOOST_NOEXCEPT {}
+
+    ~EventHandlePool(void)
+    {
+        for (auto it = free_.begin(); it != free_.end(); ++it)
+        {
+            (*it)->Release();
+        }
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(EventHandlePool(const EventHandlePool& ));
+    BOOST_DELETED_FUNCTION(EventHandlePool& operator=(const EventHandlePool& ));
+
+public:
+    /**
+     * @brief Allocate an event handle.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     *
+     * @return The event handle holds one reference that is owned by the caller.
+     *         The caller **must** call `Deallocate()` to give the reference
+     *         back to the pool.
+     */
+    template<class Target>
+    HandleType* Allocate(event_id_t id, const TimePoint& t, Target&& target)
+    {
+        HandleType* handle = nullptr;
+        if (free_.size())
+        {
+            handle = free_.back();
+            free_.pop_back();
+            handle->Reset(id, t, std::move(target));
+        }
+        else
+        {
+            handle = new HandleType(id, t, std::move(target));
+            handle->AddRef();
+        }
+        return handle;
+    }
+
+    /**
+     * @brief Deallocate an event handle.
+     *
+     * @param[in] handle The event handle that has been fired or cancelled.
+     *
+     * If the caller holds the only reference to the event handle, the event
+     * handle is kept for reuse.
+     * Otherwise, the reference is released.
+     */
+    void Deallocate(HandleType* handle) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(handle);
+        BOOST_ASSERT(!handle->IsValid());
+        // HandleType is a final class, the calls are not dispatched virtually.
+        // Probe the reference count without releasing the handle.
+        if (handle->AddRef() == 2)
+        {
+            handle->Release();
+            try
+            {
+                free_.push_back(handle);
+            }
+            catch (std::bad_alloc& )
+            {
+                handle->Release();
+            }
+        }
+        else
+        {
+            handle->Release();
+            handle->Release();
+        }
+    }
+
+    /**
+     * @brief Get the number of free event handles.
+     */
+    size_t GetNumFreeHandles(void) const BOOST_NOEXCEPT
+    {
+        return free_.size();
+    }
+
+private:
+    vector<HandleType*>  free_;
+
+}; // class EventHandlePool
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // EVENT_HANDLE_POOL_H__79681017_035E_431B_BBB5_3E68CC4703DF
+
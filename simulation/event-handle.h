@@ -19,22 +19,67 @@
 
 #include <nsfx/simulation/config.h>
 #include <nsfx/simulation/i-event-handle.h>
+#include <nsfx/simulation/event-callable.h>
 #include <nsfx/component/object.h>
 #include <nsfx/component/ptr.h>
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+# include <nsfx/simulation/event-profiler.h>
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
+#if defined(NSFX_SIMULATOR_USES_TRACER)
+# include <nsfx/simulation/event-tracer.h>
+#endif // defined(NSFX_SIMULATOR_USES_TRACER)
 
 
 NSFX_OPEN_NAMESPACE
 
 
+////////////////////////////////////////////////////////////////////////////////
+// Types.
+class EventHandle;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventHandleOwner.
+/**
+ * @ingroup Simulator
+ * @brief The owner of pending event handles.
+ *
+ * A scheduler implements this class to remove cancelled events eagerly.
+ */
+class EventHandleOwner
+{
+public:
+    virtual ~EventHandleOwner(void) {}
+
+    /**
+     * @brief Remove a cancelled event.
+     *
+     * @param[in] handle The cancelled event handle.
+     *                   The caller holds a reference to the event handle.
+     */
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT = 0;
+
+};
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // EventHandle.
 /**
  * @ingroup Simulator
  * @brief An event handle.
  *
+ * The event is fired by either an event sink, or a callable that is stored
+ * inline in the event handle.
+ *
  * # Interfaces
  * * Provides
  *   + `IEventHandle`
+ *
+ * # Cancellation
+ * When a pending event is cancelled, the event handle notifies its owner
+ * (the scheduler) to remove the event immediately.
+ * A scheduler **must** clear the owner before firing the event, and before
+ * the scheduler is destroyed.
  */
 class EventHandle :
     public IEventHandle
@@ -46,7 +91,9 @@ public:
         id_(id),
         t_(t),
         sink_(sink),
-        running_(false)
+        running_(false),
+        owner_(nullptr),
+        index_(0)
     {}
 
     EventHandle(event_id_t id,
@@ -55,7 +102,20 @@ public:
         id_(id),
         t_(t),
         sink_(std::move(sink)),
-        running_(false)
+        running_(false),
+        owner_(nullptr),
+        index_(0)
+    {}
+
+    EventHandle(event_id_t id,
+                const TimePoint& t,
+                EventCallable&& callable) :
+        id_(id),
+        t_(t),
+        callable_(std::move(callable)),
+        running_(false),
+        owner_(nullptr),
+        index_(0)
     {}
 
     virtual ~EventHandle(void) {}
@@ -69,22 +129,37 @@ public:
 
     virtual bool IsPending(void) BOOST_NOEXCEPT NSFX_OVERRIDE
     {
-        return (sink_ && !running_);
+        return (IsArmed() && !running_);
     }
 
     virtual bool IsRunning(void) BOOST_NOEXCEPT NSFX_OVERRIDE
     {
-        return (sink_ && running_);
+        return (IsArmed() && running_);
     }
 
     virtual bool IsValid(void) BOOST_NOEXCEPT NSFX_OVERRIDE
     {
-        return !!sink_;
+        return IsArmed();
     }
 
     virtual void Cancel(void) NSFX_OVERRIDE
     {
         sink_ = nullptr;
+        // A running callable cannot be destroyed until it returns.
+        if (running_)
+        {
+            callable_.Disarm();
+        }
+        else
+        {
+            callable_.Clear();
+        }
+        if (owner_)
+        {
+            EventHandleOwner* owner = owner_;
+            owner_ = nullptr;
+            owner->OnEventCancelled(this);
+        }
     }
 
     virtual TimePoint GetTimePoint(void) BOOST_NOEXCEPT NSFX_OVERRIDE
@@ -100,15 +175,119 @@ public:
         return this;
     }
 
+    /**
+     * @brief Get the event sink.
+     *
+     * @return The event sink, or `nullptr` if the event is fired by a callable,
+     *         or the event is not valid.
+     */
+    IEventSink<>* GetSink(void) const BOOST_NOEXCEPT
+    {
+        return sink_.Get();
+    }
+
     void Fire(void)
     {
         if (sink_)
         {
+            // Keep the sink alive, since the event may be cancelled within
+            // the sink.
+            Ptr<IEventSink<>> sink(sink_);
             running_ = true;
-            sink_->Fire();
+            try
+            {
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+                EventProfiler::Scope profile(sink.Get());
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
+#if defined(NSFX_SIMULATOR_USES_TRACER)
+                EventTracer::Scope trace(id_, sink.Get());
+#endif // defined(NSFX_SIMULATOR_USES_TRACER)
+                sink->Fire();
+            }
+            catch (...)
+            {
+                running_ = false;
+                sink_ = nullptr;
+                throw;
+            }
             running_ = false;
             sink_ = nullptr;
         }
+        else if (callable_.IsArmed())
+        {
+            running_ = true;
+            try
+            {
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+                EventProfiler::Scope profile(callable_.GetType());
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
+#if defined(NSFX_SIMULATOR_USES_TRACER)
+                EventTracer::Scope trace(id_, callable_.GetType());
+#endif // defined(NSFX_SIMULATOR_USES_TRACER)
+                callable_.Invoke();
+            }
+            catch (...)
+            {
+                running_ = false;
+                callable_.Clear();
+                throw;
+            }
+            running_ = false;
+            callable_.Clear();
+        }
+    }
+
+    /**
+     * @brief Reuse the event handle for another event.
+     *
+     * @remarks This function is used by schedulers to recycle event handles.
+     *          It **must** be called only when the scheduler holds the only
+     *          reference to the event handle, and the event is not running.
+     */
+    void Reset(event_id_t id, const TimePoint& t, Ptr<IEventSink<>>&& sink)
+    {
+        BOOST_ASSERT(!running_);
+        id_ = id;
+        t_ = t;
+        sink_ = std::move(sink);
+        owner_ = nullptr;
+        index_ = 0;
+    }
+
+    void Reset(event_id_t id, const TimePoint& t, EventCallable&& callable)
+    {
+        BOOST_ASSERT(!running_);
+        id_ = id;
+        t_ = t;
+        callable_ = std::move(callable);
+        owner_ = nullptr;
+        index_ = 0;
+    }
+
+    /**
+     * @brief Set the owner that removes the event when it is cancelled.
+     *
+     * @param[in] owner The owner, or `nullptr` to clear the owner.
+     */
+    void SetOwner(EventHandleOwner* owner) BOOST_NOEXCEPT
+    {
+        owner_ = owner;
+    }
+
+    /**
+     * @brief Get the position of the event handle in its owner.
+     *
+     * The meaning of the index is defined by the owner.
+     * e.g., a heap-based scheduler stores the slot of the event in the heap.
+     */
+    size_t GetIndex(void) const BOOST_NOEXCEPT
+    {
+        return index_;
+    }
+
+    void SetIndex(size_t index) BOOST_NOEXCEPT
+    {
+        index_ = index;
     }
 
     // Comparisons./*{{{*/
@@ -155,6 +334,12 @@ public:
 
     /*}}}*/
 
+private:
+    bool IsArmed(void) const BOOST_NOEXCEPT
+    {
+        return sink_ || callable_.IsArmed();
+    }
+
 private:
     NSFX_INTERFACE_MAP_BEGIN(EventHandle)
         NSFX_INTERFACE_ENTRY(IEventHandle)
@@ -164,7 +349,10 @@ private:
     event_id_t id_;
     TimePoint  t_;
     Ptr<IEventSink<>>  sink_;
+    EventCallable  callable_;
     bool running_;
+    EventHandleOwner* owner_;
+    size_t index_;
 
 };
 
@@ -0,0 +1,196 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef EVENT_INJECTION_QUEUE_H__06B4BAC6_07F2_4923_A6B8_0B9D598AAB4C
+#define EVENT_INJECTION_QUEUE_H__06B4BAC6_07F2_4923_A6B8_0B9D598AAB4C
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/component/ptr.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventInjectionQueue.
+/**
+ * @ingroup Simulator
+ * @brief A multi-producer single-consumer queue of injected events.
+ *
+ * The producers push events without locks.
+ * A producer takes a lock only to wake up the consumer when the consumer is
+ * waiting.
+ *
+ * The queue is a linked list with a dummy node at the front.
+ * A producer exchanges the back of the list, and links the previous back to
+ * the new node.
+ * The consumer pops the node after the dummy node, which becomes the new
+ * dummy node.
+ */
+class EventInjectionQueue
+{
+    struct Node
+    {
+        Node(void) :
+            next_(nullptr),
+            now_(false)
+        {}
+
+        Node(const TimePoint& t, bool now, Ptr<IEventSink<>>&& sink) :
+            next_(nullptr),
+            t_(t),
+            now_(now),
+            sink_(std::move(sink))
+        {}
+
+        std::atomic<Node*>  next_;
+        TimePoint  t_;
+        bool  now_;
+        Ptr<IEventSink<>>  sink_;
+    };
+
+public:
+    EventInjectionQueue(void) :
+        back_(new Node),
+        waiting_(false)
+    {
+        front_ = back_.load();
+    }
+
+    ~EventInjectionQueue(void)
+    {
+        while (front_)
+        {
+            Node* next = front_->next_.load(std::memory_order_relaxed);
+            delete front_;
+            front_ = next;
+        }
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(EventInjectionQueue(const EventInjectionQueue& ));
+    BOOST_DELETED_FUNCTION(EventInjectionQueue& operator=(const EventInjectionQueue& ));
+
+public:
+    /**
+     * @brief Push an event.
+     *
+     * It can be called by any thread.
+     *
+     * @param[in] t    The time point of the event.
+     * @param[in] now  Whether the event is scheduled at the current time.
+     * @param[in] sink The event sink.
+     */
+    void Push(const TimePoint& t, bool now, Ptr<IEventSink<>>&& sink)
+    {
+        Node* node = new Node(t, now, std::move(sink));
+        Node* prev = back_.exchange(node);
+        prev->next_.store(node, std::memory_order_release);
+        if (waiting_.load())
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_one();
+        }
+    }
+
+    /**
+     * @brief Whether the queue is empty.
+     *
+     * It **must** be called by the consumer.
+     *
+     * An event that is being pushed is counted.
+     */
+    bool IsEmpty(void) const BOOST_NOEXCEPT
+    {
+        return back_.load() == front_;
+    }
+
+    /**
+     * @brief Pop the events.
+     *
+     * It **must** be called by the consumer.
+     *
+     * @tparam Visitor A functor of signature
+     *                 `void(const TimePoint& t, bool now,
+     *                       Ptr<IEventSink<>>&& sink)`.
+     *
+     * @return The number of events.
+     *
+     * An event that is being pushed may not be popped.
+     */
+    template<class Visitor>
+    size_t Drain(Visitor&& visitor)
+    {
+        size_t n = 0;
+        Node* next = front_->next_.load(std::memory_order_acquire);
+        while (next)
+        {
+            delete front_;
+            front_ = next;
+            ++n;
+            visitor(next->t_, next->now_, std::move(next->sink_));
+            next = front_->next_.load(std::memory_order_acquire);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Wait until an event is pushed, or the deadline is reached.
+     *
+     * It **must** be called by the consumer.
+     */
+    template<class Clock, class Dur>
+    void WaitUntil(const std::chrono::time_point<Clock, Dur>& deadline)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiting_.store(true);
+        while (IsEmpty() && Clock::now() < deadline)
+        {
+            cv_.wait_until(lock, deadline);
+        }
+        waiting_.store(false);
+    }
+
+private:
+    /**
+     * @brief The dummy node.
+     *
+     * It is accessed by the consumer only.
+     */
+    Node* front_;
+
+    /**
+     * @brief The last node.
+     */
+    std::atomic<Node*>  back_;
+
+    std::atomic<bool>  waiting_;
+    std::mutex  mutex_;
+    std::condition_variable  cv_;
+};
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // EVENT_INJECTION_QUEUE_H__06B4BAC6_07F2_4923_A6B8_0B9D598AAB4C
+
@@ -0,0 +1,509 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef EVENT_PROFILER_H__93C004B1_818B_4F88_A9CB_D5C8022AC2ED
+#define EVENT_PROFILER_H__93C004B1_818B_4F88_A9CB_D5C8022AC2ED
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-event-profiler.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/component/object.h>
+#include <nsfx/component/ptr.h>
+
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+# include <nsfx/simulation/i-scheduler.h>
+# include <nsfx/statistics/probe/probe.h>
+# include <nsfx/statistics/probe/probe-container.h>
+# include <boost/core/demangle.hpp>
+# include <algorithm>
+# include <chrono>
+# include <memory>
+# include <typeindex>
+# include <typeinfo>
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// LabeledEventSink.
+/**
+ * @ingroup Simulator
+ * @brief An event sink with a label.
+ *
+ * It fires the wrapped event sink.
+ */
+class LabeledEventSink :
+    public IEventSink<>,
+    public IEventLabel
+{
+    typedef LabeledEventSink  ThisClass;
+
+public:
+    LabeledEventSink(const std::string& label, Ptr<IEventSink<>>&& sink) :
+        label_(label),
+        sink_(std::move(sink))
+    {}
+
+    virtual ~LabeledEventSink(void) {}
+
+    virtual void Fire(void) NSFX_OVERRIDE
+    {
+        sink_->Fire();
+    }
+
+    virtual const std::string& GetEventLabel(void) NSFX_OVERRIDE
+    {
+        return label_;
+    }
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IEventSink<>)
+        NSFX_INTERFACE_ENTRY(IEventLabel)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    std::string  label_;
+    Ptr<IEventSink<>>  sink_;
+};
+
+
+/**
+ * @ingroup Simulator
+ * @brief Label an event sink for profiling and tracing.
+ *
+ * @param[in] label The label of the events in the profiles and traces.
+ * @param[in] sink  The event sink.
+ *
+ * @code
+ * scheduler->ScheduleIn(dt, LabelEventSink("mac.backoff", sink));
+ * @endcode
+ *
+ * If neither `NSFX_SIMULATOR_USES_PROFILER` nor `NSFX_SIMULATOR_USES_TRACER`
+ * is defined, the event sink is returned as is.
+ */
+inline Ptr<IEventSink<>> LabelEventSink(const std::string& label,
+                                        Ptr<IEventSink<>> sink)
+{
+#if defined(NSFX_SIMULATOR_USES_PROFILER) || \
+    defined(NSFX_SIMULATOR_USES_TRACER)
+    if (sink)
+    {
+        sink = new Object<LabeledEventSink>(label, std::move(sink));
+    }
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER) || defined(NSFX_SIMULATOR_USES_TRACER)
+    return sink;
+}
+
+
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+
+////////////////////////////////////////////////////////////////////////////////
+// EventProfiler.
+/**
+ * @ingroup Simulator
+ * @brief An event profiler.
+ *
+ * The profiler is enabled by defining `NSFX_SIMULATOR_USES_PROFILER` before
+ * including any header of nsfx.
+ * The macro **must** be defined consistently in all translation units.
+ * If it is not defined, the profiler is not compiled, and the simulator is
+ * not instrumented at all.
+ *
+ * The profiler is aggregated by `Simulator`.
+ * When the simulator runs, the profiler is activated for the calling thread,
+ * and `EventHandle::Fire()` reports each event to the active profiler.
+ * The events whose event sinks derive from `InternalEventSinkTag` are not
+ * reported.
+ *
+ * # Probes
+ * * `"event time"`
+ *   The wall-clock time spent in the event sink of each event (in seconds).
+ * * `"event time:<name>"`
+ *   The same as above, for the events of a label, a type of event sinks,
+ *   or a type of callables.
+ *   The probe is created when the first event of the name is fired.
+ * * `"queue depth"`
+ *   The number of pending events when each event is fired.
+ * * `"event rate"`
+ *   The number of events fired per second of wall-clock time in each run.
+ *
+ * # Interfaces
+ * * Provides
+ *   + \c IEventProfiler
+ *   + \c IProbeContainer
+ */
+class EventProfiler :
+    public IEventProfiler,
+    public IProbeContainer
+{
+    typedef EventProfiler  ThisClass;
+    typedef std::chrono::steady_clock  ClockType;
+
+    struct Entry
+    {
+        EventProfile  profile_;
+        Ptr<Probe>  probe_;
+    };
+
+    struct TypeEntry
+    {
+        TypeEntry(void) : entry_(nullptr), labeled_(false), internal_(false) {}
+
+        Entry* entry_;
+        bool  labeled_;
+        bool  internal_;
+    };
+
+public:
+    EventProfiler(void) :
+        probes_(new Object<ProbeContainer>),
+        scheduler_(nullptr),
+        numEvents_(0),
+        eventTime_(0),
+        runTime_(0)
+    {
+        eventTimeProbe_  = probes_->Add("event time");
+        queueDepthProbe_ = probes_->Add("queue depth");
+        eventRateProbe_  = probes_->Add("event rate");
+    }
+
+    virtual ~EventProfiler(void) {}
+
+    // IEventProfiler /*{{{*/
+public:
+    virtual uint64_t GetNumEvents(void) NSFX_OVERRIDE
+    {
+        return numEvents_;
+    }
+
+    virtual double GetEventTime(void) NSFX_OVERRIDE
+    {
+        return eventTime_;
+    }
+
+    virtual double GetRunTime(void) NSFX_OVERRIDE
+    {
+        return runTime_;
+    }
+
+    virtual double GetEventRate(void) NSFX_OVERRIDE
+    {
+        return runTime_ > 0 ? numEvents_ / runTime_ : 0;
+    }
+
+    virtual vector<EventProfile> GetEventProfiles(void) NSFX_OVERRIDE
+    {
+        vector<EventProfile> profiles;
+        for (auto it = names_.cbegin(); it != names_.cend(); ++it)
+        {
+            if (it->second->profile_.numEvents_)
+            {
+                profiles.push_back(it->second->profile_);
+            }
+        }
+        std::sort(profiles.begin(), profiles.end(),
+                  [] (const EventProfile& lhs, const EventProfile& rhs) {
+                      return lhs.wallTime_ > rhs.wallTime_;
+                  });
+        return profiles;
+    }
+
+    virtual vector<uint64_t> GetQueueDepthHistogram(void) NSFX_OVERRIDE
+    {
+        return histogram_;
+    }
+
+    virtual void Reset(void) NSFX_OVERRIDE
+    {
+        numEvents_ = 0;
+        eventTime_ = 0;
+        runTime_ = 0;
+        histogram_.clear();
+        for (auto it = names_.begin(); it != names_.end(); ++it)
+        {
+            it->second->profile_.numEvents_ = 0;
+            it->second->profile_.wallTime_ = 0;
+        }
+    }
+
+    /*}}}*/
+
+    // IProbeContainer /*{{{*/
+public:
+    virtual Ptr<IProbeEnumerator> GetEnumerator(void) NSFX_OVERRIDE
+    {
+        return probes_->GetEnumerator();
+    }
+
+    virtual Ptr<IProbeEvent> GetProbe(const std::string& name) NSFX_OVERRIDE
+    {
+        return probes_->GetProbe(name);
+    }
+
+    virtual cookie_t Connect(const std::string& name,
+                             Ptr<IProbeEventSink> sink) NSFX_OVERRIDE
+    {
+        return probes_->Connect(name, sink);
+    }
+
+    virtual void Disconnect(const std::string& name, cookie_t cookie) NSFX_OVERRIDE
+    {
+        probes_->Disconnect(name, cookie);
+    }
+
+    /*}}}*/
+
+    // Instrumentation. /*{{{*/
+public:
+    /**
+     * @brief Set the scheduler whose queue depth is sampled.
+     */
+    void SetScheduler(IScheduler* scheduler) BOOST_NOEXCEPT
+    {
+        scheduler_ = scheduler;
+    }
+
+    /**
+     * @brief Get the profiler that is active for the calling thread.
+     */
+    static EventProfiler*& GetCurrent(void) BOOST_NOEXCEPT
+    {
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+        static thread_local EventProfiler* current = nullptr;
+#else
+        static EventProfiler* current = nullptr;
+#endif
+        return current;
+    }
+
+    /**
+     * @brief Activate a profiler for the calling thread during a run.
+     */
+    class Activation
+    {
+    public:
+        explicit Activation(EventProfiler* profiler) :
+            profiler_(profiler),
+            previous_(GetCurrent()),
+            numEvents_(profiler->numEvents_),
+            t0_(ClockType::now())
+        {
+            GetCurrent() = profiler_;
+        }
+
+        ~Activation(void)
+        {
+            GetCurrent() = previous_;
+            double secs = std::chrono::duration<double>(
+                ClockType::now() - t0_).count();
+            profiler_->runTime_ += secs;
+            if (secs > 0)
+            {
+                profiler_->eventRateProbe_->Fire(
+                    (profiler_->numEvents_ - numEvents_) / secs);
+            }
+        }
+
+    private:
+        EventProfiler* profiler_;
+        EventProfiler* previous_;
+        uint64_t  numEvents_;
+        ClockType::time_point  t0_;
+    };
+
+    /**
+     * @brief Measure an event.
+     *
+     * It is used by `EventHandle::Fire()`.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(IEventSink<>* sink) :
+            profiler_(GetCurrent()),
+            entry_(nullptr)
+        {
+            if (profiler_)
+            {
+                entry_ = profiler_->GetEntry(sink);
+                Begin();
+            }
+        }
+
+        /**
+         * @brief Measure an event that is fired by a callable.
+         *
+         * @param[in] type The type of the callable.
+         */
+        explicit Scope(const std::type_info& type) :
+            profiler_(GetCurrent()),
+            entry_(nullptr)
+        {
+            if (profiler_)
+            {
+                entry_ = profiler_->GetEntry(type);
+                Begin();
+            }
+        }
+
+        ~Scope(void)
+        {
+            if (entry_)
+            {
+                double secs = std::chrono::duration<double>(
+                    ClockType::now() - t0_).count();
+                profiler_->OnEventEnd(entry_, secs);
+            }
+        }
+
+    private:
+        void Begin(void)
+        {
+            // The entry is null if the event sink is internal.
+            if (entry_)
+            {
+                profiler_->OnEventBegin();
+                t0_ = ClockType::now();
+            }
+        }
+
+    private:
+        EventProfiler* profiler_;
+        Entry* entry_;
+        ClockType::time_point  t0_;
+    };
+
+private:
+    void OnEventBegin(void)
+    {
+        uint64_t depth = scheduler_ ? scheduler_->GetNumEvents() : 0;
+        size_t bin = 0;
+        for (uint64_t d = depth; d; d >>= 1)
+        {
+            ++bin;
+        }
+        if (histogram_.size() <= bin)
+        {
+            histogram_.resize(bin + 1, 0);
+        }
+        ++histogram_[bin];
+        queueDepthProbe_->Fire(static_cast<double>(depth));
+    }
+
+    void OnEventEnd(Entry* entry, double secs)
+    {
+        ++numEvents_;
+        eventTime_ += secs;
+        eventTimeProbe_->Fire(secs);
+        ++entry->profile_.numEvents_;
+        entry->profile_.wallTime_ += secs;
+        entry->probe_->Fire(secs);
+    }
+
+    /**
+     * @brief Get the entry of an event sink.
+     *
+     * The entries are looked up by the dynamic types of the event sinks,
+     * and by the labels if the event sinks provide `IEventLabel`.
+     *
+     * @return The entry, or `nullptr` if the event sink derives from
+     *         `InternalEventSinkTag`.
+     */
+    Entry* GetEntry(IEventSink<>* sink)
+    {
+        TypeEntry& type = types_[std::type_index(typeid(*sink))];
+        if (!type.entry_ && !type.labeled_ && !type.internal_)
+        {
+            if (dynamic_cast<InternalEventSinkTag*>(sink))
+            {
+                type.internal_ = true;
+            }
+            else if (dynamic_cast<IEventLabel*>(sink))
+            {
+                type.labeled_ = true;
+            }
+            else
+            {
+                type.entry_ = GetEntry(
+                    boost::core::demangle(typeid(*sink).name()));
+            }
+        }
+        Entry* entry = type.entry_;
+        if (type.labeled_)
+        {
+            entry = GetEntry(dynamic_cast<IEventLabel*>(sink)->GetEventLabel());
+        }
+        return entry;
+    }
+
+    /**
+     * @brief Get the entry of a type of callables.
+     */
+    Entry* GetEntry(const std::type_info& type)
+    {
+        TypeEntry& entry = types_[std::type_index(type)];
+        if (!entry.entry_)
+        {
+            entry.entry_ = GetEntry(boost::core::demangle(type.name()));
+        }
+        return entry.entry_;
+    }
+
+    Entry* GetEntry(const std::string& name)
+    {
+        std::unique_ptr<Entry>& entry = names_[name];
+        if (!entry)
+        {
+            entry.reset(new Entry);
+            entry->profile_.name_ = name;
+            entry->probe_ = probes_->Add("event time:" + name);
+        }
+        return entry.get();
+    }
+
+    /*}}}*/
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IEventProfiler)
+        NSFX_INTERFACE_ENTRY(IProbeContainer)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    Ptr<ProbeContainer>  probes_;
+    Ptr<Probe>  eventTimeProbe_;
+    Ptr<Probe>  queueDepthProbe_;
+    Ptr<Probe>  eventRateProbe_;
+    IScheduler* scheduler_;
+    uint64_t  numEvents_;
+    double    eventTime_;
+    double    runTime_;
+    vector<uint64_t>  histogram_;
+    unordered_map<std::type_index, TypeEntry>  types_;
+    unordered_map<std::string, std::unique_ptr<Entry>>  names_;
+};
+
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // EVENT_PROFILER_H__93C004B1_818B_4F88_A9CB_D5C8022AC2ED
+
@@ -0,0 +1,887 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef EVENT_TRACER_H__D3DB16A4_7E56_4662_B822_E71F537B001F
+#define EVENT_TRACER_H__D3DB16A4_7E56_4662_B822_E71F537B001F
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-event-tracer.h>
+#include <nsfx/simulation/i-event-profiler.h>
+#include <nsfx/simulation/i-simulator.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/exception.h>
+#include <nsfx/event/event-sink.h>
+#include <nsfx/component/class-registry.h>
+#include <nsfx/component/object.h>
+#include <nsfx/component/ptr.h>
+#include <boost/core/demangle.hpp>
+#include <chrono>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <iomanip>
+#include <typeindex>
+#include <typeinfo>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventTraceRecord.
+/**
+ * @ingroup Simulator
+ * @brief The record of a fired event in an event trace.
+ */
+struct EventTraceRecord
+{
+    /**
+     * @brief The wall-clock time when the event is fired
+     *        (in nanoseconds since the trace file is opened).
+     */
+    uint64_t  wallTime_;
+
+    /**
+     * @brief The wall-clock time spent in the event sink (in nanoseconds).
+     */
+    uint64_t  wallDuration_;
+
+    /**
+     * @brief The simulation time of the event (in ticks of `Duration`).
+     */
+    int64_t   simTime_;
+
+    /**
+     * @brief The id of the event.
+     */
+    event_id_t  eventId_;
+
+    /**
+     * @brief The index of the label of the event.
+     */
+    uint32_t  label_;
+
+    /**
+     * @brief The number of pending events when the event is fired.
+     *
+     * The number is saturated at `0xffffffff`.
+     */
+    uint32_t  depth_;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// The format of event trace files.
+/**
+ * @ingroup Simulator
+ * @brief The format of event trace files.
+ *
+ * All integers are little-endian.
+ *
+ * The file begins with a header.
+ * * 8 bytes: the magic `"NSFXTRCE"`.
+ * * `uint32_t`: the version.
+ * * `uint64_t`: the number of ticks of `Duration` per second.
+ *
+ * It is followed by a sequence of blocks, and each block begins with
+ * a `uint8_t` type.
+ * * A label block defines the label of the next index.
+ *   + `uint32_t`: the length of the label.
+ *   + the characters of the label.
+ * * A record block contains the records of events.
+ *   + `uint32_t`: the number of records.
+ *   + the records, each of which has 40 bytes: the fields of
+ *     `EventTraceRecord` in the order of declaration.
+ *
+ * A label is always defined before the records that refer to it.
+ */
+struct EventTraceFormat
+{
+    enum
+    {
+        VERSION = 1,
+        LABEL_BLOCK = 1,
+        RECORD_BLOCK = 2,
+        RECORD_SIZE = 40,
+    };
+
+    static const char* GetMagic(void) BOOST_NOEXCEPT
+    {
+        return "NSFXTRCE";
+    }
+
+    static void Put(std::string& buffer, uint64_t value, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            buffer.push_back(static_cast<char>(value >> (8 * i)));
+        }
+    }
+
+    static uint64_t Get(const char* p, size_t size) BOOST_NOEXCEPT
+    {
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (8 * i);
+        }
+        return value;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventTracer.
+/**
+ * @ingroup Simulator
+ * @brief An event tracer.
+ *
+ * The tracer records the wall-clock time, the simulation time, the id,
+ * the label and the queue depth of each event that is fired by a simulator.
+ * The records are buffered in memory, and written to a compact binary trace
+ * file when the buffer is full, and when the simulator pauses.
+ *
+ * The tracer is enabled by defining `NSFX_SIMULATOR_USES_TRACER` before
+ * including any header of nsfx.
+ * The macro **must** be defined consistently in all translation units.
+ * If it is not defined, the events are not instrumented, and the tracer
+ * records nothing.
+ *
+ * The tracer is activated for the calling thread when the simulator runs
+ * (`ISimulationRunEvent`), and deactivated when the simulator pauses
+ * (`ISimulationPauseEvent`).
+ * The model is not modified.
+ *
+ * An event is labeled by the label of its event sink if the event sink
+ * provides `IEventLabel` (see `LabelEventSink()`).
+ * Otherwise, it is labeled by the dynamic type of the event sink, or the
+ * type of the callable.
+ * The events whose event sinks derive from `InternalEventSinkTag` are not
+ * recorded.
+ *
+ * @see `EventTraceReader`, `ConvertEventTraceToJson()`.
+ *
+ * # Uid
+ * @code
+ * "edu.uestc.nsfx.EventTracer"
+ * @endcode
+ *
+ * # Interfaces
+ * * Uses
+ *   + \c ISimulator
+ *   + \c IScheduler (optional, to record the queue depth)
+ * * Provides
+ *   + \c IEventTracer
+ *
+ * @code
+ * Ptr<IEventTracer> tracer = CreateObject<IEventTracer>(
+ *     "edu.uestc.nsfx.EventTracer");
+ * Ptr<ISimulatorUser>(tracer)->Use(simulator);
+ * Ptr<ISchedulerUser>(tracer)->Use(scheduler);
+ * tracer->Open("events.trace");
+ * simulator->Run();
+ * tracer->Close();
+ * @endcode
+ */
+class EventTracer :
+    public IEventTracer,
+    public ISimulatorUser,
+    public ISchedulerUser
+{
+    typedef EventTracer  ThisClass;
+    typedef std::chrono::steady_clock  ClockType;
+
+    struct TypeEntry
+    {
+        TypeEntry(void) :
+            label_(0), labeled_(false), named_(false), internal_(false)
+        {}
+
+        uint32_t  label_;
+        bool  labeled_;
+        bool  named_;
+        bool  internal_;
+    };
+
+    /**
+     * @brief The label of the events of the internal event sinks.
+     */
+    static const uint32_t INTERNAL_LABEL = 0xffffffff;
+
+public:
+    EventTracer(void) :
+        scheduler_(nullptr),
+        bufferSize_(65536),
+        numLabelsWritten_(0),
+        numRecords_(0),
+        runCookie_(0),
+        pauseCookie_(0),
+        active_(false),
+        previous_(nullptr)
+    {}
+
+    virtual ~EventTracer(void)
+    {
+        Deactivate();
+        if (simulator_)
+        {
+            Ptr<ISimulationRunEvent>(simulator_)->Disconnect(runCookie_);
+            Ptr<ISimulationPauseEvent>(simulator_)->Disconnect(pauseCookie_);
+        }
+        try
+        {
+            Close();
+        }
+        catch (...)
+        {
+            // Cannot report the error.
+        }
+    }
+
+    // ISimulatorUser /*{{{*/
+public:
+    virtual void Use(Ptr<ISimulator> simulator) NSFX_OVERRIDE
+    {
+        if (simulator_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the simulator."));
+        }
+        if (!simulator)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        Ptr<IClock> clock(simulator);
+        Ptr<ISimulationRunEvent> runEvent(simulator);
+        Ptr<ISimulationPauseEvent> pauseEvent(simulator);
+        // The event sinks do not hold a reference to the tracer, since the
+        // tracer holds a reference to the simulator.
+        runCookie_ = runEvent->Connect(
+            CreateEventSink<ISimulationRunEventSink>(
+                nullptr, this, &ThisClass::OnSimulationRun));
+        pauseCookie_ = pauseEvent->Connect(
+            CreateEventSink<ISimulationPauseEventSink>(
+                nullptr, this, &ThisClass::OnSimulationPause));
+        simulator_ = simulator;
+        clock_ = clock;
+    }
+
+    /*}}}*/
+
+    // ISchedulerUser /*{{{*/
+public:
+    virtual void Use(Ptr<IScheduler> scheduler) NSFX_OVERRIDE
+    {
+        if (!scheduler)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        schedulerHolder_ = scheduler;
+        scheduler_ = schedulerHolder_.Get();
+    }
+
+    /*}}}*/
+
+    // IEventTracer /*{{{*/
+public:
+    virtual void SetBufferSize(size_t numRecords) NSFX_OVERRIDE
+    {
+        if (!numRecords)
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The buffer size must be positive."));
+        }
+        if (os_.is_open())
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the buffer size "
+                             "when the trace file is open."));
+        }
+        bufferSize_ = numRecords;
+    }
+
+    virtual void Open(const std::string& filename) NSFX_OVERRIDE
+    {
+        if (os_.is_open())
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("The trace file is open."));
+        }
+        os_.open(filename.c_str(), std::ios_base::out |
+                                   std::ios_base::binary |
+                                   std::ios_base::trunc);
+        if (!os_.is_open())
+        {
+            os_.clear();
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("Cannot open \"" + filename + "\"."));
+        }
+        records_.clear();
+        records_.reserve(bufferSize_);
+        numLabelsWritten_ = 0;
+        numRecords_ = 0;
+        t0_ = ClockType::now();
+        std::string header(EventTraceFormat::GetMagic());
+        EventTraceFormat::Put(header, EventTraceFormat::VERSION, 4);
+        EventTraceFormat::Put(header, Duration(Seconds(1)).GetCount(), 8);
+        Write(header);
+    }
+
+    virtual void Flush(void) NSFX_OVERRIDE
+    {
+        if (!os_.is_open())
+        {
+            return;
+        }
+        std::string block;
+        for (; numLabelsWritten_ < labels_.size(); ++numLabelsWritten_)
+        {
+            const std::string& label = labels_[numLabelsWritten_];
+            EventTraceFormat::Put(block, EventTraceFormat::LABEL_BLOCK, 1);
+            EventTraceFormat::Put(block, label.size(), 4);
+            block += label;
+        }
+        if (records_.size())
+        {
+            block.reserve(block.size() + 5 +
+                          records_.size() * EventTraceFormat::RECORD_SIZE);
+            EventTraceFormat::Put(block, EventTraceFormat::RECORD_BLOCK, 1);
+            EventTraceFormat::Put(block, records_.size(), 4);
+            for (auto it = records_.cbegin(); it != records_.cend(); ++it)
+            {
+                EventTraceFormat::Put(block, it->wallTime_, 8);
+                EventTraceFormat::Put(block, it->wallDuration_, 8);
+                EventTraceFormat::Put(block, static_cast<uint64_t>(it->simTime_), 8);
+                EventTraceFormat::Put(block, it->eventId_, 8);
+                EventTraceFormat::Put(block, it->label_, 4);
+                EventTraceFormat::Put(block, it->depth_, 4);
+            }
+            records_.clear();
+        }
+        Write(block);
+        os_.flush();
+    }
+
+    virtual void Close(void) NSFX_OVERRIDE
+    {
+        if (os_.is_open())
+        {
+            Flush();
+            os_.close();
+        }
+    }
+
+    virtual uint64_t GetNumRecords(void) NSFX_OVERRIDE
+    {
+        return numRecords_;
+    }
+
+    /*}}}*/
+
+    // Instrumentation. /*{{{*/
+public:
+    /**
+     * @brief Get the tracer that is active for the calling thread.
+     */
+    static EventTracer*& GetCurrent(void) BOOST_NOEXCEPT
+    {
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+        static thread_local EventTracer* current = nullptr;
+#else
+        static EventTracer* current = nullptr;
+#endif
+        return current;
+    }
+
+    /**
+     * @brief Record an event.
+     *
+     * It is used by `EventHandle::Fire()`.
+     */
+    class Scope
+    {
+    public:
+        Scope(event_id_t id, IEventSink<>* sink) :
+            tracer_(GetCurrent())
+        {
+            if (tracer_)
+            {
+                uint32_t label = tracer_->GetLabel(sink);
+                if (label == INTERNAL_LABEL)
+                {
+                    tracer_ = nullptr;
+                }
+                else
+                {
+                    Begin(id, label);
+                }
+            }
+        }
+
+        /**
+         * @brief Record an event that is fired by a callable.
+         *
+         * @param[in] id   The id of the event.
+         * @param[in] type The type of the callable.
+         */
+        Scope(event_id_t id, const std::type_info& type) :
+            tracer_(GetCurrent())
+        {
+            if (tracer_)
+            {
+                Begin(id, tracer_->GetLabel(type));
+            }
+        }
+
+        ~Scope(void)
+        {
+            if (tracer_)
+            {
+                record_.wallDuration_ = tracer_->GetWallTime() -
+                                        record_.wallTime_;
+                // The capacity is reserved.
+                tracer_->records_.push_back(record_);
+                ++tracer_->numRecords_;
+            }
+        }
+
+    private:
+        void Begin(event_id_t id, uint32_t label)
+        {
+            if (tracer_->records_.size() >= tracer_->bufferSize_)
+            {
+                tracer_->Flush();
+            }
+            record_.simTime_ = tracer_->clock_->Now().GetDuration().GetCount();
+            record_.eventId_ = id;
+            record_.label_ = label;
+            record_.depth_ = tracer_->GetDepth();
+            record_.wallDuration_ = 0;
+            record_.wallTime_ = tracer_->GetWallTime();
+        }
+
+    private:
+        EventTracer* tracer_;
+        EventTraceRecord  record_;
+    };
+
+private:
+    void OnSimulationRun(void)
+    {
+        if (os_.is_open() && !active_)
+        {
+            previous_ = GetCurrent();
+            GetCurrent() = this;
+            active_ = true;
+        }
+    }
+
+    void OnSimulationPause(void)
+    {
+        if (active_)
+        {
+            Deactivate();
+            Flush();
+        }
+    }
+
+    void Deactivate(void) BOOST_NOEXCEPT
+    {
+        if (active_)
+        {
+            if (GetCurrent() == this)
+            {
+                GetCurrent() = previous_;
+            }
+            active_ = false;
+        }
+    }
+
+    uint64_t GetWallTime(void) const
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                ClockType::now() - t0_).count());
+    }
+
+    uint32_t GetDepth(void) const
+    {
+        uint64_t depth = scheduler_ ? scheduler_->GetNumEvents() : 0;
+        return depth < 0xffffffff ? static_cast<uint32_t>(depth) : 0xffffffff;
+    }
+
+    /**
+     * @brief Get the label of an event sink.
+     *
+     * The labels are looked up by the dynamic types of the event sinks,
+     * and by the labels if the event sinks provide `IEventLabel`.
+     *
+     * @return The label, or `INTERNAL_LABEL` if the event sink derives from
+     *         `InternalEventSinkTag`.
+     */
+    uint32_t GetLabel(IEventSink<>* sink)
+    {
+        TypeEntry& type = types_[std::type_index(typeid(*sink))];
+        if (!type.named_ && !type.labeled_ && !type.internal_)
+        {
+            if (dynamic_cast<InternalEventSinkTag*>(sink))
+            {
+                type.internal_ = true;
+                type.label_ = INTERNAL_LABEL;
+            }
+            else if (dynamic_cast<IEventLabel*>(sink))
+            {
+                type.labeled_ = true;
+            }
+            else
+            {
+                type.label_ = GetLabel(
+                    boost::core::demangle(typeid(*sink).name()));
+                type.named_ = true;
+            }
+        }
+        if (type.labeled_)
+        {
+            return GetLabel(dynamic_cast<IEventLabel*>(sink)->GetEventLabel());
+        }
+        return type.label_;
+    }
+
+    /**
+     * @brief Get the label of a type of callables.
+     */
+    uint32_t GetLabel(const std::type_info& type)
+    {
+        TypeEntry& entry = types_[std::type_index(type)];
+        if (!entry.named_)
+        {
+            entry.label_ = GetLabel(boost::core::demangle(type.name()));
+            entry.named_ = true;
+        }
+        return entry.label_;
+    }
+
+    uint32_t GetLabel(const std::string& name)
+    {
+        auto result = labelIndices_.emplace(
+            name, static_cast<uint32_t>(labels_.size()));
+        if (result.second)
+        {
+            labels_.push_back(name);
+        }
+        return result.first->second;
+    }
+
+    void Write(const std::string& data)
+    {
+        os_.write(data.data(), data.size());
+        if (!os_)
+        {
+            BOOST_THROW_EXCEPTION(
+                Unexpected() <<
+                ErrorMessage("Cannot write the event trace."));
+        }
+    }
+
+    /*}}}*/
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IEventTracer)
+        NSFX_INTERFACE_ENTRY(ISimulatorUser)
+        NSFX_INTERFACE_ENTRY(ISchedulerUser)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    Ptr<ISimulator>  simulator_;
+    Ptr<IClock>      clock_;
+    Ptr<IScheduler>  schedulerHolder_;
+    IScheduler*      scheduler_;
+    size_t    bufferSize_;
+    vector<EventTraceRecord>  records_;
+    vector<std::string>  labels_;
+    size_t    numLabelsWritten_;
+    uint64_t  numRecords_;
+    unordered_map<std::string, uint32_t>  labelIndices_;
+    unordered_map<std::type_index, TypeEntry>  types_;
+    std::ofstream  os_;
+    ClockType::time_point  t0_;
+    cookie_t  runCookie_;
+    cookie_t  pauseCookie_;
+    bool  active_;
+    EventTracer*  previous_;
+};
+
+
+NSFX_REGISTER_CLASS(EventTracer, "edu.uestc.nsfx.EventTracer");
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventTraceReader.
+/**
+ * @ingroup Simulator
+ * @brief Read an event trace file.
+ *
+ * @code
+ * std::ifstream is("events.trace", std::ios_base::binary);
+ * EventTraceReader reader(is);
+ * EventTraceRecord record;
+ * while (reader.Read(record))
+ * {
+ *     std::cout << reader.GetLabel(record.label_) << std::endl;
+ * }
+ * @endcode
+ */
+class EventTraceReader
+{
+public:
+    /**
+     * @brief Read the header of an event trace.
+     *
+     * @throw BadEventTrace The stream is not an event trace.
+     */
+    explicit EventTraceReader(std::istream& is) :
+        is_(is),
+        numRecords_(0)
+    {
+        char header[8 + 4 + 8];
+        ReadBytes(header, sizeof (header));
+        if (std::string(header, 8) != EventTraceFormat::GetMagic())
+        {
+            BOOST_THROW_EXCEPTION(
+                BadEventTrace() <<
+                ErrorMessage("Not an event trace."));
+        }
+        if (EventTraceFormat::Get(header + 8, 4) != EventTraceFormat::VERSION)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadEventTrace() <<
+                ErrorMessage("Unsupported version of the event trace."));
+        }
+        ticksPerSecond_ = EventTraceFormat::Get(header + 12, 8);
+        if (!ticksPerSecond_)
+        {
+            BOOST_THROW_EXCEPTION(
+                BadEventTrace() <<
+                ErrorMessage("Invalid time resolution of the event trace."));
+        }
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(EventTraceReader(const EventTraceReader& ));
+    BOOST_DELETED_FUNCTION(EventTraceReader& operator=(const EventTraceReader& ));
+
+public:
+    /**
+     * @brief Read the next record.
+     *
+     * @return `false` if there is no more record.
+     *
+     * @throw BadEventTrace The trace is corrupted.
+     */
+    bool Read(EventTraceRecord& record)
+    {
+        while (!numRecords_)
+        {
+            char type;
+            if (!is_.get(type))
+            {
+                return false;
+            }
+            char data[EventTraceFormat::RECORD_SIZE];
+            ReadBytes(data, 4);
+            uint32_t size = static_cast<uint32_t>(EventTraceFormat::Get(data, 4));
+            if (type == EventTraceFormat::LABEL_BLOCK)
+            {
+                std::string label(size, '\0');
+                if (size)
+                {
+                    ReadBytes(&label[0], size);
+                }
+                labels_.push_back(std::move(label));
+            }
+            else if (type == EventTraceFormat::RECORD_BLOCK)
+            {
+                numRecords_ = size;
+            }
+            else
+            {
+                BOOST_THROW_EXCEPTION(
+                    BadEventTrace() <<
+                    ErrorMessage("Invalid block of the event trace."));
+            }
+        }
+        char data[EventTraceFormat::RECORD_SIZE];
+        ReadBytes(data, sizeof (data));
+        --numRecords_;
+        record.wallTime_     = EventTraceFormat::Get(data, 8);
+        record.wallDuration_ = EventTraceFormat::Get(data + 8, 8);
+        record.simTime_      = static_cast<int64_t>(
+                                   EventTraceFormat::Get(data + 16, 8));
+        record.eventId_      = EventTraceFormat::Get(data + 24, 8);
+        record.label_        = static_cast<uint32_t>(
+                                   EventTraceFormat::Get(data + 32, 4));
+        record.depth_        = static_cast<uint32_t>(
+                                   EventTraceFormat::Get(data + 36, 4));
+        if (record.label_ >= labels_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                BadEventTrace() <<
+                ErrorMessage("Undefined label in the event trace."));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get a label that has been read.
+     */
+    const std::string& GetLabel(uint32_t index) const
+    {
+        BOOST_ASSERT(index < labels_.size());
+        return labels_[index];
+    }
+
+    /**
+     * @brief Get the labels that have been read.
+     */
+    const vector<std::string>& GetLabels(void) const BOOST_NOEXCEPT
+    {
+        return labels_;
+    }
+
+    /**
+     * @brief Get the number of ticks of the simulation time per second.
+     */
+    uint64_t GetTicksPerSecond(void) const BOOST_NOEXCEPT
+    {
+        return ticksPerSecond_;
+    }
+
+private:
+    void ReadBytes(char* p, size_t size)
+    {
+        if (!is_.read(p, size))
+        {
+            BOOST_THROW_EXCEPTION(
+                BadEventTrace() <<
+                ErrorMessage("The event trace is truncated."));
+        }
+    }
+
+private:
+    std::istream&  is_;
+    uint64_t  ticksPerSecond_;
+    uint32_t  numRecords_;
+    vector<std::string>  labels_;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ConvertEventTraceToJson.
+/**
+ * @ingroup Simulator
+ * @brief Convert an event trace to the Chrome trace event format.
+ *
+ * @param[in] is The input stream of the binary event trace.
+ * @param[in] os The output stream of the JSON trace.
+ *
+ * The JSON trace can be viewed in `chrome://tracing` or Perfetto.
+ * Each event is a complete event on the wall-clock timeline, whose name is
+ * the label of the event, and whose arguments are the simulation time
+ * (in seconds), the id and the queue depth of the event.
+ * The queue depth is also shown as a counter.
+ *
+ * @return The number of events.
+ *
+ * @throw BadEventTrace The trace is corrupted.
+ */
+inline uint64_t ConvertEventTraceToJson(std::istream& is, std::ostream& os)
+{
+    struct Local
+    {
+        static void WriteString(std::ostream& os, const std::string& s)
+        {
+            os << '"';
+            for (auto it = s.cbegin(); it != s.cend(); ++it)
+            {
+                unsigned char c = static_cast<unsigned char>(*it);
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << *it;
+                }
+                else if (c < 0x20)
+                {
+                    os << "\\u" << std::hex << std::setw(4)
+                       << std::setfill('0') << static_cast<unsigned>(c)
+                       << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    os << *it;
+                }
+            }
+            os << '"';
+        }
+    };
+
+    EventTraceReader reader(is);
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::fixed;
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+          "\"args\":{\"name\":\"nsfx simulator\"}}";
+    uint64_t numEvents = 0;
+    double ticksPerSecond = static_cast<double>(reader.GetTicksPerSecond());
+    EventTraceRecord record;
+    while (reader.Read(record))
+    {
+        double ts = record.wallTime_ / 1e3;
+        os << ",\n{\"name\":";
+        Local::WriteString(os, reader.GetLabel(record.label_));
+        os << std::setprecision(3)
+           << ",\"cat\":\"event\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+           << ",\"ts\":" << ts
+           << ",\"dur\":" << record.wallDuration_ / 1e3
+           << std::setprecision(10)
+           << ",\"args\":{\"time\":" << record.simTime_ / ticksPerSecond
+           << ",\"id\":" << record.eventId_
+           << ",\"depth\":" << record.depth_ << "}}";
+        os << std::setprecision(3)
+           << ",\n{\"name\":\"queue depth\",\"ph\":\"C\",\"pid\":1"
+           << ",\"ts\":" << ts
+           << ",\"args\":{\"depth\":" << record.depth_ << "}}";
+        ++numEvents;
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+    os.precision(precision);
+    return numEvents;
+}
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // EVENT_TRACER_H__D3DB16A4_7E56_4662_B822_E71F537B001F
+
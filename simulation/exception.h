@@ -30,6 +30,12 @@ NSFX_OPEN_NAMESPACE
  */
 struct NoScheduledEvent : ComponentException {};
 
+/**
+ * @ingroup Exception
+ * @brief An event trace is corrupted.
+ */
+struct BadEventTrace : ComponentException {};
+
 
 NSFX_CLOSE_NAMESPACE
 
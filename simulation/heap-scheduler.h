@@ -19,7 +19,11 @@
 
 #include <nsfx/simulation/config.h>
 #include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
+#include <nsfx/simulation/i-batch-scheduler.h>
 #include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-checkpoint.h>
+#include <nsfx/simulation/event-handle-pool.h>
 #include <nsfx/simulation/i-clock.h>
 #include <nsfx/component/class-registry.h>
 #include <functional>
@@ -36,6 +40,14 @@ NSFX_OPEN_NAMESPACE
  * @ingroup Simulator
  * @brief An event scheduler based on heap.
  *
+ * The event handles are recycled via an `EventHandlePool`.
+ * If a user does not hold the event handle returned by `ScheduleXxx()`,
+ * the event handle is reused after the event is fired or cancelled.
+ *
+ * Each event handle stores its slot in the heap.
+ * When an event is cancelled, it is removed from the heap in `O(log n)`
+ * time, instead of staying in the heap until its time point arrives.
+ *
  * # Uid
  * @code
  * "edu.uestc.nsfx.HeapScheduler"
@@ -46,25 +58,21 @@ NSFX_OPEN_NAMESPACE
  *   + `IClock`
  * * Provides
  *   + `IScheduler`
+ *   + `ICallableScheduler`
+ *   + `IBatchScheduler`
+ *   + `ICheckpointable`
  */
 class HeapScheduler :
     public IClockUser,
-    public IScheduler
+    public IScheduler,
+    public ICallableScheduler,
+    public IBatchScheduler,
+    public ICheckpointable,
+    private EventHandleOwner
 {
 private:
     typedef HeapScheduler   ThisClass;
-
-private:
-    struct HeapLessThan
-    {
-        bool operator()(const EventHandle* lhs, const EventHandle* rhs) const BOOST_NOEXCEPT
-        {
-            // For a max-heap, put the event that happens earliest at the head.
-            // If `rhs` is to be fired earlier than `lhs`, then `rhs` shall be
-            // placed ahead of `lhs`.
-            return *rhs < *lhs;
-        }
-    };
+    typedef EventHandlePool::HandleType  HandleType;
 
 public:
     HeapScheduler(void) BOOST_NOEXCEPT :
@@ -76,6 +84,7 @@ public:
     {
         for (auto it = events_.begin(); it != events_.end(); ++it)
         {
+            (*it)->SetOwner(nullptr);
             (*it)->Release();
         }
     }
@@ -124,6 +133,86 @@ public:
         {
             BOOST_THROW_EXCEPTION(InvalidPointer());
         }
+        return Insert(t, std::move(sink));
+    }
+
+    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        return events_.size();
+    }
+
+    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    {
+        IEventHandle* result = nullptr;
+        if (events_.size())
+        {
+            result = events_.front()->GetIntf();
+        }
+        return result;
+    }
+
+    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    {
+        if (events_.size())
+        {
+            HandleType* event = events_.front();
+            // Must remove the event before firing the event.
+            // Otherwise, during firing, new scheduling can corrupt the heap.
+            RemoveAt(0);
+            event->SetOwner(nullptr);
+            try
+            {
+                event->Fire();
+            }
+            catch (...)
+            {
+                pool_.Deallocate(event);
+                throw;
+            }
+            pool_.Deallocate(event);
+        }
+    }
+
+    /*}}}*/
+
+    // ICallableScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now(), std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now() + dt, std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (callable.IsEmpty())
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(callable));
+    }
+
+    /*}}}*/
+
+private:
+    /**
+     * @brief Insert an event.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     */
+    template<class Target>
+    Ptr<IEventHandle> Insert(const TimePoint& t, Target&& target)
+    {
         if (t < clock_->Now())
         {
             BOOST_THROW_EXCEPTION(
@@ -133,60 +222,183 @@ public:
                 CurrentTimeErrorInfo(clock_->Now()) <<
                 ScheduledTimeErrorInfo(t));
         }
-        EventHandle* handle = new Object<EventHandle>(
-                                  nextEventId_++, t, std::move(sink));
-        handle->AddRef();
-        events_.push_back(handle);
-        std::push_heap(events_.begin(), events_.end(), HeapLessThan());
-        // BOOST_ASSERT(IsOrdered());
+        HandleType* handle = pool_.Allocate(nextEventId_, t, std::move(target));
+        try
+        {
+            events_.push_back(handle);
+        }
+        catch (std::bad_alloc& )
+        {
+            handle->Cancel();
+            pool_.Deallocate(handle);
+            throw;
+        }
+        ++nextEventId_;
+        SiftUp(events_.size() - 1);
+        handle->SetOwner(this);
         return handle->GetIntf();
     }
 
-    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    // IBatchScheduler /*{{{*/
+public:
+    virtual TimePoint GetNextTimePoint(void) NSFX_OVERRIDE
     {
-        return events_.size();
+        if (events_.empty())
+        {
+            BOOST_THROW_EXCEPTION(NoScheduledEvent());
+        }
+        return events_.front()->GetTimePoint();
     }
 
-    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    virtual uint64_t FireAndRemoveNextEvents(const bool& stop) NSFX_OVERRIDE
     {
-        IEventHandle* result = nullptr;
+        uint64_t n = 0;
         if (events_.size())
         {
-            result = events_.front()->GetIntf();
+            TimePoint t = events_.front()->GetTimePoint();
+            do
+            {
+                ThisClass::FireAndRemoveNextEvent();
+                ++n;
+            }
+            while (!stop && events_.size() && events_.front()->GetTimePoint() == t);
         }
-        return result;
+        return n;
     }
 
-    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    /*}}}*/
+
+    // ICheckpointable /*{{{*/
+public:
+    /**
+     * @brief Save the pending events.
+     *
+     * @throw IllegalMethodCall An event cannot be checkpointed.
+     *                          e.g., it is scheduled as a callable.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
+    {
+        vector<EventHandle*> events(events_.begin(), events_.end());
+        SaveEvents(writer, nextEventId_, events);
+    }
+
+    /**
+     * @brief Restore the pending events.
+     *
+     * The events are scheduled with their original ids, so the events that
+     * happen at the same time are fired in the original order.
+     * The clock **must** have been restored, since the events cannot be
+     * scheduled before the current time.
+     *
+     * @throw Uninitialized     The scheduler is not initialized.
+     * @throw IllegalMethodCall There are pending events.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
     {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
         if (events_.size())
         {
-            std::pop_heap(events_.begin(), events_.end(), HeapLessThan());
-            EventHandle* event = events_.back();
-            // Must pop back before firing the event.
-            // Otherwise, during firing, new scheduling can corrupt the heap.
-            events_.pop_back();
-            event->Fire();
-            event->Release();
-            // BOOST_ASSERT(IsOrdered());
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot restore a checkpoint into a scheduler "
+                             "that has pending events."));
         }
+        nextEventId_ = RestoreEvents(reader,
+            [this] (const TimePoint& t, event_id_t id, Ptr<IEventSink<>>&& sink) {
+                nextEventId_ = id;
+                Insert(t, std::move(sink));
+            });
     }
 
+    /*}}}*/
+
+    // EventHandleOwner /*{{{*/
 private:
-    bool IsOrdered(void) const BOOST_NOEXCEPT
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT NSFX_OVERRIDE
     {
-        bool ordered = true;
-        TimePoint t0;
-        auto it = events_.begin();
-        if (it != events_.end())
+        HandleType* event = static_cast<HandleType*>(handle);
+        BOOST_ASSERT(events_[event->GetIndex()] == event);
+        RemoveAt(event->GetIndex());
+        pool_.Deallocate(event);
+    }
+
+    /*}}}*/
+
+    // Heap operations. /*{{{*/
+private:
+    /**
+     * @brief Move the event at a slot toward the root.
+     */
+    void SiftUp(size_t i) BOOST_NOEXCEPT
+    {
+        HandleType* event = events_[i];
+        while (i > 0)
         {
-            t0 = (*it)->GetTimePoint();
-            for (++it; it != events_.end() && ordered; ++it)
+            size_t parent = (i - 1) / 2;
+            if (!(*event < *events_[parent]))
+            {
+                break;
+            }
+            events_[i] = events_[parent];
+            events_[i]->SetIndex(i);
+            i = parent;
+        }
+        events_[i] = event;
+        event->SetIndex(i);
+    }
+
+    /**
+     * @brief Move the event at a slot toward the leaves.
+     */
+    void SiftDown(size_t i) BOOST_NOEXCEPT
+    {
+        size_t n = events_.size();
+        HandleType* event = events_[i];
+        while (true)
+        {
+            size_t child = 2 * i + 1;
+            if (child >= n)
+            {
+                break;
+            }
+            if (child + 1 < n && *events_[child + 1] < *events_[child])
+            {
+                ++child;
+            }
+            if (!(*events_[child] < *event))
+            {
+                break;
+            }
+            events_[i] = events_[child];
+            events_[i]->SetIndex(i);
+            i = child;
+        }
+        events_[i] = event;
+        event->SetIndex(i);
+    }
+
+    /**
+     * @brief Remove the event at a slot.
+     */
+    void RemoveAt(size_t i) BOOST_NOEXCEPT
+    {
+        HandleType* last = events_.back();
+        events_.pop_back();
+        if (i < events_.size())
+        {
+            events_[i] = last;
+            if (i > 0 && *last < *events_[(i - 1) / 2])
+            {
+                SiftUp(i);
+            }
+            else
             {
-                ordered = (t0 <= (*it)->GetTimePoint());
+                SiftDown(i);
             }
         }
-        return ordered;
     }
 
     /*}}}*/
@@ -195,13 +407,17 @@ private:
     NSFX_INTERFACE_MAP_BEGIN(ThisClass)
         NSFX_INTERFACE_ENTRY(IClockUser)
         NSFX_INTERFACE_ENTRY(IScheduler)
+        NSFX_INTERFACE_ENTRY(ICallableScheduler)
+        NSFX_INTERFACE_ENTRY(IBatchScheduler)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
     NSFX_INTERFACE_MAP_END()
 
 private:
     bool  initialized_;
     Ptr<IClock>  clock_;
     event_id_t   nextEventId_;
-    vector<EventHandle*>  events_;
+    vector<HandleType*>  events_;
+    EventHandlePool  pool_;
 
 }; // class HeapScheduler
 
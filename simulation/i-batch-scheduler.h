@@ -0,0 +1,86 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_BATCH_SCHEDULER_H__B997CB22_B15E_4CCC_B7AC_06E15A4EEB4E
+#define I_BATCH_SCHEDULER_H__B997CB22_B15E_4CCC_B7AC_06E15A4EEB4E
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/exception.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IBatchScheduler.
+/**
+ * @ingroup Simulator
+ * @brief An event scheduler that fires the events at the same time in a batch.
+ *
+ * This is an optional interface of an event scheduler that also provides
+ * `IScheduler`.
+ *
+ * A simulator that drives the scheduler via `IScheduler` has to call
+ * `IScheduler::GetNextEvent()` and `IScheduler::FireAndRemoveNextEvent()`
+ * for every event.
+ * When many events happen at the same time, a simulator can use this interface
+ * to obtain the time point once, and let the scheduler fire the events in a
+ * tight loop.
+ */
+class IBatchScheduler :
+    virtual public IObject
+{
+public:
+    virtual ~IBatchScheduler(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Get the time point of the next event.
+     *
+     * @throw NoScheduledEvent There is no events in the scheduler.
+     */
+    virtual TimePoint GetNextTimePoint(void) = 0;
+
+    /**
+     * @brief Fire and remove the events that happen at the time point of the
+     *        next event.
+     *
+     * @param[in] stop A flag that is checked after each event is fired.
+     *                 The scheduler stops firing events once the flag is
+     *                 `true`, e.g., the simulator is paused by an event.
+     *
+     * @return The number of fired events.
+     *
+     * The events are fired in the same order as calling
+     * `IScheduler::FireAndRemoveNextEvent()` repeatedly.
+     * The events scheduled at the same time point during the batch are fired
+     * in the same batch.
+     * The events cancelled during the batch are not fired.
+     * If the scheduler is empty, this function does nothing.
+     */
+    virtual uint64_t FireAndRemoveNextEvents(const bool& stop) = 0;
+
+};
+
+NSFX_DEFINE_CLASS_UID(IBatchScheduler, "edu.uestc.nsfx.IBatchScheduler");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_BATCH_SCHEDULER_H__B997CB22_B15E_4CCC_B7AC_06E15A4EEB4E
+
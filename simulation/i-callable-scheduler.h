@@ -0,0 +1,140 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_CALLABLE_SCHEDULER_H__D146FCB9_C772_4CD8_A443_AD46103C9824
+#define I_CALLABLE_SCHEDULER_H__D146FCB9_C772_4CD8_A443_AD46103C9824
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-event-handle.h>
+#include <nsfx/simulation/event-callable.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ICallableScheduler.
+/**
+ * @ingroup Simulator
+ * @brief An event scheduler that schedules callables.
+ *
+ * This is an optional interface of an event scheduler that also provides
+ * `IScheduler`.
+ *
+ * Scheduling an event via `IScheduler` requires an event sink object, which
+ * is usually allocated via `CreateEventSink()` for each event.
+ * This interface accepts any callable of signature `void()`.
+ * A small callable is stored inline in the event handle, and a scheduler
+ * that recycles its event handles schedules such an event without allocating
+ * memory.
+ *
+ * @code
+ * Ptr<ICallableScheduler> scheduler(...);
+ * scheduler->ScheduleIn(Seconds(1), [this] { OnTimeout(); });
+ * @endcode
+ *
+ * @see `EventCallable`.
+ */
+class ICallableScheduler :
+    virtual public IObject
+{
+public:
+    virtual ~ICallableScheduler(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Schedule an event.
+     *
+     * @param[in] callable The callable of the event.
+     *
+     * @throw OutOfMemory
+     * @throw Uninitialized  The scheduler is not initialized.
+     * @throw InvalidPointer The callable is empty.
+     */
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) = 0;
+
+    /**
+     * @brief Schedule an event.
+     *
+     * @param[in] callable The callable of the event.
+     *
+     * @throw OutOfMemory
+     * @throw Uninitialized   The scheduler is not initialized.
+     * @throw InvalidPointer  The callable is empty.
+     * @throw InvalidArgument The duration is invalid.
+     *                         e.g., it is negative.
+     */
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) = 0;
+
+    /**
+     * @brief Schedule an event.
+     *
+     * @param[in] callable The callable of the event.
+     *
+     * @throw OutOfMemory
+     * @throw Uninitialized   The scheduler is not initialized.
+     * @throw InvalidPointer  The callable is empty.
+     * @throw InvalidArgument The time point is invalid.
+     *                         e.g., it is earlier than the current time.
+     */
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) = 0;
+
+    /**
+     * @brief Schedule a callable.
+     *
+     * @tparam F A callable type of signature `void()`.
+     */
+    template<class F>
+    Ptr<IEventHandle> ScheduleNow(F&& f)
+    {
+        return ScheduleCallableNow(EventCallable(std::forward<F>(f)));
+    }
+
+    /**
+     * @brief Schedule a callable.
+     *
+     * @tparam F A callable type of signature `void()`.
+     */
+    template<class F>
+    Ptr<IEventHandle> ScheduleIn(const Duration& dt, F&& f)
+    {
+        return ScheduleCallableIn(dt, EventCallable(std::forward<F>(f)));
+    }
+
+    /**
+     * @brief Schedule a callable.
+     *
+     * @tparam F A callable type of signature `void()`.
+     */
+    template<class F>
+    Ptr<IEventHandle> ScheduleAt(const TimePoint& t, F&& f)
+    {
+        return ScheduleCallableAt(t, EventCallable(std::forward<F>(f)));
+    }
+
+};
+
+NSFX_DEFINE_CLASS_UID(ICallableScheduler, "edu.uestc.nsfx.ICallableScheduler");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_CALLABLE_SCHEDULER_H__D146FCB9_C772_4CD8_A443_AD46103C9824
+
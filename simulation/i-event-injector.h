@@ -0,0 +1,134 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_EVENT_INJECTOR_H__19A284AC_41FE_4791_AF68_1AE86AE0261E
+#define I_EVENT_INJECTOR_H__19A284AC_41FE_4791_AF68_1AE86AE0261E
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IEventInjector.
+/**
+ * @ingroup Simulator
+ * @brief Inject events into a simulator from other threads.
+ *
+ * The methods are thread-safe, and they can be called while the simulator
+ * is running in another thread.
+ * The injected events are moved into the scheduler at the safe points of
+ * the simulator, i.e., before the next events are fired.
+ *
+ * The ownership of an event sink is transferred to the simulator.
+ * The caller **must not** hold other references to the event sink, since
+ * the reference counts of the components are not thread-safe.
+ */
+class IEventInjector :
+    virtual public IObject
+{
+public:
+    virtual ~IEventInjector(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Inject an event.
+     *
+     * @param[in] t    The time point of the event.
+     *                 If it is earlier than the current time when the event
+     *                 is moved into the scheduler, the event is scheduled at
+     *                 the current time.
+     * @param[in] sink The event sink.
+     *
+     * @throw InvalidPointer The sink is `nullptr`.
+     */
+    virtual void Inject(const TimePoint& t, Ptr<IEventSink<>> sink) = 0;
+
+    /**
+     * @brief Inject an event at the current time.
+     *
+     * The event is scheduled at the current time when it is moved into the
+     * scheduler.
+     * If the simulator is paced by the wall clock, the current time is the
+     * simulation time of the current wall-clock time.
+     *
+     * @throw InvalidPointer The sink is `nullptr`.
+     */
+    virtual void InjectNow(Ptr<IEventSink<>> sink) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IEventInjector, "edu.uestc.nsfx.IEventInjector");
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IRealTimePacing.
+/**
+ * @ingroup Simulator
+ * @brief Pace a simulator by the wall clock.
+ *
+ * When the simulator is paced, it waits until the wall-clock time of an
+ * event before the event is fired.
+ * The simulation time and the wall-clock time are aligned when the simulator
+ * starts to run.
+ * If the simulator falls behind the wall clock, the events are fired
+ * without waiting until it catches up.
+ *
+ * A paced simulator does not end a run when the scheduler becomes empty
+ * before the end time of `RunUntil()`, since events may be injected via
+ * `IEventInjector`.
+ */
+class IRealTimePacing :
+    virtual public IObject
+{
+public:
+    virtual ~IRealTimePacing(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Pace the simulator by the wall clock.
+     *
+     * @param[in] speed The ratio of the simulation time to the wall-clock
+     *                  time.
+     *
+     * @throw InvalidArgument The speed is not positive.
+     * @throw IllegalMethodCall The simulator is running.
+     */
+    virtual void EnablePacing(double speed) = 0;
+
+    /**
+     * @brief Run the simulator as fast as possible.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     */
+    virtual void DisablePacing(void) = 0;
+
+    virtual bool IsPacing(void) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IRealTimePacing, "edu.uestc.nsfx.IRealTimePacing");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_EVENT_INJECTOR_H__19A284AC_41FE_4791_AF68_1AE86AE0261E
+
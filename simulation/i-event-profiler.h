@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_EVENT_PROFILER_H__AC68AEFB_C975_48B7_A582_163363B59DA6
+#define I_EVENT_PROFILER_H__AC68AEFB_C975_48B7_A582_163363B59DA6
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+#include <string>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IEventLabel.
+/**
+ * @ingroup Simulator
+ * @brief The label of an event sink.
+ *
+ * An event sink can provide this interface to name the events it handles in
+ * the profiles of an `IEventProfiler`.
+ * Otherwise, the events are named after the dynamic type of the event sink.
+ *
+ * @see `LabelEventSink()`.
+ */
+class IEventLabel :
+    virtual public IObject
+{
+public:
+    virtual ~IEventLabel(void) BOOST_NOEXCEPT {}
+
+    virtual const std::string& GetEventLabel(void) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IEventLabel, "edu.uestc.nsfx.IEventLabel");
+
+
+////////////////////////////////////////////////////////////////////////////////
+// InternalEventSinkTag.
+/**
+ * @ingroup Simulator
+ * @brief The tag of the event sinks that are used internally by a scheduler.
+ *
+ * A scheduler that is placed in front of another scheduler can schedule its
+ * own events in that scheduler, e.g., `TimerWheelScheduler`.
+ * If the event sink of such an event derives from this class, the event is not
+ * reported to `EventProfiler` or `EventTracer`.
+ */
+class InternalEventSinkTag
+{
+public:
+    virtual ~InternalEventSinkTag(void) {}
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// EventProfile.
+/**
+ * @ingroup Simulator
+ * @brief The profile of the events of the same label.
+ */
+struct EventProfile
+{
+    EventProfile(void) :
+        numEvents_(0),
+        wallTime_(0)
+    {}
+
+    /**
+     * @brief The label, or the dynamic type of the event sinks.
+     */
+    std::string  name_;
+
+    /**
+     * @brief The number of fired events.
+     */
+    uint64_t  numEvents_;
+
+    /**
+     * @brief The wall-clock time spent in the event sinks (in seconds).
+     */
+    double  wallTime_;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IEventProfiler.
+/**
+ * @ingroup Simulator
+ * @brief An event profiler.
+ *
+ * An event profiler measures the events fired by a simulator.
+ */
+class IEventProfiler :
+    virtual public IObject
+{
+public:
+    virtual ~IEventProfiler(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Get the number of fired events.
+     */
+    virtual uint64_t GetNumEvents(void) = 0;
+
+    /**
+     * @brief Get the wall-clock time spent in the event sinks (in seconds).
+     */
+    virtual double GetEventTime(void) = 0;
+
+    /**
+     * @brief Get the wall-clock time spent in running the simulator
+     *        (in seconds).
+     */
+    virtual double GetRunTime(void) = 0;
+
+    /**
+     * @brief Get the number of events fired per second of wall-clock time.
+     */
+    virtual double GetEventRate(void) = 0;
+
+    /**
+     * @brief Get the profiles of the events.
+     *
+     * The profiles are sorted in the descending order of their wall-clock
+     * time.
+     */
+    virtual vector<EventProfile> GetEventProfiles(void) = 0;
+
+    /**
+     * @brief Get the histogram of the number of pending events.
+     *
+     * The number of pending events is sampled when an event is fired.
+     * The `0`-th bin counts the samples of `0`, and the `i`-th bin
+     * (`i > 0`) counts the samples within `[2^(i-1), 2^i)`.
+     */
+    virtual vector<uint64_t> GetQueueDepthHistogram(void) = 0;
+
+    /**
+     * @brief Clear the measurements.
+     */
+    virtual void Reset(void) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IEventProfiler, "edu.uestc.nsfx.IEventProfiler");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_EVENT_PROFILER_H__AC68AEFB_C975_48B7_A582_163363B59DA6
+
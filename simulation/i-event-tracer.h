@@ -0,0 +1,92 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_EVENT_TRACER_H__E8B83FEC_BB02_4FC7_A1CD_21C94A8E9E8E
+#define I_EVENT_TRACER_H__E8B83FEC_BB02_4FC7_A1CD_21C94A8E9E8E
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/component/i-object.h>
+#include <string>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IEventTracer.
+/**
+ * @ingroup Simulator
+ * @brief An event tracer.
+ *
+ * An event tracer records the events fired by a simulator into a trace file.
+ *
+ * @see `EventTracer`, `EventTraceReader`, `ConvertEventTraceToJson()`.
+ */
+class IEventTracer :
+    virtual public IObject
+{
+public:
+    virtual ~IEventTracer(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Set the number of records that are buffered in memory.
+     *
+     * @throw InvalidArgument   The size is `0`.
+     * @throw IllegalMethodCall The trace file is open.
+     */
+    virtual void SetBufferSize(size_t numRecords) = 0;
+
+    /**
+     * @brief Open a trace file.
+     *
+     * The events are recorded when the simulator runs, until the trace file
+     * is closed.
+     *
+     * @throw IllegalMethodCall A trace file is open.
+     * @throw InvalidArgument   Cannot open the file.
+     */
+    virtual void Open(const std::string& filename) = 0;
+
+    /**
+     * @brief Write the buffered records to the trace file.
+     *
+     * @throw Unexpected Cannot write the file.
+     */
+    virtual void Flush(void) = 0;
+
+    /**
+     * @brief Flush and close the trace file.
+     *
+     * @throw Unexpected Cannot write the file.
+     */
+    virtual void Close(void) = 0;
+
+    /**
+     * @brief Get the number of events that have been recorded.
+     */
+    virtual uint64_t GetNumRecords(void) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IEventTracer, "edu.uestc.nsfx.IEventTracer");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_EVENT_TRACER_H__E8B83FEC_BB02_4FC7_A1CD_21C94A8E9E8E
+
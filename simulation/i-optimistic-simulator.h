@@ -0,0 +1,193 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_OPTIMISTIC_SIMULATOR_H__314502F6_CF03_4767_B00D_17B7788FED02
+#define I_OPTIMISTIC_SIMULATOR_H__314502F6_CF03_4767_B00D_17B7788FED02
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-state-saver.h>
+#include <nsfx/simulation/i-parallel-simulator.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/i-user.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IOptimisticSimulator.
+/**
+ * @ingroup Simulator
+ * @brief An optimistic parallel simulator.
+ *
+ * The model is divided into partitions (logical processes), as
+ * `IParallelSimulator`.
+ * However, the partitions fire their events speculatively, without waiting
+ * for the other partitions.
+ * When a partition receives a remote event that happens before the events it
+ * has fired, it rolls back the events, and fires them again.
+ *
+ * The components in a partition use the clock and the scheduler of the
+ * partition.
+ * A component whose state is changed by the events **must** register its
+ * `IStateSaver` to the partition.
+ *
+ * The events **must not** have irreversible side effects, such as writing
+ * to a file, since an event may be fired more than once.
+ */
+class IOptimisticSimulator :
+    virtual public IObject
+{
+public:
+    virtual ~IOptimisticSimulator(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Add a partition.
+     *
+     * @return The index of the partition.
+     *
+     * The scheduler of the partition is provided by the simulator, since
+     * it has to keep the fired events for rollback.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     */
+    virtual uint32_t AddPartition(void) = 0;
+
+    /**
+     * @brief Get the number of partitions.
+     */
+    virtual uint32_t GetNumPartitions(void) = 0;
+
+    /**
+     * @brief Get the clock of a partition.
+     *
+     * @throw OutOfBounds The partition does not exist.
+     */
+    virtual Ptr<IClock> GetClock(uint32_t partition) = 0;
+
+    /**
+     * @brief Get the scheduler of a partition.
+     *
+     * @throw OutOfBounds The partition does not exist.
+     */
+    virtual Ptr<IScheduler> GetScheduler(uint32_t partition) = 0;
+
+    /**
+     * @brief Register the state-saving hooks of a component.
+     *
+     * @param[in] partition The partition of the component.
+     * @param[in] saver     The state-saving hooks.
+     *
+     * The hooks are called by the thread that fires the events in the
+     * partition.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     * @throw OutOfBounds The partition does not exist.
+     * @throw InvalidPointer The saver is `nullptr`.
+     */
+    virtual void AddStateSaver(uint32_t partition, Ptr<IStateSaver> saver) = 0;
+
+    /**
+     * @brief Set the number of threads.
+     *
+     * @param[in] numThreads The number of threads.
+     *                       If it is `0`, the number of hardware threads is used.
+     *
+     * The partitions are assigned to the threads in a round-robin manner.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     */
+    virtual void SetNumThreads(uint32_t numThreads) = 0;
+
+    /**
+     * @brief Set the number of events fired by a thread between two
+     *        computations of the global virtual time.
+     *
+     * @param[in] numEvents The number of events.
+     *                      It **must** be positive.
+     *
+     * A small number commits the events earlier, and keeps less states,
+     * at the cost of more synchronization.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     * @throw InvalidArgument The number is zero.
+     */
+    virtual void SetGvtInterval(uint32_t numEvents) = 0;
+
+    /**
+     * @brief Schedule an event in another partition.
+     *
+     * @param[in] src   The source partition.
+     *                  This function **must** be called by the thread that
+     *                  fires the events in the source partition, or when the
+     *                  simulator is not running.
+     * @param[in] dst   The destination partition.
+     * @param[in] delay The delay after the current time of the source
+     *                  partition.
+     *                  It **must not** be negative.
+     * @param[in] sink  The event sink.
+     *                  It **must not** be shared with the source partition,
+     *                  since it is fired by another thread.
+     *
+     * If the event that schedules the remote event is rolled back, an
+     * anti-message is sent to the destination partition to cancel the remote
+     * event.
+     * Therefore, no event handle is returned.
+     *
+     * If `src` equals `dst`, the event is scheduled in the partition
+     * immediately.
+     *
+     * @throw OutOfBounds The partition does not exist.
+     * @throw InvalidPointer The sink is `nullptr`.
+     * @throw InvalidArgument The delay is negative.
+     */
+    virtual void ScheduleRemote(uint32_t src, uint32_t dst,
+                                const Duration& delay,
+                                Ptr<IEventSink<>> sink) = 0;
+
+    /**
+     * @brief Get the number of events that have been committed.
+     */
+    virtual uint64_t GetNumCommittedEvents(void) = 0;
+
+    /**
+     * @brief Get the number of events that have been rolled back.
+     */
+    virtual uint64_t GetNumRolledBackEvents(void) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IOptimisticSimulator,
+                      "edu.uestc.nsfx.IOptimisticSimulator");
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IOptimisticSimulatorUser.
+NSFX_DEFINE_USER_INTERFACE(
+    IOptimisticSimulatorUser, "edu.uestc.nsfx.IOptimisticSimulatorUser",
+    IOptimisticSimulator);
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_OPTIMISTIC_SIMULATOR_H__314502F6_CF03_4767_B00D_17B7788FED02
+
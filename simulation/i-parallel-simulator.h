@@ -0,0 +1,177 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_PARALLEL_SIMULATOR_H__942C0A9B_F322_409B_A831_9EE520DA9CA8
+#define I_PARALLEL_SIMULATOR_H__942C0A9B_F322_409B_A831_9EE520DA9CA8
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/event/i-event-sink.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/i-user.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Error info.
+typedef boost::error_info<struct tag_PartitionIndex, uint32_t>
+        PartitionIndexErrorInfo;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IParallelSimulator.
+/**
+ * @ingroup Simulator
+ * @brief A parallel simulator.
+ *
+ * The model is divided into partitions (logical processes).
+ * Each partition has its own scheduler and clock, and the events in different
+ * partitions are fired by different threads.
+ *
+ * The components in a partition use the clock and the scheduler of the
+ * partition, exactly as they use a sequential simulator.
+ *
+ * The partitions interact via remote events only.
+ * A remote event is scheduled via `ScheduleRemote()`, and it **must** be
+ * scheduled at least a *link delay* after the current time of the source
+ * partition.
+ * The minimum link delay is the *lookahead* that allows the partitions to
+ * run in parallel.
+ */
+class IParallelSimulator :
+    virtual public IObject
+{
+public:
+    virtual ~IParallelSimulator(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Add a partition.
+     *
+     * @param[in] scheduler The scheduler of the partition.
+     *                      It **must** provide `IClockUser`, and it **must not**
+     *                      have been initialized, since the parallel simulator
+     *                      provides the clock of the partition.
+     *
+     * @return The index of the partition.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     * @throw InvalidPointer The scheduler is `nullptr`.
+     * @throw NoInterface The scheduler does not provide `IClockUser`.
+     */
+    virtual uint32_t AddPartition(Ptr<IScheduler> scheduler) = 0;
+
+    /**
+     * @brief Get the number of partitions.
+     */
+    virtual uint32_t GetNumPartitions(void) = 0;
+
+    /**
+     * @brief Get the clock of a partition.
+     *
+     * @throw OutOfBounds The partition does not exist.
+     */
+    virtual Ptr<IClock> GetClock(uint32_t partition) = 0;
+
+    /**
+     * @brief Get the scheduler of a partition.
+     *
+     * @throw OutOfBounds The partition does not exist.
+     */
+    virtual Ptr<IScheduler> GetScheduler(uint32_t partition) = 0;
+
+    /**
+     * @brief Declare the minimum delay of the events sent between partitions.
+     *
+     * @param[in] src   The source partition.
+     * @param[in] dst   The destination partition.
+     * @param[in] delay The minimum delay.
+     *                  It **must** be positive.
+     *
+     * A link is unidirectional.
+     * Only the partitions that are connected by links can schedule remote
+     * events.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     * @throw OutOfBounds The partition does not exist.
+     * @throw InvalidArgument The delay is not positive.
+     */
+    virtual void SetLinkDelay(uint32_t src, uint32_t dst,
+                              const Duration& delay) = 0;
+
+    /**
+     * @brief Set the number of threads.
+     *
+     * @param[in] numThreads The number of threads.
+     *                       If it is `0`, the number of hardware threads is used.
+     *
+     * The partitions are assigned to the threads in a round-robin manner.
+     *
+     * @throw IllegalMethodCall The simulator is running.
+     */
+    virtual void SetNumThreads(uint32_t numThreads) = 0;
+
+    /**
+     * @brief Schedule an event in another partition.
+     *
+     * @param[in] src   The source partition.
+     *                  This function **must** be called by the thread that
+     *                  fires the events in the source partition, or when the
+     *                  simulator is not running.
+     * @param[in] dst   The destination partition.
+     * @param[in] delay The delay after the current time of the source
+     *                  partition.
+     * @param[in] sink  The event sink.
+     *                  It **must not** be shared with the source partition,
+     *                  since it is fired by another thread.
+     *
+     * The event is scheduled in the destination partition at the beginning of
+     * the next synchronization window.
+     * Therefore, no event handle is returned.
+     *
+     * If `src` equals `dst`, the event is scheduled in the partition
+     * immediately.
+     *
+     * @throw OutOfBounds The partition does not exist.
+     * @throw InvalidPointer The sink is `nullptr`.
+     * @throw InvalidArgument There is no link from `src` to `dst`,
+     *                        or the delay is less than the link delay.
+     */
+    virtual void ScheduleRemote(uint32_t src, uint32_t dst,
+                                const Duration& delay,
+                                Ptr<IEventSink<>> sink) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IParallelSimulator, "edu.uestc.nsfx.IParallelSimulator");
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IParallelSimulatorUser.
+NSFX_DEFINE_USER_INTERFACE(
+    IParallelSimulatorUser, "edu.uestc.nsfx.IParallelSimulatorUser",
+    IParallelSimulator);
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_PARALLEL_SIMULATOR_H__942C0A9B_F322_409B_A831_9EE520DA9CA8
+
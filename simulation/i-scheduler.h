@@ -91,7 +91,8 @@ public:
     /**
      * @brief Get the number of events in the scheduler.
      *
-     * The events may be pending or cancelled.
+     * Only pending events are counted, since a cancelled event is removed
+     * from the scheduler immediately.
      * The currently running event is not counted.
      */
     virtual uint64_t GetNumEvents(void) = 0;
@@ -112,7 +113,7 @@ public:
     /**
      * @brief Fire and remove the next event in the scheduler.
      *
-     * If the events has been cancelled, it is remove without being fired.
+     * The event is removed from the scheduler before it is fired.
      */
     virtual void FireAndRemoveNextEvent(void) = 0;
 
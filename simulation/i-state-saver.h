@@ -0,0 +1,89 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_STATE_SAVER_H__369F8956_CCC2_44B0_94C4_72E1BD2642EA
+#define I_STATE_SAVER_H__369F8956_CCC2_44B0_94C4_72E1BD2642EA
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/component/i-object.h>
+#include <nsfx/component/ptr.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// IStateSaver.
+/**
+ * @ingroup Simulator
+ * @brief The state-saving hooks of a component.
+ *
+ * An optimistic simulator fires the events speculatively, and undoes the
+ * events that are fired too early.
+ * A component that changes its state when an event is fired **must** provide
+ * this interface, so the simulator is able to restore its state.
+ *
+ * The states are identified by *checkpoints*.
+ * The checkpoints are increasing, and a checkpoint is never reused.
+ */
+class IStateSaver :
+    virtual public IObject
+{
+public:
+    virtual ~IStateSaver(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Save the current state.
+     *
+     * @param[in] checkpoint The checkpoint of the state.
+     *                       It is greater than the checkpoints of the states
+     *                       that have been saved.
+     *
+     * The simulator calls this function before an event is fired.
+     */
+    virtual void SaveState(uint64_t checkpoint) = 0;
+
+    /**
+     * @brief Restore a saved state.
+     *
+     * @param[in] checkpoint The checkpoint of the state.
+     *
+     * The states saved at and after the checkpoint are no longer needed,
+     * and they can be discarded.
+     */
+    virtual void RestoreState(uint64_t checkpoint) = 0;
+
+    /**
+     * @brief Discard the states that are no longer needed.
+     *
+     * @param[in] checkpoint The states saved before the checkpoint will never
+     *                       be restored.
+     *
+     * The simulator calls this function when the events are committed.
+     */
+    virtual void CommitState(uint64_t checkpoint) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(IStateSaver, "edu.uestc.nsfx.IStateSaver");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_STATE_SAVER_H__369F8956_CCC2_44B0_94C4_72E1BD2642EA
+
@@ -0,0 +1,72 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef I_TIMER_WHEEL_H__C4D13601_B263_4C81_931C_409380246380
+#define I_TIMER_WHEEL_H__C4D13601_B263_4C81_931C_409380246380
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/component/i-object.h>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ITimerWheel.
+/**
+ * @ingroup Simulator
+ * @brief Configure a timer wheel.
+ *
+ * @see `TimerWheelScheduler`.
+ */
+class ITimerWheel :
+    virtual public IObject
+{
+public:
+    virtual ~ITimerWheel(void) BOOST_NOEXCEPT {}
+
+    /**
+     * @brief Set the width of a slot of the innermost wheel.
+     *
+     * The events that happen within the current slot are scheduled by the
+     * backing scheduler directly.
+     * The span of the wheels is `2^24` slots.
+     *
+     * @throw InvalidArgument   The resolution is not positive.
+     * @throw IllegalMethodCall There are events in the wheels.
+     */
+    virtual void SetResolution(const Duration& resolution) = 0;
+
+    virtual Duration GetResolution(void) = 0;
+
+    /**
+     * @brief Get the number of events in the wheels.
+     *
+     * The due events that have been moved out of the wheels are not
+     * counted.
+     */
+    virtual uint64_t GetNumTimers(void) = 0;
+
+};
+
+
+NSFX_DEFINE_CLASS_UID(ITimerWheel, "edu.uestc.nsfx.ITimerWheel");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // I_TIMER_WHEEL_H__C4D13601_B263_4C81_931C_409380246380
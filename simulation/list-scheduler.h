@@ -19,8 +19,10 @@
 
 #include <nsfx/simulation/config.h>
 #include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
 #include <nsfx/simulation/i-clock.h>
 #include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-checkpoint.h>
 #include <nsfx/component/class-registry.h>
 #include <functional>
 #include <memory>
@@ -35,6 +37,8 @@ NSFX_OPEN_NAMESPACE
  * @ingroup Simulator
  * @brief An event scheduler based on list.
  *
+ * A cancelled event is removed from the list immediately.
+ *
  * # Uid
  * @code
  * "edu.uestc.nsfx.ListScheduler"
@@ -45,10 +49,15 @@ NSFX_OPEN_NAMESPACE
  *   + `IClock`
  * * Provides
  *   + `IScheduler`
+ *   + `ICallableScheduler`
+ *   + `ICheckpointable`
  */
 class ListScheduler :
     public IClockUser,
-    public IScheduler
+    public IScheduler,
+    public ICallableScheduler,
+    public ICheckpointable,
+    private EventHandleOwner
 {
 private:
     typedef ListScheduler  ThisClass;
@@ -59,7 +68,13 @@ public:
         nextEventId_(0)
     {}
 
-    virtual ~ListScheduler(void) {}
+    virtual ~ListScheduler(void)
+    {
+        for (auto it = list_.begin(); it != list_.end(); ++it)
+        {
+            (*it)->SetOwner(nullptr);
+        }
+    }
 
     // IClockUser /*{{{*/
 public:
@@ -105,6 +120,90 @@ public:
         {
             BOOST_THROW_EXCEPTION(InvalidPointer());
         }
+        return Insert(t, std::move(sink));
+    }
+
+    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        return list_.size();
+    }
+
+    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    {
+        IEventHandle* result = nullptr;
+        if (list_.size() > 0)
+        {
+            result = list_.front().Get()->GetIntf();
+        }
+        return result;
+    }
+
+    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    {
+        if (list_.size() > 0)
+        {
+            Ptr<EventHandle> event(std::move(list_.front()));
+            // Remove the event before firing the event.
+            list_.pop_front();
+            event->SetOwner(nullptr);
+            event->Fire();
+            // BOOST_ASSERT(IsOrdered());
+        }
+    }
+
+private:
+    bool IsOrdered(void) const BOOST_NOEXCEPT
+    {
+        bool ordered = true;
+        TimePoint t0;
+        for (auto it = list_.cbegin(); it != list_.cend() && ordered; ++it)
+        {
+            ordered = (t0 <= (*it)->GetTimePoint());
+            t0 = (*it)->GetTimePoint();
+        }
+        return ordered;
+    }
+
+    /*}}}*/
+
+    // ICallableScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now(), std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now() + dt, std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (callable.IsEmpty())
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(callable));
+    }
+
+    /*}}}*/
+
+private:
+    /**
+     * @brief Insert an event.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     */
+    template<class Target>
+    Ptr<IEventHandle> Insert(const TimePoint& t, Target&& target)
+    {
         if (t < clock_->Now())
         {
             BOOST_THROW_EXCEPTION(
@@ -115,7 +214,7 @@ public:
                 ScheduledTimeErrorInfo(t));
         }
         Ptr<EventHandle> handle(new Object<EventHandle>(
-                                    nextEventId_++, t, std::move(sink)));
+                                    nextEventId_++, t, std::move(target)));
         if (!list_.size())
         {
             list_.push_front(handle);
@@ -138,46 +237,75 @@ public:
                 list_.push_back(handle);
             }
         }
+        handle->SetOwner(this);
         // BOOST_ASSERT(IsOrdered());
         return Ptr<IEventHandle>(handle.Detach()->GetIntf(), false);
     }
 
-    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
-    {
-        return list_.size();
-    }
-
-    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    // ICheckpointable /*{{{*/
+public:
+    /**
+     * @brief Save the pending events.
+     *
+     * @throw IllegalMethodCall An event cannot be checkpointed.
+     *                          e.g., it is scheduled as a callable.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
     {
-        IEventHandle* result = nullptr;
-        if (list_.size() > 0)
+        vector<EventHandle*> events;
+        events.reserve(list_.size());
+        for (auto it = list_.cbegin(); it != list_.cend(); ++it)
         {
-            result = list_.front().Get()->GetIntf();
+            events.push_back(it->Get());
         }
-        return result;
+        SaveEvents(writer, nextEventId_, events);
     }
 
-    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    /**
+     * @brief Restore the pending events.
+     *
+     * The events are scheduled with their original ids, so the events that
+     * happen at the same time are fired in the original order.
+     * The clock **must** have been restored, since the events cannot be
+     * scheduled before the current time.
+     *
+     * @throw Uninitialized     The scheduler is not initialized.
+     * @throw IllegalMethodCall There are pending events.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
     {
-        if (list_.size() > 0)
+        if (!initialized_)
         {
-            list_.front()->Fire();
-            list_.pop_front();
-            // BOOST_ASSERT(IsOrdered());
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (list_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot restore a checkpoint into a scheduler "
+                             "that has pending events."));
         }
+        nextEventId_ = RestoreEvents(reader,
+            [this] (const TimePoint& t, event_id_t id, Ptr<IEventSink<>>&& sink) {
+                nextEventId_ = id;
+                Insert(t, std::move(sink));
+            });
     }
 
+    /*}}}*/
+
+    // EventHandleOwner /*{{{*/
 private:
-    bool IsOrdered(void) const BOOST_NOEXCEPT
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT NSFX_OVERRIDE
     {
-        bool ordered = true;
-        TimePoint t0;
-        for (auto it = list_.cbegin(); it != list_.cend() && ordered; ++it)
+        for (auto it = list_.begin(); it != list_.end(); ++it)
         {
-            ordered = (t0 <= (*it)->GetTimePoint());
-            t0 = (*it)->GetTimePoint();
+            if (it->Get() == handle)
+            {
+                list_.erase(it);
+                break;
+            }
         }
-        return ordered;
     }
 
     /*}}}*/
@@ -186,6 +314,8 @@ private:
     NSFX_INTERFACE_MAP_BEGIN(ThisClass)
         NSFX_INTERFACE_ENTRY(IClockUser)
         NSFX_INTERFACE_ENTRY(IScheduler)
+        NSFX_INTERFACE_ENTRY(ICallableScheduler)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
     NSFX_INTERFACE_MAP_END()
 
 private:
@@ -0,0 +1,1383 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef OPTIMISTIC_SIMULATOR_H__4A4E3D39_5C8F_4E0B_9B8A_2D7C61E0F513
+#define OPTIMISTIC_SIMULATOR_H__4A4E3D39_5C8F_4E0B_9B8A_2D7C61E0F513
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-optimistic-simulator.h>
+#include <nsfx/simulation/i-simulator.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-event-handle.h>
+#include <nsfx/simulation/i-state-saver.h>
+#include <nsfx/simulation/exception.h>
+#include <nsfx/simulation/thread-barrier.h>
+#include <nsfx/event/event.h>
+#include <nsfx/component/class-registry.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// OptimisticSimulator.
+/**
+ * @ingroup Simulator
+ * @brief An optimistic (Time Warp) parallel simulator.
+ *
+ * The simulator runs a set of partitions (logical processes) in parallel.
+ * Each partition has its own scheduler and clock, which are provided by the
+ * simulator.
+ *
+ * # Speculative execution
+ * A thread fires the earliest pending event among its partitions, without
+ * waiting for the other threads.
+ * The fired events are kept by the partition, along with the events they
+ * scheduled, cancelled and sent to the other partitions.
+ * Before an event is fired, the registered `IStateSaver`s of the partition
+ * save their states.
+ *
+ * # Rollback
+ * The events in a partition are ordered by their time points, the source
+ * partitions and the order they are scheduled by the source partitions.
+ * When a partition receives a remote event that precedes a fired event
+ * (a straggler), the fired events after the straggler are rolled back in
+ * the reverse order they are fired:
+ * the events they scheduled are removed, the events they cancelled are
+ * restored, and an *anti-message* is sent for each remote event they sent.
+ * Finally, the state savers restore the state before the earliest
+ * rolled back event.
+ *
+ * The events are not always fired in the order above, since an event
+ * scheduled at the current time may precede the event that schedules it.
+ * Thus, once a fired event is rolled back, the events fired after it are also
+ * rolled back, even if they precede the straggler.
+ *
+ * An anti-message annihilates its remote event.
+ * If the remote event has been fired, the destination partition is rolled
+ * back first.
+ *
+ * Thus, the result of a simulation is the same as firing the events in the
+ * order above sequentially, and it does not depend on the number of threads.
+ *
+ * # Fossil collection
+ * After a thread has fired a number of events (see `SetGvtInterval()`), the
+ * threads meet at a barrier, and compute the global virtual time (GVT), i.e.,
+ * the time point of the earliest pending event or undelivered remote event
+ * (or anti-message) in all partitions.
+ * No event before GVT can be rolled back, and such events are committed,
+ * i.e., they are released, and the states saved before them are discarded.
+ *
+ * # Clock
+ * The clock of a partition reports the time point of the event that is being
+ * fired, which may go backward after a rollback.
+ * The clock provided by the simulator reports the simulation time *between*
+ * runs.
+ *
+ * # Pause
+ * `Pause()` can be called by any partition.
+ * The simulator is paused when the GVT is computed next time, and the events
+ * at or after the GVT are rolled back.
+ * Therefore, all fired events are committed when the simulator is paused.
+ * Note that the simulator is paused even if the event that pauses the
+ * simulator is rolled back later.
+ *
+ * # Uid
+ * @code
+ * "edu.uestc.nsfx.OptimisticSimulator"
+ * @endcode
+ *
+ * # Interfaces
+ * * Provides
+ *   + \c IOptimisticSimulator
+ *   + \c IClock
+ *   + \c ISimulator
+ * * Events
+ *   + \c ISimulationBeginEvent
+ *   + \c ISimulationRunEvent
+ *   + \c ISimulationPauseEvent
+ *   + \c ISimulationEndEvent
+ */
+class OptimisticSimulator :
+    public IOptimisticSimulator,
+    public IClock,
+    public ISimulator
+{
+    typedef OptimisticSimulator  ThisClass;
+
+    // Types./*{{{*/
+private:
+    class Partition;
+    class TimeWarpEvent;
+    struct EventLess;
+    typedef Object<TimeWarpEvent>  TimeWarpEventClass;
+
+    /**
+     * @brief The state of an event.
+     */
+    enum EventState
+    {
+        EVENT_PENDING,
+        EVENT_FIRED,
+        // The event is committed, annihilated or removed by a rollback.
+        EVENT_RELEASED
+    };
+
+    /**
+     * @brief The order of an event.
+     *
+     * The events are ordered by their time points, the source partitions,
+     * and the order they are scheduled by the source partitions.
+     */
+    struct EventKey
+    {
+        EventKey(const TimePoint& t, uint32_t src, uint64_t seq) BOOST_NOEXCEPT :
+            t_(t),
+            src_(src),
+            seq_(seq)
+        {}
+
+        bool operator<(const EventKey& rhs) const BOOST_NOEXCEPT
+        {
+            return (t_ < rhs.t_) ||
+                   (t_ == rhs.t_ && (src_ < rhs.src_ ||
+                                     (src_ == rhs.src_ && seq_ < rhs.seq_)));
+        }
+
+        TimePoint  t_;
+        uint32_t   src_;
+        uint64_t   seq_;
+    };
+
+    /**
+     * @brief A remote event sent by an event.
+     */
+    struct SentMessage
+    {
+        SentMessage(Partition* dst, const TimePoint& t, uint64_t id) :
+            dst_(dst),
+            t_(t),
+            id_(id)
+        {}
+
+        Partition* dst_;
+        TimePoint  t_;
+        uint64_t   id_;
+    };
+
+    /**
+     * @brief An event in a partition.
+     */
+    class TimeWarpEvent :
+        public IEventHandle
+    {
+        friend class Partition;
+        friend struct EventLess;
+
+    public:
+        TimeWarpEvent(Partition* partition, const TimePoint& t,
+                      uint32_t src, uint64_t seq,
+                      Ptr<IEventSink<>>&& sink) :
+            partition_(partition),
+            key_(t, src, seq),
+            maxKey_(t, src, seq),
+            id_(0),
+            remote_(false),
+            state_(EVENT_PENDING),
+            cancelled_(false),
+            running_(false),
+            checkpoint_(0),
+            seqBefore_(0),
+            sink_(std::move(sink))
+        {}
+
+        virtual ~TimeWarpEvent(void) {}
+
+        // IEventHandle /*{{{*/
+    public:
+        /**
+         * @brief The id of the event.
+         *
+         * It consists of the index of the source partition, and the order the
+         * event is scheduled by the source partition.
+         */
+        virtual event_id_t GetId(void) NSFX_OVERRIDE
+        {
+            return (static_cast<event_id_t>(key_.src_) << 40) | key_.seq_;
+        }
+
+        virtual bool IsPending(void) NSFX_OVERRIDE
+        {
+            return state_ == EVENT_PENDING && !cancelled_;
+        }
+
+        virtual bool IsRunning(void) NSFX_OVERRIDE
+        {
+            return running_;
+        }
+
+        virtual bool IsValid(void) NSFX_OVERRIDE
+        {
+            return IsPending() || IsRunning();
+        }
+
+        virtual void Cancel(void) NSFX_OVERRIDE
+        {
+            if (state_ == EVENT_PENDING && !cancelled_)
+            {
+                partition_->OnEventCancelled(this);
+            }
+        }
+
+        virtual TimePoint GetTimePoint(void) NSFX_OVERRIDE
+        {
+            return key_.t_;
+        }
+
+        /*}}}*/
+
+    private:
+        NSFX_INTERFACE_MAP_BEGIN(TimeWarpEvent)
+            NSFX_INTERFACE_ENTRY(IEventHandle)
+        NSFX_INTERFACE_MAP_END()
+
+    private:
+        Partition* partition_;
+        EventKey   key_;
+        // The maximum key of the events fired before and including the event.
+        EventKey   maxKey_;
+        // The remote event id.
+        uint64_t   id_;
+        bool  remote_;
+        EventState  state_;
+        bool  cancelled_;
+        bool  running_;
+        // The checkpoint of the states saved before the event is fired.
+        // It is 0 if the event is cancelled.
+        uint64_t  checkpoint_;
+        // The state of the partition before the event is fired.
+        TimePoint  lvt_;
+        uint64_t   seqBefore_;
+        Ptr<IEventSink<>>  sink_;
+        // The side effects of the event.
+        vector<TimeWarpEventClass*>  scheduled_;
+        vector<Ptr<TimeWarpEventClass>>  cancels_;
+        vector<SentMessage>  sent_;
+    };
+
+    /**
+     * @brief The order of the events.
+     */
+    struct EventLess
+    {
+        bool operator()(const TimeWarpEvent* lhs,
+                        const TimeWarpEvent* rhs) const BOOST_NOEXCEPT
+        {
+            return lhs->key_ < rhs->key_;
+        }
+    };
+
+    /**
+     * @brief A remote event or an anti-message.
+     */
+    struct Message
+    {
+        Message(const TimePoint& t, uint32_t src, uint64_t seq, uint64_t id,
+                Ptr<IEventSink<>>&& sink) :
+            t_(t),
+            src_(src),
+            seq_(seq),
+            id_(id),
+            sink_(std::move(sink))
+        {}
+
+        TimePoint  t_;
+        uint32_t   src_;
+        uint64_t   seq_;
+        uint64_t   id_;
+        // An anti-message carries no sink.
+        Ptr<IEventSink<>>  sink_;
+    };
+
+    /**
+     * @brief A partition.
+     *
+     * It provides the scheduler and the clock of the partition.
+     */
+    class Partition :
+        public IScheduler,
+        public IClock
+    {
+        typedef set<TimeWarpEventClass*, EventLess>  PendingSet;
+
+    public:
+        Partition(void) :
+            index_(0),
+            seq_(0),
+            numSent_(0),
+            checkpoint_(0),
+            current_(nullptr),
+            numCommitted_(0),
+            numRolledBack_(0),
+            hasMail_(false)
+        {}
+
+        virtual ~Partition(void)
+        {
+            Clear();
+        }
+
+        // IClock /*{{{*/
+    public:
+        virtual TimePoint Now(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+        {
+            return now_;
+        }
+
+        /*}}}*/
+
+        // IScheduler /*{{{*/
+    public:
+        virtual Ptr<IEventHandle> ScheduleNow(Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+        {
+            return Partition::ScheduleAt(now_, std::move(sink));
+        }
+
+        virtual Ptr<IEventHandle> ScheduleIn(const Duration& dt,
+                                             Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+        {
+            return Partition::ScheduleAt(now_ + dt, std::move(sink));
+        }
+
+        virtual Ptr<IEventHandle> ScheduleAt(const TimePoint& t,
+                                             Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+        {
+            if (!sink)
+            {
+                BOOST_THROW_EXCEPTION(InvalidPointer());
+            }
+            if (t < now_)
+            {
+                BOOST_THROW_EXCEPTION(
+                    InvalidArgument() <<
+                    ErrorMessage("Cannot schedule an event that "
+                                 "happens before the current time.") <<
+                    CurrentTimeErrorInfo(now_) <<
+                    ScheduledTimeErrorInfo(t));
+            }
+            TimeWarpEventClass* event = CreateEvent(t, index_, seq_,
+                                                    std::move(sink));
+            ++seq_;
+            Ptr<IEventHandle> handle(static_cast<IEventHandle*>(event));
+            if (current_)
+            {
+                current_->scheduled_.push_back(event);
+            }
+            pending_.insert(event);
+            return handle;
+        }
+
+        /**
+         * @brief Get the number of pending events.
+         *
+         * It is linear to the number of pending events, since the cancelled
+         * events are kept until they are committed.
+         */
+        virtual uint64_t GetNumEvents(void) NSFX_OVERRIDE
+        {
+            uint64_t n = 0;
+            for (auto it = pending_.cbegin(); it != pending_.cend(); ++it)
+            {
+                if (!(*it)->cancelled_)
+                {
+                    ++n;
+                }
+            }
+            return n;
+        }
+
+        virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+        {
+            IEventHandle* result = nullptr;
+            for (auto it = pending_.cbegin(); it != pending_.cend(); ++it)
+            {
+                if (!(*it)->cancelled_)
+                {
+                    result = *it;
+                    break;
+                }
+            }
+            return result;
+        }
+
+        virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("The events of a partition are fired by "
+                             "the optimistic simulator."));
+        }
+
+        /*}}}*/
+
+        // Remote events. /*{{{*/
+    public:
+        /**
+         * @brief Send a remote event to another partition.
+         */
+        void Send(Partition& dst, const TimePoint& t, Ptr<IEventSink<>>&& sink)
+        {
+            uint64_t id = (static_cast<uint64_t>(index_) << 40) | numSent_;
+            if (current_)
+            {
+                current_->sent_.push_back(SentMessage(&dst, t, id));
+            }
+            dst.Post(Message(t, index_, seq_, id, std::move(sink)));
+            ++seq_;
+            ++numSent_;
+        }
+
+        /**
+         * @brief Post a message to the partition.
+         *
+         * It is called by any thread.
+         */
+        void Post(Message&& message)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inbox_.push_back(std::move(message));
+            hasMail_ = true;
+        }
+
+        /**
+         * @brief Process the received messages.
+         */
+        void Receive(void)
+        {
+            if (!hasMail_)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                mail_.swap(inbox_);
+                hasMail_ = false;
+            }
+            try
+            {
+                for (auto it = mail_.begin(); it != mail_.end(); ++it)
+                {
+                    if (it->sink_)
+                    {
+                        ReceiveEvent(*it);
+                    }
+                    else
+                    {
+                        ReceiveAntiMessage(*it);
+                    }
+                }
+            }
+            catch (...)
+            {
+                mail_.clear();
+                throw;
+            }
+            mail_.clear();
+        }
+
+    private:
+        void ReceiveEvent(Message& message)
+        {
+            TimeWarpEventClass* event =
+                CreateEvent(message.t_, message.src_, message.seq_,
+                            std::move(message.sink_));
+            event->id_ = message.id_;
+            event->remote_ = true;
+            // A straggler.
+            if (fired_.size() && event->key_ < fired_.back()->maxKey_)
+            {
+                Rollback(event->key_, false);
+            }
+            pending_.insert(event);
+            remote_[message.id_] = event;
+        }
+
+        void ReceiveAntiMessage(const Message& message)
+        {
+            auto it = remote_.find(message.id_);
+            BOOST_ASSERT(it != remote_.end());
+            TimeWarpEventClass* event = it->second;
+            remote_.erase(it);
+            if (event->state_ == EVENT_FIRED)
+            {
+                Rollback(event->key_, true);
+            }
+            BOOST_ASSERT(event->state_ == EVENT_PENDING);
+            pending_.erase(event);
+            ReleaseEvent(event);
+        }
+
+        /*}}}*/
+
+        // Speculative execution. /*{{{*/
+    public:
+        /**
+         * @brief Get the time point of the earliest pending event.
+         */
+        bool GetNextTimePoint(TimePoint& t) const BOOST_NOEXCEPT
+        {
+            bool result = false;
+            if (pending_.size())
+            {
+                t = (*pending_.cbegin())->key_.t_;
+                result = true;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Get the time point of the earliest pending event or message.
+         *
+         * It is called at the barrier, when no messages are sent.
+         */
+        bool GetMinTimePoint(TimePoint& t) BOOST_NOEXCEPT
+        {
+            bool result = GetNextTimePoint(t);
+            for (auto it = inbox_.cbegin(); it != inbox_.cend(); ++it)
+            {
+                if (!result || it->t_ < t)
+                {
+                    t = it->t_;
+                    result = true;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Fire the earliest pending event.
+         */
+        void FireNextEvent(void)
+        {
+            BOOST_ASSERT(pending_.size());
+            TimeWarpEventClass* event = *pending_.begin();
+            pending_.erase(pending_.begin());
+            event->state_ = EVENT_FIRED;
+            event->lvt_ = now_;
+            event->seqBefore_ = seq_;
+            event->maxKey_ = event->key_;
+            if (fired_.size() && event->key_ < fired_.back()->maxKey_)
+            {
+                event->maxKey_ = fired_.back()->maxKey_;
+            }
+            fired_.push_back(event);
+            now_ = event->key_.t_;
+            if (event->cancelled_)
+            {
+                event->checkpoint_ = 0;
+            }
+            else
+            {
+                event->checkpoint_ = ++checkpoint_;
+                for (auto it = savers_.begin(); it != savers_.end(); ++it)
+                {
+                    (*it)->SaveState(event->checkpoint_);
+                }
+                current_ = event;
+                event->running_ = true;
+                try
+                {
+                    event->sink_->Fire();
+                }
+                catch (...)
+                {
+                    event->running_ = false;
+                    current_ = nullptr;
+                    throw;
+                }
+                event->running_ = false;
+                current_ = nullptr;
+            }
+        }
+
+        /**
+         * @brief Roll back the fired events at or after a time point.
+         */
+        void RollbackFrom(const TimePoint& t)
+        {
+            Rollback(EventKey(t, 0, 0), true);
+        }
+
+    private:
+        /**
+         * @brief Roll back the fired events after an event.
+         *
+         * The events fired after a rolled back event are also rolled back.
+         *
+         * @param[in] inclusive Whether to roll back the event itself.
+         */
+        void Rollback(const EventKey& key, bool inclusive)
+        {
+            uint64_t checkpoint = 0;
+            while (fired_.size())
+            {
+                TimeWarpEventClass* event = fired_.back();
+                if (inclusive ? event->maxKey_ < key : !(key < event->maxKey_))
+                {
+                    break;
+                }
+                fired_.pop_back();
+                Undo(event);
+                if (event->checkpoint_)
+                {
+                    checkpoint = event->checkpoint_;
+                    ++numRolledBack_;
+                }
+                now_ = event->lvt_;
+                seq_ = event->seqBefore_;
+                event->state_ = EVENT_PENDING;
+                pending_.insert(event);
+            }
+            if (checkpoint)
+            {
+                for (auto it = savers_.begin(); it != savers_.end(); ++it)
+                {
+                    (*it)->RestoreState(checkpoint);
+                }
+            }
+        }
+
+        /**
+         * @brief Undo the side effects of a fired event.
+         */
+        void Undo(TimeWarpEventClass* event)
+        {
+            // The events cancelled by the event are restored.
+            // They have not been fired, since they are pending when they are
+            // cancelled, and the events fired after this event have been
+            // rolled back.
+            for (auto it = event->cancels_.rbegin();
+                 it != event->cancels_.rend(); ++it)
+            {
+                if ((*it)->state_ == EVENT_PENDING)
+                {
+                    (*it)->cancelled_ = false;
+                }
+            }
+            event->cancels_.clear();
+            // The events scheduled by the event are removed.
+            for (auto it = event->scheduled_.rbegin();
+                 it != event->scheduled_.rend(); ++it)
+            {
+                BOOST_ASSERT((*it)->state_ == EVENT_PENDING);
+                pending_.erase(*it);
+                ReleaseEvent(*it);
+            }
+            event->scheduled_.clear();
+            // The remote events sent by the event are annihilated.
+            for (auto it = event->sent_.begin(); it != event->sent_.end(); ++it)
+            {
+                it->dst_->Post(Message(it->t_, index_, 0, it->id_, nullptr));
+            }
+            event->sent_.clear();
+        }
+
+        /*}}}*/
+
+        // Fossil collection. /*{{{*/
+    public:
+        /**
+         * @brief Commit the fired events before a time point.
+         */
+        void Commit(const TimePoint& gvt)
+        {
+            while (fired_.size() && fired_.front()->key_.t_ < gvt)
+            {
+                TimeWarpEventClass* event = fired_.front();
+                fired_.pop_front();
+                if (event->checkpoint_)
+                {
+                    ++numCommitted_;
+                }
+                event->scheduled_.clear();
+                event->cancels_.clear();
+                event->sent_.clear();
+                if (event->remote_)
+                {
+                    remote_.erase(event->id_);
+                }
+                ReleaseEvent(event);
+            }
+            uint64_t checkpoint = checkpoint_ + 1;
+            for (auto it = fired_.cbegin(); it != fired_.cend(); ++it)
+            {
+                if ((*it)->checkpoint_)
+                {
+                    checkpoint = (*it)->checkpoint_;
+                    break;
+                }
+            }
+            for (auto it = savers_.begin(); it != savers_.end(); ++it)
+            {
+                (*it)->CommitState(checkpoint);
+            }
+        }
+
+        /*}}}*/
+
+        // Helpers. /*{{{*/
+    public:
+        void OnEventCancelled(TimeWarpEvent* e)
+        {
+            TimeWarpEventClass* event = static_cast<TimeWarpEventClass*>(e);
+            if (current_)
+            {
+                current_->cancels_.push_back(event);
+            }
+            event->cancelled_ = true;
+        }
+
+        void SetIndex(uint32_t index) BOOST_NOEXCEPT
+        {
+            index_ = index;
+        }
+
+        void SetNow(const TimePoint& t) BOOST_NOEXCEPT
+        {
+            now_ = t;
+        }
+
+        void AddStateSaver(Ptr<IStateSaver> saver)
+        {
+            savers_.push_back(std::move(saver));
+        }
+
+        uint64_t GetNumMessages(void) const BOOST_NOEXCEPT
+        {
+            return inbox_.size();
+        }
+
+        uint64_t GetNumCommittedEvents(void) const BOOST_NOEXCEPT
+        {
+            return numCommitted_;
+        }
+
+        uint64_t GetNumRolledBackEvents(void) const BOOST_NOEXCEPT
+        {
+            return numRolledBack_;
+        }
+
+        /**
+         * @brief Release the events and the state savers.
+         */
+        void Clear(void)
+        {
+            for (auto it = fired_.begin(); it != fired_.end(); ++it)
+            {
+                (*it)->scheduled_.clear();
+                (*it)->cancels_.clear();
+                (*it)->sent_.clear();
+                ReleaseEvent(*it);
+            }
+            fired_.clear();
+            for (auto it = pending_.begin(); it != pending_.end(); ++it)
+            {
+                ReleaseEvent(*it);
+            }
+            pending_.clear();
+            remote_.clear();
+            inbox_.clear();
+            savers_.clear();
+        }
+
+    private:
+        TimeWarpEventClass* CreateEvent(const TimePoint& t, uint32_t src,
+                                        uint64_t seq,
+                                        Ptr<IEventSink<>>&& sink)
+        {
+            TimeWarpEventClass* event =
+                new TimeWarpEventClass(this, t, src, seq, std::move(sink));
+            event->AddRef();
+            return event;
+        }
+
+        static void ReleaseEvent(TimeWarpEventClass* event)
+        {
+            event->state_ = EVENT_RELEASED;
+            event->sink_ = nullptr;
+            event->Release();
+        }
+
+        /*}}}*/
+
+    private:
+        NSFX_INTERFACE_MAP_BEGIN(Partition)
+            NSFX_INTERFACE_ENTRY(IScheduler)
+            NSFX_INTERFACE_ENTRY(IClock)
+        NSFX_INTERFACE_MAP_END()
+
+    private:
+        uint32_t   index_;
+        TimePoint  now_;
+        // The number of events scheduled by the partition.
+        uint64_t   seq_;
+        // The number of remote events sent by the partition.
+        uint64_t   numSent_;
+        uint64_t   checkpoint_;
+        // The event that is being fired.
+        TimeWarpEventClass* current_;
+        PendingSet  pending_;
+        deque<TimeWarpEventClass*>  fired_;
+        // The remote events that are pending or fired.
+        unordered_map<uint64_t, TimeWarpEventClass*>  remote_;
+        vector<Ptr<IStateSaver>>  savers_;
+        uint64_t  numCommitted_;
+        uint64_t  numRolledBack_;
+        // The messages sent to the partition.
+        std::mutex  mutex_;
+        vector<Message>  inbox_;
+        vector<Message>  mail_;
+        std::atomic<bool>  hasMail_;
+    };
+
+    typedef Object<Partition>  PartitionClass;
+
+    /**
+     * @brief The state of a thread that is exchanged at the barrier.
+     */
+    struct Slot
+    {
+        Slot(void) : hasNext_(false), paused_(false), failed_(false) {}
+
+        TimePoint  next_;
+        bool  hasNext_;
+        bool  paused_;
+        bool  failed_;
+        std::exception_ptr  error_;
+    };
+
+    /*}}}*/
+
+public:
+    OptimisticSimulator(void) :
+        numThreads_(std::thread::hardware_concurrency()),
+        gvtInterval_(256),
+        started_(false),
+        running_(false),
+        paused_(false),
+        failed_(false),
+        beginEvent_(this),
+        runEvent_(this),
+        pauseEvent_(this),
+        endEvent_(this)
+    {
+        if (!numThreads_)
+        {
+            numThreads_ = 1;
+        }
+    }
+
+    virtual ~OptimisticSimulator(void)
+    {
+        // Break the reference cycles between the partitions and the
+        // components.
+        for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+        {
+            (*it)->Clear();
+        }
+    }
+
+    // IOptimisticSimulator /*{{{*/
+public:
+    virtual uint32_t AddPartition(void) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        Ptr<PartitionClass> p(new PartitionClass);
+        p->SetIndex(static_cast<uint32_t>(partitions_.size()));
+        p->SetNow(now_);
+        partitions_.push_back(p);
+        return static_cast<uint32_t>(partitions_.size() - 1);
+    }
+
+    virtual uint32_t GetNumPartitions(void) NSFX_OVERRIDE
+    {
+        return static_cast<uint32_t>(partitions_.size());
+    }
+
+    virtual Ptr<IClock> GetClock(uint32_t partition) NSFX_OVERRIDE
+    {
+        return Ptr<IClock>(static_cast<IClock*>(&GetPartition(partition)));
+    }
+
+    virtual Ptr<IScheduler> GetScheduler(uint32_t partition) NSFX_OVERRIDE
+    {
+        return Ptr<IScheduler>(static_cast<IScheduler*>(&GetPartition(partition)));
+    }
+
+    virtual void AddStateSaver(uint32_t partition,
+                               Ptr<IStateSaver> saver) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        Partition& p = GetPartition(partition);
+        if (!saver)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        p.AddStateSaver(std::move(saver));
+    }
+
+    virtual void SetNumThreads(uint32_t numThreads) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        if (!numThreads)
+        {
+            numThreads = std::thread::hardware_concurrency();
+        }
+        numThreads_ = numThreads ? numThreads : 1;
+    }
+
+    virtual void SetGvtInterval(uint32_t numEvents) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        if (!numEvents)
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The GVT interval must be positive."));
+        }
+        gvtInterval_ = numEvents;
+    }
+
+    virtual void ScheduleRemote(uint32_t src, uint32_t dst,
+                                const Duration& delay,
+                                Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        Partition& s = GetPartition(src);
+        Partition& d = GetPartition(dst);
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        if (delay < Duration::Zero())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The delay must not be negative."));
+        }
+        if (src == dst)
+        {
+            s.ScheduleIn(delay, std::move(sink));
+        }
+        else
+        {
+            s.Send(d, s.Now() + delay, std::move(sink));
+        }
+    }
+
+    virtual uint64_t GetNumCommittedEvents(void) NSFX_OVERRIDE
+    {
+        uint64_t n = 0;
+        for (auto it = partitions_.cbegin(); it != partitions_.cend(); ++it)
+        {
+            n += (*it)->GetNumCommittedEvents();
+        }
+        return n;
+    }
+
+    virtual uint64_t GetNumRolledBackEvents(void) NSFX_OVERRIDE
+    {
+        uint64_t n = 0;
+        for (auto it = partitions_.cbegin(); it != partitions_.cend(); ++it)
+        {
+            n += (*it)->GetNumRolledBackEvents();
+        }
+        return n;
+    }
+
+    /*}}}*/
+
+    // IClock /*{{{*/
+public:
+    virtual TimePoint Now(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        return now_;
+    }
+
+    /*}}}*/
+
+    // ISimulator /*{{{*/
+public:
+    virtual void Run(void) NSFX_OVERRIDE
+    {
+        Execute(TimePoint::Max(), false);
+    }
+
+    virtual void RunUntil(const TimePoint& t) NSFX_OVERRIDE
+    {
+        Execute(t, true);
+    }
+
+    virtual void RunFor(const Duration& dt) NSFX_OVERRIDE
+    {
+        RunUntil(now_ + dt);
+    }
+
+    virtual void Pause(void) NSFX_OVERRIDE
+    {
+        paused_ = true;
+    }
+
+    /*}}}*/
+
+    // Execution./*{{{*/
+private:
+    void Execute(const TimePoint& until, bool advance)
+    {
+        CheckNotRunning();
+        if (!GetNumEvents())
+        {
+            BOOST_THROW_EXCEPTION(NoScheduledEvent());
+        }
+        if (!started_)
+        {
+            started_ = true;
+            FireSimulationBeginEvent();
+        }
+        paused_ = false;
+        failed_ = false;
+        FireSimulationRunEvent();
+        running_ = true;
+        size_t numThreads = (std::min)(static_cast<size_t>(numThreads_),
+                                       partitions_.size());
+        slots_.assign(numThreads, Slot());
+        ThreadBarrier barrier(numThreads);
+        vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+        try
+        {
+            for (size_t k = 1; k < numThreads; ++k)
+            {
+                threads.push_back(std::thread(&ThisClass::Work, this,
+                                              k, numThreads, until,
+                                              std::ref(barrier)));
+            }
+        }
+        catch (...)
+        {
+            // Stop the threads that have been created.
+            slots_[0].error_ = std::current_exception();
+            failed_ = true;
+            barrier.Leave(numThreads - 1 - threads.size());
+        }
+        Work(0, numThreads, until, barrier);
+        for (auto it = threads.begin(); it != threads.end(); ++it)
+        {
+            it->join();
+        }
+        running_ = false;
+        // Update the clocks.
+        bool paused = paused_;
+        if (advance && !paused && !failed_)
+        {
+            now_ = until;
+            for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+            {
+                (*it)->SetNow(until);
+            }
+        }
+        else
+        {
+            for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+            {
+                TimePoint t = (*it)->Now();
+                if (now_ < t)
+                {
+                    now_ = t;
+                }
+            }
+        }
+        paused_ = true;
+        for (auto it = slots_.begin(); it != slots_.end(); ++it)
+        {
+            if (it->error_)
+            {
+                std::rethrow_exception(it->error_);
+            }
+        }
+        FireSimulationPauseEvent();
+        if (!GetNumEvents())
+        {
+            FireSimulationEndEvent();
+        }
+    }
+
+    /**
+     * @brief The main loop of a thread.
+     *
+     * @param[in] k The index of the thread.
+     * @param[in] n The number of threads.
+     *
+     * The k-th thread runs the partitions `k`, `k + n`, `k + 2n`, etc.
+     */
+    void Work(size_t k, size_t n, TimePoint until, ThreadBarrier& barrier)
+    {
+        Slot& slot = slots_[k];
+        while (true)
+        {
+            // Fire the events speculatively.
+            if (!failed_)
+            {
+                try
+                {
+                    FireEvents(k, n, until);
+                }
+                catch (...)
+                {
+                    slot.error_ = std::current_exception();
+                    failed_ = true;
+                }
+            }
+            barrier.Wait();
+            // Find the earliest pending event or message.
+            // No messages are sent by any thread at this stage.
+            slot.hasNext_ = false;
+            slot.paused_ = paused_;
+            slot.failed_ = failed_;
+            for (size_t i = k; i < partitions_.size(); i += n)
+            {
+                TimePoint t;
+                if (partitions_[i]->GetMinTimePoint(t) &&
+                    (!slot.hasNext_ || t < slot.next_))
+                {
+                    slot.next_ = t;
+                    slot.hasNext_ = true;
+                }
+            }
+            barrier.Wait();
+            // Every thread makes the same decision from the slots.
+            bool paused = false;
+            bool failed = false;
+            bool hasNext = false;
+            TimePoint gvt;
+            for (auto it = slots_.cbegin(); it != slots_.cend(); ++it)
+            {
+                paused = paused || it->paused_;
+                failed = failed || it->failed_;
+                if (it->hasNext_ && (!hasNext || it->next_ < gvt))
+                {
+                    gvt = it->next_;
+                    hasNext = true;
+                }
+            }
+            if (failed)
+            {
+                break;
+            }
+            if (paused || !hasNext || until < gvt)
+            {
+                // Roll back the speculative events, and commit the others.
+                try
+                {
+                    if (hasNext)
+                    {
+                        for (size_t i = k; i < partitions_.size(); i += n)
+                        {
+                            partitions_[i]->RollbackFrom(gvt);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    slot.error_ = std::current_exception();
+                    failed_ = true;
+                }
+                barrier.Wait();
+                if (!failed_)
+                {
+                    try
+                    {
+                        for (size_t i = k; i < partitions_.size(); i += n)
+                        {
+                            partitions_[i]->Receive();
+                            partitions_[i]->Commit(TimePoint::Max());
+                        }
+                    }
+                    catch (...)
+                    {
+                        slot.error_ = std::current_exception();
+                        failed_ = true;
+                    }
+                }
+                break;
+            }
+            // Fossil collection.
+            try
+            {
+                for (size_t i = k; i < partitions_.size(); i += n)
+                {
+                    partitions_[i]->Commit(gvt);
+                }
+            }
+            catch (...)
+            {
+                slot.error_ = std::current_exception();
+                failed_ = true;
+            }
+        }
+    }
+
+    /**
+     * @brief Fire the events of the partitions run by a thread.
+     *
+     * The thread repeatedly fires the earliest pending event among its
+     * partitions, which reduces the number of rollbacks between them.
+     */
+    void FireEvents(size_t k, size_t n, const TimePoint& until)
+    {
+        for (uint32_t count = 0; count < gvtInterval_ && !failed_; ++count)
+        {
+            Partition* next = nullptr;
+            TimePoint t0;
+            for (size_t i = k; i < partitions_.size(); i += n)
+            {
+                Partition* p = partitions_[i].Get();
+                p->Receive();
+                TimePoint t;
+                if (p->GetNextTimePoint(t) && t <= until &&
+                    (!next || t < t0))
+                {
+                    next = p;
+                    t0 = t;
+                }
+            }
+            if (!next)
+            {
+                break;
+            }
+            next->FireNextEvent();
+        }
+    }
+
+    /*}}}*/
+
+    // Helpers./*{{{*/
+private:
+    void CheckNotRunning(void)
+    {
+        if (running_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot call the method when "
+                             "the simulator is running."));
+        }
+    }
+
+    Partition& GetPartition(uint32_t partition)
+    {
+        if (partition >= partitions_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                OutOfBounds() <<
+                ErrorMessage("The partition does not exist.") <<
+                PartitionIndexErrorInfo(partition));
+        }
+        return *partitions_[partition];
+    }
+
+    /**
+     * @brief Get the number of pending events and messages.
+     */
+    uint64_t GetNumEvents(void)
+    {
+        uint64_t n = 0;
+        for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+        {
+            n += (*it)->GetNumEvents() + (*it)->GetNumMessages();
+        }
+        return n;
+    }
+
+    /*}}}*/
+
+    // Events./*{{{*/
+private:
+    void FireSimulationBeginEvent(void)
+    {
+        beginEvent_.GetImpl()->Fire();
+    }
+
+    void FireSimulationRunEvent(void)
+    {
+        runEvent_.GetImpl()->Fire();
+    }
+
+    void FireSimulationPauseEvent(void)
+    {
+        pauseEvent_.GetImpl()->Fire();
+    }
+
+    void FireSimulationEndEvent(void)
+    {
+        endEvent_.GetImpl()->Fire();
+    }
+
+    /*}}}*/
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IOptimisticSimulator)
+        NSFX_INTERFACE_ENTRY(IClock)
+        NSFX_INTERFACE_ENTRY(ISimulator)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationBeginEvent, &beginEvent_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationRunEvent,   &runEvent_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationPauseEvent, &pauseEvent_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationEndEvent,   &endEvent_)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    TimePoint  now_;
+    vector<Ptr<PartitionClass>>  partitions_;
+    uint32_t  numThreads_;
+    uint32_t  gvtInterval_;
+    bool  started_;
+    bool  running_;
+    std::atomic<bool>  paused_;
+    std::atomic<bool>  failed_;
+    vector<Slot>  slots_;
+
+    MemberAggObject<Event<ISimulationBeginEvent>>  beginEvent_;
+    MemberAggObject<Event<ISimulationRunEvent>>    runEvent_;
+    MemberAggObject<Event<ISimulationPauseEvent>>  pauseEvent_;
+    MemberAggObject<Event<ISimulationEndEvent>>    endEvent_;
+
+}; // class OptimisticSimulator
+
+
+NSFX_REGISTER_CLASS(OptimisticSimulator, "edu.uestc.nsfx.OptimisticSimulator");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // OPTIMISTIC_SIMULATOR_H__4A4E3D39_5C8F_4E0B_9B8A_2D7C61E0F513
+
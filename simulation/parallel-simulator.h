@@ -0,0 +1,701 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef PARALLEL_SIMULATOR_H__1005ABFE_FCB7_4895_8528_2CA3A0D1BE23
+#define PARALLEL_SIMULATOR_H__1005ABFE_FCB7_4895_8528_2CA3A0D1BE23
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-parallel-simulator.h>
+#include <nsfx/simulation/i-simulator.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-batch-scheduler.h>
+#include <nsfx/simulation/exception.h>
+#include <nsfx/simulation/thread-barrier.h>
+#include <nsfx/event/event.h>
+#include <nsfx/component/class-registry.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ParallelSimulator.
+/**
+ * @ingroup Simulator
+ * @brief A conservative parallel simulator.
+ *
+ * The simulator runs a set of partitions (logical processes) in parallel.
+ * Each partition has its own scheduler and clock.
+ *
+ * # Synchronization
+ * The simulator advances the partitions in synchronization windows
+ * (barrier windows, as in YAWNS).
+ * Let `T` be the time point of the earliest pending event in all partitions,
+ * and `L` be the *lookahead*, i.e., the minimum link delay declared via
+ * `SetLinkDelay()`.
+ * A remote event that is scheduled by an event within `[T, T + L)` happens
+ * at or after `T + L`.
+ * Therefore, the partitions can fire their events within `[T, T + L)`
+ * independently.
+ *
+ * At the end of each window, the threads meet at a barrier, and the remote
+ * events are delivered to the schedulers of the destination partitions.
+ * The remote events are delivered in the order of their time points, source
+ * partitions, and the order they are sent.
+ * Thus, the result of a simulation does not depend on the number of threads.
+ *
+ * If no links are declared, the partitions are independent, and they run
+ * in a single window.
+ *
+ * # Clock
+ * The clock provided by the parallel simulator reports the simulation time
+ * *between* runs.
+ * The components in a partition **must** use the clock of the partition,
+ * which is obtained via `GetClock()`.
+ *
+ * # Pause
+ * `Pause()` can be called by any partition.
+ * The simulator is paused at the end of the current window.
+ *
+ * # Uid
+ * @code
+ * "edu.uestc.nsfx.ParallelSimulator"
+ * @endcode
+ *
+ * # Interfaces
+ * * Provides
+ *   + \c IParallelSimulator
+ *   + \c IClock
+ *   + \c ISimulator
+ * * Events
+ *   + \c ISimulationBeginEvent
+ *   + \c ISimulationRunEvent
+ *   + \c ISimulationPauseEvent
+ *   + \c ISimulationEndEvent
+ */
+class ParallelSimulator :
+    public IParallelSimulator,
+    public IClock,
+    public ISimulator
+{
+    typedef ParallelSimulator  ThisClass;
+
+    // Types./*{{{*/
+private:
+    /**
+     * @brief The clock of a partition.
+     */
+    class PartitionClock :
+        public IClock
+    {
+    public:
+        PartitionClock(void) BOOST_NOEXCEPT {}
+        virtual ~PartitionClock(void) {}
+
+        virtual TimePoint Now(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+        {
+            return now_;
+        }
+
+        void SetNow(const TimePoint& t) BOOST_NOEXCEPT
+        {
+            now_ = t;
+        }
+
+    private:
+        NSFX_INTERFACE_MAP_BEGIN(PartitionClock)
+            NSFX_INTERFACE_ENTRY(IClock)
+        NSFX_INTERFACE_MAP_END()
+
+    private:
+        TimePoint  now_;
+    };
+
+    typedef Object<PartitionClock>  PartitionClockClass;
+
+    /**
+     * @brief A remote event.
+     */
+    struct Message
+    {
+        Message(const TimePoint& t, uint32_t src, uint64_t seq,
+                Ptr<IEventSink<>>&& sink) :
+            t_(t),
+            src_(src),
+            seq_(seq),
+            sink_(std::move(sink))
+        {}
+
+        bool operator<(const Message& rhs) const BOOST_NOEXCEPT
+        {
+            return (t_ < rhs.t_) ||
+                   (t_ == rhs.t_ && (src_ < rhs.src_ ||
+                                     (src_ == rhs.src_ && seq_ < rhs.seq_)));
+        }
+
+        TimePoint  t_;
+        uint32_t   src_;
+        uint64_t   seq_;
+        Ptr<IEventSink<>>  sink_;
+    };
+
+    /**
+     * @brief A partition.
+     */
+    struct Partition
+    {
+        Partition(void) : numSent_(0) {}
+
+        Ptr<PartitionClockClass>  clock_;
+        Ptr<IScheduler>       scheduler_;
+        Ptr<IBatchScheduler>  batchScheduler_;
+        // The number of remote events sent by the partition.
+        uint64_t  numSent_;
+        // The remote events sent to the partition.
+        std::mutex  mutex_;
+        vector<Message>  inbox_;
+    };
+
+    /**
+     * @brief The state of a thread that is exchanged at the barrier.
+     */
+    struct Slot
+    {
+        Slot(void) : hasNext_(false), stop_(false) {}
+
+        TimePoint  next_;
+        bool  hasNext_;
+        bool  stop_;
+        std::exception_ptr  error_;
+    };
+
+    /*}}}*/
+
+public:
+    ParallelSimulator(void) :
+        numThreads_(std::thread::hardware_concurrency()),
+        lookahead_(Duration::Max()),
+        started_(false),
+        running_(false),
+        paused_(false),
+        failed_(false),
+        beginEvent_(this),
+        runEvent_(this),
+        pauseEvent_(this),
+        endEvent_(this)
+    {
+        if (!numThreads_)
+        {
+            numThreads_ = 1;
+        }
+    }
+
+    virtual ~ParallelSimulator(void) {}
+
+    // IParallelSimulator /*{{{*/
+public:
+    virtual uint32_t AddPartition(Ptr<IScheduler> scheduler) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        if (!scheduler)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        std::unique_ptr<Partition> p(new Partition);
+        p->clock_ = new PartitionClockClass;
+        p->clock_->SetNow(now_);
+        Ptr<IClockUser>(scheduler)->Use(Ptr<IClock>(p->clock_));
+        p->scheduler_ = scheduler;
+        try
+        {
+            p->batchScheduler_ = scheduler;
+        }
+        catch (NoInterface& )
+        {
+            // The scheduler does not support batch firing.
+        }
+        partitions_.push_back(std::move(p));
+        return static_cast<uint32_t>(partitions_.size() - 1);
+    }
+
+    virtual uint32_t GetNumPartitions(void) NSFX_OVERRIDE
+    {
+        return static_cast<uint32_t>(partitions_.size());
+    }
+
+    virtual Ptr<IClock> GetClock(uint32_t partition) NSFX_OVERRIDE
+    {
+        return Ptr<IClock>(GetPartition(partition).clock_);
+    }
+
+    virtual Ptr<IScheduler> GetScheduler(uint32_t partition) NSFX_OVERRIDE
+    {
+        return GetPartition(partition).scheduler_;
+    }
+
+    virtual void SetLinkDelay(uint32_t src, uint32_t dst,
+                              const Duration& delay) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        GetPartition(src);
+        GetPartition(dst);
+        if (delay <= Duration::Zero())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The link delay must be positive."));
+        }
+        links_[GetLinkKey(src, dst)] = delay;
+        lookahead_ = Duration::Max();
+        for (auto it = links_.cbegin(); it != links_.cend(); ++it)
+        {
+            if (it->second < lookahead_)
+            {
+                lookahead_ = it->second;
+            }
+        }
+    }
+
+    virtual void SetNumThreads(uint32_t numThreads) NSFX_OVERRIDE
+    {
+        CheckNotRunning();
+        if (!numThreads)
+        {
+            numThreads = std::thread::hardware_concurrency();
+        }
+        numThreads_ = numThreads ? numThreads : 1;
+    }
+
+    virtual void ScheduleRemote(uint32_t src, uint32_t dst,
+                                const Duration& delay,
+                                Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        Partition& s = GetPartition(src);
+        Partition& d = GetPartition(dst);
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        if (src == dst)
+        {
+            s.scheduler_->ScheduleIn(delay, std::move(sink));
+        }
+        else
+        {
+            auto it = links_.find(GetLinkKey(src, dst));
+            if (it == links_.end())
+            {
+                BOOST_THROW_EXCEPTION(
+                    InvalidArgument() <<
+                    ErrorMessage("There is no link between the partitions."));
+            }
+            if (delay < it->second)
+            {
+                BOOST_THROW_EXCEPTION(
+                    InvalidArgument() <<
+                    ErrorMessage("The delay is less than the link delay."));
+            }
+            TimePoint t = s.clock_->Now() + delay;
+            std::lock_guard<std::mutex> lock(d.mutex_);
+            d.inbox_.push_back(Message(t, src, s.numSent_, std::move(sink)));
+            ++s.numSent_;
+        }
+    }
+
+    /*}}}*/
+
+    // IClock /*{{{*/
+public:
+    virtual TimePoint Now(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        return now_;
+    }
+
+    /*}}}*/
+
+    // ISimulator /*{{{*/
+public:
+    virtual void Run(void) NSFX_OVERRIDE
+    {
+        Execute(TimePoint::Max(), false);
+    }
+
+    virtual void RunUntil(const TimePoint& t) NSFX_OVERRIDE
+    {
+        Execute(t, true);
+    }
+
+    virtual void RunFor(const Duration& dt) NSFX_OVERRIDE
+    {
+        RunUntil(now_ + dt);
+    }
+
+    virtual void Pause(void) NSFX_OVERRIDE
+    {
+        paused_ = true;
+    }
+
+    /*}}}*/
+
+    // Execution./*{{{*/
+private:
+    void Execute(const TimePoint& until, bool advance)
+    {
+        CheckNotRunning();
+        if (!GetNumEvents())
+        {
+            BOOST_THROW_EXCEPTION(NoScheduledEvent());
+        }
+        if (!started_)
+        {
+            started_ = true;
+            FireSimulationBeginEvent();
+        }
+        paused_ = false;
+        failed_ = false;
+        FireSimulationRunEvent();
+        running_ = true;
+        // Run the windows.
+        size_t numThreads = (std::min)(static_cast<size_t>(numThreads_),
+                                       partitions_.size());
+        slots_.assign(numThreads, Slot());
+        ThreadBarrier barrier(numThreads);
+        vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+        try
+        {
+            for (size_t k = 1; k < numThreads; ++k)
+            {
+                threads.push_back(std::thread(&ThisClass::Work, this,
+                                              k, numThreads, until,
+                                              std::ref(barrier)));
+            }
+        }
+        catch (...)
+        {
+            // Stop the threads that have been created.
+            slots_[0].error_ = std::current_exception();
+            failed_ = true;
+            barrier.Leave(numThreads - 1 - threads.size());
+        }
+        Work(0, numThreads, until, barrier);
+        for (auto it = threads.begin(); it != threads.end(); ++it)
+        {
+            it->join();
+        }
+        running_ = false;
+        // Update the clocks.
+        bool paused = paused_;
+        if (advance && !paused && !failed_)
+        {
+            now_ = until;
+            for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+            {
+                (*it)->clock_->SetNow(until);
+            }
+        }
+        else
+        {
+            for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+            {
+                TimePoint t = (*it)->clock_->Now();
+                if (now_ < t)
+                {
+                    now_ = t;
+                }
+            }
+        }
+        paused_ = true;
+        for (auto it = slots_.begin(); it != slots_.end(); ++it)
+        {
+            if (it->error_)
+            {
+                std::rethrow_exception(it->error_);
+            }
+        }
+        FireSimulationPauseEvent();
+        if (!GetNumEvents())
+        {
+            FireSimulationEndEvent();
+        }
+    }
+
+    /**
+     * @brief The main loop of a thread.
+     *
+     * @param[in] k The index of the thread.
+     * @param[in] n The number of threads.
+     *
+     * The k-th thread runs the partitions `k`, `k + n`, `k + 2n`, etc.
+     */
+    void Work(size_t k, size_t n, TimePoint until, ThreadBarrier& barrier)
+    {
+        Slot& slot = slots_[k];
+        while (true)
+        {
+            // Deliver the remote events, and find the earliest event.
+            // No events are fired by any thread at this stage.
+            slot.hasNext_ = false;
+            slot.stop_ = paused_ || failed_;
+            if (!slot.stop_)
+            {
+                try
+                {
+                    for (size_t i = k; i < partitions_.size(); i += n)
+                    {
+                        Partition& p = *partitions_[i];
+                        Deliver(p);
+                        TimePoint t;
+                        if (GetNextTimePoint(p, t) &&
+                            (!slot.hasNext_ || t < slot.next_))
+                        {
+                            slot.next_ = t;
+                            slot.hasNext_ = true;
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    slot.error_ = std::current_exception();
+                    slot.stop_ = true;
+                    failed_ = true;
+                }
+            }
+            barrier.Wait();
+            // Every thread makes the same decision from the slots.
+            bool stop = false;
+            bool hasNext = false;
+            TimePoint t0;
+            for (auto it = slots_.cbegin(); it != slots_.cend(); ++it)
+            {
+                stop = stop || it->stop_;
+                if (it->hasNext_ && (!hasNext || it->next_ < t0))
+                {
+                    t0 = it->next_;
+                    hasNext = true;
+                }
+            }
+            if (stop || !hasNext || until < t0)
+            {
+                break;
+            }
+            // Fire the events within [t0, t0 + lookahead).
+            TimePoint limit = until;
+            if (lookahead_ <= TimePoint::Max() - t0)
+            {
+                TimePoint end = t0 + (lookahead_ - Duration(1));
+                if (end < limit)
+                {
+                    limit = end;
+                }
+            }
+            try
+            {
+                for (size_t i = k; i < partitions_.size(); i += n)
+                {
+                    Fire(*partitions_[i], limit);
+                }
+            }
+            catch (...)
+            {
+                slot.error_ = std::current_exception();
+                failed_ = true;
+            }
+            barrier.Wait();
+        }
+    }
+
+    /**
+     * @brief Schedule the remote events sent to a partition.
+     */
+    void Deliver(Partition& p)
+    {
+        if (p.inbox_.size())
+        {
+            std::sort(p.inbox_.begin(), p.inbox_.end());
+            for (auto it = p.inbox_.begin(); it != p.inbox_.end(); ++it)
+            {
+                p.scheduler_->ScheduleAt(it->t_, std::move(it->sink_));
+            }
+            p.inbox_.clear();
+        }
+    }
+
+    static bool GetNextTimePoint(Partition& p, TimePoint& t)
+    {
+        bool result = false;
+        if (p.batchScheduler_)
+        {
+            if (p.scheduler_->GetNumEvents())
+            {
+                t = p.batchScheduler_->GetNextTimePoint();
+                result = true;
+            }
+        }
+        else
+        {
+            Ptr<IEventHandle> handle = p.scheduler_->GetNextEvent();
+            if (handle)
+            {
+                t = handle->GetTimePoint();
+                result = true;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Fire the events in a partition up to a time point (inclusive).
+     */
+    static void Fire(Partition& p, const TimePoint& limit)
+    {
+        TimePoint t;
+        if (p.batchScheduler_)
+        {
+            bool stop = false;
+            while (GetNextTimePoint(p, t) && t <= limit)
+            {
+                p.clock_->SetNow(t);
+                p.batchScheduler_->FireAndRemoveNextEvents(stop);
+            }
+        }
+        else
+        {
+            while (GetNextTimePoint(p, t) && t <= limit)
+            {
+                p.clock_->SetNow(t);
+                p.scheduler_->FireAndRemoveNextEvent();
+            }
+        }
+    }
+
+    /*}}}*/
+
+    // Helpers./*{{{*/
+private:
+    void CheckNotRunning(void)
+    {
+        if (running_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot call the method when "
+                             "the simulator is running."));
+        }
+    }
+
+    Partition& GetPartition(uint32_t partition)
+    {
+        if (partition >= partitions_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                OutOfBounds() <<
+                ErrorMessage("The partition does not exist.") <<
+                PartitionIndexErrorInfo(partition));
+        }
+        return *partitions_[partition];
+    }
+
+    static uint64_t GetLinkKey(uint32_t src, uint32_t dst) BOOST_NOEXCEPT
+    {
+        return (static_cast<uint64_t>(src) << 32) | dst;
+    }
+
+    /**
+     * @brief Get the number of events in the schedulers and inboxes.
+     */
+    uint64_t GetNumEvents(void)
+    {
+        uint64_t n = 0;
+        for (auto it = partitions_.begin(); it != partitions_.end(); ++it)
+        {
+            n += (*it)->scheduler_->GetNumEvents() + (*it)->inbox_.size();
+        }
+        return n;
+    }
+
+    /*}}}*/
+
+    // Events./*{{{*/
+private:
+    void FireSimulationBeginEvent(void)
+    {
+        beginEvent_.GetImpl()->Fire();
+    }
+
+    void FireSimulationRunEvent(void)
+    {
+        runEvent_.GetImpl()->Fire();
+    }
+
+    void FireSimulationPauseEvent(void)
+    {
+        pauseEvent_.GetImpl()->Fire();
+    }
+
+    void FireSimulationEndEvent(void)
+    {
+        endEvent_.GetImpl()->Fire();
+    }
+
+    /*}}}*/
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IParallelSimulator)
+        NSFX_INTERFACE_ENTRY(IClock)
+        NSFX_INTERFACE_ENTRY(ISimulator)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationBeginEvent, &beginEvent_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationRunEvent,   &runEvent_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationPauseEvent, &pauseEvent_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationEndEvent,   &endEvent_)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    TimePoint  now_;
+    vector<std::unique_ptr<Partition>>  partitions_;
+    unordered_map<uint64_t, Duration>  links_;
+    uint32_t  numThreads_;
+    Duration  lookahead_;
+    bool  started_;
+    bool  running_;
+    std::atomic<bool>  paused_;
+    std::atomic<bool>  failed_;
+    vector<Slot>  slots_;
+
+    MemberAggObject<Event<ISimulationBeginEvent>>  beginEvent_;
+    MemberAggObject<Event<ISimulationRunEvent>>    runEvent_;
+    MemberAggObject<Event<ISimulationPauseEvent>>  pauseEvent_;
+    MemberAggObject<Event<ISimulationEndEvent>>    endEvent_;
+
+}; // class ParallelSimulator
+
+
+NSFX_REGISTER_CLASS(ParallelSimulator, "edu.uestc.nsfx.ParallelSimulator");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // PARALLEL_SIMULATOR_H__1005ABFE_FCB7_4895_8528_2CA3A0D1BE23
+
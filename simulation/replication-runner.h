@@ -0,0 +1,622 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef REPLICATION_RUNNER_H__E9EB4ED3_FD70_459F_B593_18769BB28B42
+#define REPLICATION_RUNNER_H__E9EB4ED3_FD70_459F_B593_18769BB28B42
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-simulator.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/random/pseudo-random-generator.h>
+#include <nsfx/statistics/summary/summary.h>
+#include <nsfx/component/class-registry.h>
+#include <nsfx/component/ptr.h>
+#include <boost/math/distributions/students_t.hpp>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility> // pair
+#include <cmath> // sqrt, isnan
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Replication.
+/**
+ * @ingroup Simulator
+ * @brief A replication of a simulation.
+ *
+ * A replication consists of a simulator, a scheduler and a pseudo-random
+ * number engine that are independent of other replications.
+ *
+ * The scenario of a simulation builds the model upon them, and registers
+ * the summaries of the results of the replication.
+ */
+class Replication
+{
+public:
+    Replication(size_t index,
+                Ptr<ISimulator> simulator,
+                Ptr<IScheduler> scheduler,
+                Ptr<IRandom> random) :
+        index_(index),
+        simulator_(std::move(simulator)),
+        scheduler_(std::move(scheduler)),
+        random_(std::move(random))
+    {}
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(Replication(const Replication& ));
+    BOOST_DELETED_FUNCTION(Replication& operator=(const Replication& ));
+
+public:
+    /**
+     * @brief Get the index of the replication.
+     */
+    size_t GetIndex(void) const BOOST_NOEXCEPT
+    {
+        return index_;
+    }
+
+    Ptr<ISimulator> GetSimulator(void) const
+    {
+        return simulator_;
+    }
+
+    Ptr<IScheduler> GetScheduler(void) const
+    {
+        return scheduler_;
+    }
+
+    Ptr<IClock> GetClock(void) const
+    {
+        return Ptr<IClock>(simulator_);
+    }
+
+    /**
+     * @brief Get the pseudo-random number engine of the replication.
+     *
+     * The engines of the replications generate non-overlapping subsequences.
+     */
+    Ptr<IRandom> GetRandom(void) const
+    {
+        return random_;
+    }
+
+    /**
+     * @brief Register a summary of a result.
+     *
+     * @param[in] name    The name of the result.
+     * @param[in] summary The summary.
+     *                    The mean of the summary after the replication is the
+     *                    result of the replication.
+     *
+     * @throw InvalidPointer  The summary is `nullptr`.
+     * @throw InvalidArgument The name has been registered.
+     */
+    void AddSummary(const std::string& name, Ptr<ISummary> summary)
+    {
+        if (!summary)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        for (auto it = summaries_.cbegin(); it != summaries_.cend(); ++it)
+        {
+            if (it->first == name)
+            {
+                BOOST_THROW_EXCEPTION(
+                    InvalidArgument() <<
+                    ErrorMessage("Duplicate summary name \"" + name + "\"."));
+            }
+        }
+        summaries_.emplace_back(name, std::move(summary));
+    }
+
+    /**
+     * @brief Create and register a summary of a result.
+     *
+     * The summary provides `IProbeEventSink`, and it can be connected to
+     * a probe.
+     *
+     * @throw InvalidArgument The name has been registered.
+     */
+    Ptr<ISummary> CreateSummary(const std::string& name)
+    {
+        // Not via the class registry, since it is not thread-safe.
+        Ptr<ISummary> summary(new Object<Summary>);
+        AddSummary(name, summary);
+        return summary;
+    }
+
+    const vector<std::pair<std::string, Ptr<ISummary>>>&
+    GetSummaries(void) const BOOST_NOEXCEPT
+    {
+        return summaries_;
+    }
+
+private:
+    size_t index_;
+    Ptr<ISimulator> simulator_;
+    Ptr<IScheduler> scheduler_;
+    Ptr<IRandom>    random_;
+    vector<std::pair<std::string, Ptr<ISummary>>>  summaries_;
+
+}; // class Replication
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ReplicationSummary.
+/**
+ * @ingroup Simulator
+ * @brief The statistics of a result across replications.
+ *
+ * The result of each replication is the mean of its summary.
+ * A replication whose summary has no sample is excluded.
+ */
+class ReplicationSummary
+{
+public:
+    ReplicationSummary(void) :
+        numExcluded_(0)
+    {}
+
+    /**
+     * @brief Add the result of a replication.
+     */
+    void Add(double value)
+    {
+        if ((std::isnan)(value))
+        {
+            ++numExcluded_;
+        }
+        else
+        {
+            values_.push_back(value);
+        }
+    }
+
+    /**
+     * @brief Get the number of replications that have results.
+     */
+    size_t GetNumReplications(void) const BOOST_NOEXCEPT
+    {
+        return values_.size();
+    }
+
+    /**
+     * @brief Get the number of replications that have no result.
+     */
+    size_t GetNumExcluded(void) const BOOST_NOEXCEPT
+    {
+        return numExcluded_;
+    }
+
+    /**
+     * @brief Get the results of the replications in the order of their
+     *        indices.
+     */
+    const vector<double>& GetValues(void) const BOOST_NOEXCEPT
+    {
+        return values_;
+    }
+
+    double Mean(void) const
+    {
+        double mean = std::numeric_limits<double>::quiet_NaN();
+        if (values_.size())
+        {
+            double sum = 0;
+            for (auto it = values_.cbegin(); it != values_.cend(); ++it)
+            {
+                sum += *it;
+            }
+            mean = sum / values_.size();
+        }
+        return mean;
+    }
+
+    /**
+     * @brief The sample standard deviation of the results.
+     */
+    double Stddev(void) const
+    {
+        double stddev = std::numeric_limits<double>::quiet_NaN();
+        if (values_.size() >= 2)
+        {
+            double mean = Mean();
+            double sum = 0;
+            for (auto it = values_.cbegin(); it != values_.cend(); ++it)
+            {
+                sum += (*it - mean) * (*it - mean);
+            }
+            stddev = std::sqrt(sum / (values_.size() - 1));
+        }
+        return stddev;
+    }
+
+    /**
+     * @brief Get the half-width of the confidence interval of the mean.
+     *
+     * @param[in] level The confidence level in `(0, 1)`.
+     *
+     * The interval is based on the Student's t-distribution, i.e., the
+     * results of the replications are assumed to be i.i.d. and approximately
+     * normal.
+     * The confidence interval is `[Mean() - h, Mean() + h]`.
+     *
+     * @throw InvalidArgument The confidence level is not in `(0, 1)`.
+     */
+    double GetHalfWidth(double level = 0.95) const
+    {
+        if (!(level > 0 && level < 1))
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The confidence level must be in (0, 1)."));
+        }
+        double h = std::numeric_limits<double>::quiet_NaN();
+        if (values_.size() >= 2)
+        {
+            size_t n = values_.size();
+            boost::math::students_t dist(static_cast<double>(n - 1));
+            double t = boost::math::quantile(
+                boost::math::complement(dist, (1 - level) / 2));
+            h = t * Stddev() / std::sqrt(static_cast<double>(n));
+        }
+        return h;
+    }
+
+private:
+    vector<double> values_;
+    size_t numExcluded_;
+
+}; // class ReplicationSummary
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ReplicationRunner.
+/**
+ * @ingroup Simulator
+ * @brief Run the independent replications of a simulation in parallel.
+ *
+ * Each replication has its own simulator, scheduler and pseudo-random number
+ * engine (`Xoshiro256StarstarEngine`).
+ * The engine of the `i`-th replication is seeded by the seed of the runner,
+ * and jumped `i` times.
+ * Thus, the engines generate non-overlapping subsequences of length `2^128`.
+ *
+ * The replications run on a pool of threads, and each replication runs on
+ * a single thread.
+ * The objects of a replication **must not** be shared with other
+ * replications.
+ *
+ * The class registry is not thread-safe, since the class factories are
+ * shared by the replications.
+ * Thus the scenarios are called one at a time, and a scenario can call
+ * `CreateObject()` to build the model.
+ * Only the simulations run in parallel.
+ * If the events call `CreateObject()` during the simulations,
+ * `NSFX_COMPONENT_THREAD_SAFE` **must** be defined, and the classes
+ * **must not** be registered or unregistered while the replications run.
+ *
+ * The results do not depend on the number of threads.
+ *
+ * @code
+ * ReplicationRunner runner;
+ * runner.SetNumReplications(100);
+ * runner.Run([] (Replication& r) {
+ *     // Build the model, and schedule the initial events.
+ *     ...
+ *     Ptr<ISummary> delay = r.CreateSummary("delay");
+ *     // Connect the summary to a probe of the model.
+ *     ...
+ * });
+ * const ReplicationSummary& delay = runner.GetSummary("delay");
+ * std::cout << delay.Mean() << " +/- " << delay.GetHalfWidth(0.95);
+ * @endcode
+ */
+class ReplicationRunner
+{
+public:
+    /**
+     * @brief The scenario of a simulation.
+     *
+     * It builds the model of a replication.
+     * It is called in different threads for different replications, but
+     * not concurrently.
+     */
+    typedef std::function<void(Replication&)>  Scenario;
+
+public:
+    ReplicationRunner(void) :
+        numReplications_(1),
+        numThreads_(std::thread::hardware_concurrency()),
+        seed_(1),
+        schedulerCid_("edu.uestc.nsfx.HeapScheduler"),
+        hasDuration_(false)
+    {
+        if (!numThreads_)
+        {
+            numThreads_ = 1;
+        }
+    }
+
+    // Non-copyable.
+private:
+    BOOST_DELETED_FUNCTION(ReplicationRunner(const ReplicationRunner& ));
+    BOOST_DELETED_FUNCTION(ReplicationRunner& operator=(const ReplicationRunner& ));
+
+public:
+    void SetNumReplications(size_t numReplications) BOOST_NOEXCEPT
+    {
+        numReplications_ = numReplications;
+    }
+
+    /**
+     * @brief Set the number of threads.
+     *
+     * @param[in] numThreads The number of threads.
+     *                       If it is `0`, the number of hardware threads is
+     *                       used.
+     */
+    void SetNumThreads(size_t numThreads) BOOST_NOEXCEPT
+    {
+        if (!numThreads)
+        {
+            numThreads = std::thread::hardware_concurrency();
+        }
+        numThreads_ = numThreads ? numThreads : 1;
+    }
+
+    void SetSeed(uint64_t seed) BOOST_NOEXCEPT
+    {
+        seed_ = seed;
+    }
+
+    /**
+     * @brief Set the class of the schedulers.
+     *
+     * The class **must** be registered.
+     * The default is `"edu.uestc.nsfx.HeapScheduler"`.
+     */
+    void SetScheduler(const std::string& cid)
+    {
+        schedulerCid_ = cid;
+    }
+
+    /**
+     * @brief Run each replication for a duration.
+     *
+     * By default, a replication runs until there is no pending event.
+     */
+    void SetDuration(const Duration& dt) BOOST_NOEXCEPT
+    {
+        duration_ = dt;
+        hasDuration_ = true;
+    }
+
+    /**
+     * @brief Run the replications.
+     *
+     * The results of the previous run are discarded.
+     *
+     * If a replication throws an exception, the replications that have not
+     * started are skipped, and the exception thrown by the replication of
+     * the smallest index is rethrown.
+     *
+     * @throw InvalidPointer The scenario is empty.
+     */
+    void Run(const Scenario& scenario)
+    {
+        if (!scenario)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        summaries_.clear();
+        vector<Slot> slots(numReplications_);
+        // Derive the non-overlapping streams.
+        xoshiro256starstar rng(seed_);
+        for (size_t i = 0; i < numReplications_; ++i)
+        {
+            Slot& slot = slots[i];
+            slot.simulator_ =
+                CreateObject<ISimulator>("edu.uestc.nsfx.Simulator");
+            slot.scheduler_ = CreateObject<IScheduler>(schedulerCid_.c_str());
+            slot.rng_ = rng;
+            rng.jump();
+        }
+        size_t numThreads = (std::min)(numThreads_, numReplications_);
+        std::atomic<size_t> next(0);
+        std::atomic<bool> failed(false);
+        std::mutex mutex;
+        vector<std::thread> threads;
+        if (numThreads > 1)
+        {
+            threads.reserve(numThreads - 1);
+            try
+            {
+                for (size_t k = 1; k < numThreads; ++k)
+                {
+                    threads.push_back(std::thread(
+                        &ThisClass::Work, this, std::cref(scenario),
+                        std::ref(slots), std::ref(next), std::ref(failed),
+                        std::ref(mutex)));
+                }
+            }
+            catch (...)
+            {
+                // Run the replications in the threads that have been created.
+            }
+        }
+        Work(scenario, slots, next, failed, mutex);
+        for (auto it = threads.begin(); it != threads.end(); ++it)
+        {
+            it->join();
+        }
+        for (auto it = slots.begin(); it != slots.end(); ++it)
+        {
+            if (it->error_)
+            {
+                std::rethrow_exception(it->error_);
+            }
+        }
+        // Merge the results in the order of the replications.
+        for (auto it = slots.begin(); it != slots.end(); ++it)
+        {
+            for (auto r = it->results_.cbegin(); r != it->results_.cend(); ++r)
+            {
+                summaries_[r->first].Add(r->second);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the names of the results.
+     */
+    vector<std::string> GetSummaryNames(void) const
+    {
+        vector<std::string> names;
+        names.reserve(summaries_.size());
+        for (auto it = summaries_.cbegin(); it != summaries_.cend(); ++it)
+        {
+            names.push_back(it->first);
+        }
+        return names;
+    }
+
+    /**
+     * @brief Get the statistics of a result across the replications.
+     *
+     * @throw InvalidArgument No replication has the result.
+     */
+    const ReplicationSummary& GetSummary(const std::string& name) const
+    {
+        auto it = summaries_.find(name);
+        if (it == summaries_.cend())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("No summary named \"" + name + "\"."));
+        }
+        return it->second;
+    }
+
+private:
+    typedef ReplicationRunner  ThisClass;
+
+    /**
+     * @brief The state of a replication.
+     */
+    struct Slot
+    {
+        Ptr<ISimulator>     simulator_;
+        Ptr<IScheduler>     scheduler_;
+        xoshiro256starstar  rng_;
+        vector<std::pair<std::string, double>>  results_;
+        std::exception_ptr  error_;
+    };
+
+    /**
+     * @param[in] mutex The mutex that serializes the scenarios.
+     */
+    void Work(const Scenario& scenario, vector<Slot>& slots,
+              std::atomic<size_t>& next, std::atomic<bool>& failed,
+              std::mutex& mutex)
+    {
+        while (!failed)
+        {
+            size_t i = next++;
+            if (i >= slots.size())
+            {
+                break;
+            }
+            try
+            {
+                RunReplication(scenario, i, slots[i], mutex);
+            }
+            catch (...)
+            {
+                slots[i].error_ = std::current_exception();
+                failed = true;
+            }
+            // Release the objects of the replication.
+            slots[i].simulator_ = nullptr;
+            slots[i].scheduler_ = nullptr;
+        }
+    }
+
+    void RunReplication(const Scenario& scenario, size_t index, Slot& slot,
+                        std::mutex& mutex)
+    {
+        Ptr<ISimulator> simulator = slot.simulator_;
+        Ptr<IScheduler> scheduler = slot.scheduler_;
+        Ptr<ISchedulerUser>(simulator)->Use(scheduler);
+        Ptr<IClockUser>(scheduler)->Use(Ptr<IClock>(simulator));
+        Ptr<Xoshiro256StarstarEngine> engine(
+            new Object<Xoshiro256StarstarEngine>);
+        engine->GetRng() = slot.rng_;
+        Replication replication(index, simulator, scheduler,
+                                Ptr<IRandom>(engine));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            scenario(replication);
+        }
+        if (scheduler->GetNumEvents())
+        {
+            if (hasDuration_)
+            {
+                simulator->RunFor(duration_);
+            }
+            else
+            {
+                simulator->Run();
+            }
+        }
+        const auto& summaries = replication.GetSummaries();
+        slot.results_.reserve(summaries.size());
+        for (auto it = summaries.cbegin(); it != summaries.cend(); ++it)
+        {
+            slot.results_.emplace_back(it->first, it->second->Mean());
+        }
+    }
+
+private:
+    size_t    numReplications_;
+    size_t    numThreads_;
+    uint64_t  seed_;
+    std::string  schedulerCid_;
+    Duration  duration_;
+    bool      hasDuration_;
+    map<std::string, ReplicationSummary>  summaries_;
+
+}; // class ReplicationRunner
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // REPLICATION_RUNNER_H__E9EB4ED3_FD70_459F_B593_18769BB28B42
+
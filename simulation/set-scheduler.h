@@ -19,7 +19,9 @@
 
 #include <nsfx/simulation/config.h>
 #include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
 #include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-checkpoint.h>
 #include <nsfx/simulation/i-clock.h>
 #include <nsfx/component/class-registry.h>
 #include <functional>
@@ -35,6 +37,8 @@ NSFX_OPEN_NAMESPACE
  * @ingroup Simulator
  * @brief An event scheduler based on set.
  *
+ * A cancelled event is removed from the set immediately.
+ *
  * # Uid
  * @code
  * "edu.uestc.nsfx.SetScheduler"
@@ -45,10 +49,15 @@ NSFX_OPEN_NAMESPACE
  *   + `IClock`
  * * Provides
  *   + `IScheduler`
+ *   + `ICallableScheduler`
+ *   + `ICheckpointable`
  */
 class SetScheduler :
     public IClockUser,
-    public IScheduler
+    public IScheduler,
+    public ICallableScheduler,
+    public ICheckpointable,
+    private EventHandleOwner
 {
 private:
     typedef SetScheduler   ThisClass;
@@ -59,7 +68,13 @@ public:
         nextEventId_(0)
     {}
 
-    virtual ~SetScheduler(void) {}
+    virtual ~SetScheduler(void)
+    {
+        for (auto it = set_.begin(); it != set_.end(); ++it)
+        {
+            (*it)->SetOwner(nullptr);
+        }
+    }
 
     // IClockUser /*{{{*/
 public:
@@ -105,20 +120,7 @@ public:
         {
             BOOST_THROW_EXCEPTION(InvalidPointer());
         }
-        if (t < clock_->Now())
-        {
-            BOOST_THROW_EXCEPTION(
-                InvalidArgument() <<
-                ErrorMessage("Cannot schedule an event that "
-                             "happens before the current time.") <<
-                CurrentTimeErrorInfo(clock_->Now()) <<
-                ScheduledTimeErrorInfo(t));
-        }
-        Ptr<EventHandle> handle(new Object<EventHandle>(
-                                    nextEventId_++, t, std::move(sink)));
-        set_.insert(handle);
-        // BOOST_ASSERT(IsOrdered());
-        return Ptr<IEventHandle>(handle.Detach()->GetIntf(), false);
+        return Insert(t, std::move(sink));
     }
 
     virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
@@ -142,8 +144,11 @@ public:
         if (set_.size())
         {
             auto it = set_.begin();
-            (*it)->Fire();
+            Ptr<EventHandle> event(*it);
+            // Remove the event before firing the event.
             set_.erase(it);
+            event->SetOwner(nullptr);
+            event->Fire();
             // BOOST_ASSERT(IsOrdered());
         }
     }
@@ -163,10 +168,128 @@ private:
 
     /*}}}*/
 
+    // ICallableScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now(), std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        return ThisClass::ScheduleCallableAt(clock_->Now() + dt, std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (callable.IsEmpty())
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(callable));
+    }
+
+    /*}}}*/
+
+private:
+    /**
+     * @brief Insert an event.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     */
+    template<class Target>
+    Ptr<IEventHandle> Insert(const TimePoint& t, Target&& target)
+    {
+        if (t < clock_->Now())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("Cannot schedule an event that "
+                             "happens before the current time.") <<
+                CurrentTimeErrorInfo(clock_->Now()) <<
+                ScheduledTimeErrorInfo(t));
+        }
+        Ptr<EventHandle> handle(new Object<EventHandle>(
+                                    nextEventId_++, t, std::move(target)));
+        set_.insert(handle);
+        handle->SetOwner(this);
+        // BOOST_ASSERT(IsOrdered());
+        return Ptr<IEventHandle>(handle.Detach()->GetIntf(), false);
+    }
+
+    // ICheckpointable /*{{{*/
+public:
+    /**
+     * @brief Save the pending events.
+     *
+     * @throw IllegalMethodCall An event cannot be checkpointed.
+     *                          e.g., it is scheduled as a callable.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
+    {
+        vector<EventHandle*> events;
+        events.reserve(set_.size());
+        for (auto it = set_.cbegin(); it != set_.cend(); ++it)
+        {
+            events.push_back(it->Get());
+        }
+        SaveEvents(writer, nextEventId_, events);
+    }
+
+    /**
+     * @brief Restore the pending events.
+     *
+     * The events are scheduled with their original ids, so the events that
+     * happen at the same time are fired in the original order.
+     * The clock **must** have been restored, since the events cannot be
+     * scheduled before the current time.
+     *
+     * @throw Uninitialized     The scheduler is not initialized.
+     * @throw IllegalMethodCall There are pending events.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+        if (set_.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot restore a checkpoint into a scheduler "
+                             "that has pending events."));
+        }
+        nextEventId_ = RestoreEvents(reader,
+            [this] (const TimePoint& t, event_id_t id, Ptr<IEventSink<>>&& sink) {
+                nextEventId_ = id;
+                Insert(t, std::move(sink));
+            });
+    }
+
+    /*}}}*/
+
+    // EventHandleOwner /*{{{*/
+private:
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        set_.erase(Ptr<EventHandle>(handle));
+    }
+
+    /*}}}*/
+
 private:
     NSFX_INTERFACE_MAP_BEGIN(ThisClass)
         NSFX_INTERFACE_ENTRY(IClockUser)
         NSFX_INTERFACE_ENTRY(IScheduler)
+        NSFX_INTERFACE_ENTRY(ICallableScheduler)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
     NSFX_INTERFACE_MAP_END()
 
 private:
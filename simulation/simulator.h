@@ -21,9 +21,17 @@
 #include <nsfx/simulation/i-simulator.h>
 #include <nsfx/simulation/i-clock.h>
 #include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-batch-scheduler.h>
+#include <nsfx/simulation/i-event-injector.h>
+#include <nsfx/simulation/event-injection-queue.h>
 #include <nsfx/simulation/exception.h>
+#include <nsfx/component/i-checkpointable.h>
 #include <nsfx/event/event.h>
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+# include <nsfx/simulation/event-profiler.h>
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
 #include <nsfx/component/class-registry.h>
+#include <chrono>
 
 
 NSFX_OPEN_NAMESPACE
@@ -42,6 +50,18 @@ class Simulator;
  *
  * This simulator provides a clock, and fires events in a scheduler.
  *
+ * If the scheduler provides `IBatchScheduler`, the simulator fires the events
+ * that happen at the same time in a batch.
+ *
+ * If `NSFX_SIMULATOR_USES_PROFILER` is defined, the simulator aggregates an
+ * `EventProfiler` that measures the events fired during the runs.
+ *
+ * Other threads can inject events via `IEventInjector` while the simulator
+ * is running.
+ * The injected events are moved into the scheduler before the simulator
+ * fires the next events.
+ * The simulator can be paced by the wall clock via `IRealTimePacing`.
+ *
  * # Uid
  * @code
  * "edu.uestc.nsfx.Simulator"
@@ -50,29 +70,53 @@ class Simulator;
  * # Interfaces
  * * Uses
  *   + \c IScheduler
+ *   + \c IBatchScheduler (optional)
  * * Provides
  *   + \c IClock
  *   + \c ISimulator
+ *   + \c ICheckpointable
+ *   + \c IEventInjector
+ *   + \c IRealTimePacing
+ *   + \c IEventProfiler (if `NSFX_SIMULATOR_USES_PROFILER` is defined)
+ *   + \c IProbeContainer (if `NSFX_SIMULATOR_USES_PROFILER` is defined)
  * * Events
  *   + \c ISimulationBeginEvent
  *   + \c ISimulationRunEvent
  *   + \c ISimulationPauseEvent
  *   + \c ISimulationEndEvent
+ *
+ * # Checkpoint
+ * The simulator saves the current time and the pending events in its
+ * scheduler, which **must** provide `ICheckpointable`.
+ * The state is restored into a simulator that is wired with a scheduler of
+ * the same class.
+ * If the simulation had begun when the checkpoint was saved, the restored
+ * simulator does not fire `ISimulationBeginEvent` again.
  */
 class Simulator :
     public ISchedulerUser,
     public IClock,
-    public ISimulator
+    public ISimulator,
+    public ICheckpointable,
+    public IEventInjector,
+    public IRealTimePacing
 {
+    typedef std::chrono::steady_clock  ClockType;
+
 public:
-    Simulator(void) BOOST_NOEXCEPT :
+    Simulator(void) :
         initialized_(false),
         started_(false),
         paused_(true),
+        pacing_(false),
+        speed_(1),
         beginEvent_(this),
         runEvent_(this),
         pauseEvent_(this),
         endEvent_(this)
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+        , profiler_(this)
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
     {
     }
 
@@ -92,7 +136,18 @@ public:
         {
             BOOST_THROW_EXCEPTION(InvalidPointer());
         }
+        try
+        {
+            batchScheduler_ = scheduler;
+        }
+        catch (NoInterface& )
+        {
+            // The scheduler does not support batch firing.
+        }
         scheduler_ = scheduler;
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+        profiler_.GetImpl()->SetScheduler(scheduler_.Get());
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
         initialized_ = true;
     }
 
@@ -111,10 +166,9 @@ public:
 public:
     virtual void Run(void) NSFX_OVERRIDE
     {
-        if (!initialized_)
-        {
-            BOOST_THROW_EXCEPTION(Uninitialized());
-        }
+        CheckInitialized();
+        BeginPacing();
+        InjectEvents();
         if (!scheduler_->GetNumEvents())
         {
             BOOST_THROW_EXCEPTION(NoScheduledEvent());
@@ -122,18 +176,27 @@ public:
         CheckBeginOfSimulation();
         paused_ = false;
         FireSimulationRunEvent();
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+        EventProfiler::Activation profile(profiler_.GetImpl());
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
         // An external object can schedule events in its event sink.
         while (!paused_)
         {
-            Ptr<IEventHandle> handle = scheduler_->GetNextEvent();
-            if (!handle)
+            InjectEvents();
+            TimePoint t0;
+            if (!GetNextTimePoint(t0))
             {
                 // End the loop when the scheduler is empty.
                 break;
             }
-            now_ = handle->GetTimePoint();
+            if (pacing_ && !WaitUntil(t0))
+            {
+                // An event is injected.
+                continue;
+            }
+            now_ = t0;
             // Can pause simulation.
-            scheduler_->FireAndRemoveNextEvent();
+            FireNextEvents();
         }
         paused_ = true;
         FireSimulationPauseEvent();
@@ -142,37 +205,45 @@ public:
 
     virtual void RunUntil(const TimePoint& t) NSFX_OVERRIDE
     {
-        if (!initialized_)
-        {
-            BOOST_THROW_EXCEPTION(Uninitialized());
-        }
-        if (!scheduler_->GetNumEvents())
+        CheckInitialized();
+        BeginPacing();
+        InjectEvents();
+        // A paced simulator waits for injected events.
+        if (!pacing_ && !scheduler_->GetNumEvents())
         {
             BOOST_THROW_EXCEPTION(NoScheduledEvent());
         }
         CheckBeginOfSimulation();
         paused_ = false;
         FireSimulationRunEvent();
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+        EventProfiler::Activation profile(profiler_.GetImpl());
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
         // An external object can schedule events in its event sink.
         while (!paused_)
         {
-            Ptr<IEventHandle> handle = scheduler_->GetNextEvent();
-            if (!handle)
+            InjectEvents();
+            TimePoint t0;
+            if (!GetNextTimePoint(t0) || t0 > t)
             {
-                // End the loop when the scheduler is empty.
+                if (pacing_ && !WaitUntil(t))
+                {
+                    // An event is injected.
+                    continue;
+                }
+                // End the loop if the scheduler is empty, or the event is
+                // scheduled for a later time.
                 now_ = t;
                 break;
             }
-            TimePoint t0 = handle->GetTimePoint();
-            if (t0 > t)
+            if (pacing_ && !WaitUntil(t0))
             {
-                // End the loop if the event is scheduled for a later time.
-                now_ = t;
-                break;
+                // An event is injected.
+                continue;
             }
             now_ = t0;
             // Can pause simulation.
-            scheduler_->FireAndRemoveNextEvent();
+            FireNextEvents();
         }
         paused_ = true;
         FireSimulationPauseEvent();
@@ -190,6 +261,58 @@ public:
     }
 
 private:
+    void CheckInitialized(void)
+    {
+        if (!initialized_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+    }
+
+    /**
+     * @brief Get the time point of the next event.
+     *
+     * @return `false` if the scheduler is empty.
+     */
+    bool GetNextTimePoint(TimePoint& t)
+    {
+        if (batchScheduler_)
+        {
+            if (!scheduler_->GetNumEvents())
+            {
+                return false;
+            }
+            t = batchScheduler_->GetNextTimePoint();
+        }
+        else
+        {
+            Ptr<IEventHandle> handle = scheduler_->GetNextEvent();
+            if (!handle)
+            {
+                return false;
+            }
+            t = handle->GetTimePoint();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Fire the next event, or the next events at the same time.
+     *
+     * It can pause the simulation.
+     */
+    void FireNextEvents(void)
+    {
+        if (batchScheduler_)
+        {
+            batchScheduler_->FireAndRemoveNextEvents(paused_);
+        }
+        else
+        {
+            scheduler_->FireAndRemoveNextEvent();
+        }
+    }
+
     void CheckBeginOfSimulation(void)
     {
         if (!started_)
@@ -209,6 +332,191 @@ private:
 
     /*}}}*/
 
+    // IEventInjector /*{{{*/
+public:
+    virtual void Inject(const TimePoint& t, Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        injections_.Push(t, false, std::move(sink));
+    }
+
+    virtual void InjectNow(Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        injections_.Push(TimePoint(), true, std::move(sink));
+    }
+
+private:
+    /**
+     * @brief Move the injected events into the scheduler.
+     */
+    void InjectEvents(void)
+    {
+        if (!injections_.IsEmpty())
+        {
+            injections_.Drain([this] (const TimePoint& t, bool now,
+                                      Ptr<IEventSink<>>&& sink) {
+                TimePoint t0 = now ? GetWallTimePoint() : t;
+                scheduler_->ScheduleAt(t0 < now_ ? now_ : t0, std::move(sink));
+            });
+        }
+    }
+
+    /*}}}*/
+
+    // IRealTimePacing /*{{{*/
+public:
+    virtual void EnablePacing(double speed) NSFX_OVERRIDE
+    {
+        if (!(speed > 0))
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The speed must be positive."));
+        }
+        CheckPaused();
+        pacing_ = true;
+        speed_ = speed;
+    }
+
+    virtual void DisablePacing(void) NSFX_OVERRIDE
+    {
+        CheckPaused();
+        pacing_ = false;
+    }
+
+    virtual bool IsPacing(void) NSFX_OVERRIDE
+    {
+        return pacing_;
+    }
+
+private:
+    void CheckPaused(void)
+    {
+        if (!paused_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the pacing "
+                             "while the simulator is running."));
+        }
+    }
+
+    /**
+     * @brief Align the simulation time with the wall-clock time.
+     */
+    void BeginPacing(void)
+    {
+        wall0_ = ClockType::now();
+        sim0_ = now_;
+    }
+
+    /**
+     * @brief Get the simulation time of the current wall-clock time.
+     *
+     * @return The current time if the simulator is not paced.
+     */
+    TimePoint GetWallTimePoint(void)
+    {
+        if (!pacing_)
+        {
+            return now_;
+        }
+        double secs = std::chrono::duration<double>(
+            ClockType::now() - wall0_).count() * speed_;
+        return sim0_ + Duration(static_cast<int64_t>(
+            secs * Duration(Seconds(1)).GetCount()));
+    }
+
+    /**
+     * @brief Wait until the wall-clock time of a time point.
+     *
+     * @return `false` if an event is injected before the time point.
+     */
+    bool WaitUntil(const TimePoint& t)
+    {
+        double secs = static_cast<double>((t - sim0_).GetCount()) /
+                      Duration(Seconds(1)).GetCount() / speed_;
+        for (;;)
+        {
+            ClockType::time_point now = ClockType::now();
+            double remaining = secs -
+                std::chrono::duration<double>(now - wall0_).count();
+            if (remaining <= 0)
+            {
+                return true;
+            }
+            // Wait for at most one year at a time, so the deadline of a
+            // far-off time point does not overflow the clock.
+            if (remaining > 365 * 86400.0)
+            {
+                remaining = 365 * 86400.0;
+            }
+            ClockType::time_point deadline = now +
+                std::chrono::duration_cast<ClockType::duration>(
+                    std::chrono::duration<double>(remaining));
+            injections_.WaitUntil(deadline);
+            if (!injections_.IsEmpty())
+            {
+                return false;
+            }
+        }
+    }
+
+    /*}}}*/
+
+    // ICheckpointable /*{{{*/
+public:
+    /**
+     * @brief Save the current time and the pending events.
+     *
+     * It can be called within an event sink, and the event that is being
+     * fired is not saved.
+     *
+     * @throw Uninitialized The simulator is not initialized.
+     * @throw NoInterface   The scheduler does not provide `ICheckpointable`.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        Ptr<ICheckpointable> scheduler(scheduler_);
+        writer.WriteInt64(now_.GetDuration().GetCount());
+        writer.WriteBool(started_);
+        scheduler->SaveCheckpoint(writer);
+    }
+
+    /**
+     * @brief Restore the current time and the pending events.
+     *
+     * @throw Uninitialized     The simulator is not initialized.
+     * @throw IllegalMethodCall The simulator is running.
+     * @throw NoInterface       The scheduler does not provide `ICheckpointable`.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        if (!paused_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot restore a checkpoint "
+                             "while the simulator is running."));
+        }
+        Ptr<ICheckpointable> scheduler(scheduler_);
+        // The clock must be restored before the events are scheduled.
+        now_ = TimePoint(Duration(reader.ReadInt64()));
+        started_ = reader.ReadBool();
+        scheduler->RestoreCheckpoint(reader);
+    }
+
+    /*}}}*/
+
     // Events./*{{{*/
 private:
     void FireSimulationBeginEvent(void)
@@ -238,23 +546,40 @@ private:
         NSFX_INTERFACE_ENTRY(ISchedulerUser)
         NSFX_INTERFACE_ENTRY(IClock)
         NSFX_INTERFACE_ENTRY(ISimulator)
+        NSFX_INTERFACE_ENTRY(ICheckpointable)
+        NSFX_INTERFACE_ENTRY(IEventInjector)
+        NSFX_INTERFACE_ENTRY(IRealTimePacing)
         NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationBeginEvent, &beginEvent_)
         NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationRunEvent,   &runEvent_)
         NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationPauseEvent, &pauseEvent_)
         NSFX_INTERFACE_AGGREGATED_ENTRY(ISimulationEndEvent,   &endEvent_)
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(IEventProfiler,  &profiler_)
+        NSFX_INTERFACE_AGGREGATED_ENTRY(IProbeContainer, &profiler_)
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
     NSFX_INTERFACE_MAP_END()
 
 private:
     TimePoint  now_;
     Ptr<IScheduler>  scheduler_;
+    Ptr<IBatchScheduler>  batchScheduler_;
     bool  initialized_;
     bool  started_;
     bool  paused_;
 
+    EventInjectionQueue  injections_;
+    bool    pacing_;
+    double  speed_;
+    ClockType::time_point  wall0_;
+    TimePoint  sim0_;
+
     MemberAggObject<Event<ISimulationBeginEvent>>  beginEvent_;
     MemberAggObject<Event<ISimulationRunEvent>>    runEvent_;
     MemberAggObject<Event<ISimulationPauseEvent>>  pauseEvent_;
     MemberAggObject<Event<ISimulationEndEvent>>    endEvent_;
+#if defined(NSFX_SIMULATOR_USES_PROFILER)
+    MemberAggObject<EventProfiler>  profiler_;
+#endif // defined(NSFX_SIMULATOR_USES_PROFILER)
 
 };
 
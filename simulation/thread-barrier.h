@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef THREAD_BARRIER_H__F629739A_A0E9_4568_BAC2_504476B6BEF7
+#define THREAD_BARRIER_H__F629739A_A0E9_4568_BAC2_504476B6BEF7
+
+
+#include <nsfx/simulation/config.h>
+#include <condition_variable>
+#include <mutex>
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// ThreadBarrier.
+/**
+ * @ingroup Simulator
+ * @brief A reusable thread barrier.
+ *
+ * It is used by the parallel simulators to synchronize their threads.
+ */
+class ThreadBarrier
+{
+public:
+    explicit ThreadBarrier(size_t count) :
+        count_(count),
+        arrived_(0),
+        generation_(0)
+    {}
+
+    /**
+     * @brief Wait until all threads arrive at the barrier.
+     */
+    void Wait(void)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        size_t generation = generation_;
+        if (++arrived_ >= count_)
+        {
+            arrived_ = 0;
+            ++generation_;
+            cv_.notify_all();
+        }
+        else
+        {
+            while (generation == generation_)
+            {
+                cv_.wait(lock);
+            }
+        }
+    }
+
+    /**
+     * @brief Reduce the number of threads that wait at the barrier.
+     */
+    void Leave(size_t n)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        count_ -= n;
+        if (arrived_ && arrived_ >= count_)
+        {
+            arrived_ = 0;
+            ++generation_;
+            cv_.notify_all();
+        }
+    }
+
+private:
+    std::mutex  mutex_;
+    std::condition_variable  cv_;
+    size_t  count_;
+    size_t  arrived_;
+    size_t  generation_;
+};
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // THREAD_BARRIER_H__F629739A_A0E9_4568_BAC2_504476B6BEF7
+
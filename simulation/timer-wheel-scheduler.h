@@ -0,0 +1,903 @@
+/**
+ * @file
+ *
+ * @brief Simulation support for Network Simulation Frameworks.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef TIMER_WHEEL_SCHEDULER_H__9BDC5E1D_116E_4D20_AB0B_38FAEFEBC320
+#define TIMER_WHEEL_SCHEDULER_H__9BDC5E1D_116E_4D20_AB0B_38FAEFEBC320
+
+
+#include <nsfx/simulation/config.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
+#include <nsfx/simulation/i-timer-wheel.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/simulation/i-event-profiler.h>
+#include <nsfx/simulation/event-handle.h>
+#include <nsfx/simulation/event-handle-pool.h>
+#include <nsfx/event/event-sink.h>
+#include <nsfx/component/class-registry.h>
+#include <algorithm>
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif // defined(_MSC_VER)
+
+
+NSFX_OPEN_NAMESPACE
+
+
+////////////////////////////////////////////////////////////////////////////////
+// TimerWheelScheduler.
+/**
+ * @ingroup Simulator
+ * @brief An event scheduler that keeps the near future events in timer wheels.
+ *
+ * Protocol models create a lot of short-lived timers, e.g., backoff timers
+ * and retransmission timers, and most of them are cancelled before they
+ * expire.
+ * This scheduler is placed in front of another scheduler (the backing
+ * scheduler), and keeps the near future events in hashed hierarchical timer
+ * wheels.
+ * Scheduling and cancelling an event in the wheels is `O(1)`, and a
+ * cancelled event never reaches the backing scheduler.
+ *
+ * # Uid
+ * @code
+ * "edu.uestc.nsfx.TimerWheelScheduler"
+ * @endcode
+ *
+ * # Interfaces
+ * * Uses
+ *   + `IClock`
+ *   + `IScheduler` (the backing scheduler)
+ * * Provides
+ *   + `IScheduler`
+ *   + `ICallableScheduler`
+ *   + `ITimerWheel`
+ *
+ * # Algorithm
+ * The time axis is divided into *ticks* of the resolution of the wheels.
+ * There are `4` levels of wheels, and each wheel has `64` slots.
+ * A slot of the wheel at level `k` spans `64^k` ticks.
+ * An event is put into the innermost wheel that covers its tick, and the
+ * events in a slot of an outer wheel are cascaded into the inner wheels
+ * when the current tick reaches the slot.
+ *
+ * The scheduler schedules a *tick event* in the backing scheduler at the
+ * next tick that has events (or has events to cascade).
+ * When the tick event is fired, the events in the slot of the tick are moved
+ * into a queue in the order of their time points and ids.
+ * A single *relay event* is scheduled in the backing scheduler at the exact
+ * time point of the earliest event in the queue, and it fires the event.
+ * Before the event is fired, the relay event is scheduled again for the
+ * next event in the queue.
+ * Thus the events are fired at their exact time points by the backing
+ * scheduler, the backing scheduler holds a few events only, and the
+ * resolution only affects the performance.
+ *
+ * The events in the current tick, and the events beyond the span of the
+ * wheels are scheduled by the backing scheduler directly.
+ *
+ * The events that happen at the same time are fired in the order they are
+ * scheduled, unless some of them are scheduled by the backing scheduler
+ * directly.
+ * The event handles returned for the events scheduled by the backing
+ * scheduler directly carry the ids of the backing scheduler.
+ *
+ * The tick events and the relay events are not returned by `GetNextEvent()`,
+ * and they are not reported to `EventProfiler` or `EventTracer`.
+ *
+ * The backing scheduler **must** fire the events that happen at the same time
+ * in the order they are scheduled, as all schedulers in this library do.
+ * The backing scheduler **must not** be used by others.
+ */
+class TimerWheelScheduler :
+    public IClockUser,
+    public ISchedulerUser,
+    public IScheduler,
+    public ICallableScheduler,
+    public ITimerWheel,
+    private EventHandleOwner
+{
+private:
+    typedef TimerWheelScheduler  ThisClass;
+    typedef EventHandlePool::HandleType  HandleType;
+
+    enum
+    {
+        /**
+         * @brief The number of bits of the slot index of a wheel.
+         */
+        SLOT_BITS = 6,
+        NUM_SLOTS = 1 << SLOT_BITS,
+        SLOT_MASK = NUM_SLOTS - 1,
+        NUM_LEVELS = 4,
+        /**
+         * @brief The number of bits of the slot of an event in its index.
+         */
+        POS_SHIFT = 8,
+    };
+
+    /**
+     * @brief The span of the wheels in ticks.
+     */
+    static const uint64_t SPAN = uint64_t(1) << (SLOT_BITS * NUM_LEVELS);
+
+    /**
+     * @brief The flag in the index of an event that has been moved out of
+     *        the wheels, and is fired by the relay event.
+     */
+    static const size_t MOVED = ~(~size_t(0) >> 1);
+
+    /**
+     * @brief The event sink of the tick events and the relay events.
+     */
+    class InternalSink :
+        public IEventSink<>,
+        public InternalEventSinkTag
+    {
+        typedef void (ThisClass::*Callback)(void);
+
+    public:
+        InternalSink(ThisClass* scheduler, Callback callback) :
+            scheduler_(scheduler),
+            callback_(callback)
+        {}
+
+        virtual ~InternalSink(void) {}
+
+        virtual void Fire(void) NSFX_OVERRIDE
+        {
+            (scheduler_->*callback_)();
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(InternalSink)
+            NSFX_INTERFACE_ENTRY(IEventSink<>)
+        NSFX_INTERFACE_MAP_END()
+
+    private:
+        ThisClass* scheduler_;
+        Callback callback_;
+    };
+
+public:
+    TimerWheelScheduler(void) :
+        resolution_(MilliSeconds(1)),
+        nextEventId_(0),
+        cur_(0),
+        numTimers_(0),
+        tickAt_(0),
+        numMoved_(0),
+        popped_(0)
+    {
+        std::fill(bitmaps_, bitmaps_ + NUM_LEVELS, 0);
+        tickSink_ = new Object<InternalSink>(this, &ThisClass::OnTick);
+        relaySink_ = new Object<InternalSink>(this, &ThisClass::OnRelay);
+    }
+
+    virtual ~TimerWheelScheduler(void)
+    {
+        CancelTick();
+        CancelRelay();
+        for (auto it = moved_.begin(); it != moved_.end(); ++it)
+        {
+            if (*it)
+            {
+                (*it)->SetOwner(nullptr);
+                (*it)->Release();
+            }
+        }
+        for (size_t i = 0; i < NUM_LEVELS * NUM_SLOTS; ++i)
+        {
+            vector<HandleType*>& slot = slots_[i];
+            for (auto it = slot.begin(); it != slot.end(); ++it)
+            {
+                (*it)->SetOwner(nullptr);
+                (*it)->Release();
+            }
+        }
+    }
+
+    // IClockUser /*{{{*/
+public:
+    virtual void Use(Ptr<IClock> clock) NSFX_OVERRIDE
+    {
+        if (clock_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the clock after initialization."));
+        }
+        if (!clock)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        clock_ = clock;
+    }
+
+    /*}}}*/
+
+    // ISchedulerUser /*{{{*/
+public:
+    /**
+     * @brief Use a backing scheduler.
+     *
+     * If the backing scheduler provides `ICallableScheduler`, the callables
+     * that are not kept in the wheels are scheduled by it directly.
+     * Otherwise, such callables cannot be scheduled.
+     */
+    virtual void Use(Ptr<IScheduler> scheduler) NSFX_OVERRIDE
+    {
+        if (scheduler_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the backing scheduler "
+                             "after initialization."));
+        }
+        if (!scheduler)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        try
+        {
+            callableScheduler_ = scheduler;
+        }
+        catch (NoInterface& )
+        {
+            // The backing scheduler does not support callables.
+        }
+        scheduler_ = scheduler;
+    }
+
+    /*}}}*/
+
+    // ITimerWheel /*{{{*/
+public:
+    virtual void SetResolution(const Duration& resolution) NSFX_OVERRIDE
+    {
+        if (resolution <= Duration())
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("The resolution must be positive."));
+        }
+        if (numTimers_ || numMoved_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("Cannot change the resolution when there are "
+                             "events in the wheels."));
+        }
+        resolution_ = resolution;
+        cur_ = 0;
+    }
+
+    virtual Duration GetResolution(void) NSFX_OVERRIDE
+    {
+        return resolution_;
+    }
+
+    virtual uint64_t GetNumTimers(void) NSFX_OVERRIDE
+    {
+        return numTimers_;
+    }
+
+    /*}}}*/
+
+    // IScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleNow(Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        return ThisClass::ScheduleAt(clock_->Now(), std::move(sink));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleIn(const Duration& dt,
+                                         Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        return ThisClass::ScheduleAt(clock_->Now() + dt, std::move(sink));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleAt(const TimePoint& t,
+                                         Ptr<IEventSink<>> sink) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        if (!sink)
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(sink));
+    }
+
+    /**
+     * @brief Get the number of pending events.
+     *
+     * The tick event and the relay event are not counted.
+     */
+    virtual uint64_t GetNumEvents(void) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        uint64_t n = numTimers_ + numMoved_;
+        if (scheduler_)
+        {
+            n += scheduler_->GetNumEvents() - (tick_ ? 1 : 0) -
+                 (relay_ ? 1 : 0);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Get the next event.
+     *
+     * If the next event of the backing scheduler is the tick event, the due
+     * events are moved out of the wheels in advance.
+     * If it is the relay event, the handle of the relayed event is returned,
+     * so cancelling the returned handle cancels the relayed event.
+     */
+    virtual Ptr<IEventHandle> GetNextEvent(void) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        ScheduleRelay();
+        Ptr<IEventHandle> next = scheduler_->GetNextEvent();
+        while (next && next == tick_)
+        {
+            // The events are moved with their exact time points, so it is
+            // safe to move them before the tick is reached.
+            CancelTick();
+            OnTick();
+            next = scheduler_->GetNextEvent();
+        }
+        // The front of moved_ is not cancelled.
+        if (next && next == relay_)
+        {
+            next = moved_.front()->GetIntf();
+        }
+        return next;
+    }
+
+    virtual void FireAndRemoveNextEvent(void) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        ScheduleRelay();
+        scheduler_->FireAndRemoveNextEvent();
+    }
+
+    /*}}}*/
+
+    // ICallableScheduler /*{{{*/
+public:
+    virtual Ptr<IEventHandle> ScheduleCallableNow(EventCallable&& callable) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        return ThisClass::ScheduleCallableAt(clock_->Now(), std::move(callable));
+    }
+
+    virtual Ptr<IEventHandle> ScheduleCallableIn(const Duration& dt,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        return ThisClass::ScheduleCallableAt(clock_->Now() + dt, std::move(callable));
+    }
+
+    /**
+     * @throw IllegalMethodCall The callable is not kept in the wheels, and
+     *                          the backing scheduler does not provide
+     *                          `ICallableScheduler`.
+     */
+    virtual Ptr<IEventHandle> ScheduleCallableAt(const TimePoint& t,
+                                                 EventCallable&& callable) NSFX_OVERRIDE
+    {
+        CheckInitialized();
+        if (callable.IsEmpty())
+        {
+            BOOST_THROW_EXCEPTION(InvalidPointer());
+        }
+        return Insert(t, std::move(callable));
+    }
+
+    /*}}}*/
+
+private:
+    void CheckInitialized(void)
+    {
+        if (!clock_ || !scheduler_)
+        {
+            BOOST_THROW_EXCEPTION(Uninitialized());
+        }
+    }
+
+    /**
+     * @brief Get the tick of a time point.
+     */
+    uint64_t GetTick(const TimePoint& t) const BOOST_NOEXCEPT
+    {
+        return static_cast<uint64_t>(t.GetDuration().GetCount()) /
+               static_cast<uint64_t>(resolution_.GetCount());
+    }
+
+    /**
+     * @brief Insert an event.
+     *
+     * @tparam Target `Ptr<IEventSink<>>` or `EventCallable`.
+     */
+    template<class Target>
+    Ptr<IEventHandle> Insert(const TimePoint& t, Target&& target)
+    {
+        TimePoint now = clock_->Now();
+        if (t < now)
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidArgument() <<
+                ErrorMessage("Cannot schedule an event that "
+                             "happens before the current time.") <<
+                CurrentTimeErrorInfo(now) <<
+                ScheduledTimeErrorInfo(t));
+        }
+        // The ticks before the tick event are empty, and they are skipped.
+        uint64_t tick = GetTick(now);
+        if (tick_ && tick >= tickAt_)
+        {
+            tick = tickAt_ - 1;
+        }
+        if (cur_ < tick)
+        {
+            cur_ = tick;
+        }
+        uint64_t e = GetTick(t);
+        if (e <= cur_ || e - cur_ >= SPAN)
+        {
+            return ScheduleDirectly(t, std::move(target));
+        }
+        HandleType* handle = pool_.Allocate(nextEventId_, t, std::move(target));
+        try
+        {
+            Place(handle, e);
+        }
+        catch (std::bad_alloc& )
+        {
+            handle->Cancel();
+            pool_.Deallocate(handle);
+            throw;
+        }
+        ++nextEventId_;
+        ++numTimers_;
+        handle->SetOwner(this);
+        uint64_t at = GetCascadeTick(handle->GetIndex() & SLOT_INDEX_MASK, e);
+        if (!tick_ || at < tickAt_)
+        {
+            try
+            {
+                ScheduleTick(at);
+            }
+            catch (...)
+            {
+                handle->Cancel();
+                throw;
+            }
+        }
+        return handle->GetIntf();
+    }
+
+    Ptr<IEventHandle> ScheduleDirectly(const TimePoint& t,
+                                       Ptr<IEventSink<>>&& sink)
+    {
+        return scheduler_->ScheduleAt(t, std::move(sink));
+    }
+
+    Ptr<IEventHandle> ScheduleDirectly(const TimePoint& t,
+                                       EventCallable&& callable)
+    {
+        if (!callableScheduler_)
+        {
+            BOOST_THROW_EXCEPTION(
+                IllegalMethodCall() <<
+                ErrorMessage("The backing scheduler does not support "
+                             "callables."));
+        }
+        return callableScheduler_->ScheduleCallableAt(t, std::move(callable));
+    }
+
+    // Wheels. /*{{{*/
+private:
+    enum
+    {
+        /**
+         * @brief The mask of the slot in the index of an event.
+         *
+         * A slot is identified by `level * NUM_SLOTS + slot index`.
+         */
+        SLOT_INDEX_MASK = (1 << POS_SHIFT) - 1,
+    };
+
+    /**
+     * @brief Put an event into the wheels.
+     *
+     * @param[in] e The tick of the event, which is later than the current
+     *              tick, and within the span of the wheels.
+     */
+    void Place(HandleType* handle, uint64_t e)
+    {
+        uint64_t delta = e - cur_;
+        size_t level = 0;
+        while (delta >> (SLOT_BITS * (level + 1)))
+        {
+            ++level;
+        }
+        BOOST_ASSERT(level < NUM_LEVELS);
+        size_t index = static_cast<size_t>(e >> (SLOT_BITS * level)) & SLOT_MASK;
+        size_t s = level * NUM_SLOTS + index;
+        vector<HandleType*>& slot = slots_[s];
+        slot.push_back(handle);
+        handle->SetIndex(((slot.size() - 1) << POS_SHIFT) | s);
+        bitmaps_[level] |= uint64_t(1) << index;
+    }
+
+    /**
+     * @brief Remove an event from the wheels.
+     */
+    void Unlink(HandleType* handle) BOOST_NOEXCEPT
+    {
+        size_t s = handle->GetIndex() & SLOT_INDEX_MASK;
+        size_t pos = handle->GetIndex() >> POS_SHIFT;
+        vector<HandleType*>& slot = slots_[s];
+        BOOST_ASSERT(slot[pos] == handle);
+        if (pos + 1 < slot.size())
+        {
+            slot[pos] = slot.back();
+            slot[pos]->SetIndex((pos << POS_SHIFT) | s);
+        }
+        slot.pop_back();
+        if (slot.empty())
+        {
+            bitmaps_[s / NUM_SLOTS] &= ~(uint64_t(1) << (s % NUM_SLOTS));
+        }
+    }
+
+    /**
+     * @brief Get the tick when the events in a slot are due or cascaded.
+     *
+     * @param[in] s The slot.
+     * @param[in] e The tick of an event in the slot.
+     */
+    static uint64_t GetCascadeTick(size_t s, uint64_t e) BOOST_NOEXCEPT
+    {
+        size_t shift = SLOT_BITS * (s / NUM_SLOTS);
+        return (e >> shift) << shift;
+    }
+
+    /**
+     * @brief Get the next tick after the current tick that has events to
+     *        move or to cascade.
+     *
+     * The wheels **must not** be empty.
+     */
+    uint64_t GetNextTick(void) const BOOST_NOEXCEPT
+    {
+        uint64_t next = ~uint64_t(0);
+        for (size_t level = 0; level < NUM_LEVELS; ++level)
+        {
+            uint64_t bitmap = bitmaps_[level];
+            if (bitmap)
+            {
+                size_t shift = SLOT_BITS * level;
+                uint64_t base = (cur_ >> shift) + 1;
+                size_t r = static_cast<size_t>(base & SLOT_MASK);
+                // Rotate the bitmap, so the slot of base becomes the lowest bit.
+                if (r)
+                {
+                    bitmap = (bitmap >> r) | (bitmap << (NUM_SLOTS - r));
+                }
+                uint64_t at = (base + FindFirstSet(bitmap)) << shift;
+                if (at < next)
+                {
+                    next = at;
+                }
+            }
+        }
+        return next;
+    }
+
+    static size_t FindFirstSet(uint64_t bitmap) BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT(bitmap);
+#if defined(__GNUC__)
+        return static_cast<size_t>(__builtin_ctzll(bitmap));
+#elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long index;
+        _BitScanForward64(&index, bitmap);
+        return index;
+#else
+        size_t index = 0;
+        while (!(bitmap & 1))
+        {
+            bitmap >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    /*}}}*/
+
+    // Tick events. /*{{{*/
+private:
+    /**
+     * @brief Schedule the tick event.
+     *
+     * The pending tick event is cancelled.
+     */
+    void ScheduleTick(uint64_t at)
+    {
+        Ptr<IEventHandle> tick = scheduler_->ScheduleAt(
+            TimePoint(resolution_ * static_cast<chrono::count_t>(at)), tickSink_);
+        CancelTick();
+        tick_ = std::move(tick);
+        tickAt_ = at;
+    }
+
+    void CancelTick(void)
+    {
+        if (tick_)
+        {
+            tick_->Cancel();
+            tick_ = nullptr;
+        }
+    }
+
+    /**
+     * @brief Move the due events into the backing scheduler, and cascade the
+     *        events in the outer wheels.
+     */
+    void OnTick(void)
+    {
+        tick_ = nullptr;
+        cur_ = tickAt_;
+        // Cascade from the outermost wheel, so the events can be cascaded
+        // level by level in the same tick.
+        for (size_t level = NUM_LEVELS - 1; level > 0; --level)
+        {
+            size_t shift = SLOT_BITS * level;
+            if (!(cur_ & ((uint64_t(1) << shift) - 1)))
+            {
+                size_t index = static_cast<size_t>(cur_ >> shift) & SLOT_MASK;
+                if (bitmaps_[level] & (uint64_t(1) << index))
+                {
+                    cascaded_.swap(slots_[level * NUM_SLOTS + index]);
+                    bitmaps_[level] &= ~(uint64_t(1) << index);
+                    for (auto it = cascaded_.begin(); it != cascaded_.end(); ++it)
+                    {
+                        uint64_t e = GetTick((*it)->EventHandle::GetTimePoint());
+                        if (e <= cur_)
+                        {
+                            due_.push_back(*it);
+                        }
+                        else
+                        {
+                            Place(*it, e);
+                        }
+                    }
+                    cascaded_.clear();
+                }
+            }
+        }
+        size_t index = static_cast<size_t>(cur_) & SLOT_MASK;
+        if (bitmaps_[0] & (uint64_t(1) << index))
+        {
+            vector<HandleType*>& slot = slots_[index];
+            due_.insert(due_.end(), slot.begin(), slot.end());
+            slot.clear();
+            bitmaps_[0] &= ~(uint64_t(1) << index);
+        }
+        // Move the due events in the order of their time points and ids.
+        std::sort(due_.begin(), due_.end(),
+                  [] (const HandleType* lhs, const HandleType* rhs) {
+                      return *lhs < *rhs;
+                  });
+        // The due events are later than the events in moved_.
+        for (auto it = due_.begin(); it != due_.end(); ++it)
+        {
+            HandleType* handle = *it;
+            handle->SetIndex(MOVED | (popped_ + moved_.size()));
+            moved_.push_back(handle);
+            --numTimers_;
+            ++numMoved_;
+        }
+        due_.clear();
+        if (numTimers_)
+        {
+            ScheduleTick(GetNextTick());
+        }
+        ScheduleRelay();
+    }
+
+    /*}}}*/
+
+    // Relay event. /*{{{*/
+private:
+    /**
+     * @brief Schedule the relay event for the earliest moved event.
+     *
+     * It does nothing if the relay event is pending, or there is no moved
+     * event.
+     */
+    void ScheduleRelay(void)
+    {
+        if (!relay_ && numMoved_)
+        {
+            BOOST_ASSERT(moved_.front());
+            relay_ = scheduler_->ScheduleAt(
+                moved_.front()->EventHandle::GetTimePoint(), relaySink_);
+        }
+    }
+
+    void CancelRelay(void) BOOST_NOEXCEPT
+    {
+        if (relay_)
+        {
+            relay_->Cancel();
+            relay_ = nullptr;
+        }
+    }
+
+    /**
+     * @brief Fire the earliest moved event.
+     */
+    void OnRelay(void)
+    {
+        // Release the relay event, so the backing scheduler can reuse it.
+        relay_ = nullptr;
+        BOOST_ASSERT(numMoved_);
+        HandleType* handle = moved_.front();
+        BOOST_ASSERT(handle->EventHandle::GetTimePoint() == clock_->Now());
+        moved_.pop_front();
+        ++popped_;
+        --numMoved_;
+        PopCancelled();
+        handle->SetOwner(nullptr);
+        try
+        {
+            // Schedule the relay event for the next moved event before the
+            // event is fired, so the next moved event that happens at the
+            // same time is fired before the events scheduled by this event.
+            ScheduleRelay();
+        }
+        catch (std::bad_alloc& )
+        {
+            // The relay event is scheduled by GetNextEvent() or
+            // FireAndRemoveNextEvent() later.
+        }
+        try
+        {
+            handle->Fire();
+        }
+        catch (...)
+        {
+            pool_.Deallocate(handle);
+            throw;
+        }
+        pool_.Deallocate(handle);
+    }
+
+    /**
+     * @brief Pop the cancelled events at the front of moved_.
+     */
+    void PopCancelled(void) BOOST_NOEXCEPT
+    {
+        while (moved_.size() && !moved_.front())
+        {
+            moved_.pop_front();
+            ++popped_;
+        }
+    }
+
+    /*}}}*/
+
+    // EventHandleOwner /*{{{*/
+private:
+    virtual void OnEventCancelled(EventHandle* handle) BOOST_NOEXCEPT NSFX_OVERRIDE
+    {
+        HandleType* event = static_cast<HandleType*>(handle);
+        size_t index = event->GetIndex();
+        if (index & MOVED)
+        {
+            size_t pos = (index & ~MOVED) - popped_;
+            BOOST_ASSERT(moved_[pos] == event);
+            moved_[pos] = nullptr;
+            --numMoved_;
+            // The relay event is for the front of moved_.
+            // It is scheduled for the next moved event by GetNextEvent() or
+            // FireAndRemoveNextEvent(), since this function cannot throw.
+            if (!pos)
+            {
+                CancelRelay();
+                PopCancelled();
+            }
+        }
+        else
+        {
+            Unlink(event);
+            --numTimers_;
+            // Do not keep the tick event for empty wheels, since it would
+            // advance the clock.
+            if (!numTimers_)
+            {
+                CancelTick();
+            }
+        }
+        pool_.Deallocate(event);
+    }
+
+    /*}}}*/
+
+private:
+    NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+        NSFX_INTERFACE_ENTRY(IClockUser)
+        NSFX_INTERFACE_ENTRY(ISchedulerUser)
+        NSFX_INTERFACE_ENTRY(IScheduler)
+        NSFX_INTERFACE_ENTRY(ICallableScheduler)
+        NSFX_INTERFACE_ENTRY(ITimerWheel)
+    NSFX_INTERFACE_MAP_END()
+
+private:
+    Ptr<IClock>  clock_;
+    Ptr<IScheduler>  scheduler_;
+    Ptr<ICallableScheduler>  callableScheduler_;
+    Duration  resolution_;
+    event_id_t  nextEventId_;
+
+    /**
+     * @brief The current tick.
+     *
+     * The events at or before the current tick are not in the wheels.
+     */
+    uint64_t  cur_;
+    uint64_t  numTimers_;
+    uint64_t  bitmaps_[NUM_LEVELS];
+    vector<HandleType*>  slots_[NUM_LEVELS * NUM_SLOTS];
+    vector<HandleType*>  cascaded_;
+    vector<HandleType*>  due_;
+
+    Ptr<IEventSink<>>  tickSink_;
+    Ptr<IEventHandle>  tick_;
+    uint64_t  tickAt_;
+
+    Ptr<IEventSink<>>  relaySink_;
+    /**
+     * @brief The relay event of the front of `moved_`.
+     */
+    Ptr<IEventHandle>  relay_;
+    /**
+     * @brief The events that have been moved out of the wheels.
+     *
+     * The cancelled events are `nullptr`, and the front is not cancelled.
+     */
+    deque<HandleType*>  moved_;
+    uint64_t  numMoved_;
+    /**
+     * @brief The number of events that have been popped from `moved_`.
+     */
+    size_t  popped_;
+
+    EventHandlePool  pool_;
+
+};
+
+
+NSFX_REGISTER_CLASS(TimerWheelScheduler, "edu.uestc.nsfx.TimerWheelScheduler");
+
+
+NSFX_CLOSE_NAMESPACE
+
+
+#endif // TIMER_WHEEL_SCHEDULER_H__9BDC5E1D_116E_4D20_AB0B_38FAEFEBC320
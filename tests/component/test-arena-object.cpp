@@ -0,0 +1,341 @@
+/**
+ * @file
+ *
+ * @brief Test ArenaObject and bulk object creation.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/component/arena-object.h>
+#include <nsfx/component/class-registry.h>
+#include <nsfx/component/ptr.h>
+#include <iostream>
+#include <chrono>
+#include <stdexcept>
+
+
+NSFX_TEST_SUITE(ArenaObject)
+{
+    using nsfx::refcount_t;
+
+    struct INode : virtual nsfx::IObject/*{{{*/
+    {
+        virtual ~INode(void) {}
+
+        virtual int GetId(void) = 0;
+        virtual void SetId(int id) = 0;
+    };/*}}}*/
+
+    NSFX_DEFINE_CLASS_UID(INode, "edu.uestc.nsfx.test.INode");
+
+    static int numLive = 0;
+    static int numFailAt = -1;
+
+    struct Node : INode/*{{{*/
+    {
+        Node(void) : id_(0)
+        {
+            if (numLive == numFailAt)
+            {
+                throw std::runtime_error("Failed to construct a node.");
+            }
+            ++numLive;
+        }
+
+        Node(int id) : id_(id)
+        {
+            ++numLive;
+        }
+
+        virtual ~Node(void)
+        {
+            --numLive;
+        }
+
+        virtual int GetId(void) NSFX_OVERRIDE
+        {
+            return id_;
+        }
+
+        virtual void SetId(int id) NSFX_OVERRIDE
+        {
+            id_ = id;
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Node)
+            NSFX_INTERFACE_ENTRY(INode)
+        NSFX_INTERFACE_MAP_END()
+
+        int id_;
+    };/*}}}*/
+
+    NSFX_REGISTER_CLASS(Node, "edu.uestc.nsfx.test.Node");
+
+    refcount_t RefCount(nsfx::IObject* p)/*{{{*/
+    {
+        refcount_t result = 0;
+        if (p)
+        {
+            p->AddRef();
+            result = p->Release();
+        }
+        return result;
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Create)/*{{{*/
+    {
+        typedef nsfx::ArenaObject<Node>  NodeClass;
+        numLive = 0;
+        {
+            nsfx::vector<nsfx::Ptr<NodeClass>> nodes =
+                nsfx::CreateArenaObjects<Node>(10, 7);
+            NSFX_TEST_ASSERT_EQ(nodes.size(), 10);
+            NSFX_TEST_EXPECT_EQ(numLive, 10);
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(RefCount(nodes[i].Get()), 1);
+                NSFX_TEST_EXPECT_EQ(nodes[i]->GetId(), 7);
+                // Stored contiguously.
+                if (i)
+                {
+                    NSFX_TEST_EXPECT_EQ(
+                        reinterpret_cast<char*>(nodes[i].Get()) -
+                        reinterpret_cast<char*>(nodes[i-1].Get()),
+                        sizeof (NodeClass));
+                }
+            }
+
+            // Release in an arbitrary order.
+            nsfx::Ptr<INode> keep(nodes[5]);
+            nodes[3] = nullptr;
+            NSFX_TEST_EXPECT_EQ(numLive, 9);
+            nodes.clear();
+            NSFX_TEST_EXPECT_EQ(numLive, 1);
+            NSFX_TEST_EXPECT_EQ(RefCount(keep.Get()), 1);
+            keep->SetId(5);
+            NSFX_TEST_EXPECT_EQ(keep->GetId(), 5);
+        }
+        NSFX_TEST_EXPECT_EQ(numLive, 0);
+
+        NSFX_TEST_EXPECT(nsfx::CreateArenaObjects<Node>(0).empty());
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Exception)/*{{{*/
+    {
+        numLive = 0;
+        numFailAt = 5;
+        try
+        {
+            nsfx::CreateArenaObjects<Node>(10);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (std::runtime_error& )
+        {
+            // Should come here.
+        }
+        numFailAt = -1;
+        NSFX_TEST_EXPECT_EQ(numLive, 0);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Registry)/*{{{*/
+    {
+        numLive = 0;
+        try
+        {
+            nsfx::vector<nsfx::Ptr<INode>> nodes =
+                nsfx::CreateObjects<INode>("edu.uestc.nsfx.test.Node", 100);
+            NSFX_TEST_ASSERT_EQ(nodes.size(), 100);
+            NSFX_TEST_EXPECT_EQ(numLive, 100);
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(RefCount(nodes[i].Get()), 1);
+                nodes[i]->SetId(static_cast<int>(i));
+            }
+            nodes.clear();
+            NSFX_TEST_EXPECT_EQ(numLive, 0);
+
+            // The interface is not supported.
+            try
+            {
+                nsfx::CreateObjects<nsfx::IClassFactory>(
+                    "edu.uestc.nsfx.test.Node", 10);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::NoInterface& )
+            {
+                // Should come here.
+            }
+            NSFX_TEST_EXPECT_EQ(numLive, 0);
+
+            // The class is not registered.
+            try
+            {
+                nsfx::CreateObjects<INode>("edu.uestc.nsfx.test.None", 10);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::ClassNotRegistered& )
+            {
+                // Should come here.
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    // A factory that does not create objects in bulk.
+    struct NodeFactory : nsfx::IClassFactory/*{{{*/
+    {
+        virtual ~NodeFactory(void) {}
+
+        virtual nsfx::Ptr<nsfx::IObject>
+        CreateObject(nsfx::IObject* /*controller*/) NSFX_OVERRIDE
+        {
+            return nsfx::Ptr<nsfx::IObject>(new nsfx::Object<Node>(1));
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(NodeFactory)
+            NSFX_INTERFACE_ENTRY(nsfx::IClassFactory)
+        NSFX_INTERFACE_MAP_END()
+    };/*}}}*/
+
+    NSFX_TEST_CASE(Fallback)/*{{{*/
+    {
+        numLive = 0;
+        try
+        {
+            nsfx::RegisterClassFactory<NodeFactory>("edu.uestc.nsfx.test.Node1");
+            nsfx::vector<nsfx::Ptr<INode>> nodes =
+                nsfx::CreateObjects<INode>("edu.uestc.nsfx.test.Node1", 10);
+            NSFX_TEST_ASSERT_EQ(nodes.size(), 10);
+            NSFX_TEST_EXPECT_EQ(numLive, 10);
+            NSFX_TEST_EXPECT_EQ(nodes[9]->GetId(), 1);
+            nodes.clear();
+            NSFX_TEST_EXPECT_EQ(numLive, 0);
+            nsfx::UnregisterClassFactory("edu.uestc.nsfx.test.Node1");
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    static int numBrokenCtors = 0;
+
+    // A class that queries an interface its dependency does not provide.
+    struct BrokenNode : INode/*{{{*/
+    {
+        BrokenNode(void)
+        {
+            ++numBrokenCtors;
+            nsfx::Ptr<nsfx::IObject> dependency(new nsfx::Object<Node>(1));
+            nsfx::Ptr<nsfx::IClassFactory> factory(dependency);
+        }
+
+        virtual ~BrokenNode(void) {}
+
+        virtual int GetId(void) NSFX_OVERRIDE
+        {
+            return 0;
+        }
+
+        virtual void SetId(int /*id*/) NSFX_OVERRIDE
+        {
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(BrokenNode)
+            NSFX_INTERFACE_ENTRY(INode)
+        NSFX_INTERFACE_MAP_END()
+    };/*}}}*/
+
+    NSFX_REGISTER_CLASS(BrokenNode, "edu.uestc.nsfx.test.BrokenNode");
+
+    NSFX_TEST_CASE(ConstructorThrows)/*{{{*/
+    {
+        numLive = 0;
+        numBrokenCtors = 0;
+        // The exception is not mistaken for the lack of IBulkClassFactory,
+        // thus the objects are not created again one by one.
+        try
+        {
+            nsfx::CreateObjects<INode>("edu.uestc.nsfx.test.BrokenNode", 10);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::NoInterface& )
+        {
+            // Should come here.
+        }
+        NSFX_TEST_EXPECT_EQ(numBrokenCtors, 1);
+        NSFX_TEST_EXPECT_EQ(numLive, 0);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // Build, visit and tear down a large topology.
+        const size_t n = 100000;
+        const int rounds = 10;
+        double secs[2] = { 0, 0 };
+        int sum[2] = { 0, 0 };
+        for (int r = 0; r < rounds; ++r)
+        {
+            for (int k = 0; k < 2; ++k)
+            {
+                auto t0 = std::chrono::steady_clock::now();
+                {
+                    nsfx::vector<nsfx::Ptr<INode>> nodes;
+                    if (k == 0)
+                    {
+                        nodes.reserve(n);
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            nodes.emplace_back(nsfx::CreateObject<INode>(
+                                "edu.uestc.nsfx.test.Node"));
+                        }
+                    }
+                    else
+                    {
+                        nodes = nsfx::CreateObjects<INode>(
+                            "edu.uestc.nsfx.test.Node", n);
+                    }
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        nodes[i]->SetId(1);
+                    }
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        sum[k] += nodes[i]->GetId();
+                    }
+                }
+                auto t1 = std::chrono::steady_clock::now();
+                secs[k] += std::chrono::duration<double>(t1 - t0).count();
+            }
+        }
+        NSFX_TEST_EXPECT_EQ(sum[0], sum[1]);
+        std::cout << "CreateObject():  "
+                  << static_cast<uint64_t>(rounds * n / secs[0])
+                  << " objects per second." << std::endl;
+        std::cout << "CreateObjects(): "
+                  << static_cast<uint64_t>(rounds * n / secs[1])
+                  << " objects per second." << std::endl;
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
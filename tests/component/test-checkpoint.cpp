@@ -0,0 +1,246 @@
+/**
+ * @file
+ *
+ * @brief Test Checkpoint.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/component/checkpoint.h>
+#include <nsfx/component/object.h>
+#include <iostream>
+#include <sstream>
+#include <limits>
+
+
+NSFX_TEST_SUITE(Checkpoint)
+{
+    using nsfx::Ptr;
+
+    struct Counter :/*{{{*/
+        nsfx::ICheckpointable
+    {
+        Counter(void) : n_(0), name_() {}
+        virtual ~Counter(void) {}
+
+        virtual void SaveCheckpoint(nsfx::CheckpointWriter& writer) NSFX_OVERRIDE
+        {
+            writer.WriteInt64(n_);
+            writer.WriteString(name_);
+        }
+
+        virtual void RestoreCheckpoint(nsfx::CheckpointReader& reader) NSFX_OVERRIDE
+        {
+            n_ = reader.ReadInt64();
+            name_ = reader.ReadString();
+        }
+
+        int64_t n_;
+        std::string name_;
+
+        NSFX_INTERFACE_MAP_BEGIN(Counter)
+            NSFX_INTERFACE_ENTRY(nsfx::ICheckpointable)
+        NSFX_INTERFACE_MAP_END()
+    };/*}}}*/
+
+    NSFX_TEST_CASE(Stream)/*{{{*/
+    {
+        std::stringstream ss;
+        {
+            // A small buffer to test the flushes.
+            nsfx::CheckpointWriter writer(ss, 64);
+            writer.WriteUint64(0);
+            writer.WriteUint64(127);
+            writer.WriteUint64(128);
+            writer.WriteUint64((std::numeric_limits<uint64_t>::max)());
+            writer.WriteInt64(-1);
+            writer.WriteInt64((std::numeric_limits<int64_t>::min)());
+            writer.WriteInt64((std::numeric_limits<int64_t>::max)());
+            writer.WriteUint32(0xffffffff);
+            writer.WriteInt32(-2);
+            writer.WriteBool(true);
+            writer.WriteBool(false);
+            writer.WriteDouble(-1.5);
+            writer.WriteString(std::string(200, 'x'));
+            writer.WriteString("");
+            NSFX_TEST_EXPECT_EQ(writer.GetNumBytes(), 1 + 1 + 2 + 10 + 1 +
+                                10 + 10 + 5 + 1 + 1 + 1 + 8 + 202 + 1);
+            writer.Flush();
+        }
+        nsfx::CheckpointReader reader(ss, nullptr, 64);
+        NSFX_TEST_EXPECT_EQ(reader.ReadUint64(), 0);
+        NSFX_TEST_EXPECT_EQ(reader.ReadUint64(), 127);
+        NSFX_TEST_EXPECT_EQ(reader.ReadUint64(), 128);
+        NSFX_TEST_EXPECT_EQ(reader.ReadUint64(),
+                            (std::numeric_limits<uint64_t>::max)());
+        NSFX_TEST_EXPECT_EQ(reader.ReadInt64(), -1);
+        NSFX_TEST_EXPECT_EQ(reader.ReadInt64(),
+                            (std::numeric_limits<int64_t>::min)());
+        NSFX_TEST_EXPECT_EQ(reader.ReadInt64(),
+                            (std::numeric_limits<int64_t>::max)());
+        NSFX_TEST_EXPECT_EQ(reader.ReadUint32(), 0xffffffff);
+        NSFX_TEST_EXPECT_EQ(reader.ReadInt32(), -2);
+        NSFX_TEST_EXPECT(reader.ReadBool());
+        NSFX_TEST_EXPECT(!reader.ReadBool());
+        NSFX_TEST_EXPECT_EQ(reader.ReadDouble(), -1.5);
+        NSFX_TEST_EXPECT(reader.ReadString() == std::string(200, 'x'));
+        NSFX_TEST_EXPECT(reader.ReadString().empty());
+        // End of the checkpoint.
+        try
+        {
+            reader.ReadUint64();
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::BadCheckpoint& )
+        {
+            // Should come here.
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(InvalidData)/*{{{*/
+    {
+        // An integer that is too large.
+        {
+            std::stringstream ss;
+            {
+                nsfx::CheckpointWriter writer(ss);
+                writer.WriteUint64(0x100000000ULL);
+            }
+            nsfx::CheckpointReader reader(ss);
+            try
+            {
+                reader.ReadUint32();
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadCheckpoint& )
+            {
+                // Should come here.
+            }
+        }
+        // An integer that does not terminate.
+        {
+            std::stringstream ss(std::string(11, '\xff'));
+            nsfx::CheckpointReader reader(ss);
+            try
+            {
+                reader.ReadUint64();
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadCheckpoint& )
+            {
+                // Should come here.
+            }
+        }
+        // An invalid boolean.
+        {
+            std::stringstream ss("\x02");
+            nsfx::CheckpointReader reader(ss);
+            try
+            {
+                reader.ReadBool();
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadCheckpoint& )
+            {
+                // Should come here.
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(SaveRestore)/*{{{*/
+    {
+        Ptr<Counter> c1(new nsfx::Object<Counter>);
+        Ptr<Counter> c2(new nsfx::Object<Counter>);
+        c1->n_ = -123456789;
+        c1->name_ = "c1";
+        c2->n_ = 42;
+        c2->name_ = "c2";
+        nsfx::Checkpoint checkpoint;
+        checkpoint.Add("c1", Ptr<nsfx::ICheckpointable>(c1));
+        checkpoint.Add("c2", Ptr<nsfx::ICheckpointable>(c2));
+        try
+        {
+            checkpoint.Add("c1", Ptr<nsfx::ICheckpointable>(c2));
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+        std::stringstream ss;
+        checkpoint.Save(ss);
+        std::string data = ss.str();
+
+        c1->n_ = 0;
+        c1->name_.clear();
+        c2->n_ = 0;
+        c2->name_.clear();
+        checkpoint.Restore(ss);
+        NSFX_TEST_EXPECT_EQ(c1->n_, -123456789);
+        NSFX_TEST_EXPECT(c1->name_ == "c1");
+        NSFX_TEST_EXPECT_EQ(c2->n_, 42);
+        NSFX_TEST_EXPECT(c2->name_ == "c2");
+
+        // Not a checkpoint.
+        {
+            std::stringstream bad("NOTACKPT");
+            try
+            {
+                checkpoint.Restore(bad);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadCheckpoint& )
+            {
+                // Should come here.
+            }
+        }
+        // Truncated.
+        {
+            std::stringstream bad(data.substr(0, data.size() - 1));
+            try
+            {
+                checkpoint.Restore(bad);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadCheckpoint& )
+            {
+                // Should come here.
+            }
+        }
+        // The objects do not match.
+        {
+            nsfx::Checkpoint other;
+            other.Add("c2", Ptr<nsfx::ICheckpointable>(c2));
+            other.Add("c1", Ptr<nsfx::ICheckpointable>(c1));
+            std::stringstream is(data);
+            try
+            {
+                other.Restore(is);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadCheckpoint& )
+            {
+                // Should come here.
+            }
+        }
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
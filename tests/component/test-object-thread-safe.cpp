@@ -0,0 +1,186 @@
+/**
+ * @file
+ *
+ * @brief Test Object with atomic reference counts.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#define NSFX_COMPONENT_THREAD_SAFE
+
+#include <nsfx/test.h>
+#include <nsfx/component/object.h>
+#include <nsfx/component/ptr.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+
+NSFX_TEST_SUITE(ThreadSafeObject)
+{
+    using nsfx::refcount_t;
+
+    struct ITest :/*{{{*/
+        virtual nsfx::IObject
+    {
+        virtual ~ITest(void) {}
+
+        virtual refcount_t GetRefCount(void) = 0;
+    };/*}}}*/
+
+    NSFX_DEFINE_CLASS_UID(ITest, "edu.uestc.nsfx.test.ITest");
+
+    static std::atomic<int> deallocated(0);
+
+    struct Test :/*{{{*/
+        ITest
+    {
+        virtual ~Test(void)
+        {
+            ++deallocated;
+        }
+
+        virtual refcount_t GetRefCount(void)
+        {
+            AddRef();
+            return Release();
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Test)
+            NSFX_INTERFACE_ENTRY(ITest)
+        NSFX_INTERFACE_MAP_END()
+
+    };/*}}}*/
+
+    struct Wedge :/*{{{*/
+        nsfx::IObject
+    {
+        Wedge(void) :
+            test_(/* controller = */this)
+        {}
+
+        virtual ~Wedge(void)
+        {
+            ++deallocated;
+        }
+
+        ITest* GetTest(void)
+        {
+            return test_.GetImpl();
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Wedge)
+            NSFX_INTERFACE_AGGREGATED_ENTRY(ITest, &test_)
+        NSFX_INTERFACE_MAP_END()
+
+        nsfx::MemberAggObject<Test> test_;
+
+    };/*}}}*/
+
+    NSFX_TEST_CASE(RefCount)/*{{{*/
+    {
+        deallocated = 0;
+        {
+            nsfx::Ptr<ITest> p(new nsfx::Object<Test>);
+            NSFX_TEST_EXPECT_EQ(p->GetRefCount(), 1);
+            nsfx::Ptr<ITest> q(p);
+            NSFX_TEST_EXPECT_EQ(p->GetRefCount(), 2);
+            q.Reset();
+            NSFX_TEST_EXPECT_EQ(p->GetRefCount(), 1);
+        }
+        NSFX_TEST_EXPECT_EQ(deallocated.load(), 1);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Share)/*{{{*/
+    {
+        deallocated = 0;
+        const int numThreads = 4;
+        const int numCopies = 200000;
+        {
+            nsfx::Ptr<ITest> p(new nsfx::Object<Test>);
+            nsfx::Ptr<nsfx::Object<Wedge>> w(new nsfx::Object<Wedge>);
+            nsfx::Ptr<ITest> q(w->GetImpl()->GetTest());
+            w.Reset();
+            std::vector<std::thread> threads;
+            for (int k = 0; k < numThreads; ++k)
+            {
+                // Each thread holds its own copies.
+                nsfx::Ptr<ITest> pk(p);
+                nsfx::Ptr<ITest> qk(q);
+                threads.emplace_back([pk, qk] {
+                    std::vector<nsfx::Ptr<ITest>> v(16);
+                    for (int i = 0; i < numCopies; ++i)
+                    {
+                        v[i & 15] = (i & 1) ? pk : qk;
+                    }
+                });
+            }
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+            NSFX_TEST_EXPECT_EQ(p->GetRefCount(), 1);
+            NSFX_TEST_EXPECT_EQ(q->GetRefCount(), 1);
+            NSFX_TEST_EXPECT_EQ(deallocated.load(), 0);
+        }
+        // The object, the wedge and its member object.
+        NSFX_TEST_EXPECT_EQ(deallocated.load(), 3);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Release)/*{{{*/
+    {
+        // The last reference is released by any thread.
+        deallocated = 0;
+        const int numObjects = 10000;
+        std::vector<nsfx::Ptr<ITest>> v0;
+        std::vector<nsfx::Ptr<ITest>> v1;
+        for (int i = 0; i < numObjects; ++i)
+        {
+            v0.emplace_back(new nsfx::Object<Test>);
+        }
+        v1 = v0;
+        std::thread t0([&] { v0.clear(); });
+        std::thread t1([&] { v1.clear(); });
+        t0.join();
+        t1.join();
+        NSFX_TEST_EXPECT_EQ(deallocated.load(), numObjects);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // Compare with Object/Performance, which uses plain reference counts.
+        nsfx::Ptr<ITest> p(new nsfx::Object<Test>);
+        std::vector<nsfx::Ptr<ITest>> v(16);
+        const int n = 10000000;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; ++i)
+        {
+            v[i & 15] = p;
+            v[(i + 8) & 15] = nullptr;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double secs = std::chrono::duration<double>(t1 - t0).count();
+        std::cout << "Atomic reference count: "
+                  << static_cast<uint64_t>(n / secs)
+                  << " AddRef/Release pairs per second." << std::endl;
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
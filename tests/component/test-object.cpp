@@ -17,6 +17,8 @@
 #include <nsfx/component/object.h>
 #include <nsfx/component/ptr.h>
 #include <iostream>
+#include <chrono>
+#include <vector>
 
 
 NSFX_TEST_SUITE(Object)
@@ -738,6 +740,82 @@ NSFX_TEST_SUITE(Object)
 
     }/*}}}*/
 
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // Compare with ThreadSafeObject/Performance, which uses atomic
+        // reference counts.
+        nsfx::Ptr<ITest> p(new nsfx::Object<Test>);
+        std::vector<nsfx::Ptr<ITest>> v(16);
+        const int n = 10000000;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; ++i)
+        {
+            v[i & 15] = p;
+            v[(i + 8) & 15] = nullptr;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double secs = std::chrono::duration<double>(t1 - t0).count();
+        std::cout << "Plain reference count: "
+                  << static_cast<uint64_t>(n / secs)
+                  << " AddRef/Release pairs per second." << std::endl;
+    }/*}}}*/
+
+    NSFX_DEFINE_CLASS_UID(class IQuery0, "edu.uestc.nsfx.test.IQuery0");
+    NSFX_DEFINE_CLASS_UID(class IQuery1, "edu.uestc.nsfx.test.IQuery1");
+    NSFX_DEFINE_CLASS_UID(class IQuery2, "edu.uestc.nsfx.test.IQuery2");
+    NSFX_DEFINE_CLASS_UID(class IQuery3, "edu.uestc.nsfx.test.IQuery3");
+    NSFX_DEFINE_CLASS_UID(class IQuery4, "edu.uestc.nsfx.test.IQuery4");
+    NSFX_DEFINE_CLASS_UID(class IQuery5, "edu.uestc.nsfx.test.IQuery5");
+    NSFX_DEFINE_CLASS_UID(class IQuery6, "edu.uestc.nsfx.test.IQuery6");
+    NSFX_DEFINE_CLASS_UID(class IQuery7, "edu.uestc.nsfx.test.IQuery7");
+
+    class IQuery0 : virtual public nsfx::IObject {};
+    class IQuery1 : virtual public nsfx::IObject {};
+    class IQuery2 : virtual public nsfx::IObject {};
+    class IQuery3 : virtual public nsfx::IObject {};
+    class IQuery4 : virtual public nsfx::IObject {};
+    class IQuery5 : virtual public nsfx::IObject {};
+    class IQuery6 : virtual public nsfx::IObject {};
+    class IQuery7 : virtual public nsfx::IObject {};
+
+    struct Query :/*{{{*/
+        IQuery0, IQuery1, IQuery2, IQuery3,
+        IQuery4, IQuery5, IQuery6, IQuery7
+    {
+        virtual ~Query(void) {}
+
+        NSFX_INTERFACE_MAP_BEGIN(Query)
+            NSFX_INTERFACE_ENTRY(IQuery0)
+            NSFX_INTERFACE_ENTRY(IQuery1)
+            NSFX_INTERFACE_ENTRY(IQuery2)
+            NSFX_INTERFACE_ENTRY(IQuery3)
+            NSFX_INTERFACE_ENTRY(IQuery4)
+            NSFX_INTERFACE_ENTRY(IQuery5)
+            NSFX_INTERFACE_ENTRY(IQuery6)
+            NSFX_INTERFACE_ENTRY(IQuery7)
+        NSFX_INTERFACE_MAP_END()
+    };/*}}}*/
+
+    NSFX_TEST_CASE(QueryPerformance)/*{{{*/
+    {
+        // Convert smart pointers, which queries the interfaces.
+        nsfx::Ptr<IQuery0> p0(new nsfx::Object<Query>);
+        nsfx::Ptr<IQuery7> p7;
+        const int n = 2000000;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; ++i)
+        {
+            p7 = p0;
+            p0 = p7;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double secs = std::chrono::duration<double>(t1 - t0).count();
+        NSFX_TEST_EXPECT(p7);
+        std::cout << "Query interface: "
+                  << static_cast<uint64_t>(2 * n / secs)
+                  << " queries per second." << std::endl;
+    }/*}}}*/
+
 }
 
 
@@ -16,6 +16,9 @@
 #include <nsfx/test.h>
 #include <nsfx/component/uid.h>
 #include <iostream>
+#include <cstring>
+#include <memory>
+#include <string>
 
 
 NSFX_TEST_SUITE(uid)
@@ -47,6 +50,48 @@ NSFX_TEST_SUITE(uid)
         }
     }
 
+    NSFX_TEST_CASE(Intern)
+    {
+        // A string that is not a string literal.
+        std::string s("edu.uestc.nsfx.test.Object");
+        nsfx::Uid uid(s.c_str());
+        s = "edu.uestc.nsfx.test.Interface";
+        NSFX_TEST_EXPECT(uid == nsfx::uid_of<Object>());
+        NSFX_TEST_EXPECT(uid != nsfx::uid_of<Interface>());
+        NSFX_TEST_EXPECT(uid == "edu.uestc.nsfx.test.Object");
+        // The equal UIDs share the interned string.
+        NSFX_TEST_EXPECT(static_cast<const char*>(uid) ==
+                         static_cast<const char*>(nsfx::uid_of<Object>()));
+        NSFX_TEST_EXPECT(static_cast<const char*>(uid) != s.c_str());
+        NSFX_TEST_EXPECT_EQ(hash_value(uid), hash_value(nsfx::uid_of<Object>()));
+    }
+
+    NSFX_TEST_CASE(Compare)
+    {
+        // A separately allocated copy of the UID string of a class.
+        const char* literal = nsfx::uid_of<Object>();
+        std::unique_ptr<char[]> copy(new char[std::strlen(literal) + 1]);
+        std::strcpy(copy.get(), literal);
+        nsfx::Uid uid(copy.get());
+        NSFX_TEST_EXPECT(uid == nsfx::uid_of<Object>());
+        NSFX_TEST_EXPECT(!(uid != nsfx::uid_of<Object>()));
+
+        // A UID that is constructed in another module has another address.
+        nsfx::aux::UidPool pool;
+        nsfx::Uid other(copy.get(), pool);
+        NSFX_TEST_EXPECT(static_cast<const char*>(other) !=
+                         static_cast<const char*>(nsfx::uid_of<Object>()));
+        NSFX_TEST_EXPECT(other == nsfx::uid_of<Object>());
+        NSFX_TEST_EXPECT(!(other != nsfx::uid_of<Object>()));
+        NSFX_TEST_EXPECT(nsfx::uid_of<Object>() == other);
+        NSFX_TEST_EXPECT(other == "edu.uestc.nsfx.test.Object");
+        NSFX_TEST_EXPECT(other != nsfx::uid_of<Interface>());
+        NSFX_TEST_EXPECT(!(other == nsfx::uid_of<Interface>()));
+        // The hash values do not depend upon the pool.
+        NSFX_TEST_EXPECT_EQ(hash_value(other), hash_value(nsfx::uid_of<Object>()));
+        NSFX_TEST_EXPECT_NE(hash_value(other), hash_value(nsfx::uid_of<Interface>()));
+    }
+
 }
 
 
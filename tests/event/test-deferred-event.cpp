@@ -0,0 +1,306 @@
+/**
+ * @file
+ *
+ * @brief Test DeferredEvent.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/event/deferred-event.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+NSFX_TEST_SUITE(DeferredEvent)
+{
+    NSFX_DEFINE_EVENT_SINK_INTERFACE(
+        IRecordSink, "edu.uestc.nsfx.test.IRecordSink",
+        ( void(int, const std::string&) ));
+
+    NSFX_DEFINE_EVENT_INTERFACE(
+        IRecordEvent, "edu.uestc.nsfx.test.IRecordEvent", IRecordSink);
+
+    typedef nsfx::Object<nsfx::DeferredEvent<IRecordEvent>>  EventClass;
+
+    struct Record
+    {
+        Record(int i, const std::string& s) : i_(i), s_(s) {}
+        int i_;
+        std::string s_;
+    };
+
+    NSFX_TEST_CASE(Flush)/*{{{*/
+    {
+        try
+        {
+            nsfx::Ptr<EventClass> event(new EventClass);
+            auto impl = event->GetImpl();
+            std::vector<Record> records;
+
+            // No sinks.
+            impl->Fire(0, "none");
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 0);
+
+            event->Connect(nsfx::CreateEventSink<IRecordSink>(nullptr,
+                [&] (int i, const std::string& s) {
+                    records.push_back(Record(i, s));
+            }));
+            int requests = 0;
+            impl->SetFlushRequest(nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                nullptr, [&] { ++requests; }));
+
+            {
+                // The arguments are copied.
+                std::string s("a");
+                impl->Fire(1, s);
+                s = "b";
+                impl->Fire(2, s);
+            }
+            impl->Fire(3, "c");
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 3);
+            NSFX_TEST_EXPECT_EQ(requests, 1);
+            NSFX_TEST_EXPECT(records.empty());
+
+            impl->Flush();
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 0);
+            NSFX_TEST_ASSERT_EQ(records.size(), 3);
+            NSFX_TEST_EXPECT_EQ(records[0].i_, 1);
+            NSFX_TEST_EXPECT_EQ(records[0].s_, "a");
+            NSFX_TEST_EXPECT_EQ(records[1].i_, 2);
+            NSFX_TEST_EXPECT_EQ(records[1].s_, "b");
+            NSFX_TEST_EXPECT_EQ(records[2].i_, 3);
+            NSFX_TEST_EXPECT_EQ(records[2].s_, "c");
+
+            // Requested again after a flush.
+            impl->Fire(4, "d");
+            NSFX_TEST_EXPECT_EQ(requests, 2);
+            impl->Flush();
+            NSFX_TEST_EXPECT_EQ(records.size(), 4);
+            impl->Flush();
+            NSFX_TEST_EXPECT_EQ(records.size(), 4);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Drop)/*{{{*/
+    {
+        try
+        {
+            nsfx::Ptr<EventClass> event(new EventClass);
+            auto impl = event->GetImpl();
+            std::vector<int> values;
+            event->Connect(nsfx::CreateEventSink<IRecordSink>(nullptr,
+                [&] (int i, const std::string& ) { values.push_back(i); }));
+            try
+            {
+                impl->SetQueueLimit(0);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::InvalidArgument& )
+            {
+                // Should come here.
+            }
+            impl->SetQueueLimit(4);
+            NSFX_TEST_EXPECT_EQ(impl->GetOverflowPolicy(),
+                                nsfx::DEFERRED_EVENT_DROP);
+            for (int i = 0; i < 10; ++i)
+            {
+                impl->Fire(i, "");
+            }
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 4);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumDropped(), 6);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 4);
+            for (int i = 0; i < 4; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(values[i], i);
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Backpressure)/*{{{*/
+    {
+        try
+        {
+            nsfx::Ptr<EventClass> event(new EventClass);
+            auto impl = event->GetImpl();
+            std::vector<int> values;
+            event->Connect(nsfx::CreateEventSink<IRecordSink>(nullptr,
+                [&] (int i, const std::string& ) { values.push_back(i); }));
+            impl->SetQueueLimit(4);
+            impl->SetOverflowPolicy(nsfx::DEFERRED_EVENT_FLUSH);
+            for (int i = 0; i < 10; ++i)
+            {
+                impl->Fire(i, "");
+            }
+            NSFX_TEST_EXPECT_EQ(values.size(), 8);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 2);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumDropped(), 0);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 10);
+            for (int i = 0; i < 10; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(values[i], i);
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Reentrance)/*{{{*/
+    {
+        try
+        {
+            nsfx::Ptr<EventClass> event(new EventClass);
+            auto impl = event->GetImpl();
+            std::vector<int> values;
+            impl->SetQueueLimit(2);
+            impl->SetOverflowPolicy(nsfx::DEFERRED_EVENT_FLUSH);
+            int requests = 0;
+            impl->SetFlushRequest(nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                nullptr, [&] { ++requests; }));
+            event->Connect(nsfx::CreateEventSink<IRecordSink>(nullptr,
+                [&] (int i, const std::string& ) {
+                    values.push_back(i);
+                    // Fire the event during a flush.
+                    if (i < 10)
+                    {
+                        impl->Fire(i + 10, "");
+                        impl->Fire(i + 20, "");
+                        impl->Fire(i + 30, "");
+                    }
+                    impl->Flush(); // No effect.
+            }));
+            impl->Fire(1, "");
+            impl->Fire(2, "");
+            NSFX_TEST_EXPECT_EQ(requests, 1);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 2);
+            // Queued during the flush, and the rest are dropped.
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 2);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumDropped(), 4);
+            NSFX_TEST_EXPECT_EQ(requests, 2);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 4);
+            NSFX_TEST_EXPECT_EQ(values[2], 11);
+            NSFX_TEST_EXPECT_EQ(values[3], 21);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 0);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(RefillDuringFlush)/*{{{*/
+    {
+        try
+        {
+            nsfx::Ptr<EventClass> event(new EventClass);
+            auto impl = event->GetImpl();
+            std::vector<int> values;
+            impl->SetQueueLimit(2);
+            impl->SetOverflowPolicy(nsfx::DEFERRED_EVENT_FLUSH);
+            event->Connect(nsfx::CreateEventSink<IRecordSink>(nullptr,
+                [&] (int i, const std::string& ) {
+                    values.push_back(i);
+                    // Fill the queue during the overflow flush.
+                    if (i < 10)
+                    {
+                        impl->Fire(i + 10, "");
+                        impl->Fire(i + 20, "");
+                    }
+            }));
+            impl->Fire(1, "");
+            impl->Fire(2, "");
+            // Flush the queue, which is filled again by the sinks.
+            impl->Fire(3, "");
+            NSFX_TEST_ASSERT_EQ(values.size(), 2);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 2);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumDropped(), 3);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 4);
+            NSFX_TEST_EXPECT_EQ(values[2], 11);
+            NSFX_TEST_EXPECT_EQ(values[3], 21);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 0);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(NestedFlush)/*{{{*/
+    {
+        try
+        {
+            nsfx::Ptr<EventClass> event(new EventClass);
+            auto impl = event->GetImpl();
+            std::vector<int> values;
+            int requests = 0;
+            impl->SetFlushRequest(nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                nullptr, [&] { ++requests; }));
+            event->Connect(nsfx::CreateEventSink<IRecordSink>(nullptr,
+                [&] (int i, const std::string& ) {
+                    values.push_back(i);
+                    if (i < 10)
+                    {
+                        impl->Fire(i + 10, "");
+                    }
+                    // Keep the request posted during the flush.
+                    impl->Flush();
+            }));
+            impl->Fire(1, "");
+            impl->Fire(2, "");
+            NSFX_TEST_EXPECT_EQ(requests, 1);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 2);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 2);
+            // One request for the events queued during the flush.
+            NSFX_TEST_EXPECT_EQ(requests, 2);
+            impl->Flush();
+            NSFX_TEST_ASSERT_EQ(values.size(), 4);
+            NSFX_TEST_EXPECT_EQ(values[2], 11);
+            NSFX_TEST_EXPECT_EQ(values[3], 12);
+            NSFX_TEST_EXPECT_EQ(impl->GetNumPending(), 0);
+            NSFX_TEST_EXPECT_EQ(requests, 2);
+            // A new request after the queue is drained.
+            impl->Fire(20, "");
+            NSFX_TEST_EXPECT_EQ(requests, 3);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -205,6 +205,96 @@ NSFX_TEST_SUITE(Event)
         }
     }
 
+    NSFX_TEST_CASE(Reuse)
+    {
+        try
+        {
+            nsfx::Ptr<Iv1> sv1 = nsfx::EventSinkCreator<Iv1>()(nullptr, &V1);
+            nsfx::Ptr<nsfx::Object<Test>> test = new nsfx::Object<Test>();
+            nsfx::Ptr<Ev1> ev1(test);
+
+            nsfx::cookie_t c1 = ev1->Connect(sv1);
+            nsfx::cookie_t c2 = ev1->Connect(sv1);
+            nsfx::cookie_t c3 = ev1->Connect(sv1);
+            NSFX_TEST_EXPECT_EQ(c1, 1);
+            NSFX_TEST_EXPECT_EQ(c2, 2);
+            NSFX_TEST_EXPECT_EQ(c3, 3);
+
+            // The most recently disconnected slot is reused first.
+            ev1->Disconnect(c1);
+            ev1->Disconnect(c2);
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), c2);
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), c1);
+            NSFX_TEST_EXPECT_EQ(test->v1_.GetImpl()->GetNumSinks(), 3);
+
+            x = 0;
+            test->FireV1(1);
+            NSFX_TEST_EXPECT_EQ(x, 3);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }
+
+    NSFX_TEST_CASE(Trim)
+    {
+        try
+        {
+            nsfx::Ptr<Iv1> sv1 = nsfx::EventSinkCreator<Iv1>()(nullptr, &V1);
+            nsfx::Ptr<nsfx::Object<Test>> test = new nsfx::Object<Test>();
+            nsfx::Ptr<Ev1> ev1(test);
+
+            nsfx::cookie_t cookies[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                cookies[i] = ev1->Connect(sv1);
+            }
+
+            // Disconnecting the tail shrinks the array, so the last sink is
+            // non-null when the event is fired.
+            ev1->Disconnect(cookies[3]);
+            x = 0;
+            test->FireV1(1);
+            NSFX_TEST_EXPECT_EQ(x, 3);
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), cookies[3]);
+
+            // The stale index of the trimmed slot 4 is skipped, and the
+            // slot 2 is reused.
+            ev1->Disconnect(cookies[1]);
+            ev1->Disconnect(cookies[3]);
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), cookies[1]);
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), cookies[3]);
+
+            // The trailing free slots are trimmed together, and the cookies
+            // are not reused twice.
+            ev1->Disconnect(cookies[1]);
+            ev1->Disconnect(cookies[2]);
+            ev1->Disconnect(cookies[3]);
+            NSFX_TEST_EXPECT_EQ(test->v1_.GetImpl()->GetNumSinks(), 1);
+            for (size_t i = 1; i < 4; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), cookies[i]);
+            }
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), 5);
+            x = 0;
+            test->FireV1(1);
+            NSFX_TEST_EXPECT_EQ(x, 5);
+
+            // Disconnecting all sinks empties the array.
+            for (nsfx::cookie_t c = 1; c <= 5; ++c)
+            {
+                ev1->Disconnect(c);
+            }
+            NSFX_TEST_EXPECT_EQ(test->v1_.GetImpl()->GetNumSinks(), 0);
+            NSFX_TEST_EXPECT_EQ(ev1->Connect(sv1), 1);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }
+
 }
 
 
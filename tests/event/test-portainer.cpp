@@ -17,6 +17,7 @@
 #include <nsfx/event/portainer.h>
 #include <iostream>
 #include <set>
+#include <vector>
 
 
 NSFX_TEST_SUITE(Portainer)
@@ -104,6 +105,67 @@ NSFX_TEST_SUITE(Portainer)
         }
     }
 
+    NSFX_TEST_CASE(Reuse)
+    {
+        try
+        {
+            nsfx::Portainer<Item> ct;
+            const int n = 10000;
+            std::vector<nsfx::cookie_t> cookies;
+            for (int i = 1; i <= n; ++i)
+            {
+                cookies.push_back(ct.Add(Item(i)));
+                NSFX_TEST_ASSERT_EQ(cookies.back(), i);
+            }
+
+            ////////////////////////////////////////
+            // Remove every other item.
+            for (int i = 0; i < n; i += 2)
+            {
+                ct.Remove(cookies[i]);
+                ct.Remove(cookies[i]); // No effect.
+            }
+            NSFX_TEST_EXPECT_EQ(ct.GetSize(), n / 2);
+
+            ////////////////////////////////////////
+            // The free slots are reused before the container grows.
+            std::set<nsfx::cookie_t> freed;
+            for (int i = 0; i < n; i += 2)
+            {
+                freed.insert(cookies[i]);
+            }
+            for (int i = 0; i < n / 2; ++i)
+            {
+                nsfx::cookie_t c = ct.Add(Item(-1));
+                NSFX_TEST_ASSERT(freed.erase(c) == 1);
+            }
+            NSFX_TEST_EXPECT_EQ(ct.GetSize(), n);
+            NSFX_TEST_EXPECT_EQ(ct.Add(Item(-1)), n + 1);
+
+            ////////////////////////////////////////
+            // Remove the trailing items.
+            for (nsfx::cookie_t c = n + 1; c > 10; --c)
+            {
+                ct.Remove(c);
+            }
+            size_t count = 0;
+            ct.Visit([&] (const Item& ) { ++count; });
+            NSFX_TEST_EXPECT_EQ(count, 10);
+            NSFX_TEST_EXPECT_EQ(ct.GetSize(), 10);
+            count = 0;
+            ct.Visit([&] (const Item& ) { ++count; });
+            NSFX_TEST_EXPECT_EQ(count, 10);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }
+
     NSFX_TEST_CASE(Add1)
     {
         try
@@ -0,0 +1,306 @@
+/**
+ * @file
+ *
+ * @brief Test TypedEvent.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/event/typed-event.h>
+#include <nsfx/event/event.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+
+NSFX_TEST_SUITE(TypedEvent)
+{
+    static int x;
+
+    NSFX_TEST_CASE(Sink)/*{{{*/
+    {
+        // Inline.
+        nsfx::TypedEventSink<int(int)> s0([] (int i) { return i + 1; });
+        NSFX_TEST_ASSERT(!s0.IsEmpty());
+        int i = 1;
+        NSFX_TEST_EXPECT_EQ(s0(i), 2);
+
+        // On the heap.
+        std::string a(100, 'a');
+        std::string b(100, 'b');
+        std::string c(100, 'c');
+        nsfx::TypedEventSink<int(int)> s1([a, b, c] (int i) {
+            return static_cast<int>(a.size() + b.size() + c.size()) + i;
+        });
+        NSFX_TEST_EXPECT_EQ(s1(i), 301);
+
+        // Move.
+        nsfx::TypedEventSink<int(int)> s2(std::move(s1));
+        NSFX_TEST_EXPECT(s1.IsEmpty());
+        NSFX_TEST_EXPECT_EQ(s2(i), 301);
+        s2 = std::move(s0);
+        NSFX_TEST_EXPECT(s0.IsEmpty());
+        NSFX_TEST_EXPECT_EQ(s2(i), 2);
+        s2.Clear();
+        NSFX_TEST_EXPECT(s2.IsEmpty());
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Connect)/*{{{*/
+    {
+        try
+        {
+            nsfx::TypedEvent<void(int)> event;
+            NSFX_TEST_EXPECT_EQ(event.GetNumSinks(), 0);
+            nsfx::cookie_t cookies[10];
+            for (int i = 0; i < 10; ++i)
+            {
+                cookies[i] = event.Connect([i] (int n) { x += n * (i + 1); });
+            }
+            NSFX_TEST_EXPECT_EQ(event.GetNumSinks(), 10);
+            x = 0;
+            event.Fire(1);
+            NSFX_TEST_EXPECT_EQ(x, 55);
+
+            event.Disconnect(cookies[9]);
+            event.Disconnect(cookies[0]);
+            event.Disconnect(cookies[0]);
+            event.Disconnect(0);
+            event.Disconnect(100);
+            NSFX_TEST_EXPECT_EQ(event.GetNumSinks(), 8);
+            x = 0;
+            event.Fire(1);
+            NSFX_TEST_EXPECT_EQ(x, 44);
+
+            // The free slots are reused.
+            nsfx::cookie_t c0 = event.Connect([] (int n) { x += n * 100; });
+            nsfx::cookie_t c1 = event.Connect([] (int n) { x += n * 1000; });
+            NSFX_TEST_EXPECT((c0 == cookies[0] && c1 == cookies[9]) ||
+                             (c0 == cookies[9] && c1 == cookies[0]));
+            nsfx::cookie_t c2 = event.Connect([] (int n) { x += n * 10000; });
+            NSFX_TEST_EXPECT_EQ(c2, 11);
+            x = 0;
+            event.Fire(2);
+            NSFX_TEST_EXPECT_EQ(x, 2 * (44 + 11100));
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Trim)/*{{{*/
+    {
+        try
+        {
+            nsfx::TypedEvent<void(int)> event;
+            nsfx::cookie_t cookies[10];
+            for (int i = 0; i < 10; ++i)
+            {
+                cookies[i] = event.Connect([i] (int n) { x += n * (i + 1); });
+            }
+            // Leave the first and the last sinks.
+            for (int i = 1; i < 9; ++i)
+            {
+                event.Disconnect(cookies[i]);
+            }
+            // Connect and disconnect a sink at the tail repeatedly.
+            for (int i = 0; i < 100; ++i)
+            {
+                event.Disconnect(cookies[9]);
+                cookies[9] = event.Connect([] (int n) { x += n * 10; });
+                NSFX_TEST_ASSERT(cookies[9] != cookies[0]);
+            }
+            NSFX_TEST_EXPECT_EQ(event.GetNumSinks(), 2);
+            x = 0;
+            event.Fire(1);
+            NSFX_TEST_EXPECT_EQ(x, 11);
+
+            // The trimmed slots are not reused twice.
+            std::set<nsfx::cookie_t> used;
+            used.insert(cookies[0]);
+            used.insert(cookies[9]);
+            for (int i = 0; i < 10; ++i)
+            {
+                nsfx::cookie_t c = event.Connect([] (int n) { x += n; });
+                NSFX_TEST_EXPECT(used.insert(c).second);
+            }
+            NSFX_TEST_EXPECT_EQ(event.GetNumSinks(), 12);
+            x = 0;
+            event.Fire(1);
+            NSFX_TEST_EXPECT_EQ(x, 21);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Reentrance)/*{{{*/
+    {
+        try
+        {
+            nsfx::TypedEvent<void(void)> event;
+            nsfx::cookie_t c0 = 0;
+            nsfx::cookie_t c1 = 0;
+            // A sink that holds a resource.
+            std::shared_ptr<int> resource(new int(0));
+            std::weak_ptr<int> weak(resource);
+            c0 = event.Connect([&, resource] {
+                ++x;
+                // Disconnect itself and another sink.
+                event.Disconnect(c0);
+                event.Disconnect(c1);
+                // Still alive while it is running.
+                NSFX_TEST_EXPECT_EQ(*resource, 0);
+                try
+                {
+                    event.Connect([] {});
+                    NSFX_TEST_EXPECT(false);
+                }
+                catch (nsfx::IllegalMethodCall& )
+                {
+                    // Should come here.
+                }
+            });
+            c1 = event.Connect([] { x += 100; });
+            resource.reset();
+            x = 0;
+            event.Fire();
+            NSFX_TEST_EXPECT_EQ(x, 1);
+            NSFX_TEST_EXPECT_EQ(event.GetNumSinks(), 0);
+            // Destroyed after the event is fired.
+            NSFX_TEST_EXPECT(weak.expired());
+            event.Fire();
+            NSFX_TEST_EXPECT_EQ(x, 1);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    struct Adder/*{{{*/
+    {
+        explicit Adder(int n) : n_(n) {}
+
+        void operator()(int i)
+        {
+            x += n_ * i;
+        }
+
+        int n_;
+    };/*}}}*/
+
+    NSFX_TEST_CASE(KnownSink)/*{{{*/
+    {
+        nsfx::TypedEvent<void(int), Adder> event;
+        event.Connect(Adder(1));
+        nsfx::cookie_t c = event.Connect(Adder(2));
+        event.Connect(3);
+        x = 0;
+        event.Fire(1);
+        NSFX_TEST_EXPECT_EQ(x, 6);
+        event.Disconnect(c);
+        x = 0;
+        event.Fire(1);
+        NSFX_TEST_EXPECT_EQ(x, 4);
+    }/*}}}*/
+
+    // Performance.
+    NSFX_DEFINE_EVENT_SINK_INTERFACE(
+        ICountSink, "edu.uestc.nsfx.test.ICountSink", ( void(int) ));
+
+    NSFX_DEFINE_EVENT_INTERFACE(
+        ICountEvent, "edu.uestc.nsfx.test.ICountEvent", ICountSink);
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // An event with a large fan-out, e.g., a broadcast channel.
+        const int numSinks = 100;
+        const int numFires = 200000;
+        double secs[3];
+        int results[3];
+        {
+            nsfx::Ptr<nsfx::Object<nsfx::Event<ICountEvent>>> event(
+                new nsfx::Object<nsfx::Event<ICountEvent>>);
+            for (int i = 0; i < numSinks; ++i)
+            {
+                event->Connect(nsfx::CreateEventSink<ICountSink>(
+                    nullptr, [] (int n) { x += n; }));
+            }
+            x = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < numFires; ++i)
+            {
+                event->GetImpl()->Fire(i & 1);
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            secs[0] = std::chrono::duration<double>(t1 - t0).count();
+            results[0] = x;
+        }
+        {
+            nsfx::TypedEvent<void(int)> event;
+            for (int i = 0; i < numSinks; ++i)
+            {
+                event.Connect([] (int n) { x += n; });
+            }
+            x = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < numFires; ++i)
+            {
+                event.Fire(i & 1);
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            secs[1] = std::chrono::duration<double>(t1 - t0).count();
+            results[1] = x;
+        }
+        {
+            nsfx::TypedEvent<void(int), Adder> event;
+            for (int i = 0; i < numSinks; ++i)
+            {
+                event.Connect(Adder(1));
+            }
+            x = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < numFires; ++i)
+            {
+                event.Fire(i & 1);
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            secs[2] = std::chrono::duration<double>(t1 - t0).count();
+            results[2] = x;
+        }
+        const char* names[] = {
+            "Event<>", "TypedEvent<Proto>", "TypedEvent<Proto, Sink>"
+        };
+        for (int k = 0; k < 3; ++k)
+        {
+            NSFX_TEST_EXPECT_EQ(results[k], numSinks * numFires / 2);
+            std::cout << names[k] << ": "
+                      << static_cast<uint64_t>(numSinks * numFires / secs[k])
+                      << " calls per second." << std::endl;
+        }
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+/**
+ * @file
+ *
+ * @brief Test Crc32.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/network/buffer.h>
+#include <nsfx/network/buffer/checksum/crc32.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+
+NSFX_TEST_SUITE(Crc32)
+{
+    using namespace nsfx;
+
+    // Compute the CRC bit by bit.
+    template<uint32_t poly>
+    uint32_t Reference(const uint8_t* data, size_t size)
+    {
+        uint32_t crc = 0xffffffff;
+        for (size_t i = 0; i < size; ++i)
+        {
+            crc ^= data[i];
+            for (size_t k = 0; k < 8; ++k)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ poly : (crc >> 1);
+            }
+        }
+        return ~crc;
+    }
+
+    std::vector<uint8_t> MakeData(size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        uint32_t x = 12345;
+        for (size_t i = 0; i < size; ++i)
+        {
+            x = x * 1103515245 + 12345;
+            data[i] = static_cast<uint8_t>(x >> 16);
+        }
+        return data;
+    }
+
+    Buffer MakeBuffer(const uint8_t* data, size_t size)
+    {
+        Buffer buffer(size);
+        buffer.AddAtEnd(data, size);
+        return buffer;
+    }
+
+    template<class CrcType, uint32_t poly>
+    void TestSizes(void)
+    {
+        std::vector<uint8_t> data = MakeData(5000);
+        const size_t sizes[] = { 0, 1, 7, 8, 15, 16, 63, 64, 65, 79, 80,
+                                 127, 128, 129, 1000, 4099 };
+        for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); ++i)
+        {
+            // Misaligned.
+            const uint8_t* p = data.data() + 3;
+            CrcType crc;
+            crc.Update(p, sizes[i]);
+            NSFX_TEST_EXPECT_EQ(crc.GetValue(), Reference<poly>(p, sizes[i]));
+        }
+    }
+
+    NSFX_TEST_CASE(CheckValue)/*{{{*/
+    {
+        const uint8_t data[] = "123456789";
+        Crc32 crc32;
+        crc32.Update(data, 9);
+        NSFX_TEST_EXPECT_EQ(crc32.GetValue(), 0xcbf43926);
+        Crc32c crc32c;
+        crc32c.Update(data, 9);
+        NSFX_TEST_EXPECT_EQ(crc32c.GetValue(), 0xe3069283);
+        crc32c.Reset();
+        NSFX_TEST_EXPECT_EQ(crc32c.GetValue(), 0);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Sizes)/*{{{*/
+    {
+        TestSizes<Crc32,  0xedb88320>();
+        TestSizes<Crc32c, 0x82f63b78>();
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Pieces)/*{{{*/
+    {
+        std::vector<uint8_t> data = MakeData(300);
+        uint32_t expected = Reference<0xedb88320>(data.data(), data.size());
+        for (size_t i = 0; i <= data.size(); i += 7)
+        {
+            Crc32 crc0;
+            crc0.Update(data.data(), i);
+            // Continue a CRC.
+            Crc32 crc1(crc0.GetValue());
+            crc1.Update(data.data() + i, data.size() - i);
+            NSFX_TEST_EXPECT_EQ(crc1.GetValue(), expected);
+            // Combine two CRCs.
+            Crc32 crc2;
+            crc2.Update(data.data() + i, data.size() - i);
+            NSFX_TEST_EXPECT_EQ(Crc32::Combine(crc0.GetValue(), crc2.GetValue(),
+                                               data.size() - i),
+                                expected);
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Zeros)/*{{{*/
+    {
+        std::vector<uint8_t> zeros(100000);
+        const size_t sizes[] = { 0, 1, 2, 3, 8, 100, 1400, 65536, 100000 };
+        for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); ++i)
+        {
+            Crc32 crc0;
+            crc0.Update(zeros.data(), 5);
+            crc0.Update(zeros.data(), sizes[i]);
+            Crc32 crc1;
+            crc1.Update(zeros.data(), 5);
+            crc1.UpdateZeros(sizes[i]);
+            NSFX_TEST_EXPECT_EQ(crc0.GetValue(), crc1.GetValue());
+
+            Crc32c crc2;
+            crc2.Update(zeros.data(), sizes[i]);
+            Crc32c crc3;
+            crc3.UpdateZeros(sizes[i]);
+            NSFX_TEST_EXPECT_EQ(crc2.GetValue(), crc3.GetValue());
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Buffer)/*{{{*/
+    {
+        std::vector<uint8_t> data = MakeData(1001);
+        Buffer b0 = MakeBuffer(data.data(), data.size());
+        NSFX_TEST_EXPECT_EQ(ComputeCrc32(b0),
+                            Reference<0xedb88320>(data.data(), data.size()));
+        ConstBuffer b1 = b0.MakeFragment(1, 500);
+        NSFX_TEST_EXPECT_EQ(ComputeCrc32c(b1),
+                            Reference<0x82f63b78>(data.data() + 1, 500));
+    }/*}}}*/
+
+    NSFX_TEST_CASE(ZcBuffer)/*{{{*/
+    {
+        const size_t sizes[] = { 0, 1, 14, 100 };
+        for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); ++i)
+        {
+            for (size_t j = 0; j < sizeof (sizes) / sizeof (sizes[0]); ++j)
+            {
+                // | header | zero | trailer |
+                ZcBuffer b0(0, 1400, 0);
+                std::vector<uint8_t> header = MakeData(sizes[i]);
+                std::vector<uint8_t> trailer = MakeData(sizes[j]);
+                if (header.size())
+                {
+                    b0.AddAtStart(header.data(), header.size());
+                }
+                if (trailer.size())
+                {
+                    b0.AddAtEnd(trailer.data(), trailer.size());
+                }
+
+                std::vector<uint8_t> data(b0.GetSize());
+                b0.cbegin().Read(data.data(), data.size());
+                NSFX_TEST_ASSERT_EQ(ComputeCrc32(b0),
+                    Reference<0xedb88320>(data.data(), data.size()));
+                NSFX_TEST_ASSERT_EQ(ComputeCrc32c(b0),
+                    Reference<0x82f63b78>(data.data(), data.size()));
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(SegBuffer)/*{{{*/
+    {
+        std::vector<uint8_t> data = MakeData(1001);
+        SegBuffer b0;
+        b0.AddAtEnd(MakeBuffer(data.data(), 7));
+        b0.AddAtEnd(MakeBuffer(data.data() + 7, 500));
+        b0.AddAtEnd(MakeBuffer(data.data() + 507, 494));
+        NSFX_TEST_EXPECT_EQ(ComputeCrc32(b0),
+                            Reference<0xedb88320>(data.data(), data.size()));
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        typedef std::chrono::high_resolution_clock  clock_type;
+        {
+            const size_t n = 200;
+            std::vector<uint8_t> data = MakeData(65536);
+            uint32_t total = 0;
+
+            clock_type::time_point t0 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                uint32_t crc = 0xffffffff;
+                for (size_t k = 0; k < data.size(); ++k)
+                {
+                    crc = (crc >> 8) ^
+                          aux::CrcTable<0xedb88320>::Get().t_[0][(crc ^ data[k]) & 0xff];
+                }
+                total += ~crc;
+            }
+            clock_type::time_point t1 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                Crc32 crc;
+                crc.Update(data.data(), data.size());
+                total -= crc.GetValue();
+            }
+            clock_type::time_point t2 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                Crc32c crc;
+                crc.Update(data.data(), data.size());
+                total += crc.GetValue();
+            }
+            clock_type::time_point t3 = clock_type::now();
+            NSFX_TEST_EXPECT_EQ(total, static_cast<uint32_t>(n) *
+                                Reference<0x82f63b78>(data.data(), data.size()));
+
+            double mb = n * data.size() / 1e6;
+            std::cout << "Byte-wise CRC-32: "
+                      << mb / std::chrono::duration<double>(t1 - t0).count()
+                      << " MB/s" << std::endl;
+            std::cout << "CRC-32:           "
+                      << mb / std::chrono::duration<double>(t2 - t1).count()
+                      << " MB/s" << std::endl;
+            std::cout << "CRC-32C:          "
+                      << mb / std::chrono::duration<double>(t3 - t2).count()
+                      << " MB/s" << std::endl;
+        }
+        {
+            // A packet with 1400 bytes of zero-compressed payload.
+            const size_t n = 100000;
+            ZcBuffer b0(0, 1400, 0);
+            b0.AddAtStart(40);
+            uint32_t total = 0;
+
+            clock_type::time_point t0 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                uint32_t crc = 0xffffffff;
+                ConstZcBufferIterator it = b0.cbegin();
+                for (size_t k = 0; k < b0.GetSize(); ++k)
+                {
+                    crc = (crc >> 8) ^
+                          aux::CrcTable<0xedb88320>::Get().t_[0][(crc ^ it.Read<uint8_t>()) & 0xff];
+                }
+                total += ~crc;
+            }
+            clock_type::time_point t1 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                total -= ComputeCrc32(b0);
+            }
+            clock_type::time_point t2 = clock_type::now();
+            NSFX_TEST_EXPECT_EQ(total, 0);
+
+            std::cout << "Iterator: "
+                      << n / std::chrono::duration<double>(t1 - t0).count()
+                      << " packets/s" << std::endl;
+            std::cout << "CRC-32:   "
+                      << n / std::chrono::duration<double>(t2 - t1).count()
+                      << " packets/s" << std::endl;
+        }
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -0,0 +1,223 @@
+/**
+ * @file
+ *
+ * @brief Test InternetChecksum.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/network/buffer.h>
+#include <nsfx/network/buffer/checksum/internet-checksum.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+
+NSFX_TEST_SUITE(InternetChecksum)
+{
+    using namespace nsfx;
+
+    // Sum the big endian 16-bit words one by one.
+    uint16_t Reference(const uint8_t* data, size_t size)
+    {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < size; i += 2)
+        {
+            uint32_t word = static_cast<uint32_t>(data[i]) << 8;
+            if (i + 1 < size)
+            {
+                word |= data[i + 1];
+            }
+            sum += word;
+            sum = (sum & 0xffff) + (sum >> 16);
+        }
+        return static_cast<uint16_t>(~sum);
+    }
+
+    std::vector<uint8_t> MakeData(size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        uint32_t x = 12345;
+        for (size_t i = 0; i < size; ++i)
+        {
+            x = x * 1103515245 + 12345;
+            data[i] = static_cast<uint8_t>(x >> 16);
+        }
+        return data;
+    }
+
+    Buffer MakeBuffer(const uint8_t* data, size_t size)
+    {
+        Buffer buffer(size);
+        buffer.AddAtEnd(data, size);
+        return buffer;
+    }
+
+    NSFX_TEST_CASE(Rfc1071)/*{{{*/
+    {
+        const uint8_t data[] = { 0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7 };
+        InternetChecksum checksum;
+        checksum.Update(data, sizeof (data));
+        NSFX_TEST_EXPECT_EQ(checksum.GetValue(), 0x220d);
+        // Verify the data with the checksum.
+        const uint8_t sum[] = { 0x22, 0x0d };
+        checksum.Update(sum, sizeof (sum));
+        NSFX_TEST_EXPECT_EQ(checksum.GetValue(), 0);
+        checksum.Reset();
+        NSFX_TEST_EXPECT_EQ(checksum.GetValue(), 0xffff);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Pieces)/*{{{*/
+    {
+        for (size_t size = 0; size < 100; ++size)
+        {
+            std::vector<uint8_t> data = MakeData(size);
+            uint16_t expected = Reference(data.data(), size);
+            for (size_t i = 0; i <= size; ++i)
+            {
+                for (size_t j = i; j <= size; j += 3)
+                {
+                    InternetChecksum checksum;
+                    checksum.Update(data.data(), i);
+                    checksum.Update(data.data() + i, j - i);
+                    checksum.Update(data.data() + j, size - j);
+                    NSFX_TEST_ASSERT_EQ(checksum.GetValue(), expected);
+                }
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Buffer)/*{{{*/
+    {
+        std::vector<uint8_t> data = MakeData(1001);
+        Buffer b0 = MakeBuffer(data.data(), data.size());
+        NSFX_TEST_EXPECT_EQ(ComputeInternetChecksum(b0),
+                            Reference(data.data(), data.size()));
+        ConstBuffer b1 = b0.MakeFragment(1, 500);
+        NSFX_TEST_EXPECT_EQ(ComputeInternetChecksum(b1),
+                            Reference(data.data() + 1, 500));
+        Buffer b2;
+        NSFX_TEST_EXPECT_EQ(ComputeInternetChecksum(b2), 0xffff);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(ZcBuffer)/*{{{*/
+    {
+        const size_t sizes[] = { 0, 1, 2, 13, 14, 1000, 1001 };
+        for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); ++i)
+        {
+            for (size_t j = 0; j < sizeof (sizes) / sizeof (sizes[0]); ++j)
+            {
+                // | header | zero | trailer |
+                ZcBuffer b0(0, 1001, 0);
+                std::vector<uint8_t> header = MakeData(sizes[i]);
+                std::vector<uint8_t> trailer = MakeData(sizes[j]);
+                if (header.size())
+                {
+                    b0.AddAtStart(header.data(), header.size());
+                }
+                if (trailer.size())
+                {
+                    b0.AddAtEnd(trailer.data(), trailer.size());
+                }
+
+                std::vector<uint8_t> data(b0.GetSize());
+                b0.cbegin().Read(data.data(), data.size());
+                NSFX_TEST_ASSERT_EQ(ComputeInternetChecksum(b0),
+                                    Reference(data.data(), data.size()));
+            }
+        }
+        ZcBuffer b1(0, 1001, 0);
+        NSFX_TEST_EXPECT_EQ(ComputeInternetChecksum(b1), 0xffff);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(SegBuffer)/*{{{*/
+    {
+        std::vector<uint8_t> data = MakeData(1001);
+        SegBuffer b0;
+        b0.AddAtEnd(MakeBuffer(data.data(), 7));
+        b0.AddAtEnd(MakeBuffer(data.data() + 7, 500));
+        b0.AddAtEnd(MakeBuffer(data.data() + 507, 494));
+        NSFX_TEST_EXPECT_EQ(ComputeInternetChecksum(b0),
+                            Reference(data.data(), data.size()));
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Incremental)/*{{{*/
+    {
+        std::vector<uint8_t> data = MakeData(20);
+        Buffer b0 = MakeBuffer(data.data(), data.size());
+        uint16_t checksum = ComputeInternetChecksum(b0);
+
+        // Rewrite a 16-bit word, e.g., the TTL and the protocol.
+        BufferIterator it = b0.begin() + 8;
+        uint16_t oldValue = it.ReadB<uint16_t>();
+        it = b0.begin() + 8;
+        it.WriteB<uint16_t>(0x0111);
+        checksum = UpdateInternetChecksum(checksum, oldValue, 0x0111);
+        NSFX_TEST_EXPECT_EQ(checksum, ComputeInternetChecksum(b0));
+
+        // Rewrite a 32-bit word, e.g., the source address.
+        it = b0.begin() + 12;
+        uint32_t oldAddress = it.ReadB<uint32_t>();
+        it = b0.begin() + 12;
+        it.WriteB<uint32_t>(0xc0a80001);
+        checksum = UpdateInternetChecksum32(checksum, oldAddress, 0xc0a80001);
+        NSFX_TEST_EXPECT_EQ(checksum, ComputeInternetChecksum(b0));
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // A packet with 1400 bytes of zero-compressed payload.
+        const size_t n = 100000;
+        ZcBuffer b0(0, 1400, 0);
+        b0.AddAtStart(40);
+        b0.AddAtEnd(4);
+        typedef std::chrono::high_resolution_clock  clock_type;
+        uint32_t total = 0;
+
+        clock_type::time_point t0 = clock_type::now();
+        for (size_t i = 0; i < n; ++i)
+        {
+            uint32_t sum = 0;
+            ConstZcBufferIterator it = b0.cbegin();
+            for (size_t k = 0; k < b0.GetSize() / 2; ++k)
+            {
+                sum += it.ReadB<uint16_t>();
+            }
+            sum = (sum & 0xffff) + (sum >> 16);
+            sum = (sum & 0xffff) + (sum >> 16);
+            total += static_cast<uint16_t>(~sum);
+        }
+        clock_type::time_point t1 = clock_type::now();
+        for (size_t i = 0; i < n; ++i)
+        {
+            total -= ComputeInternetChecksum(b0);
+        }
+        clock_type::time_point t2 = clock_type::now();
+        NSFX_TEST_EXPECT_EQ(total, 0);
+
+        std::cout << "Iterator: "
+                  << n / std::chrono::duration<double>(t1 - t0).count()
+                  << " packets/s" << std::endl;
+        std::cout << "Checksum: "
+                  << n / std::chrono::duration<double>(t2 - t1).count()
+                  << " packets/s" << std::endl;
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
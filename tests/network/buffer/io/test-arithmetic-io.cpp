@@ -17,6 +17,9 @@
 #include <nsfx/network/buffer.h>
 #include <nsfx/network/buffer/io/arithmetic-io.h>
 #include <iostream>
+#include <chrono>
+#include <cstring>   // memcmp
+#include <vector>
 
 
 NSFX_TEST_SUITE(ArithmeticIo)
@@ -1298,6 +1301,170 @@ NSFX_TEST_SUITE(ArithmeticIo)
         }
     }/*}}}*/
 
+    NSFX_TEST_SUITE(Bulk)/*{{{*/
+    {
+        // Fill an array with distinct bytes.
+        template<class T>
+        void MakeArray(T* ar, size_t n)
+        {
+            uint8_t* bytes = reinterpret_cast<uint8_t*>(ar);
+            for (size_t i = 0; i < n * sizeof (T); ++i)
+            {
+                bytes[i] = static_cast<uint8_t>(i * 7 + 3);
+            }
+        }
+
+        // Compare the bulk operations against the scalar operations.
+        template<class T>
+        void TestLayout(size_t n)
+        {
+            std::vector<T> v0(n);
+            MakeArray(v0.data(), n);
+            // Misalign the arrays by one byte.
+            Buffer b0(1, n * sizeof (T) * 2 + 1, 1);
+            Buffer b1(1, n * sizeof (T) * 2 + 1, 1);
+            auto it0 = b0.begin();
+            auto it1 = b1.begin();
+            ++it0;
+            ++it1;
+            WriteB(it0, v0.data(), n);
+            WriteL(it0, v0.data(), n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                it1.WriteB<T>(v0[i]);
+            }
+            for (size_t i = 0; i < n; ++i)
+            {
+                it1.WriteL<T>(v0[i]);
+            }
+            NSFX_TEST_EXPECT_EQ(it0.GetCursor(), it1.GetCursor());
+            std::vector<uint8_t> bytes0(b0.GetSize());
+            std::vector<uint8_t> bytes1(b1.GetSize());
+            b0.cbegin().Read(bytes0.data(), bytes0.size());
+            b1.cbegin().Read(bytes1.data(), bytes1.size());
+            NSFX_TEST_EXPECT(bytes0 == bytes1);
+
+            std::vector<T> v1(n);
+            std::vector<T> v2(n);
+            auto itr = b0.cbegin();
+            ++itr;
+            ReadB(itr, v1.data(), n);
+            ReadL(itr, v2.data(), n);
+            NSFX_TEST_EXPECT(itr == b0.cend());
+            // The data of an empty vector can be null.
+            if (n)
+            {
+                NSFX_TEST_EXPECT(!std::memcmp(v0.data(), v1.data(), n * sizeof (T)));
+                NSFX_TEST_EXPECT(!std::memcmp(v0.data(), v2.data(), n * sizeof (T)));
+            }
+        }
+
+        NSFX_TEST_CASE(Layout)
+        {
+            // Cover the 32-byte and 16-byte blocks, and the remainders.
+            const size_t sizes[] = { 0, 1, 7, 8, 15, 16, 33, 100 };
+            for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); ++i)
+            {
+                TestLayout<uint8_t>(sizes[i]);
+                TestLayout<int16_t>(sizes[i]);
+                TestLayout<uint16_t>(sizes[i]);
+                TestLayout<int32_t>(sizes[i]);
+                TestLayout<uint32_t>(sizes[i]);
+                TestLayout<uint64_t>(sizes[i]);
+                TestLayout<float>(sizes[i]);
+                TestLayout<double>(sizes[i]);
+            }
+        }
+
+        NSFX_TEST_CASE(ZcBuffer)
+        {
+            // | header | zero | trailer |
+            ZcBuffer buffer(16, 16, 16);
+            buffer.AddAtStart(16);
+            buffer.AddAtEnd(16);
+            uint32_t v0[4] = { 0x01020304, 0x05060708, 0x090a0b0c, 0x0d0e0f10 };
+            auto itw = buffer.begin();
+            WriteB(itw, v0, 4);
+            itw += 16;
+            WriteB(itw, v0, 4);
+
+            // In the header area.
+            uint32_t v1[4];
+            auto itr = buffer.cbegin();
+            ReadB(itr, v1, 4);
+            NSFX_TEST_EXPECT(!std::memcmp(v0, v1, sizeof (v0)));
+            // In the zero-compressed area.
+            ReadB(itr, v1, 4);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(v1[i], 0);
+            }
+            // In the trailer area.
+            ReadB(itr, v1, 4);
+            NSFX_TEST_EXPECT(!std::memcmp(v0, v1, sizeof (v0)));
+            // Across the zero-compressed area.
+            uint32_t v2[12];
+            itr = buffer.cbegin();
+            ReadB(itr, v2, 12);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(v2[i], v0[i]);
+                NSFX_TEST_EXPECT_EQ(v2[i + 4], 0);
+                NSFX_TEST_EXPECT_EQ(v2[i + 8], v0[i]);
+            }
+            NSFX_TEST_EXPECT(itr == buffer.cend());
+        }
+
+        NSFX_TEST_CASE(Performance)
+        {
+            const size_t n = 16384;
+            const size_t rounds = 1000;
+            typedef std::chrono::high_resolution_clock  clock_type;
+            std::vector<uint32_t> v0(n);
+            std::vector<uint32_t> v1(n);
+            MakeArray(v0.data(), n);
+            Buffer buffer(n * sizeof (uint32_t));
+            buffer.AddAtStart(n * sizeof (uint32_t));
+            uint32_t sum = 0;
+
+            clock_type::time_point t0 = clock_type::now();
+            for (size_t r = 0; r < rounds; ++r)
+            {
+                auto itw = buffer.begin();
+                for (size_t i = 0; i < n; ++i)
+                {
+                    itw.WriteB<uint32_t>(v0[i]);
+                }
+                auto itr = buffer.cbegin();
+                for (size_t i = 0; i < n; ++i)
+                {
+                    v1[i] = itr.ReadB<uint32_t>();
+                }
+                sum += v1[r % n];
+            }
+            clock_type::time_point t1 = clock_type::now();
+            for (size_t r = 0; r < rounds; ++r)
+            {
+                auto itw = buffer.begin();
+                WriteB(itw, v0.data(), n);
+                auto itr = buffer.cbegin();
+                ReadB(itr, v1.data(), n);
+                sum += v1[r % n];
+            }
+            clock_type::time_point t2 = clock_type::now();
+            NSFX_TEST_EXPECT(v0 == v1);
+
+            double mb = 2.0 * rounds * n * sizeof (uint32_t) / 1e6;
+            std::cout << "Scalar: "
+                      << mb / std::chrono::duration<double>(t1 - t0).count()
+                      << " MB/s" << std::endl;
+            std::cout << "Bulk:   "
+                      << mb / std::chrono::duration<double>(t2 - t1).count()
+                      << " MB/s" << std::endl;
+            std::cout << "(" << sum << ")" << std::endl;
+        }
+    }/*}}}*/
+
 }
 
 
@@ -0,0 +1,207 @@
+/**
+ * @file
+ *
+ * @brief Test BufferProfile.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/network/buffer.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+
+NSFX_TEST_SUITE(BufferProfile)
+{
+    // Add the headers and trailer of a typical protocol stack.
+    template<class BufferType>
+    void AddHeaders(BufferType& b)
+    {
+        b.AddAtStart(8);
+        b.AddAtStart(20);
+        b.AddAtStart(14);
+        b.AddAtEnd(4);
+    }
+
+    NSFX_TEST_CASE(Reserve)/*{{{*/
+    {
+        nsfx::BufferProfile profile(20, 4);
+        nsfx::Buffer b0(100, profile);
+        NSFX_TEST_EXPECT_EQ(b0.GetSize(), 100);
+        NSFX_TEST_EXPECT_EQ(b0.GetStart(), 20);
+        NSFX_TEST_EXPECT_EQ(b0.GetCapacity(), 124);
+        nsfx::ConstBufferIterator it = b0.cbegin();
+        for (size_t i = 0; i < 100; ++i)
+        {
+            NSFX_TEST_EXPECT_EQ(it.Read<uint8_t>(), 0);
+        }
+        b0.AddAtStart(20);
+        b0.AddAtEnd(4);
+        NSFX_TEST_EXPECT_EQ(b0.GetCapacity(), 124);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numBuffers_, 1);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 0);
+        // An empty profile still tracks an empty buffer.
+        nsfx::BufferProfile profile1;
+        nsfx::Buffer b1(0, profile1);
+        NSFX_TEST_EXPECT_EQ(b1.GetSize(), 0);
+        NSFX_TEST_ASSERT(b1.GetStorage());
+        NSFX_TEST_EXPECT(b1.GetStorage()->profile_ == &profile1);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Learn)/*{{{*/
+    {
+        nsfx::BufferProfile profile;
+        {
+            nsfx::Buffer b0(1000, profile);
+            AddHeaders(b0);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 1046);
+        }
+        NSFX_TEST_EXPECT_EQ(profile.GetHeadroom(), 42);
+        NSFX_TEST_EXPECT_EQ(profile.GetTailroom(), 4);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 4);
+        profile.ResetStats();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            nsfx::Buffer b1(1000, profile);
+            AddHeaders(b1);
+        }
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numBuffers_, 10);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 0);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().GetCopyRate(), 0);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(InFlight)/*{{{*/
+    {
+        // The buffers created before the profile learns do not inflate
+        // the prediction.
+        nsfx::BufferProfile profile;
+        std::vector<nsfx::Buffer> buffers;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            buffers.push_back(nsfx::Buffer(1000, profile));
+        }
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            AddHeaders(buffers[i]);
+        }
+        NSFX_TEST_EXPECT_EQ(profile.GetHeadroom(), 42);
+        NSFX_TEST_EXPECT_EQ(profile.GetTailroom(), 4);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 40);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(MaxRoom)/*{{{*/
+    {
+        nsfx::BufferProfile profile(0, 0, 16);
+        nsfx::Buffer b0(10, profile);
+        b0.AddAtStart(100);
+        b0.AddAtEnd(100);
+        NSFX_TEST_EXPECT_EQ(profile.GetHeadroom(), 16);
+        NSFX_TEST_EXPECT_EQ(profile.GetTailroom(), 16);
+        NSFX_TEST_EXPECT_EQ(profile.GetMaxRoom(), 16);
+        // The initial rooms are clamped.
+        nsfx::BufferProfile profile1(100, 50, 16);
+        NSFX_TEST_EXPECT_EQ(profile1.GetHeadroom(), 16);
+        NSFX_TEST_EXPECT_EQ(profile1.GetTailroom(), 16);
+        nsfx::BufferProfile profile2(2000, 4);
+        NSFX_TEST_EXPECT_EQ(profile2.GetHeadroom(), 1024);
+        NSFX_TEST_EXPECT_EQ(profile2.GetTailroom(), 4);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Shared)/*{{{*/
+    {
+        // A copy due to sharing is counted, but it is not a shortage.
+        nsfx::BufferProfile profile(20, 0);
+        nsfx::Buffer b0(100, profile);
+        nsfx::Buffer b1(b0);
+        b1.AddAtStart(10);
+        b0.AddAtStart(10);
+        NSFX_TEST_EXPECT(b0.GetStorage() != b1.GetStorage());
+        NSFX_TEST_EXPECT(b0.GetStorage()->profile_ == &profile);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 1);
+        NSFX_TEST_EXPECT_EQ(profile.GetHeadroom(), 20);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(MoveMemory)/*{{{*/
+    {
+        // Moving the data within the storage is also a copy.
+        nsfx::BufferProfile profile(0, 10);
+        nsfx::Buffer b0(100, profile);
+        b0.AddAtStart(8);
+        NSFX_TEST_EXPECT_EQ(b0.GetCapacity(), 110);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 1);
+        NSFX_TEST_EXPECT_EQ(profile.GetHeadroom(), 8);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(ZcBuffer)/*{{{*/
+    {
+        nsfx::BufferProfile profile;
+        {
+            nsfx::ZcBuffer b0(1000, profile);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 1000);
+            AddHeaders(b0);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 1046);
+        }
+        NSFX_TEST_EXPECT_EQ(profile.GetHeadroom(), 42);
+        NSFX_TEST_EXPECT_EQ(profile.GetTailroom(), 4);
+        profile.ResetStats();
+        nsfx::ZcBuffer b1(1000, profile);
+        NSFX_TEST_EXPECT_EQ(b1.GetSize(), 1000);
+        NSFX_TEST_EXPECT_EQ(b1.GetCapacity(), 46);
+        AddHeaders(b1);
+        NSFX_TEST_EXPECT_EQ(profile.GetStats().numCopies_, 0);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        const size_t n = 1000000;
+        const size_t noRoom = 0;
+        typedef std::chrono::high_resolution_clock  clock_type;
+        size_t total = 0;
+
+        clock_type::time_point t0 = clock_type::now();
+        for (size_t i = 0; i < n; ++i)
+        {
+            nsfx::Buffer b(noRoom, 1400, noRoom);
+            AddHeaders(b);
+            total += b.GetSize();
+        }
+        clock_type::time_point t1 = clock_type::now();
+        nsfx::BufferProfile profile;
+        for (size_t i = 0; i < n; ++i)
+        {
+            nsfx::Buffer b(1400, profile);
+            AddHeaders(b);
+            total += b.GetSize();
+        }
+        clock_type::time_point t2 = clock_type::now();
+        NSFX_TEST_EXPECT_EQ(total, 2 * n * 1446);
+
+        nsfx::BufferProfileStats stats = profile.GetStats();
+        std::cout << "Without profile: "
+                  << n / std::chrono::duration<double>(t1 - t0).count()
+                  << " packets/s" << std::endl;
+        std::cout << "With profile:    "
+                  << n / std::chrono::duration<double>(t2 - t1).count()
+                  << " packets/s, "
+                  << stats.GetCopyRate() << " copies/packet" << std::endl;
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -0,0 +1,148 @@
+/**
+ * @file
+ *
+ * @brief Test BufferStoragePool.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/network/buffer.h>
+#include <nsfx/network/packet/packet.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+
+NSFX_TEST_SUITE(BufferStoragePool)
+{
+    typedef nsfx::BasicBufferStorage<true>  Storage;
+    typedef nsfx::BufferStoragePool<Storage>  Pool;
+
+    NSFX_TEST_CASE(SizeClass)/*{{{*/
+    {
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(1), 0);
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(64), 0);
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(65), 1);
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(1500), 4);
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(1501), 5);
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(9000), 5);
+        NSFX_TEST_EXPECT_EQ(Pool::GetClass(9001), Pool::NUM_CLASSES);
+    }/*}}}*/
+
+#if !defined(NSFX_NO_BUFFER_STORAGE_POOL) && \
+    !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+    NSFX_TEST_CASE(Reuse)/*{{{*/
+    {
+        Pool::Clear();
+        Storage* s0 = Storage::Allocate(100);
+        NSFX_TEST_ASSERT(s0);
+        NSFX_TEST_EXPECT_EQ(s0->capacity_, 100);
+        Storage::Release(s0);
+        NSFX_TEST_EXPECT_EQ(Pool::GetStats().numCached_, 1);
+
+        // The same size class.
+        Storage* s1 = Storage::Allocate(128);
+        NSFX_TEST_EXPECT(s1 == s0);
+        NSFX_TEST_EXPECT_EQ(s1->capacity_, 128);
+        NSFX_TEST_EXPECT_EQ(s1->refCount_, 1);
+        NSFX_TEST_EXPECT_EQ(s1->dirtyStart_, 0);
+        NSFX_TEST_EXPECT_EQ(s1->dirtyEnd_, 0);
+
+        // A different size class.
+        Storage* s2 = Storage::Allocate(129);
+        NSFX_TEST_EXPECT(s2 != s0);
+        Storage::Release(s1);
+        Storage::Release(s2);
+        NSFX_TEST_EXPECT_EQ(Pool::GetStats().numCached_, 2);
+
+        // Not pooled.
+        Storage* s3 = Storage::Allocate(10000);
+        Storage::Release(s3);
+
+        nsfx::BufferStoragePoolStats stats = Pool::GetStats();
+        NSFX_TEST_EXPECT_EQ(stats.numAllocs_, 3);
+        NSFX_TEST_EXPECT_EQ(stats.numHits_, 1);
+        NSFX_TEST_EXPECT_EQ(stats.numCached_, 2);
+
+        Pool::Clear();
+        stats = Pool::GetStats();
+        NSFX_TEST_EXPECT_EQ(stats.numAllocs_, 0);
+        NSFX_TEST_EXPECT_EQ(stats.numCached_, 0);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Bound)/*{{{*/
+    {
+        Pool::Clear();
+        std::vector<Storage*> storages;
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            storages.push_back(Storage::Allocate(9000));
+        }
+        for (size_t i = 0; i < storages.size(); ++i)
+        {
+            Storage::Release(storages[i]);
+        }
+        nsfx::BufferStoragePoolStats stats = Pool::GetStats();
+        NSFX_TEST_EXPECT_LT(stats.numCached_ * 9000,
+                            2 * Pool::MAX_CACHED_BYTES);
+        Pool::Clear();
+    }/*}}}*/
+
+    NSFX_TEST_CASE(HitRate)/*{{{*/
+    {
+        Pool::Clear();
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            nsfx::ZcBuffer b0(1500, 500, 1000);
+            nsfx::ZcBuffer b1(b0);
+            b1.AddAtEnd(100);
+            nsfx::ZcBuffer b2(64);
+        }
+        nsfx::BufferStoragePoolStats stats = Pool::GetStats();
+        NSFX_TEST_EXPECT_GT(stats.GetHitRate(), 0.99);
+        Pool::Clear();
+    }/*}}}*/
+#endif // !defined(NSFX_NO_BUFFER_STORAGE_POOL) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // Create and destroy packets at line rate.
+        const size_t n = 2000000;
+        const size_t window = 64;
+        std::vector<nsfx::Packet> inflight(window);
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; ++i)
+        {
+            nsfx::PacketBuffer b(1500, 1460, 0);
+            b.AddAtStart(40);
+            // Replace the oldest packet.
+            inflight[i % window] = nsfx::Packet(b);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        double secs = std::chrono::duration<double>(t1 - t0).count();
+        inflight.clear();
+        std::cout << "Packets:  "
+                  << static_cast<uint64_t>(n / secs)
+                  << " per second." << std::endl;
+        std::cout << "Hit rate: " << Pool::GetStats().GetHitRate() << std::endl;
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
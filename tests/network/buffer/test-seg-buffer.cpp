@@ -0,0 +1,493 @@
+/**
+ * @file
+ *
+ * @brief Test SegBuffer.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/network/buffer.h>
+#include <iostream>
+#include <chrono>
+
+
+NSFX_TEST_SUITE(SegBuffer)
+{
+    NSFX_TEST_SUITE(Ctor)/*{{{*/
+    {
+        NSFX_TEST_CASE(Ctor0)
+        {
+            nsfx::SegBuffer b0;
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 0);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 0);
+            NSFX_TEST_EXPECT(b0.cbegin() == b0.cend());
+        }
+
+        NSFX_TEST_CASE(Ctor1)
+        {
+            nsfx::SegBuffer b0(1000);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 0);
+            // The empty segment reserves space.
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 1);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(0).GetCapacity(), 1000);
+            b0.AddAtStart(100);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 100);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 1);
+        }
+
+        NSFX_TEST_CASE(Ctor3)
+        {
+            nsfx::SegBuffer b0(1000, 300, 700);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 300);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 1);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(0).GetCapacity(), 2000);
+            nsfx::ConstSegBufferIterator it = b0.cbegin();
+            for (size_t i = 0; i < 300; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(it.Read<uint8_t>(), 0);
+            }
+            NSFX_TEST_EXPECT(it == b0.cend());
+        }
+
+        NSFX_TEST_CASE(FromBuffer)
+        {
+            nsfx::Buffer s0(100, 200, 100);
+            nsfx::SegBuffer b0(s0);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 200);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 1);
+            // The segment is shared.
+            NSFX_TEST_EXPECT(b0.GetSegment(0).GetStorage() == s0.GetStorage());
+        }
+    }/*}}}*/
+
+    NSFX_TEST_SUITE(Add)/*{{{*/
+    {
+        NSFX_TEST_CASE(InPlace)
+        {
+            nsfx::SegBuffer b0(100, 0, 100);
+            b0.AddAtStart(20);
+            b0.AddAtEnd(30);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 50);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 1);
+        }
+
+        NSFX_TEST_CASE(NewSegment)
+        {
+            nsfx::SegBuffer b0(10, 10, 10);
+            b0.AddAtStart(20);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 30);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 2);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(0).GetSize(), 20);
+            b0.AddAtEnd(20);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 50);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 3);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(2).GetSize(), 20);
+            // The new segments reserve space for later headers and trailers.
+            b0.AddAtStart(8);
+            b0.AddAtEnd(8);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 66);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 3);
+        }
+
+        NSFX_TEST_CASE(Contents)
+        {
+            const uint8_t h[] = { 1, 2, 3 };
+            const uint8_t t[] = { 7, 8, 9 };
+            nsfx::SegBuffer b0(0, 3, 0);
+            b0.AddAtStart(h, 3);
+            b0.AddAtEnd(t, 3);
+            uint8_t d[9];
+            NSFX_TEST_ASSERT_EQ(b0.CopyTo(d, sizeof (d)), 9);
+            const uint8_t e[] = { 1, 2, 3, 0, 0, 0, 7, 8, 9 };
+            for (size_t i = 0; i < 9; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(d[i], e[i]);
+            }
+        }
+
+        NSFX_TEST_CASE(Splice)
+        {
+            nsfx::SegBuffer h(0, 20, 0);
+            nsfx::SegBuffer p(0, 1000, 0);
+            nsfx::SegBuffer t(0, 4, 0);
+            nsfx::SegBuffer b0(p);
+            b0.AddAtStart(h);
+            b0.AddAtEnd(nsfx::ConstSegBuffer(t));
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 1024);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 3);
+            // The data is not copied.
+            NSFX_TEST_EXPECT(b0.GetSegment(0).GetStorage() ==
+                             h.GetSegment(0).GetStorage());
+            NSFX_TEST_EXPECT(b0.GetSegment(1).GetStorage() ==
+                             p.GetSegment(0).GetStorage());
+            NSFX_TEST_EXPECT(b0.GetSegment(2).GetStorage() ==
+                             t.GetSegment(0).GetStorage());
+            // The buffer itself.
+            b0.AddAtEnd(b0);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 2048);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 6);
+            NSFX_TEST_EXPECT_EQ(p.GetSize(), 1000);
+            NSFX_TEST_EXPECT_EQ(p.GetNumSegments(), 1);
+        }
+
+        NSFX_TEST_CASE(SpliceIntoReserved)
+        {
+            nsfx::SegBuffer b(0, 20, 0);
+            b.AddAtEnd(nsfx::SegBuffer(0, 30, 0));
+            NSFX_TEST_ASSERT_EQ(b.GetNumSegments(), 2);
+            // The empty segment that reserves space is replaced.
+            nsfx::SegBuffer b0(100);
+            b0.AddAtEnd(b);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 50);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 2);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(0).GetSize(), 20);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(1).GetSize(), 30);
+            nsfx::SegBuffer b1(100);
+            b1.AddAtStart(b);
+            NSFX_TEST_EXPECT_EQ(b1.GetSize(), 50);
+            NSFX_TEST_ASSERT_EQ(b1.GetNumSegments(), 2);
+            NSFX_TEST_EXPECT_EQ(b1.GetSegment(0).GetSize(), 20);
+            NSFX_TEST_EXPECT_EQ(b1.GetSegment(1).GetSize(), 30);
+        }
+
+        NSFX_TEST_CASE(FromBuffer)
+        {
+            nsfx::Buffer s0(1, 100, 1);
+            nsfx::SegBuffer b0;
+            b0.AddAtEnd(s0);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 1);
+            NSFX_TEST_EXPECT(b0.GetSegment(0).GetStorage() == s0.GetStorage());
+            // A const buffer is copied.
+            nsfx::ConstBuffer s1(s0);
+            b0.AddAtStart(s1);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 2);
+            NSFX_TEST_EXPECT(b0.GetSegment(0).GetStorage() != s0.GetStorage());
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 200);
+        }
+
+        NSFX_TEST_CASE(SharedSegment)
+        {
+            nsfx::Buffer s0(100, 100, 100);
+            nsfx::SegBuffer b0(s0);
+            nsfx::SegBuffer b1(s0);
+            // b0 expands the segment in place, and b1 cannot overwrite it.
+            b0.AddAtStart(10);
+            b1.AddAtStart(10);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 1);
+            NSFX_TEST_EXPECT_EQ(b1.GetNumSegments(), 2);
+            b0.begin().Write<uint8_t>(1);
+            b1.begin().Write<uint8_t>(2);
+            NSFX_TEST_EXPECT_EQ(b0.cbegin().Read<uint8_t>(), 1);
+            NSFX_TEST_EXPECT_EQ(b1.cbegin().Read<uint8_t>(), 2);
+        }
+    }/*}}}*/
+
+    NSFX_TEST_SUITE(Remove)/*{{{*/
+    {
+        NSFX_TEST_CASE(Start)
+        {
+            nsfx::SegBuffer b0(0, 10, 0);
+            b0.AddAtEnd(nsfx::SegBuffer(0, 20, 0));
+            b0.AddAtEnd(nsfx::SegBuffer(0, 30, 0));
+            b0.RemoveAtStart(10);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 50);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 2);
+            b0.RemoveAtStart(25);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 25);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 1);
+            NSFX_TEST_EXPECT_EQ(b0.GetSegment(0).GetSize(), 25);
+            b0.RemoveAtStart(100);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 0);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 0);
+        }
+
+        NSFX_TEST_CASE(End)
+        {
+            nsfx::SegBuffer b0(0, 10, 0);
+            b0.AddAtEnd(nsfx::SegBuffer(0, 20, 0));
+            b0.AddAtEnd(nsfx::SegBuffer(0, 30, 0));
+            b0.RemoveAtEnd(30);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 30);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 2);
+            b0.RemoveAtEnd(25);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 5);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 1);
+            b0.RemoveAtEnd(5);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 0);
+        }
+
+        NSFX_TEST_CASE(CopyOnWrite)
+        {
+            nsfx::SegBuffer b0(0, 10, 0);
+            b0.AddAtEnd(nsfx::SegBuffer(0, 20, 0));
+            nsfx::SegBuffer b1(b0);
+            b1.RemoveAtStart(15);
+            NSFX_TEST_EXPECT_EQ(b0.GetSize(), 30);
+            NSFX_TEST_EXPECT_EQ(b0.GetNumSegments(), 2);
+            NSFX_TEST_EXPECT_EQ(b1.GetSize(), 15);
+            NSFX_TEST_EXPECT_EQ(b1.GetNumSegments(), 1);
+        }
+    }/*}}}*/
+
+    NSFX_TEST_SUITE(Fragment)/*{{{*/
+    {
+        NSFX_TEST_CASE(Share)
+        {
+            nsfx::SegBuffer b0(0, 10, 0);
+            b0.AddAtEnd(nsfx::SegBuffer(0, 20, 0));
+            b0.AddAtEnd(nsfx::SegBuffer(0, 30, 0));
+            nsfx::SegBufferIterator it = b0.begin();
+            for (size_t i = 0; i < 60; ++i)
+            {
+                it.Write<uint8_t>(static_cast<uint8_t>(i));
+            }
+            nsfx::SegBuffer f0 = b0.MakeFragment(5, 30);
+            NSFX_TEST_EXPECT_EQ(f0.GetSize(), 30);
+            NSFX_TEST_ASSERT_EQ(f0.GetNumSegments(), 3);
+            NSFX_TEST_EXPECT(f0.GetSegment(1).GetStorage() ==
+                             b0.GetSegment(1).GetStorage());
+            nsfx::ConstSegBufferIterator it2 = f0.cbegin();
+            for (size_t i = 5; i < 35; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), i);
+            }
+            // The fragment cannot overwrite the data of the buffer.
+            f0.AddAtStart(1);
+            f0.AddAtEnd(1);
+            NSFX_TEST_EXPECT_EQ(f0.GetNumSegments(), 5);
+            f0.begin().Write<uint8_t>(0xff);
+            NSFX_TEST_EXPECT_EQ(b0.cbegin().Read<uint8_t>(), 0);
+        }
+
+        NSFX_TEST_CASE(Whole)
+        {
+            nsfx::SegBuffer b0(0, 10, 0);
+            nsfx::SegBuffer f0 = b0.MakeFragment(0, 10);
+            NSFX_TEST_EXPECT(f0.cbegin() == b0.cbegin());
+            nsfx::SegBuffer f1 = b0.MakeFragment(3, 0);
+            NSFX_TEST_EXPECT_EQ(f1.GetSize(), 0);
+        }
+
+        NSFX_TEST_CASE(RealBuffer)
+        {
+            nsfx::SegBuffer b0(0, 10, 0);
+            nsfx::Buffer r0 = b0.MakeRealBuffer();
+            NSFX_TEST_EXPECT(r0.GetStorage() == b0.GetSegment(0).GetStorage());
+            b0.AddAtEnd(nsfx::SegBuffer(0, 20, 0));
+            b0.begin().Write<uint8_t>(1);
+            nsfx::ConstSegBuffer c0(b0);
+            nsfx::ConstBuffer r1 = c0.MakeRealBuffer();
+            NSFX_TEST_EXPECT_EQ(r1.GetSize(), 30);
+            NSFX_TEST_EXPECT_EQ(r1.cbegin().Read<uint8_t>(), 1);
+        }
+    }/*}}}*/
+
+    NSFX_TEST_SUITE(Iterator)/*{{{*/
+    {
+        // Make a buffer that consists of 1-byte segments.
+        nsfx::SegBuffer MakeBuffer(size_t size)
+        {
+            nsfx::SegBuffer b;
+            for (size_t i = 0; i < size; ++i)
+            {
+                b.AddAtEnd(nsfx::Buffer(1, 1, 1));
+            }
+            return b;
+        }
+
+        NSFX_TEST_CASE(Straddle)
+        {
+            nsfx::SegBuffer b0 = MakeBuffer(16);
+            NSFX_TEST_ASSERT_EQ(b0.GetNumSegments(), 16);
+            nsfx::SegBufferIterator it = b0.begin();
+            it.Write<uint16_t>(0x0102);
+            it.WriteL<uint32_t>(0x03040506);
+            it.WriteB<uint32_t>(0x0708090a);
+            it.WriteB<uint16_t>(0x0b0c);
+            it.Fill(0xee, 4);
+            NSFX_TEST_EXPECT(it == b0.end());
+            nsfx::ConstSegBufferIterator it2 = b0.cbegin();
+            NSFX_TEST_EXPECT_EQ(it2.Read<uint16_t>(), 0x0102);
+            NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), 0x06);
+            it2 -= 1;
+            NSFX_TEST_EXPECT_EQ(it2.ReadL<uint32_t>(), 0x03040506);
+            NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), 0x07);
+            --it2;
+            NSFX_TEST_EXPECT_EQ(it2.ReadB<uint32_t>(), 0x0708090a);
+            NSFX_TEST_EXPECT_EQ(it2.ReadB<uint16_t>(), 0x0b0c);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), 0xee);
+            }
+            NSFX_TEST_EXPECT(it2 == b0.cend());
+            NSFX_TEST_EXPECT_EQ(it2 - b0.cbegin(), 16);
+        }
+
+        NSFX_TEST_CASE(Bytes)
+        {
+            nsfx::SegBuffer b0 = MakeBuffer(2);
+            b0.AddAtEnd(nsfx::Buffer(1, 5, 1));
+            b0.AddAtEnd(MakeBuffer(3));
+            const uint8_t d[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+            nsfx::SegBufferIterator it = b0.begin();
+            it.Write(d, sizeof (d));
+            uint8_t e[10];
+            nsfx::ConstSegBufferIterator it2 = b0.cbegin();
+            it2.Read(e, sizeof (e));
+            for (size_t i = 0; i < 10; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(e[i], d[i]);
+            }
+            it2 = b0.cbegin() + 3;
+            NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), 4);
+            it2 = b0.cend() - 2;
+            NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), 9);
+            // The same layout as a continuous buffer.
+            nsfx::Buffer r0(1, 10, 1);
+            nsfx::BufferIterator it3 = r0.begin();
+            it3.WriteB(d, sizeof (d));
+            it = b0.begin();
+            it.WriteB(d, sizeof (d));
+            it2 = b0.cbegin();
+            it2.Read(e, sizeof (e));
+            it3 = r0.begin();
+            for (size_t i = 0; i < 10; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(e[i], it3.Read<uint8_t>());
+            }
+            it2 = b0.cbegin();
+            it2.ReadB(e, sizeof (e));
+            for (size_t i = 0; i < 10; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(e[i], d[i]);
+            }
+            it = b0.begin();
+            it.WriteL(d, sizeof (d));
+            it2 = b0.cbegin();
+            it2.ReadL(e, sizeof (e));
+            for (size_t i = 0; i < 10; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(e[i], d[i]);
+            }
+        }
+
+        NSFX_TEST_CASE(Array)
+        {
+            // Segments of 7, 1, 13 and 7 bytes, so some elements straddle.
+            nsfx::SegBuffer b0;
+            b0.AddAtEnd(nsfx::Buffer(1, 7, 1));
+            b0.AddAtEnd(nsfx::Buffer(1, 1, 1));
+            b0.AddAtEnd(nsfx::Buffer(1, 13, 1));
+            b0.AddAtEnd(nsfx::Buffer(1, 7, 1));
+            NSFX_TEST_ASSERT_EQ(b0.GetSize(), 28);
+            const uint32_t d[] = { 0x01020304, 0x05060708, 0x090a0b0c,
+                                   0x0d0e0f10, 0x11121314, 0x15161718,
+                                   0x191a1b1c };
+            uint32_t e[7];
+            // The same layout as a continuous buffer.
+            nsfx::Buffer r0(1, 28, 1);
+            nsfx::BufferIterator it3 = r0.begin();
+            it3.WriteArrayB<uint32_t>(d, 7);
+            nsfx::SegBufferIterator it = b0.begin();
+            it.WriteArrayB<uint32_t>(d, 7);
+            NSFX_TEST_EXPECT(it == b0.end());
+            nsfx::ConstSegBufferIterator it2 = b0.cbegin();
+            it3 = r0.begin();
+            for (size_t i = 0; i < 28; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(it2.Read<uint8_t>(), it3.Read<uint8_t>());
+            }
+            it2 = b0.cbegin();
+            it2.ReadArrayB<uint32_t>(e, 7);
+            NSFX_TEST_EXPECT(it2 == b0.cend());
+            for (size_t i = 0; i < 7; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(e[i], d[i]);
+            }
+            it = b0.begin();
+            it.WriteArrayL<uint32_t>(d, 7);
+            it2 = b0.cbegin();
+            for (size_t i = 0; i < 7; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(it2.ReadL<uint32_t>(), d[i]);
+            }
+            it2 = b0.cbegin();
+            it2.ReadArrayL<uint32_t>(e, 7);
+            for (size_t i = 0; i < 7; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(e[i], d[i]);
+            }
+            const double f[] = { 1.5, -2.25, 1e100 };
+            double g[3];
+            it = b0.begin() + 1;
+            it.WriteArray<double>(f, 3);
+            it2 = b0.cbegin() + 1;
+            it2.ReadArray<double>(g, 3);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(g[i], f[i]);
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // Prepend a header to a payload, and make a fragment.
+        const size_t n = 1000000;
+        const size_t payloadSizes[] = { 1400, 8000 };
+        typedef std::chrono::high_resolution_clock  clock_type;
+        for (size_t k = 0; k < 2; ++k)
+        {
+            nsfx::Buffer payload(64, payloadSizes[k], 0);
+            nsfx::SegBuffer segPayload(payload);
+            size_t total = 0;
+
+            clock_type::time_point t0 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                nsfx::Buffer b(64, 0, 0);
+                b.AddAtStart(40);
+                b.AddAtEnd(payload);
+                nsfx::Buffer f = b.MakeFragment(20, 1000);
+                total += f.GetSize();
+            }
+            clock_type::time_point t1 = clock_type::now();
+            for (size_t i = 0; i < n; ++i)
+            {
+                nsfx::SegBuffer b(64, 0, 0);
+                b.AddAtStart(40);
+                b.AddAtEnd(segPayload);
+                nsfx::SegBuffer f = b.MakeFragment(20, 1000);
+                total += f.GetSize();
+            }
+            clock_type::time_point t2 = clock_type::now();
+            NSFX_TEST_EXPECT_EQ(total, 2 * n * 1000);
+
+            std::cout << "Payload: " << payloadSizes[k] << " bytes" << std::endl;
+            std::cout << "Buffer:    "
+                      << n / std::chrono::duration<double>(t1 - t0).count()
+                      << " packets/s" << std::endl;
+            std::cout << "SegBuffer: "
+                      << n / std::chrono::duration<double>(t2 - t1).count()
+                      << " packets/s" << std::endl;
+        }
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -198,6 +198,52 @@ NSFX_TEST_SUITE(Packet)
         }
     }/*}}}*/
 
+    NSFX_TEST_CASE(HeaderIo)/*{{{*/
+    {
+        typedef nsfx::Address<48>  Address;
+        const uint8_t x[] = { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc };
+        const Address a0(x, nsfx::big_endian);
+        const uint16_t ar0[3] = { 0x0102, 0x0304, 0x0506 };
+
+        nsfx::PacketBuffer b0(1000, 300, 700);
+        nsfx::Packet p0(b0);
+        // Serialize a header via the buffer I/O helpers.
+        nsfx::PacketBuffer h = p0.AddHeader(2 + 4 + sizeof (ar0) +
+                                            Address::GetSize());
+        auto it = h.begin();
+        nsfx::WriteB(it, (uint16_t)(0x1234));
+        nsfx::WriteL(it, (uint32_t)(0x56789abc));
+        nsfx::WriteB(it, ar0);
+        nsfx::Write(it, a0);
+        // Split the header into two fragments, so the fields that lie
+        // across the cut span two segments of a segmented packet buffer.
+        nsfx::Packet f0 = p0.MakeFragment(0, 3);
+        nsfx::Packet f1 = p0.MakeFragment(3, p0.GetSize() - 3);
+        nsfx::Packet p1(f1);
+        p1.AddHeader(f0);
+        // Deserialize the header via the buffer I/O helpers.
+        auto it1 = p1.GetBuffer().cbegin();
+        uint16_t v16 = 0;
+        nsfx::ReadB(it1, &v16);
+        NSFX_TEST_EXPECT_EQ(v16, 0x1234);
+        uint32_t v32 = 0;
+        nsfx::ReadL(it1, &v32);
+        NSFX_TEST_EXPECT_EQ(v32, 0x56789abc);
+        uint16_t ar1[3] = { 0 };
+        nsfx::ReadB(it1, &ar1);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            NSFX_TEST_EXPECT_EQ(ar1[i], ar0[i]);
+        }
+        Address a1;
+        nsfx::Read(it1, &a1);
+        NSFX_TEST_EXPECT_EQ(a1, a0);
+        for (size_t i = 0; i < 300; ++i)
+        {
+            NSFX_TEST_EXPECT_EQ(it1.Read<uint8_t>(), 0);
+        }
+    }/*}}}*/
+
     NSFX_TEST_CASE(ByteTag)/*{{{*/
     {
         nsfx::TagBuffer tb(16);
@@ -140,6 +140,27 @@ NSFX_TEST_SUITE(xoshiro)
         }
     }
 
+    NSFX_TEST_CASE(jump)
+    {
+        // The expected values are obtained by raising the transformation
+        // matrix of xoshiro256 to the power of 2^128.
+        nsfx::xoshiro256starstar r;
+        r.jump();
+        NSFX_TEST_EXPECT_EQ(r(), 0x332802f81eaae9d0ULL);
+        NSFX_TEST_EXPECT_EQ(r(), 0x02d18d7749b84f96ULL);
+        NSFX_TEST_EXPECT_EQ(r(), 0xc3729a527851f63dULL);
+
+        // The jumped generators produce different subsequences.
+        nsfx::xoshiro128starstar r1;
+        nsfx::xoshiro128starstar r2(r1);
+        r2.jump();
+        NSFX_TEST_EXPECT_NE(r1(), r2());
+        nsfx::xoshiro512starstar_01 r3;
+        nsfx::xoshiro512starstar_01 r4(r3);
+        r4.jump();
+        NSFX_TEST_EXPECT_NE(r3(), r4());
+    }
+
 }
 
 
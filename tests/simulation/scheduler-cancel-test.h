@@ -0,0 +1,116 @@
+/**
+ * @file
+ *
+ * @brief Test the cancellation of events of a scheduler.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#ifndef SCHEDULER_CANCEL_TEST_H__5B54CE59_1993_46E5_8CAD_B6B53D9A22E6
+#define SCHEDULER_CANCEL_TEST_H__5B54CE59_1993_46E5_8CAD_B6B53D9A22E6
+
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/i-scheduler.h>
+#include <nsfx/simulation/i-callable-scheduler.h>
+#include <nsfx/simulation/i-clock.h>
+#include <nsfx/component/object.h>
+#include <nsfx/component/class-registry.h>
+#include <vector>
+
+
+/**
+ * @brief A clock that stays at the epoch.
+ */
+struct CancelTestClock : nsfx::IClock/*{{{*/
+{
+    virtual ~CancelTestClock(void) {}
+
+    virtual nsfx::TimePoint Now(void) NSFX_OVERRIDE
+    {
+        return nsfx::TimePoint::Epoch();
+    }
+
+    NSFX_INTERFACE_MAP_BEGIN(CancelTestClock)
+        NSFX_INTERFACE_ENTRY(nsfx::IClock)
+    NSFX_INTERFACE_MAP_END()
+};/*}}}*/
+
+/**
+ * @brief Test the cancellation of events of a scheduler.
+ *
+ * @param[in] cid The CID of the scheduler.
+ */
+inline void TestCancel(const char* cid)/*{{{*/
+{
+    using nsfx::Ptr;
+    try
+    {
+        Ptr<nsfx::IScheduler> sch = nsfx::CreateObject<nsfx::IScheduler>(cid);
+        Ptr<nsfx::IClockUser>(sch)->Use(Ptr<nsfx::IClock>(
+            new nsfx::Object<CancelTestClock>));
+
+        std::vector<int> fired;
+        Ptr<nsfx::IEventHandle> h[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            h[i] = nsfx::ScheduleAt(sch, nsfx::TimePoint(nsfx::Duration(i)),
+                                    [&fired, i] { fired.push_back(i); });
+        }
+        NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 6);
+        // Cancel the first, a middle and the last event.
+        h[0]->Cancel();
+        h[3]->Cancel();
+        h[5]->Cancel();
+        NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 3);
+        NSFX_TEST_EXPECT(!h[3]->IsValid());
+        // Cancel twice.
+        h[3]->Cancel();
+        NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 3);
+        NSFX_TEST_EXPECT_EQ(sch->GetNextEvent()->GetTimePoint(),
+                            nsfx::TimePoint(nsfx::Duration(1)));
+        // Cancel another event within an event.
+        nsfx::ScheduleAt(sch, nsfx::TimePoint(nsfx::Duration(1)),
+                         [&] { h[4]->Cancel(); });
+        // Cancel the running event.
+        Ptr<nsfx::IEventHandle> self;
+        self = nsfx::ScheduleAt(sch, nsfx::TimePoint(nsfx::Duration(2)),
+                                [&] { self->Cancel(); fired.push_back(7); });
+        NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 5);
+        while (sch->GetNumEvents())
+        {
+            sch->FireAndRemoveNextEvent();
+        }
+        NSFX_TEST_ASSERT_EQ(fired.size(), 3);
+        NSFX_TEST_EXPECT_EQ(fired[0], 1);
+        NSFX_TEST_EXPECT_EQ(fired[1], 2);
+        NSFX_TEST_EXPECT_EQ(fired[2], 7);
+        // Cancel a fired event.
+        h[1]->Cancel();
+        NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 0);
+        // Cancel a pending event after the scheduler is released.
+        h[0] = nsfx::ScheduleAt(sch, nsfx::TimePoint(nsfx::Duration(9)),
+                                [] {});
+        sch = nullptr;
+        h[0]->Cancel();
+        NSFX_TEST_EXPECT(!h[0]->IsValid());
+    }
+    catch (boost::exception& e)
+    {
+        NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+    }
+    catch (std::exception& e)
+    {
+        NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+    }
+}/*}}}*/
+
+
+#endif // SCHEDULER_CANCEL_TEST_H__5B54CE59_1993_46E5_8CAD_B6B53D9A22E6
@@ -0,0 +1,364 @@
+/**
+ * @file
+ *
+ * @brief Test CalendarScheduler.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/calendar-scheduler.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include "scheduler-cancel-test.h"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+
+
+NSFX_TEST_SUITE(CalendarScheduler)
+{
+    using nsfx::Ptr;
+
+    static nsfx::TimePoint tp;
+    struct Sink : nsfx::IEventSink<> /*{{{*/
+    {
+        Sink() {}
+        Sink(nsfx::TimePoint tp) : tp_(tp) {}
+
+        virtual ~Sink(void) {}
+
+        virtual void Fire(void) NSFX_OVERRIDE
+        {
+            tp = tp_;
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Sink)
+            NSFX_INTERFACE_ENTRY(nsfx::IEventSink<>)
+        NSFX_INTERFACE_MAP_END()
+
+    private:
+        nsfx::TimePoint tp_;
+    };/*}}}*/
+    typedef nsfx::Object<Sink>  SinkClass;
+
+    static nsfx::TimePoint clk;
+    struct Clock : nsfx::IClock/*{{{*/
+    {
+        virtual ~Clock() {}
+
+        virtual nsfx::TimePoint Now() NSFX_OVERRIDE
+        {
+            return clk;
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Clock)
+            NSFX_INTERFACE_ENTRY(nsfx::IClock)
+        NSFX_INTERFACE_MAP_END()
+
+    };/*}}}*/
+    typedef nsfx::Object<Clock>  ClockClass;
+    NSFX_REGISTER_CLASS(Clock, "edu.uestc.nsfx.test.Clock");
+
+    NSFX_TEST_CASE(ExternalDriven)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> sch =
+                nsfx::CreateObject<nsfx::IScheduler>(
+                    "edu.uestc.nsfx.CalendarScheduler");
+            {
+                Ptr<nsfx::IClock> clock =
+                    nsfx::CreateObject<nsfx::IClock>(
+                        "edu.uestc.nsfx.test.Clock");
+                Ptr<nsfx::IClockUser>(sch)->Use(clock);
+            }
+            nsfx::TimePoint t1(nsfx::Duration(1));
+            nsfx::TimePoint t2(nsfx::Duration(2));
+            nsfx::TimePoint t3(nsfx::Duration(3));
+            Ptr<SinkClass> s1(new SinkClass(t1));
+            Ptr<SinkClass> s2(new SinkClass(t2));
+            Ptr<SinkClass> s3(new SinkClass(t3));
+            Ptr<SinkClass> s3_1(new SinkClass(t3));
+
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 0);
+            Ptr<nsfx::IEventHandle> h2 = sch->ScheduleAt(t2, s2);
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 1);
+            Ptr<nsfx::IEventHandle> h1 = sch->ScheduleAt(t1, s1);
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 2);
+            Ptr<nsfx::IEventHandle> h3 = sch->ScheduleAt(t3, s3);
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 3);
+
+            NSFX_TEST_EXPECT_EQ(sch->GetNextEvent()->GetTimePoint(), t1);
+            clk = t1;
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 2);
+            NSFX_TEST_EXPECT_EQ(clk, tp);
+
+            NSFX_TEST_EXPECT_EQ(sch->GetNextEvent()->GetTimePoint(), t2);
+            clk = t2;
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 1);
+            NSFX_TEST_EXPECT_EQ(clk, tp);
+
+            NSFX_TEST_EXPECT_EQ(sch->GetNextEvent()->GetTimePoint(), t3);
+            clk = t3;
+            sch->FireAndRemoveNextEvent();
+            // Do not save the handle.
+            /* Ptr<nsfx::IEventHandle> h3_1 = */ sch->ScheduleNow(s3_1);
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 1);
+            NSFX_TEST_EXPECT_EQ(clk, tp);
+
+            NSFX_TEST_EXPECT_EQ(sch->GetNextEvent()->GetTimePoint(), t3);
+            clk = t3;
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_ASSERT_EQ(sch->GetNumEvents(), 0);
+            NSFX_TEST_EXPECT_EQ(clk, tp);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Random)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> sch =
+                nsfx::CreateObject<nsfx::IScheduler>(
+                    "edu.uestc.nsfx.CalendarScheduler");
+            {
+                Ptr<nsfx::IClock> clock =
+                    nsfx::CreateObject<nsfx::IClock>(
+                        "edu.uestc.nsfx.test.Clock");
+                Ptr<nsfx::IClockUser>(sch)->Use(clock);
+            }
+            clk = nsfx::TimePoint::Epoch();
+
+            std::mt19937 g;
+            std::uniform_real_distribution<double> u(0, 1000);
+            // Schedule events.
+            for (size_t i = 0; i < 500; ++i)
+            {
+                double d = u(g);
+                nsfx::Duration dt(d, nsfx::round_downward);
+                nsfx::ScheduleAt(sch, nsfx::TimePoint(dt), [] {});
+            }
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 500);
+            // Fire events.
+            for (size_t i = 0; i < 200; ++i)
+            {
+                sch->FireAndRemoveNextEvent();
+            }
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 300);
+            // Schedule events.
+            for (size_t i = 0; i < 500; ++i)
+            {
+                double d = u(g);
+                nsfx::Duration dt(d, nsfx::round_downward);
+                nsfx::ScheduleIn(sch, dt, [] {});
+            }
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 800);
+            // Fire events.
+            for (size_t i = 0; i < 800; ++i)
+            {
+                sch->FireAndRemoveNextEvent();
+            }
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 0);
+
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(ScheduleDuringFire)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> sch =
+                nsfx::CreateObject<nsfx::IScheduler>(
+                    "edu.uestc.nsfx.CalendarScheduler");
+            {
+                Ptr<nsfx::IClock> clock =
+                    nsfx::CreateObject<nsfx::IClock>(
+                        "edu.uestc.nsfx.test.Clock");
+                Ptr<nsfx::IClockUser>(sch)->Use(clock);
+            }
+            clk = nsfx::TimePoint::Epoch();
+
+            size_t n = 0;
+            nsfx::ScheduleNow(sch, [&] {
+                ++n;
+                nsfx::ScheduleIn(sch, nsfx::Seconds(1), [&] { ++n; });
+            });
+
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_EXPECT_EQ(n, 1);
+
+            clk += nsfx::Seconds(1);
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_EXPECT_EQ(n, 2);
+
+        }
+        catch (boost::exception& e)
+        {
+            std::cout << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            std::cout << e.what() << std::endl;
+        }
+    }/*}}}*/
+    static nsfx::vector<nsfx::event_id_t> fired;
+    static Ptr<nsfx::IScheduler> Create(const char* cid)/*{{{*/
+    {
+        Ptr<nsfx::IScheduler> sch = nsfx::CreateObject<nsfx::IScheduler>(cid);
+        Ptr<nsfx::IClock> clock =
+            nsfx::CreateObject<nsfx::IClock>("edu.uestc.nsfx.test.Clock");
+        Ptr<nsfx::IClockUser>(sch)->Use(clock);
+        return sch;
+    }/*}}}*/
+
+    /**
+     * @brief Fire all events, and schedule new events during firing.
+     *
+     * The time points are drawn from distributions of very different scales,
+     * so the calendar queue is resized and the width of a day is re-estimated.
+     */
+    static void Drive(Ptr<nsfx::IScheduler> sch)/*{{{*/
+    {
+        clk = nsfx::TimePoint::Epoch();
+        fired.clear();
+        std::mt19937 g;
+        std::uniform_int_distribution<int> coarse(0, 100);
+        std::exponential_distribution<double> fine(1e6);
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            nsfx::Duration dt(nsfx::Seconds(coarse(g)));
+            nsfx::ScheduleIn(sch, dt, [] {});
+        }
+        size_t n = 0;
+        while (sch->GetNumEvents())
+        {
+            Ptr<nsfx::IEventHandle> h = sch->GetNextEvent();
+            NSFX_TEST_ASSERT(clk <= h->GetTimePoint());
+            clk = h->GetTimePoint();
+            fired.push_back(h->GetId());
+            h = nullptr;
+            sch->FireAndRemoveNextEvent();
+            if (++n < 20000)
+            {
+                // Many events happen at the same time.
+                if (n % 3 == 0)
+                {
+                    nsfx::ScheduleNow(sch, [] {});
+                }
+                nsfx::Duration dt(fine(g), nsfx::round_downward);
+                nsfx::ScheduleIn(sch, dt, [] {});
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Order)/*{{{*/
+    {
+        try
+        {
+            Drive(Create("edu.uestc.nsfx.HeapScheduler"));
+            nsfx::vector<nsfx::event_id_t> expected;
+            expected.swap(fired);
+            Drive(Create("edu.uestc.nsfx.CalendarScheduler"));
+            NSFX_TEST_ASSERT_EQ(fired.size(), expected.size());
+            NSFX_TEST_EXPECT(fired == expected);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Cancel)/*{{{*/
+    {
+        TestCancel("edu.uestc.nsfx.CalendarScheduler");
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // The classic hold model: a fixed number of events are pending,
+        // and each fired event schedules a new event.
+        try
+        {
+            const char* cids[] = {
+                "edu.uestc.nsfx.HeapScheduler",
+                "edu.uestc.nsfx.CalendarScheduler",
+            };
+            const size_t numPending = 100000;
+            const size_t numFired = 1000000;
+            for (size_t k = 0; k < sizeof (cids) / sizeof (cids[0]); ++k)
+            {
+                Ptr<nsfx::IScheduler> sch = Create(cids[k]);
+                clk = nsfx::TimePoint::Epoch();
+                std::mt19937 g;
+                std::exponential_distribution<double> u(1.0);
+                Ptr<SinkClass> sink(new SinkClass);
+                for (size_t i = 0; i < numPending; ++i)
+                {
+                    nsfx::Duration dt(u(g), nsfx::round_downward);
+                    sch->ScheduleIn(dt, sink);
+                }
+                auto t0 = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < numFired; ++i)
+                {
+                    clk = sch->GetNextEvent()->GetTimePoint();
+                    sch->FireAndRemoveNextEvent();
+                    nsfx::Duration dt(u(g), nsfx::round_downward);
+                    sch->ScheduleIn(dt, sink);
+                }
+                auto t1 = std::chrono::steady_clock::now();
+                double secs = std::chrono::duration<double>(t1 - t0).count();
+                std::cout << cids[k] << ": "
+                          << static_cast<uint64_t>(numFired / secs)
+                          << " events per second." << std::endl;
+                NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), numPending);
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
@@ -0,0 +1,348 @@
+/**
+ * @file
+ *
+ * @brief Test ICallableScheduler.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/list-scheduler.h>
+#include <nsfx/simulation/set-scheduler.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/calendar-scheduler.h>
+#include <nsfx/simulation/dary-heap-scheduler.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+
+NSFX_TEST_SUITE(CallableScheduler)
+{
+    using nsfx::Ptr;
+
+    static const char* schedulers[] = {
+        "edu.uestc.nsfx.ListScheduler",
+        "edu.uestc.nsfx.SetScheduler",
+        "edu.uestc.nsfx.HeapScheduler",
+        "edu.uestc.nsfx.CalendarScheduler",
+        "edu.uestc.nsfx.DaryHeapScheduler",
+    };
+
+    struct Fixture
+    {
+        explicit Fixture(const char* cid)
+        {
+            simulator_ = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            scheduler_ = nsfx::CreateObject<nsfx::IScheduler>(cid);
+            Ptr<nsfx::ISchedulerUser>(simulator_)->Use(scheduler_);
+            Ptr<nsfx::IClockUser>(scheduler_)->Use(
+                Ptr<nsfx::IClock>(simulator_));
+            callable_ = scheduler_;
+            clock_ = simulator_;
+        }
+
+        Ptr<nsfx::ISimulator> simulator_;
+        Ptr<nsfx::IScheduler> scheduler_;
+        Ptr<nsfx::ICallableScheduler> callable_;
+        Ptr<nsfx::IClock> clock_;
+    };
+
+    NSFX_TEST_CASE(EventCallable)/*{{{*/
+    {
+        const size_t capacity = nsfx::EventCallable::CAPACITY;
+        int n = 0;
+        auto small = [&n] { ++n; };
+        NSFX_TEST_EXPECT_LE(sizeof (small), capacity);
+
+        nsfx::EventCallable c0;
+        NSFX_TEST_EXPECT(c0.IsEmpty());
+        NSFX_TEST_EXPECT(!c0.IsArmed());
+
+        nsfx::EventCallable c1(small);
+        NSFX_TEST_EXPECT(!c1.IsEmpty());
+        NSFX_TEST_EXPECT(c1.IsArmed());
+        NSFX_TEST_EXPECT(c1.GetType() == typeid(small));
+        c1.Invoke();
+        NSFX_TEST_EXPECT_EQ(n, 1);
+
+        nsfx::EventCallable c2(std::move(c1));
+        NSFX_TEST_EXPECT(c1.IsEmpty());
+        NSFX_TEST_EXPECT(c2.IsArmed());
+        c2.Invoke();
+        NSFX_TEST_EXPECT_EQ(n, 2);
+
+        c2.Disarm();
+        NSFX_TEST_EXPECT(!c2.IsArmed());
+        NSFX_TEST_EXPECT(!c2.IsEmpty());
+        c2.Clear();
+        NSFX_TEST_EXPECT(c2.IsEmpty());
+
+        // A large callable is wrapped in an event sink.
+        char data[8 * sizeof (void*)] = {};
+        auto large = [&n, data] { n += 1 + data[0]; };
+        NSFX_TEST_EXPECT_GT(sizeof (large), capacity);
+        nsfx::EventCallable c3(large);
+        NSFX_TEST_EXPECT(c3.GetType() == typeid(large));
+        nsfx::EventCallable c4;
+        c4 = std::move(c3);
+        NSFX_TEST_EXPECT(c3.IsEmpty());
+        c4.Invoke();
+        NSFX_TEST_EXPECT_EQ(n, 3);
+
+        // The captured objects are destroyed with the callable.
+        std::shared_ptr<int> p(new int(0));
+        {
+            nsfx::EventCallable c5([p] { ++*p; });
+            NSFX_TEST_EXPECT_EQ(p.use_count(), 2);
+            c5.Invoke();
+        }
+        NSFX_TEST_EXPECT_EQ(*p, 1);
+        NSFX_TEST_EXPECT_EQ(p.use_count(), 1);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Order)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            try
+            {
+                Fixture f(schedulers[i]);
+                std::vector<int> order;
+                // Interleave event sinks and callables.
+                for (int j = 0; j < 20; ++j)
+                {
+                    nsfx::TimePoint t(nsfx::Seconds(j % 4));
+                    if (j % 2)
+                    {
+                        f.callable_->ScheduleAt(t, [&order, j] {
+                            order.push_back(j);
+                        });
+                    }
+                    else
+                    {
+                        f.scheduler_->ScheduleAt(t,
+                            nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                                nullptr, [&order, j] { order.push_back(j); }));
+                    }
+                }
+                f.callable_->ScheduleNow([&] {
+                    NSFX_TEST_EXPECT_EQ(f.clock_->Now(), nsfx::TimePoint());
+                    f.callable_->ScheduleIn(nsfx::Seconds(10), [&order] {
+                        order.push_back(100);
+                    });
+                });
+                f.simulator_->Run();
+                NSFX_TEST_ASSERT_EQ(order.size(), 21);
+                size_t k = 0;
+                for (int t = 0; t < 4; ++t)
+                {
+                    for (int j = t; j < 20; j += 4)
+                    {
+                        NSFX_TEST_EXPECT_EQ(order[k++], j) << schedulers[i];
+                    }
+                }
+                NSFX_TEST_EXPECT_EQ(order[k], 100);
+                NSFX_TEST_EXPECT_EQ(f.clock_->Now(),
+                                    nsfx::TimePoint(nsfx::Seconds(10)));
+            }
+            catch (boost::exception& e)
+            {
+                NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Cancel)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            try
+            {
+                Fixture f(schedulers[i]);
+                std::shared_ptr<int> p(new int(0));
+                Ptr<nsfx::IEventHandle> h1 = f.callable_->ScheduleIn(
+                    nsfx::Seconds(1), [p] { ++*p; });
+                Ptr<nsfx::IEventHandle> h2 = f.callable_->ScheduleIn(
+                    nsfx::Seconds(2), [p] { ++*p; });
+                NSFX_TEST_EXPECT_EQ(p.use_count(), 3);
+                NSFX_TEST_EXPECT(h1->IsPending());
+                NSFX_TEST_EXPECT(h1->IsValid());
+
+                // A cancelled callable is destroyed immediately.
+                h1->Cancel();
+                NSFX_TEST_EXPECT(!h1->IsPending());
+                NSFX_TEST_EXPECT(!h1->IsValid());
+                NSFX_TEST_EXPECT_EQ(p.use_count(), 2);
+                NSFX_TEST_EXPECT_EQ(f.scheduler_->GetNumEvents(), 1);
+
+                // A running callable cancels itself.
+                Ptr<nsfx::IEventHandle> h3;
+                h3 = f.callable_->ScheduleIn(nsfx::Seconds(3), [&h3, p] {
+                    NSFX_TEST_EXPECT(h3->IsRunning());
+                    h3->Cancel();
+                    NSFX_TEST_EXPECT(!h3->IsRunning());
+                    NSFX_TEST_EXPECT(!h3->IsValid());
+                    // The captured objects are still alive.
+                    ++*p;
+                });
+                f.simulator_->Run();
+                NSFX_TEST_EXPECT_EQ(*p, 2);
+                NSFX_TEST_EXPECT(!h2->IsValid());
+                NSFX_TEST_EXPECT(!h3->IsValid());
+                NSFX_TEST_EXPECT_EQ(p.use_count(), 1);
+
+                // The pending callables are destroyed with the scheduler.
+                {
+                    Ptr<nsfx::ICallableScheduler> scheduler =
+                        nsfx::CreateObject<nsfx::ICallableScheduler>(schedulers[i]);
+                    Ptr<nsfx::IClockUser>(scheduler)->Use(f.clock_);
+                    scheduler->ScheduleIn(nsfx::Seconds(1), [p] { ++*p; });
+                    NSFX_TEST_EXPECT_EQ(p.use_count(), 2);
+                }
+                NSFX_TEST_EXPECT_EQ(p.use_count(), 1);
+            }
+            catch (boost::exception& e)
+            {
+                NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Exception)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            Fixture f(schedulers[i]);
+            // Schedule in the past.
+            f.callable_->ScheduleIn(nsfx::Seconds(1), [&f] {
+                try
+                {
+                    f.callable_->ScheduleAt(nsfx::TimePoint(), [] {});
+                    NSFX_TEST_EXPECT(false);
+                }
+                catch (nsfx::InvalidArgument& )
+                {
+                    // Should come here.
+                }
+            });
+            // Schedule an empty callable.
+            try
+            {
+                f.callable_->ScheduleCallableNow(nsfx::EventCallable());
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::InvalidPointer& )
+            {
+                // Should come here.
+            }
+            // Throw from a callable.
+            Ptr<nsfx::IEventHandle> h = f.callable_->ScheduleIn(
+                nsfx::Seconds(2), [] {
+                    BOOST_THROW_EXCEPTION(nsfx::Unexpected());
+                });
+            try
+            {
+                f.simulator_->Run();
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::Unexpected& )
+            {
+                // Should come here.
+            }
+            NSFX_TEST_EXPECT(!h->IsValid());
+            NSFX_TEST_EXPECT_EQ(f.scheduler_->GetNumEvents(), 0);
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        const size_t numEvents = 1000000;
+        const size_t numPending = 1000;
+        for (size_t i = 2; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            double rates[2];
+            for (int callable = 0; callable < 2; ++callable)
+            {
+                Fixture f(schedulers[i]);
+                size_t n = 0;
+                // Each event reschedules itself, and the number of pending
+                // events stays constant.
+                struct Event
+                {
+                    Fixture* f_;
+                    size_t* n_;
+                    size_t numEvents_;
+                    void operator()(void) const
+                    {
+                        if (++*n_ < numEvents_)
+                        {
+                            f_->callable_->ScheduleIn(nsfx::Seconds(1), *this);
+                        }
+                    }
+                };
+                struct Sink
+                {
+                    Fixture* f_;
+                    size_t* n_;
+                    size_t numEvents_;
+                    void operator()(void) const
+                    {
+                        if (++*n_ < numEvents_)
+                        {
+                            f_->scheduler_->ScheduleIn(nsfx::Seconds(1),
+                                nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                                    nullptr, Sink(*this)));
+                        }
+                    }
+                };
+                for (size_t j = 0; j < numPending; ++j)
+                {
+                    nsfx::Duration dt(j);
+                    if (callable)
+                    {
+                        Event e = { &f, &n, numEvents };
+                        f.callable_->ScheduleIn(dt, e);
+                    }
+                    else
+                    {
+                        Sink e = { &f, &n, numEvents };
+                        f.scheduler_->ScheduleIn(dt,
+                            nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                                nullptr, std::move(e)));
+                    }
+                }
+                auto t0 = std::chrono::steady_clock::now();
+                f.simulator_->Run();
+                auto t1 = std::chrono::steady_clock::now();
+                NSFX_TEST_EXPECT_EQ(n, numEvents + numPending - 1);
+                rates[callable] = n /
+                    std::chrono::duration<double>(t1 - t0).count();
+            }
+            std::cout << schedulers[i] << ": "
+                      << rates[0] << " events/s via IEventSink, "
+                      << rates[1] << " events/s via callables." << std::endl;
+        }
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -0,0 +1,264 @@
+/**
+ * @file
+ *
+ * @brief Test the event injection and the real-time pacing of Simulator.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/list-scheduler.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+NSFX_TEST_SUITE(EventInjection)
+{
+    using nsfx::Ptr;
+
+    typedef std::chrono::steady_clock  ClockType;
+
+    struct Model
+    {
+        explicit Model(const char* cid)
+        {
+            simulator_ = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            scheduler_ = nsfx::CreateObject<nsfx::IScheduler>(cid);
+            Ptr<nsfx::ISchedulerUser>(simulator_)->Use(scheduler_);
+            Ptr<nsfx::IClockUser>(scheduler_)->Use(
+                Ptr<nsfx::IClock>(simulator_));
+            clock_ = simulator_;
+            injector_ = simulator_;
+            pacing_ = simulator_;
+        }
+
+        Ptr<nsfx::ISimulator> simulator_;
+        Ptr<nsfx::IScheduler> scheduler_;
+        Ptr<nsfx::IClock> clock_;
+        Ptr<nsfx::IEventInjector> injector_;
+        Ptr<nsfx::IRealTimePacing> pacing_;
+    };
+
+    static const char* schedulers[] = {
+        "edu.uestc.nsfx.HeapScheduler",
+        "edu.uestc.nsfx.ListScheduler",
+    };
+
+    NSFX_TEST_CASE(Inject)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            Model m(schedulers[i]);
+            std::vector<nsfx::TimePoint> fired;
+            nsfx::IClock* clock = m.clock_.Get();
+            auto record = [&fired, clock] {
+                return nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                    nullptr, [&fired, clock] { fired.push_back(clock->Now()); });
+            };
+            m.injector_->Inject(nsfx::TimePoint(nsfx::Seconds(2)), record());
+            m.injector_->InjectNow(record());
+            // The injected events are scheduled when the simulator runs.
+            NSFX_TEST_EXPECT_EQ(m.scheduler_->GetNumEvents(), 0);
+            m.simulator_->RunUntil(nsfx::TimePoint(nsfx::Seconds(5)));
+            NSFX_TEST_ASSERT_EQ(fired.size(), 2);
+            NSFX_TEST_EXPECT(fired[0] == nsfx::TimePoint());
+            NSFX_TEST_EXPECT(fired[1] == nsfx::TimePoint(nsfx::Seconds(2)));
+
+            // An event in the past is scheduled at the current time.
+            m.injector_->Inject(nsfx::TimePoint(nsfx::Seconds(1)), record());
+            m.simulator_->Run();
+            NSFX_TEST_ASSERT_EQ(fired.size(), 3);
+            NSFX_TEST_EXPECT(fired[2] == nsfx::TimePoint(nsfx::Seconds(5)));
+
+            try
+            {
+                m.injector_->InjectNow(nullptr);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::InvalidPointer& )
+            {
+                // Should come here.
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Concurrent)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            Model m(schedulers[i]);
+            const int numThreads = 4;
+            const int numEvents = 2000;
+            int counter = 0;
+            std::vector<int> last(numThreads, -1);
+            bool ordered = true;
+            std::vector<std::thread> threads;
+            for (int k = 0; k < numThreads; ++k)
+            {
+                nsfx::IEventInjector* injector = m.injector_.Get();
+                threads.push_back(std::thread([=, &counter, &last, &ordered] {
+                    for (int j = 0; j < numEvents; ++j)
+                    {
+                        injector->InjectNow(
+                            nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                                nullptr, [=, &counter, &last, &ordered] {
+                                    ++counter;
+                                    // The events of a thread are in order.
+                                    ordered = ordered && (last[k] < j);
+                                    last[k] = j;
+                                }));
+                    }
+                }));
+            }
+            // Run for 0.1 second of wall-clock time.
+            m.pacing_->EnablePacing(10);
+            m.simulator_->RunUntil(nsfx::TimePoint(nsfx::Seconds(1)));
+            for (auto it = threads.begin(); it != threads.end(); ++it)
+            {
+                it->join();
+            }
+            // Fire the events that are injected after the run.
+            m.pacing_->DisablePacing();
+            try
+            {
+                m.simulator_->Run();
+            }
+            catch (nsfx::NoScheduledEvent& )
+            {
+                // All events have been fired.
+            }
+            NSFX_TEST_EXPECT_EQ(counter, numThreads * numEvents);
+            NSFX_TEST_EXPECT(ordered);
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Pacing)/*{{{*/
+    {
+        Model m(schedulers[0]);
+        int counter = 0;
+        for (int i = 1; i <= 5; ++i)
+        {
+            m.scheduler_->ScheduleAt(
+                nsfx::TimePoint(nsfx::MilliSeconds(100 * i)),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [&] {
+                    ++counter;
+                }));
+        }
+        try
+        {
+            m.pacing_->EnablePacing(0);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+        // 0.5 second of simulation time in 0.05 second.
+        m.pacing_->EnablePacing(10);
+        NSFX_TEST_EXPECT(m.pacing_->IsPacing());
+        auto t0 = ClockType::now();
+        m.simulator_->Run();
+        double secs = std::chrono::duration<double>(ClockType::now() - t0).count();
+        NSFX_TEST_EXPECT_EQ(counter, 5);
+        NSFX_TEST_EXPECT_GE(secs, 0.049);
+        NSFX_TEST_EXPECT_LT(secs, 0.5);
+
+        // Run for a duration without events.
+        t0 = ClockType::now();
+        m.simulator_->RunFor(nsfx::MilliSeconds(200));
+        secs = std::chrono::duration<double>(ClockType::now() - t0).count();
+        NSFX_TEST_EXPECT_GE(secs, 0.019);
+        NSFX_TEST_EXPECT(m.clock_->Now() ==
+                         nsfx::TimePoint(nsfx::MilliSeconds(700)));
+
+        // Cannot change the pacing while running.
+        m.scheduler_->ScheduleNow(
+            nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [&] {
+                try
+                {
+                    m.pacing_->DisablePacing();
+                    NSFX_TEST_EXPECT(false);
+                }
+                catch (nsfx::IllegalMethodCall& )
+                {
+                    // Should come here.
+                }
+            }));
+        m.simulator_->Run();
+    }/*}}}*/
+
+    NSFX_TEST_CASE(WakeUp)/*{{{*/
+    {
+        Model m(schedulers[0]);
+        m.pacing_->EnablePacing(1);
+        nsfx::TimePoint paused;
+        nsfx::ISimulator* simulator = m.simulator_.Get();
+        nsfx::IClock* clock = m.clock_.Get();
+        nsfx::IEventInjector* injector = m.injector_.Get();
+        std::thread thread([=, &paused] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            injector->InjectNow(
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=, &paused] {
+                    paused = clock->Now();
+                    simulator->Pause();
+                }));
+        });
+        // The simulator waits for an hour, unless it is paused by an injected
+        // event.
+        auto t0 = ClockType::now();
+        m.simulator_->RunUntil(nsfx::TimePoint(nsfx::Hours(1)));
+        double secs = std::chrono::duration<double>(ClockType::now() - t0).count();
+        thread.join();
+        NSFX_TEST_EXPECT_LT(secs, 10);
+        // The event is scheduled at the simulation time of the wall-clock
+        // time.
+        NSFX_TEST_EXPECT(paused >= nsfx::TimePoint(nsfx::MilliSeconds(19)));
+        NSFX_TEST_EXPECT(paused < nsfx::TimePoint(nsfx::Seconds(10)));
+        NSFX_TEST_EXPECT(m.clock_->Now() == paused);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(FarTarget)/*{{{*/
+    {
+        Model m(schedulers[0]);
+        m.pacing_->EnablePacing(1);
+        nsfx::ISimulator* simulator = m.simulator_.Get();
+        nsfx::IEventInjector* injector = m.injector_.Get();
+        std::thread thread([=] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            injector->InjectNow(
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=] {
+                    simulator->Pause();
+                }));
+        });
+        // The target is more than one year away, and the simulator keeps
+        // waiting for it instead of jumping to it.
+        nsfx::TimePoint t(nsfx::Hours(24 * 365 * 10));
+        m.simulator_->RunUntil(t);
+        thread.join();
+        NSFX_TEST_EXPECT(m.clock_->Now() < nsfx::TimePoint(nsfx::Seconds(10)));
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -0,0 +1,306 @@
+/**
+ * @file
+ *
+ * @brief Test EventProfiler.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#define NSFX_SIMULATOR_USES_PROFILER
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/list-scheduler.h>
+#include <nsfx/simulation/timer-wheel-scheduler.h>
+#include <nsfx/event/event-sink.h>
+#include <nsfx/statistics/summary/summary.h>
+#include <iostream>
+
+
+NSFX_TEST_SUITE(EventProfiler)
+{
+    using nsfx::Ptr;
+    using nsfx::Object;
+
+    static int counter = 0;
+
+    struct Sink :
+        nsfx::IEventSink<>
+    {
+        virtual ~Sink(void) {}
+
+        virtual void Fire(void) NSFX_OVERRIDE
+        {
+            ++counter;
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Sink)
+            NSFX_INTERFACE_ENTRY(nsfx::IEventSink<>)
+        NSFX_INTERFACE_MAP_END()
+    };
+
+    Ptr<nsfx::ISimulator> CreateSimulator(const char* schedulerCid,
+                                          Ptr<nsfx::IScheduler>& scheduler)
+    {
+        Ptr<nsfx::ISimulator> simulator = nsfx::CreateObject<nsfx::ISimulator>(
+            "edu.uestc.nsfx.Simulator");
+        scheduler = nsfx::CreateObject<nsfx::IScheduler>(schedulerCid);
+        Ptr<nsfx::ISchedulerUser>(simulator)->Use(scheduler);
+        Ptr<nsfx::IClockUser>(scheduler)->Use(Ptr<nsfx::IClock>(simulator));
+        return simulator;
+    }
+
+    void Schedule(const char* schedulerCid)
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> scheduler;
+            Ptr<nsfx::ISimulator> simulator =
+                CreateSimulator(schedulerCid, scheduler);
+            Ptr<nsfx::IEventProfiler> profiler(simulator);
+
+            Ptr<nsfx::ISummary> eventTime = nsfx::CreateObject<nsfx::ISummary>(
+                "edu.uestc.nsfx.Summary");
+            Ptr<nsfx::ISummary> queueDepth = nsfx::CreateObject<nsfx::ISummary>(
+                "edu.uestc.nsfx.Summary");
+            Ptr<nsfx::ISummary> eventRate = nsfx::CreateObject<nsfx::ISummary>(
+                "edu.uestc.nsfx.Summary");
+            Ptr<nsfx::IProbeContainer> probes(simulator);
+            probes->Connect("event time",  eventTime);
+            probes->Connect("queue depth", queueDepth);
+            probes->Connect("event rate",  eventRate);
+
+            counter = 0;
+            int lambdaCounter = 0;
+            Ptr<nsfx::IEventSink<>> sink(new Object<Sink>);
+            Ptr<nsfx::IEventSink<>> lambda = nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                nullptr, [&] { ++lambdaCounter; });
+            for (int i = 0; i < 10; ++i)
+            {
+                scheduler->ScheduleIn(nsfx::Seconds(i), sink);
+            }
+            for (int i = 0; i < 5; ++i)
+            {
+                scheduler->ScheduleIn(nsfx::Seconds(i),
+                                      nsfx::LabelEventSink("backoff", lambda));
+            }
+            for (int i = 0; i < 3; ++i)
+            {
+                scheduler->ScheduleIn(nsfx::Seconds(i),
+                                      nsfx::LabelEventSink("timeout", sink));
+            }
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 0);
+
+            simulator->RunUntil(nsfx::TimePoint(nsfx::Seconds(4)));
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 3 + 5 + 5);
+            simulator->Run();
+            NSFX_TEST_EXPECT_EQ(counter, 10 + 3);
+            NSFX_TEST_EXPECT_EQ(lambdaCounter, 5);
+
+            // Counts.
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 18);
+            NSFX_TEST_EXPECT_GE(profiler->GetEventTime(), 0);
+            NSFX_TEST_EXPECT_GE(profiler->GetRunTime(), profiler->GetEventTime());
+            NSFX_TEST_EXPECT_GE(profiler->GetEventRate(), 0);
+
+            // Profiles.
+            nsfx::vector<nsfx::EventProfile> profiles = profiler->GetEventProfiles();
+            NSFX_TEST_ASSERT_EQ(profiles.size(), 3);
+            uint64_t numEvents = 0;
+            double wallTime = 0;
+            bool foundBackoff = false;
+            bool foundTimeout = false;
+            bool foundSink = false;
+            for (size_t i = 0; i < profiles.size(); ++i)
+            {
+                const nsfx::EventProfile& profile = profiles[i];
+                numEvents += profile.numEvents_;
+                wallTime  += profile.wallTime_;
+                if (i > 0)
+                {
+                    NSFX_TEST_EXPECT_GE(profiles[i-1].wallTime_, profile.wallTime_);
+                }
+                if (profile.name_ == "backoff")
+                {
+                    NSFX_TEST_EXPECT_EQ(profile.numEvents_, 5);
+                    foundBackoff = true;
+                }
+                else if (profile.name_ == "timeout")
+                {
+                    NSFX_TEST_EXPECT_EQ(profile.numEvents_, 3);
+                    foundTimeout = true;
+                }
+                else
+                {
+                    // Named after the dynamic type.
+                    NSFX_TEST_EXPECT(profile.name_.find("Sink") != std::string::npos);
+                    NSFX_TEST_EXPECT_EQ(profile.numEvents_, 10);
+                    foundSink = true;
+                }
+            }
+            NSFX_TEST_EXPECT(foundBackoff);
+            NSFX_TEST_EXPECT(foundTimeout);
+            NSFX_TEST_EXPECT(foundSink);
+            NSFX_TEST_EXPECT_EQ(numEvents, 18);
+            NSFX_TEST_EXPECT_GE(wallTime, 0);
+
+            // Histogram.
+            // The queue depth is sampled after the event is removed.
+            nsfx::vector<uint64_t> histogram = profiler->GetQueueDepthHistogram();
+            NSFX_TEST_ASSERT_EQ(histogram.size(), 6);
+            uint64_t sum = 0;
+            for (size_t i = 0; i < histogram.size(); ++i)
+            {
+                sum += histogram[i];
+            }
+            NSFX_TEST_EXPECT_EQ(sum, 18);
+            NSFX_TEST_EXPECT_EQ(histogram[0], 1);  // 0
+            NSFX_TEST_EXPECT_EQ(histogram[1], 1);  // 1
+            NSFX_TEST_EXPECT_EQ(histogram[2], 2);  // 2, 3
+            NSFX_TEST_EXPECT_EQ(histogram[3], 4);  // 4 ~ 7
+            NSFX_TEST_EXPECT_EQ(histogram[4], 8);  // 8 ~ 15
+            NSFX_TEST_EXPECT_EQ(histogram[5], 2);  // 16, 17
+
+            // Probes.
+            NSFX_TEST_EXPECT_EQ(eventTime->Count(), 18);
+            NSFX_TEST_EXPECT_EQ(queueDepth->Count(), 18);
+            NSFX_TEST_EXPECT_EQ(queueDepth->Max(), 17);
+            NSFX_TEST_EXPECT_EQ(queueDepth->Min(), 0);
+            NSFX_TEST_EXPECT_LE(eventRate->Count(), 2);
+            NSFX_TEST_EXPECT(probes->GetProbe("event time:backoff"));
+            NSFX_TEST_EXPECT(probes->GetProbe("event time:timeout"));
+
+            // Reset.
+            profiler->Reset();
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 0);
+            NSFX_TEST_EXPECT_EQ(profiler->GetEventTime(), 0);
+            NSFX_TEST_EXPECT_EQ(profiler->GetRunTime(), 0);
+            NSFX_TEST_EXPECT(profiler->GetEventProfiles().empty());
+            NSFX_TEST_EXPECT(profiler->GetQueueDepthHistogram().empty());
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }
+
+    NSFX_TEST_CASE(HeapScheduler)
+    {
+        Schedule("edu.uestc.nsfx.HeapScheduler");
+    }
+
+    NSFX_TEST_CASE(ListScheduler)
+    {
+        Schedule("edu.uestc.nsfx.ListScheduler");
+    }
+
+    NSFX_TEST_CASE(Callable)
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> scheduler;
+            Ptr<nsfx::ISimulator> simulator =
+                CreateSimulator("edu.uestc.nsfx.HeapScheduler", scheduler);
+            Ptr<nsfx::IEventProfiler> profiler(simulator);
+            Ptr<nsfx::ICallableScheduler> callable(scheduler);
+            int n = 0;
+            auto f = [&n] { ++n; };
+            for (int i = 0; i < 3; ++i)
+            {
+                callable->ScheduleIn(nsfx::Seconds(i), f);
+            }
+            simulator->Run();
+            NSFX_TEST_EXPECT_EQ(n, 3);
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 3);
+            // Named after the type of the callable.
+            nsfx::vector<nsfx::EventProfile> profiles = profiler->GetEventProfiles();
+            NSFX_TEST_ASSERT_EQ(profiles.size(), 1);
+            NSFX_TEST_EXPECT_EQ(profiles[0].numEvents_, 3);
+            NSFX_TEST_EXPECT_EQ(profiles[0].name_,
+                                boost::core::demangle(typeid(f).name()));
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }
+
+    NSFX_TEST_CASE(TimerWheelScheduler)
+    {
+        // The tick events and the relay events are not profiled.
+        try
+        {
+            Ptr<nsfx::ISimulator> simulator = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            Ptr<nsfx::IScheduler> wheel = nsfx::CreateObject<nsfx::IScheduler>(
+                "edu.uestc.nsfx.TimerWheelScheduler");
+            Ptr<nsfx::IScheduler> heap = nsfx::CreateObject<nsfx::IScheduler>(
+                "edu.uestc.nsfx.HeapScheduler");
+            Ptr<nsfx::IClockUser>(heap)->Use(Ptr<nsfx::IClock>(simulator));
+            Ptr<nsfx::IClockUser>(wheel)->Use(Ptr<nsfx::IClock>(simulator));
+            Ptr<nsfx::ISchedulerUser>(wheel)->Use(heap);
+            Ptr<nsfx::ISchedulerUser>(simulator)->Use(wheel);
+            Ptr<nsfx::IEventProfiler> profiler(simulator);
+            Ptr<nsfx::IEventSink<>> sink(new Object<Sink>);
+            counter = 0;
+            for (int i = 0; i < 10; ++i)
+            {
+                wheel->ScheduleIn(nsfx::MilliSeconds(10 * i + 5), sink);
+            }
+            simulator->Run();
+            NSFX_TEST_EXPECT_EQ(counter, 10);
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 10);
+            nsfx::vector<nsfx::EventProfile> profiles = profiler->GetEventProfiles();
+            NSFX_TEST_ASSERT_EQ(profiles.size(), 1);
+            NSFX_TEST_EXPECT_EQ(profiles[0].numEvents_, 10);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }
+
+    NSFX_TEST_CASE(Performance)
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> scheduler;
+            Ptr<nsfx::ISimulator> simulator =
+                CreateSimulator("edu.uestc.nsfx.HeapScheduler", scheduler);
+            Ptr<nsfx::IEventProfiler> profiler(simulator);
+            Ptr<nsfx::IEventSink<>> sink(new Object<Sink>);
+            for (int i = 0; i < 100000; ++i)
+            {
+                scheduler->ScheduleIn(nsfx::Duration(i), sink);
+            }
+            simulator->Run();
+            NSFX_TEST_EXPECT_EQ(profiler->GetNumEvents(), 100000);
+            std::cout << "EventProfiler: "
+                      << profiler->GetEventRate() << " events/s, "
+                      << profiler->GetEventTime() / profiler->GetNumEvents() * 1e9
+                      << " ns/event in event sinks." << std::endl;
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -0,0 +1,296 @@
+/**
+ * @file
+ *
+ * @brief Test EventTracer.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#define NSFX_SIMULATOR_USES_TRACER
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/list-scheduler.h>
+#include <nsfx/simulation/event-tracer.h>
+#include <nsfx/simulation/event-profiler.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+
+NSFX_TEST_SUITE(EventTracer)
+{
+    using nsfx::Ptr;
+    using nsfx::Object;
+
+    static const char* filename = "test-event-tracer.trace";
+
+    static int counter = 0;
+
+    struct Sink :
+        nsfx::IEventSink<>
+    {
+        virtual ~Sink(void) {}
+
+        virtual void Fire(void) NSFX_OVERRIDE
+        {
+            ++counter;
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Sink)
+            NSFX_INTERFACE_ENTRY(nsfx::IEventSink<>)
+        NSFX_INTERFACE_MAP_END()
+    };
+
+    void Trace(const char* schedulerCid)
+    {
+        try
+        {
+            Ptr<nsfx::ISimulator> simulator = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            Ptr<nsfx::IScheduler> scheduler =
+                nsfx::CreateObject<nsfx::IScheduler>(schedulerCid);
+            Ptr<nsfx::ISchedulerUser>(simulator)->Use(scheduler);
+            Ptr<nsfx::IClockUser>(scheduler)->Use(Ptr<nsfx::IClock>(simulator));
+
+            Ptr<nsfx::IEventTracer> tracer = nsfx::CreateObject<nsfx::IEventTracer>(
+                "edu.uestc.nsfx.EventTracer");
+            Ptr<nsfx::ISimulatorUser>(tracer)->Use(simulator);
+            Ptr<nsfx::ISchedulerUser>(tracer)->Use(scheduler);
+            // A small buffer to test the flushes.
+            tracer->SetBufferSize(7);
+
+            counter = 0;
+            Ptr<nsfx::IEventSink<>> sink(new Object<Sink>);
+            for (int i = 0; i < 10; ++i)
+            {
+                scheduler->ScheduleAt(nsfx::TimePoint(nsfx::Seconds(i)), sink);
+                scheduler->ScheduleAt(nsfx::TimePoint(nsfx::Seconds(i)),
+                                      nsfx::LabelEventSink("labeled", sink));
+            }
+            // Not traced, since the trace file is not open.
+            simulator->RunUntil(nsfx::TimePoint(nsfx::Seconds(1)));
+            NSFX_TEST_EXPECT_EQ(counter, 4);
+            NSFX_TEST_EXPECT_EQ(tracer->GetNumRecords(), 0);
+
+            tracer->Open(filename);
+            try
+            {
+                tracer->SetBufferSize(10);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::IllegalMethodCall& )
+            {
+                // Should come here.
+            }
+            simulator->RunUntil(nsfx::TimePoint(nsfx::Seconds(5)));
+            Ptr<nsfx::ICallableScheduler>(scheduler)->ScheduleIn(
+                nsfx::Seconds(1), [] { ++counter; });
+            simulator->Run();
+            NSFX_TEST_EXPECT_EQ(counter, 21);
+            NSFX_TEST_EXPECT_EQ(tracer->GetNumRecords(), 17);
+            tracer->Close();
+
+            std::ifstream is(filename, std::ios_base::binary);
+            nsfx::EventTraceReader reader(is);
+            NSFX_TEST_EXPECT_EQ(reader.GetTicksPerSecond(),
+                                nsfx::Duration(nsfx::Seconds(1)).GetCount());
+            nsfx::EventTraceRecord record;
+            size_t n = 0;
+            size_t numLabeled = 0;
+            size_t numCallables = 0;
+            uint64_t wallTime = 0;
+            int64_t simTime = 0;
+            while (reader.Read(record))
+            {
+                NSFX_TEST_EXPECT_GE(record.wallTime_, wallTime);
+                NSFX_TEST_EXPECT_GE(record.simTime_, simTime);
+                NSFX_TEST_EXPECT_GE(record.simTime_,
+                                    nsfx::Duration(nsfx::Seconds(2)).GetCount());
+                wallTime = record.wallTime_;
+                simTime = record.simTime_;
+                const std::string& label = reader.GetLabel(record.label_);
+                if (label == "labeled")
+                {
+                    ++numLabeled;
+                }
+                else if (label.find("Sink") == std::string::npos)
+                {
+                    ++numCallables;
+                }
+                ++n;
+            }
+            NSFX_TEST_EXPECT_EQ(n, 17);
+            NSFX_TEST_EXPECT_EQ(numLabeled, 8);
+            NSFX_TEST_EXPECT_EQ(numCallables, 1);
+            NSFX_TEST_EXPECT_EQ(reader.GetLabels().size(), 3);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e);
+        }
+        std::remove(filename);
+    }
+
+    NSFX_TEST_CASE(HeapScheduler)
+    {
+        Trace("edu.uestc.nsfx.HeapScheduler");
+    }
+
+    NSFX_TEST_CASE(ListScheduler)
+    {
+        Trace("edu.uestc.nsfx.ListScheduler");
+    }
+
+    NSFX_TEST_CASE(Depth)
+    {
+        Ptr<nsfx::ISimulator> simulator = nsfx::CreateObject<nsfx::ISimulator>(
+            "edu.uestc.nsfx.Simulator");
+        Ptr<nsfx::IScheduler> scheduler = nsfx::CreateObject<nsfx::IScheduler>(
+            "edu.uestc.nsfx.ListScheduler");
+        Ptr<nsfx::ISchedulerUser>(simulator)->Use(scheduler);
+        Ptr<nsfx::IClockUser>(scheduler)->Use(Ptr<nsfx::IClock>(simulator));
+        Ptr<nsfx::IEventTracer> tracer = nsfx::CreateObject<nsfx::IEventTracer>(
+            "edu.uestc.nsfx.EventTracer");
+        Ptr<nsfx::ISimulatorUser>(tracer)->Use(simulator);
+        Ptr<nsfx::ISchedulerUser>(tracer)->Use(scheduler);
+        Ptr<nsfx::IEventSink<>> sink(new Object<Sink>);
+        for (int i = 0; i < 5; ++i)
+        {
+            scheduler->ScheduleAt(nsfx::TimePoint(nsfx::Seconds(i)), sink);
+        }
+        tracer->Open(filename);
+        simulator->Run();
+        tracer->Close();
+
+        std::ifstream is(filename, std::ios_base::binary);
+        nsfx::EventTraceReader reader(is);
+        nsfx::EventTraceRecord record;
+        uint32_t depth = 5;
+        nsfx::event_id_t id = 0;
+        while (reader.Read(record))
+        {
+            // The number of pending events decreases.
+            NSFX_TEST_EXPECT_LT(record.depth_, depth);
+            depth = record.depth_;
+            NSFX_TEST_EXPECT_EQ(record.eventId_, id);
+            ++id;
+        }
+        NSFX_TEST_EXPECT_EQ(id, 5);
+        is.close();
+        std::remove(filename);
+    }
+
+    NSFX_TEST_CASE(Json)
+    {
+        Ptr<nsfx::ISimulator> simulator = nsfx::CreateObject<nsfx::ISimulator>(
+            "edu.uestc.nsfx.Simulator");
+        Ptr<nsfx::IScheduler> scheduler = nsfx::CreateObject<nsfx::IScheduler>(
+            "edu.uestc.nsfx.HeapScheduler");
+        Ptr<nsfx::ISchedulerUser>(simulator)->Use(scheduler);
+        Ptr<nsfx::IClockUser>(scheduler)->Use(Ptr<nsfx::IClock>(simulator));
+        Ptr<nsfx::IEventTracer> tracer = nsfx::CreateObject<nsfx::IEventTracer>(
+            "edu.uestc.nsfx.EventTracer");
+        Ptr<nsfx::ISimulatorUser>(tracer)->Use(simulator);
+        Ptr<nsfx::IEventSink<>> sink(new Object<Sink>);
+        scheduler->ScheduleAt(nsfx::TimePoint(nsfx::MilliSeconds(1500)),
+                              nsfx::LabelEventSink("mac \"backoff\"", sink));
+        scheduler->ScheduleAt(nsfx::TimePoint(nsfx::Seconds(2)), sink);
+        tracer->Open(filename);
+        simulator->Run();
+        tracer->Close();
+
+        std::ifstream is(filename, std::ios_base::binary);
+        std::ostringstream os;
+        NSFX_TEST_EXPECT_EQ(nsfx::ConvertEventTraceToJson(is, os), 2);
+        std::string json = os.str();
+        NSFX_TEST_EXPECT(json.find("\"traceEvents\"") != std::string::npos);
+        NSFX_TEST_EXPECT(json.find("\"name\":\"mac \\\"backoff\\\"\"") !=
+                         std::string::npos);
+        NSFX_TEST_EXPECT(json.find("\"time\":1.5000000000") !=
+                         std::string::npos);
+        NSFX_TEST_EXPECT(json.find("\"ph\":\"C\"") != std::string::npos);
+        NSFX_TEST_EXPECT(json.substr(json.size() - 4) == "\n]}\n");
+        is.close();
+        std::remove(filename);
+    }
+
+    NSFX_TEST_CASE(BadTrace)
+    {
+        {
+            std::istringstream is("NOTATRCE");
+            try
+            {
+                nsfx::EventTraceReader reader(is);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadEventTrace& )
+            {
+                // Should come here.
+            }
+        }
+        {
+            // A record block that refers to an undefined label.
+            std::string data("NSFXTRCE");
+            nsfx::EventTraceFormat::Put(data, 1, 4);
+            nsfx::EventTraceFormat::Put(data, 10000000000ULL, 8);
+            nsfx::EventTraceFormat::Put(data, 2, 1);
+            nsfx::EventTraceFormat::Put(data, 1, 4);
+            data.append(40, '\0');
+            std::istringstream is(data);
+            nsfx::EventTraceReader reader(is);
+            nsfx::EventTraceRecord record;
+            try
+            {
+                reader.Read(record);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadEventTrace& )
+            {
+                // Should come here.
+            }
+        }
+        {
+            // Truncated.
+            std::string data("NSFXTRCE");
+            nsfx::EventTraceFormat::Put(data, 1, 4);
+            nsfx::EventTraceFormat::Put(data, 10000000000ULL, 8);
+            nsfx::EventTraceFormat::Put(data, 1, 1);
+            nsfx::EventTraceFormat::Put(data, 5, 4);
+            data += "ab";
+            std::istringstream is(data);
+            nsfx::EventTraceReader reader(is);
+            nsfx::EventTraceRecord record;
+            try
+            {
+                reader.Read(record);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::BadEventTrace& )
+            {
+                // Should come here.
+            }
+        }
+    }
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -15,8 +15,11 @@
 
 #include <nsfx/test.h>
 #include <nsfx/simulation/heap-scheduler.h>
+#include "scheduler-cancel-test.h"
 #include <iostream>
+#include <vector>
 #include <random>
+#include <chrono>
 
 
 NSFX_TEST_SUITE(HeapScheduler)
@@ -223,6 +226,132 @@ NSFX_TEST_SUITE(HeapScheduler)
             std::cout << e.what() << std::endl;
         }
     }
+
+    NSFX_TEST_CASE(Recycle)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::IScheduler> sch =
+                nsfx::CreateObject<nsfx::IScheduler>(
+                    "edu.uestc.nsfx.HeapScheduler");
+            {
+                Ptr<nsfx::IClock> clock =
+                    nsfx::CreateObject<nsfx::IClock>(
+                        "edu.uestc.nsfx.test.Clock");
+                Ptr<nsfx::IClockUser>(sch)->Use(clock);
+            }
+            clk = nsfx::TimePoint::Epoch();
+
+            size_t n = 0;
+            // The handle is not held by the user, and shall be recycled.
+            nsfx::ScheduleNow(sch, [&] { ++n; });
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_EXPECT_EQ(n, 1);
+
+            // The handle is held by the user, and shall remain valid.
+            Ptr<nsfx::IEventHandle> h1 = nsfx::ScheduleNow(sch, [&] { ++n; });
+            Ptr<nsfx::IEventHandle> h2 = nsfx::ScheduleNow(sch, [&] { ++n; });
+            NSFX_TEST_EXPECT_NE(h1.Get(), h2.Get());
+            NSFX_TEST_EXPECT_EQ(h1->GetId(), 1);
+            NSFX_TEST_EXPECT_EQ(h2->GetId(), 2);
+            h2->Cancel();
+            sch->FireAndRemoveNextEvent();
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_EXPECT_EQ(n, 2);
+            NSFX_TEST_EXPECT(!h1->IsValid());
+            NSFX_TEST_EXPECT(!h2->IsValid());
+            NSFX_TEST_EXPECT_EQ(h1->GetId(), 1);
+            NSFX_TEST_EXPECT_EQ(h2->GetId(), 2);
+
+            // A recycled handle is not shared with the handles held by users.
+            Ptr<nsfx::IEventHandle> h3 = nsfx::ScheduleNow(sch, [&] { ++n; });
+            NSFX_TEST_EXPECT_NE(h3.Get(), h1.Get());
+            NSFX_TEST_EXPECT_NE(h3.Get(), h2.Get());
+            NSFX_TEST_EXPECT_EQ(h3->GetId(), 3);
+            NSFX_TEST_EXPECT(h3->IsPending());
+            sch->FireAndRemoveNextEvent();
+            NSFX_TEST_EXPECT_EQ(n, 3);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Cancel)/*{{{*/
+    {
+        TestCancel("edu.uestc.nsfx.HeapScheduler");
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // The classic hold model: a fixed number of events are pending,
+        // and each fired event schedules a new event.
+        // If the event handles are held by the user, they cannot be recycled,
+        // and every event allocates a new event handle.
+        try
+        {
+            const size_t numPending = 10000;
+            const size_t numFired = 1000000;
+            std::mt19937 g;
+            std::exponential_distribution<double> u(1.0);
+            for (int hold = 1; hold >= 0; --hold)
+            {
+                Ptr<nsfx::IScheduler> sch =
+                    nsfx::CreateObject<nsfx::IScheduler>(
+                        "edu.uestc.nsfx.HeapScheduler");
+                {
+                    Ptr<nsfx::IClock> clock =
+                        nsfx::CreateObject<nsfx::IClock>(
+                            "edu.uestc.nsfx.test.Clock");
+                    Ptr<nsfx::IClockUser>(sch)->Use(clock);
+                }
+                clk = nsfx::TimePoint::Epoch();
+                Ptr<SinkClass> sink(new SinkClass);
+                nsfx::vector<Ptr<nsfx::IEventHandle>> handles(numPending);
+                for (size_t i = 0; i < numPending; ++i)
+                {
+                    nsfx::Duration dt(u(g), nsfx::round_downward);
+                    Ptr<nsfx::IEventHandle> h = sch->ScheduleIn(dt, sink);
+                    if (hold)
+                    {
+                        handles[i] = std::move(h);
+                    }
+                }
+                auto t0 = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < numFired; ++i)
+                {
+                    clk = sch->GetNextEvent()->GetTimePoint();
+                    sch->FireAndRemoveNextEvent();
+                    nsfx::Duration dt(u(g), nsfx::round_downward);
+                    Ptr<nsfx::IEventHandle> h = sch->ScheduleIn(dt, sink);
+                    if (hold)
+                    {
+                        handles[i % numPending] = std::move(h);
+                    }
+                }
+                auto t1 = std::chrono::steady_clock::now();
+                double secs = std::chrono::duration<double>(t1 - t0).count();
+                std::cout << (hold ? "Handles held:     "
+                                   : "Handles recycled: ")
+                          << static_cast<uint64_t>(numFired / secs)
+                          << " events per second." << std::endl;
+                NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), numPending);
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
 }
 
 
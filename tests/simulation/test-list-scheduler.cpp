@@ -15,7 +15,9 @@
 
 #include <nsfx/test.h>
 #include <nsfx/simulation/list-scheduler.h>
+#include "scheduler-cancel-test.h"
 #include <iostream>
+#include <vector>
 #include <random>
 
 
@@ -185,6 +187,11 @@ NSFX_TEST_SUITE(ListScheduler)
         }
     }/*}}}*/
 
+    NSFX_TEST_CASE(Cancel)/*{{{*/
+    {
+        TestCancel("edu.uestc.nsfx.ListScheduler");
+    }/*}}}*/
+
 }
 
 
@@ -0,0 +1,635 @@
+/**
+ * @file
+ *
+ * @brief Test OptimisticSimulator.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/optimistic-simulator.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+NSFX_TEST_SUITE(OptimisticSimulator)
+{
+    using nsfx::Ptr;
+
+    /**
+     * @brief The configuration of a PHOLD model.
+     */
+    struct PholdConfig/*{{{*/
+    {
+        uint32_t numLps_;
+        uint32_t population_;
+        // The probability (in percent) that an event is sent to another LP.
+        uint32_t remote_;
+        // The minimum delay.
+        nsfx::Duration lookahead_;
+        // The mean of the exponential delay (in ticks).
+        double mean_;
+        nsfx::TimePoint end_;
+    };/*}}}*/
+
+    /**
+     * @brief A logical process of the PHOLD model.
+     *
+     * When an event is fired, the LP sends a new event to itself or to a
+     * random LP, with an exponential delay.
+     * The random number generator is a part of the state of the LP.
+     */
+    class PholdLp :/*{{{*/
+        public nsfx::IStateSaver
+    {
+        typedef PholdLp  ThisClass;
+
+    public:
+        struct State
+        {
+            State(void) : rng_(0), count_(0), checksum_(0) {}
+
+            uint64_t rng_;
+            uint64_t count_;
+            uint64_t checksum_;
+        };
+
+        PholdLp(void) :
+            index_(0),
+            lps_(nullptr),
+            config_(nullptr),
+            optimistic_(nullptr),
+            simulator_(nullptr),
+            paused_(nullptr)
+        {}
+
+        virtual ~PholdLp(void) {}
+
+        void OnEvent(void)
+        {
+            // Do not use the test macros, since they are not thread-safe.
+            nsfx::TimePoint now = clock_->Now();
+            ++state_.count_;
+            state_.checksum_ = (state_.checksum_ * 1099511628211ULL) ^
+                               static_cast<uint64_t>(now.GetDuration().GetCount());
+            if (paused_ && pauseAt_ <= now && !paused_->exchange(true))
+            {
+                simulator_->Pause();
+            }
+            if (now < config_->end_)
+            {
+                Send();
+            }
+        }
+
+        void Send(void)
+        {
+            uint32_t dst = index_;
+            if (Next() % 100 < config_->remote_)
+            {
+                dst = static_cast<uint32_t>(Next() % config_->numLps_);
+            }
+            double u = static_cast<double>(Next() >> 11) / 9007199254740992.0;
+            nsfx::Duration dt = config_->lookahead_ +
+                nsfx::Duration(static_cast<int64_t>(
+                    -std::log(1 - u) * config_->mean_));
+            PholdLp* lp = (*lps_)[dst];
+            Ptr<nsfx::IEventSink<>> sink =
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                    nullptr, [lp] { lp->OnEvent(); });
+            if (optimistic_)
+            {
+                optimistic_->ScheduleRemote(index_, dst, dt, std::move(sink));
+            }
+            else
+            {
+                scheduler_->ScheduleIn(dt, std::move(sink));
+            }
+        }
+
+        // SplitMix64.
+        uint64_t Next(void)
+        {
+            uint64_t z = (state_.rng_ += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        // IStateSaver
+        virtual void SaveState(uint64_t checkpoint) NSFX_OVERRIDE
+        {
+            saved_.push_back(std::make_pair(checkpoint, state_));
+        }
+
+        virtual void RestoreState(uint64_t checkpoint) NSFX_OVERRIDE
+        {
+            while (saved_.back().first > checkpoint)
+            {
+                saved_.pop_back();
+            }
+            state_ = saved_.back().second;
+            saved_.pop_back();
+        }
+
+        virtual void CommitState(uint64_t checkpoint) NSFX_OVERRIDE
+        {
+            while (saved_.size() && saved_.front().first < checkpoint)
+            {
+                saved_.pop_front();
+            }
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+            NSFX_INTERFACE_ENTRY(nsfx::IStateSaver)
+        NSFX_INTERFACE_MAP_END()
+
+    public:
+        uint32_t index_;
+        std::vector<PholdLp*>* lps_;
+        const PholdConfig* config_;
+        nsfx::IOptimisticSimulator* optimistic_;
+        nsfx::ISimulator* simulator_;
+        Ptr<nsfx::IClock> clock_;
+        Ptr<nsfx::IScheduler> scheduler_;
+        State state_;
+        std::deque<std::pair<uint64_t, State>> saved_;
+        // Pause the simulator once.
+        std::atomic<bool>* paused_;
+        nsfx::TimePoint pauseAt_;
+    };/*}}}*/
+
+    typedef nsfx::Object<PholdLp>  PholdLpClass;
+
+    struct PholdResult/*{{{*/
+    {
+        std::vector<uint64_t> counts_;
+        std::vector<uint64_t> checksums_;
+        uint64_t total_;
+        uint64_t committed_;
+        uint64_t rolledBack_;
+        double secs_;
+    };/*}}}*/
+
+    /**
+     * @brief Run a PHOLD model.
+     *
+     * @param[in] numThreads If it is `0`, the model is run by a sequential
+     *                       simulator.
+     * @param[in] pause Pause the simulator once in the middle.
+     */
+    static PholdResult RunPhold(const PholdConfig& config,
+                                uint32_t numThreads,
+                                bool pause = false)/*{{{*/
+    {
+        PholdResult result;
+        result.total_ = 0;
+        result.committed_ = 0;
+        result.rolledBack_ = 0;
+        std::atomic<bool> paused(false);
+        std::vector<Ptr<PholdLpClass>> objects;
+        std::vector<PholdLp*> lps;
+        for (uint32_t i = 0; i < config.numLps_; ++i)
+        {
+            objects.push_back(Ptr<PholdLpClass>(new PholdLpClass));
+            PholdLp* lp = objects.back().Get();
+            lp->index_ = i;
+            lp->lps_ = &lps;
+            lp->config_ = &config;
+            lp->state_.rng_ = i;
+            lp->paused_ = pause ? &paused : nullptr;
+            lp->pauseAt_ = nsfx::TimePoint(config.end_.GetDuration() / 2);
+            lps.push_back(lp);
+        }
+        Ptr<nsfx::ISimulator> simulator;
+        Ptr<nsfx::IOptimisticSimulator> optimistic;
+        Ptr<nsfx::IScheduler> scheduler;
+        if (numThreads)
+        {
+            optimistic = nsfx::CreateObject<nsfx::IOptimisticSimulator>(
+                "edu.uestc.nsfx.OptimisticSimulator");
+            optimistic->SetNumThreads(numThreads);
+            simulator = optimistic;
+            for (uint32_t i = 0; i < config.numLps_; ++i)
+            {
+                optimistic->AddPartition();
+                lps[i]->optimistic_ = optimistic.Get();
+                lps[i]->clock_ = optimistic->GetClock(i);
+                lps[i]->scheduler_ = optimistic->GetScheduler(i);
+                optimistic->AddStateSaver(i, Ptr<nsfx::IStateSaver>(objects[i]));
+            }
+        }
+        else
+        {
+            simulator = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            scheduler = nsfx::CreateObject<nsfx::IScheduler>(
+                "edu.uestc.nsfx.HeapScheduler");
+            nsfx::Ptr<nsfx::ISchedulerUser>(simulator)->Use(scheduler);
+            nsfx::Ptr<nsfx::IClockUser>(scheduler)->Use(
+                nsfx::Ptr<nsfx::IClock>(simulator));
+            for (uint32_t i = 0; i < config.numLps_; ++i)
+            {
+                lps[i]->clock_ = simulator;
+                lps[i]->scheduler_ = scheduler;
+            }
+        }
+        for (uint32_t i = 0; i < config.numLps_; ++i)
+        {
+            lps[i]->simulator_ = simulator.Get();
+            for (uint32_t j = 0; j < config.population_; ++j)
+            {
+                lps[i]->Send();
+            }
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        simulator->Run();
+        if (pause)
+        {
+            NSFX_TEST_EXPECT(paused.load());
+            NSFX_TEST_EXPECT(Ptr<nsfx::IClock>(simulator)->Now() < config.end_);
+            simulator->Run();
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        result.secs_ = std::chrono::duration<double>(t1 - t0).count();
+        for (uint32_t i = 0; i < config.numLps_; ++i)
+        {
+            result.counts_.push_back(lps[i]->state_.count_);
+            result.checksums_.push_back(lps[i]->state_.checksum_);
+            result.total_ += lps[i]->state_.count_;
+            NSFX_TEST_EXPECT_EQ(lps[i]->scheduler_->GetNumEvents(), 0);
+            lps[i]->clock_ = nullptr;
+            lps[i]->scheduler_ = nullptr;
+        }
+        if (optimistic)
+        {
+            result.committed_ = optimistic->GetNumCommittedEvents();
+            result.rolledBack_ = optimistic->GetNumRolledBackEvents();
+        }
+        return result;
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Phold)
+    {
+        PholdConfig config;
+        config.numLps_ = 16;
+        config.population_ = 4;
+        config.remote_ = 50;
+        config.lookahead_ = nsfx::Duration(1);
+        config.mean_ = 1e9;
+        config.end_ = nsfx::TimePoint(nsfx::Seconds(20));
+        PholdResult expected = RunPhold(config, 0);
+        NSFX_TEST_ASSERT(expected.total_ > 0);
+        uint32_t threads[] = { 1, 2, 4 };
+        for (size_t i = 0; i < sizeof (threads) / sizeof (threads[0]); ++i)
+        {
+            PholdResult result = RunPhold(config, threads[i]);
+            NSFX_TEST_EXPECT(result.counts_ == expected.counts_);
+            NSFX_TEST_EXPECT(result.checksums_ == expected.checksums_);
+            NSFX_TEST_EXPECT_EQ(result.committed_, expected.total_);
+        }
+        // Pause in the middle.
+        {
+            PholdResult result = RunPhold(config, 4, true);
+            NSFX_TEST_EXPECT(result.counts_ == expected.counts_);
+            NSFX_TEST_EXPECT(result.checksums_ == expected.checksums_);
+            NSFX_TEST_EXPECT_EQ(result.committed_, expected.total_);
+        }
+    }
+
+    /**
+     * @brief A component that records the events it fires.
+     */
+    class Recorder :/*{{{*/
+        public nsfx::IStateSaver
+    {
+        typedef Recorder  ThisClass;
+
+    public:
+        virtual ~Recorder(void) {}
+
+        virtual void SaveState(uint64_t checkpoint) NSFX_OVERRIDE
+        {
+            saved_.push_back(std::make_pair(checkpoint, log_.size()));
+        }
+
+        virtual void RestoreState(uint64_t checkpoint) NSFX_OVERRIDE
+        {
+            while (saved_.back().first > checkpoint)
+            {
+                saved_.pop_back();
+            }
+            log_.resize(saved_.back().second);
+            saved_.pop_back();
+        }
+
+        virtual void CommitState(uint64_t checkpoint) NSFX_OVERRIDE
+        {
+            while (saved_.size() && saved_.front().first < checkpoint)
+            {
+                saved_.pop_front();
+            }
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(ThisClass)
+            NSFX_INTERFACE_ENTRY(nsfx::IStateSaver)
+        NSFX_INTERFACE_MAP_END()
+
+    public:
+        std::vector<int> log_;
+        std::deque<std::pair<uint64_t, size_t>> saved_;
+    };/*}}}*/
+
+    typedef nsfx::Object<Recorder>  RecorderClass;
+
+    NSFX_TEST_CASE(Rollback)
+    {
+        // Partition 1 fires the events at 1us, 2us, ..., 20us.
+        // Partition 0 fires an event at 10us, which sends a remote event to
+        // partition 1 at 12us.
+        // The event at 3us in partition 1 waits until the event at 10us in
+        // partition 0 is fired, and sends a remote event to partition 0 at 5us.
+        // Thus, partition 0 must roll back its event at 10us, and partition 1
+        // receives an anti-message for its remote event at 12us.
+        Ptr<nsfx::IOptimisticSimulator> simulator =
+            nsfx::CreateObject<nsfx::IOptimisticSimulator>(
+                "edu.uestc.nsfx.OptimisticSimulator");
+        simulator->SetNumThreads(2);
+        Ptr<RecorderClass> r0(new RecorderClass);
+        Ptr<RecorderClass> r1(new RecorderClass);
+        simulator->AddPartition();
+        simulator->AddPartition();
+        simulator->AddStateSaver(0, Ptr<nsfx::IStateSaver>(r0));
+        simulator->AddStateSaver(1, Ptr<nsfx::IStateSaver>(r1));
+        Ptr<nsfx::IScheduler> s0 = simulator->GetScheduler(0);
+        Ptr<nsfx::IScheduler> s1 = simulator->GetScheduler(1);
+        nsfx::IOptimisticSimulator* sim = simulator.Get();
+        Recorder* log0 = r0.Get();
+        Recorder* log1 = r1.Get();
+        std::atomic<bool> fired(false);
+        std::atomic<bool>* flag = &fired;
+        nsfx::ScheduleAt(s0, nsfx::TimePoint(nsfx::MicroSeconds(10)),
+                         [=] {
+            log0->log_.push_back(10);
+            sim->ScheduleRemote(0, 1, nsfx::MicroSeconds(2),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                    nullptr, [=] { log1->log_.push_back(-12); }));
+            *flag = true;
+        });
+        for (int i = 1; i <= 20; ++i)
+        {
+            nsfx::ScheduleAt(s1, nsfx::TimePoint(nsfx::MicroSeconds(i)),
+                             [=] {
+                log1->log_.push_back(i);
+                if (i == 3)
+                {
+                    while (!*flag)
+                    {
+                        std::this_thread::yield();
+                    }
+                    sim->ScheduleRemote(1, 0, nsfx::MicroSeconds(2),
+                        nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                            nullptr, [=] { log0->log_.push_back(-5); }));
+                }
+            });
+        }
+        Ptr<nsfx::ISimulator>(simulator)->Run();
+        std::vector<int> expected0 = { -5, 10 };
+        std::vector<int> expected1 = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+                                       -12, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+        NSFX_TEST_EXPECT(log0->log_ == expected0);
+        NSFX_TEST_EXPECT(log1->log_ == expected1);
+        NSFX_TEST_EXPECT_EQ(simulator->GetNumCommittedEvents(), 23);
+        NSFX_TEST_EXPECT_GE(simulator->GetNumRolledBackEvents(), 1);
+        NSFX_TEST_EXPECT(r0->saved_.empty());
+        NSFX_TEST_EXPECT(r1->saved_.empty());
+        NSFX_TEST_EXPECT_EQ(Ptr<nsfx::IClock>(simulator)->Now(),
+                            nsfx::TimePoint(nsfx::MicroSeconds(20)));
+    }
+
+    NSFX_TEST_CASE(RollbackSameTime)
+    {
+        // Partition 3 sends an event E to partition 0 at 10us.
+        // E schedules an event S at 10us, which precedes E, since S is
+        // scheduled by partition 0.
+        // The event at 1us in partition 1 waits until S is fired, and sends
+        // a remote event R to partition 0 at 10us.
+        // R precedes E but not S, thus both S and E must be rolled back.
+        Ptr<nsfx::IOptimisticSimulator> simulator =
+            nsfx::CreateObject<nsfx::IOptimisticSimulator>(
+                "edu.uestc.nsfx.OptimisticSimulator");
+        simulator->SetNumThreads(2);
+        Ptr<RecorderClass> r0(new RecorderClass);
+        for (int i = 0; i < 4; ++i)
+        {
+            simulator->AddPartition();
+        }
+        simulator->AddStateSaver(0, Ptr<nsfx::IStateSaver>(r0));
+        Ptr<nsfx::IScheduler> s0 = simulator->GetScheduler(0);
+        Ptr<nsfx::IScheduler> s1 = simulator->GetScheduler(1);
+        nsfx::IOptimisticSimulator* sim = simulator.Get();
+        nsfx::IScheduler* scheduler0 = s0.Get();
+        Recorder* log0 = r0.Get();
+        std::atomic<bool> fired(false);
+        std::atomic<bool>* flag = &fired;
+        sim->ScheduleRemote(3, 0, nsfx::MicroSeconds(10),
+            nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=] {
+                log0->log_.push_back(3);
+                nsfx::ScheduleNow(scheduler0, [=] {
+                    log0->log_.push_back(0);
+                    *flag = true;
+                });
+            }));
+        nsfx::ScheduleAt(s1, nsfx::TimePoint(nsfx::MicroSeconds(1)), [=] {
+            while (!*flag)
+            {
+                std::this_thread::yield();
+            }
+            sim->ScheduleRemote(1, 0, nsfx::MicroSeconds(9),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                    nullptr, [=] { log0->log_.push_back(1); }));
+        });
+        Ptr<nsfx::ISimulator>(simulator)->Run();
+        std::vector<int> expected = { 1, 3, 0 };
+        NSFX_TEST_EXPECT(log0->log_ == expected);
+        NSFX_TEST_EXPECT_EQ(simulator->GetNumCommittedEvents(), 4);
+        NSFX_TEST_EXPECT_GE(simulator->GetNumRolledBackEvents(), 2);
+        NSFX_TEST_EXPECT(r0->saved_.empty());
+    }
+
+    NSFX_TEST_CASE(Cancel)
+    {
+        Ptr<nsfx::IOptimisticSimulator> simulator =
+            nsfx::CreateObject<nsfx::IOptimisticSimulator>(
+                "edu.uestc.nsfx.OptimisticSimulator");
+        simulator->SetNumThreads(1);
+        simulator->AddPartition();
+        Ptr<nsfx::IScheduler> scheduler = simulator->GetScheduler(0);
+        int counter = 0;
+        Ptr<nsfx::IEventHandle> h1 =
+            nsfx::ScheduleIn(scheduler, nsfx::Seconds(1), [&] { ++counter; });
+        Ptr<nsfx::IEventHandle> h2 =
+            nsfx::ScheduleIn(scheduler, nsfx::Seconds(2), [&] { ++counter; });
+        NSFX_TEST_EXPECT_EQ(scheduler->GetNumEvents(), 2);
+        h1->Cancel();
+        NSFX_TEST_EXPECT(!h1->IsValid());
+        NSFX_TEST_EXPECT(h2->IsPending());
+        NSFX_TEST_EXPECT_EQ(scheduler->GetNumEvents(), 1);
+        NSFX_TEST_EXPECT(scheduler->GetNextEvent() == h2);
+        Ptr<nsfx::ISimulator>(simulator)->Run();
+        NSFX_TEST_EXPECT_EQ(counter, 1);
+        NSFX_TEST_EXPECT(!h2->IsValid());
+        NSFX_TEST_EXPECT_EQ(simulator->GetNumCommittedEvents(), 1);
+        try
+        {
+            scheduler->FireAndRemoveNextEvent();
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::IllegalMethodCall& )
+        {
+            // Should come here.
+        }
+    }
+
+    NSFX_TEST_CASE(RunUntil)
+    {
+        Ptr<nsfx::IOptimisticSimulator> simulator =
+            nsfx::CreateObject<nsfx::IOptimisticSimulator>(
+                "edu.uestc.nsfx.OptimisticSimulator");
+        simulator->SetNumThreads(2);
+        simulator->AddPartition();
+        simulator->AddPartition();
+        Ptr<nsfx::ISimulator> sim(simulator);
+        Ptr<nsfx::IClock> clock(simulator);
+        std::vector<int> fired;
+        try
+        {
+            sim->Run();
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::NoScheduledEvent& )
+        {
+            // Should come here.
+        }
+        try
+        {
+            simulator->ScheduleRemote(0, 1, nsfx::Duration(-1),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [] {}));
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+        try
+        {
+            simulator->GetScheduler(2);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::OutOfBounds& )
+        {
+            // Should come here.
+        }
+        try
+        {
+            simulator->SetGvtInterval(0);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+        Ptr<nsfx::IScheduler> s0 = simulator->GetScheduler(0);
+        Ptr<nsfx::IScheduler> s1 = simulator->GetScheduler(1);
+        nsfx::ScheduleIn(s0, nsfx::Seconds(1), [] {});
+        nsfx::ScheduleIn(s1, nsfx::Seconds(3), [] {});
+        sim->RunUntil(nsfx::TimePoint(nsfx::Seconds(2)));
+        NSFX_TEST_EXPECT_EQ(clock->Now(), nsfx::TimePoint(nsfx::Seconds(2)));
+        NSFX_TEST_EXPECT_EQ(simulator->GetClock(0)->Now(),
+                            nsfx::TimePoint(nsfx::Seconds(2)));
+        NSFX_TEST_EXPECT_EQ(simulator->GetClock(1)->Now(),
+                            nsfx::TimePoint(nsfx::Seconds(2)));
+        NSFX_TEST_EXPECT_EQ(s0->GetNumEvents(), 0);
+        NSFX_TEST_EXPECT_EQ(s1->GetNumEvents(), 1);
+        sim->Run();
+        NSFX_TEST_EXPECT_EQ(clock->Now(), nsfx::TimePoint(nsfx::Seconds(3)));
+        NSFX_TEST_EXPECT_EQ(s1->GetNumEvents(), 0);
+        NSFX_TEST_EXPECT_EQ(simulator->GetNumCommittedEvents(), 2);
+    }
+
+    NSFX_TEST_CASE(Exception)
+    {
+        Ptr<nsfx::IOptimisticSimulator> simulator =
+            nsfx::CreateObject<nsfx::IOptimisticSimulator>(
+                "edu.uestc.nsfx.OptimisticSimulator");
+        simulator->SetNumThreads(2);
+        simulator->AddPartition();
+        simulator->AddPartition();
+        nsfx::ScheduleIn(simulator->GetScheduler(0), nsfx::Seconds(1), [] {});
+        nsfx::ScheduleIn(simulator->GetScheduler(1), nsfx::Seconds(1), [] {
+            BOOST_THROW_EXCEPTION(nsfx::Unexpected());
+        });
+        try
+        {
+            Ptr<nsfx::ISimulator>(simulator)->Run();
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::Unexpected& )
+        {
+            // Should come here.
+        }
+    }
+
+    NSFX_TEST_CASE(Performance)
+    {
+        PholdConfig config;
+        config.numLps_ = 64;
+        config.population_ = 8;
+        config.remote_ = 90;
+        config.lookahead_ = nsfx::Duration(1);
+        config.mean_ = 1e9;
+        config.end_ = nsfx::TimePoint(nsfx::Seconds(20));
+        PholdResult expected = RunPhold(config, 0);
+        std::cout << "PHOLD: " << config.numLps_ << " LPs, "
+                  << expected.total_ << " events" << std::endl;
+        std::cout << "  Simulator: "
+                  << expected.total_ / expected.secs_ << " events/s"
+                  << std::endl;
+        uint32_t threads[] = { 1, 2, 4 };
+        for (size_t i = 0; i < sizeof (threads) / sizeof (threads[0]); ++i)
+        {
+            PholdResult result = RunPhold(config, threads[i]);
+            NSFX_TEST_EXPECT_EQ(result.committed_, expected.total_);
+            std::cout << "  OptimisticSimulator (" << threads[i]
+                      << " threads): "
+                      << result.committed_ / result.secs_ << " events/s, "
+                      << result.rolledBack_ << " rolled back" << std::endl;
+        }
+    }
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -0,0 +1,374 @@
+/**
+ * @file
+ *
+ * @brief Test ParallelSimulator.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/parallel-simulator.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/list-scheduler.h>
+#include <iostream>
+#include <functional>
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <chrono>
+
+
+NSFX_TEST_SUITE(ParallelSimulator)
+{
+    using nsfx::Ptr;
+
+    /**
+     * @brief A node in a ring of partitions.
+     *
+     * Each event is either a local event, or a remote event that is sent to
+     * the next partition.
+     * The random number generator is owned by the partition, so the result
+     * does not depend on the order the partitions are run.
+     */
+    struct Node/*{{{*/
+    {
+        Node* ring_;
+        uint32_t index_;
+        uint32_t next_;
+        nsfx::IParallelSimulator* simulator_;
+        Ptr<nsfx::IClock> clock_;
+        Ptr<nsfx::IScheduler> scheduler_;
+        std::mt19937 rng_;
+        std::vector<nsfx::TimePoint> fired_;
+        nsfx::TimePoint end_;
+        size_t work_;
+
+        void OnEvent(void)
+        {
+            // Do not use the test macros, since they are not thread-safe.
+            nsfx::TimePoint now = clock_->Now();
+            fired_.push_back(now);
+            // Consume some CPU time.
+            volatile size_t x = 0;
+            for (size_t i = 0; i < work_; ++i)
+            {
+                x = x + i;
+            }
+            if (now < end_)
+            {
+                nsfx::Duration dt(nsfx::MicroSeconds(1 + rng_() % 100));
+                if (rng_() % 2)
+                {
+                    nsfx::ScheduleIn(scheduler_, dt, [this] { OnEvent(); });
+                }
+                else
+                {
+                    Node* next = &ring_[next_];
+                    simulator_->ScheduleRemote(
+                        index_, next_, nsfx::MicroSeconds(10) + dt,
+                        nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                            nullptr, [next] { next->OnEvent(); }));
+                }
+            }
+        }
+    };/*}}}*/
+
+    /**
+     * @brief Build a ring, and run the simulation.
+     */
+    static std::vector<Node> RunRing(uint32_t numPartitions,
+                                     uint32_t numThreads,
+                                     size_t work,
+                                     double* secs = nullptr)/*{{{*/
+    {
+        Ptr<nsfx::IParallelSimulator> simulator =
+            nsfx::CreateObject<nsfx::IParallelSimulator>(
+                "edu.uestc.nsfx.ParallelSimulator");
+        simulator->SetNumThreads(numThreads);
+        std::vector<Node> nodes(numPartitions);
+        for (uint32_t i = 0; i < numPartitions; ++i)
+        {
+            Ptr<nsfx::IScheduler> scheduler =
+                nsfx::CreateObject<nsfx::IScheduler>(
+                    i % 2 ? "edu.uestc.nsfx.HeapScheduler"
+                          : "edu.uestc.nsfx.ListScheduler");
+            uint32_t index = simulator->AddPartition(scheduler);
+            NSFX_TEST_EXPECT_EQ(index, i);
+            Node& node = nodes[i];
+            node.ring_ = nodes.data();
+            node.index_ = i;
+            node.next_ = (i + 1) % numPartitions;
+            node.simulator_ = simulator.Get();
+            node.clock_ = simulator->GetClock(i);
+            node.scheduler_ = scheduler;
+            node.rng_.seed(i);
+            node.end_ = nsfx::TimePoint(nsfx::MilliSeconds(20));
+            node.work_ = work;
+        }
+        for (uint32_t i = 0; i < numPartitions; ++i)
+        {
+            simulator->SetLinkDelay(i, (i + 1) % numPartitions,
+                                    nsfx::MicroSeconds(10));
+            Node* node = &nodes[i];
+            for (size_t j = 0; j < 4; ++j)
+            {
+                nsfx::ScheduleIn(node->scheduler_,
+                                 nsfx::MicroSeconds(j),
+                                 [node] { node->OnEvent(); });
+            }
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        Ptr<nsfx::ISimulator>(simulator)->Run();
+        auto t1 = std::chrono::steady_clock::now();
+        if (secs)
+        {
+            *secs = std::chrono::duration<double>(t1 - t0).count();
+        }
+        for (uint32_t i = 0; i < numPartitions; ++i)
+        {
+            NSFX_TEST_EXPECT_EQ(nodes[i].scheduler_->GetNumEvents(), 0);
+            NSFX_TEST_EXPECT(std::is_sorted(nodes[i].fired_.begin(),
+                                            nodes[i].fired_.end()));
+            nodes[i].clock_ = nullptr;
+            nodes[i].scheduler_ = nullptr;
+        }
+        return nodes;
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Determinism)/*{{{*/
+    {
+        try
+        {
+            std::vector<Node> expected = RunRing(8, 1, 0);
+            size_t total = 0;
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                NSFX_TEST_EXPECT(expected[i].fired_.size());
+                total += expected[i].fired_.size();
+            }
+            NSFX_TEST_EXPECT(total > 1000);
+            for (uint32_t n = 2; n <= 8; n *= 2)
+            {
+                std::vector<Node> nodes = RunRing(8, n, 0);
+                for (size_t i = 0; i < nodes.size(); ++i)
+                {
+                    NSFX_TEST_EXPECT(nodes[i].fired_ == expected[i].fired_)
+                        << n << " threads, partition " << i;
+                }
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(RunUntil)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::IParallelSimulator> simulator =
+                nsfx::CreateObject<nsfx::IParallelSimulator>(
+                    "edu.uestc.nsfx.ParallelSimulator");
+            simulator->SetNumThreads(2);
+            for (size_t i = 0; i < 2; ++i)
+            {
+                simulator->AddPartition(
+                    nsfx::CreateObject<nsfx::IScheduler>(
+                        "edu.uestc.nsfx.HeapScheduler"));
+            }
+            simulator->SetLinkDelay(0, 1, nsfx::Seconds(1));
+            Ptr<nsfx::ISimulator> sim(simulator);
+            Ptr<nsfx::IClock> clock(simulator);
+
+            // Validation.
+            try
+            {
+                simulator->SetLinkDelay(0, 2, nsfx::Seconds(1));
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::OutOfBounds& )
+            {
+                // Should come here.
+            }
+            try
+            {
+                simulator->SetLinkDelay(0, 1, nsfx::Seconds(0));
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::InvalidArgument& )
+            {
+                // Should come here.
+            }
+            try
+            {
+                simulator->ScheduleRemote(1, 0, nsfx::Seconds(1),
+                    nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [] {}));
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::InvalidArgument& )
+            {
+                // Should come here.
+            }
+            try
+            {
+                simulator->ScheduleRemote(0, 1, nsfx::MilliSeconds(999),
+                    nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [] {}));
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::InvalidArgument& )
+            {
+                // Should come here.
+            }
+            try
+            {
+                sim->Run();
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::NoScheduledEvent& )
+            {
+                // Should come here.
+            }
+
+            // Partition 0 sends an event to partition 1 every second.
+            std::vector<nsfx::TimePoint> received;
+            Ptr<nsfx::IScheduler> s0 = simulator->GetScheduler(0);
+            Ptr<nsfx::IClock> c0 = simulator->GetClock(0);
+            Ptr<nsfx::IClock> c1 = simulator->GetClock(1);
+            std::function<void(void)> send = [&] {
+                simulator->ScheduleRemote(0, 1, nsfx::Seconds(1),
+                    nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [&] {
+                        received.push_back(c1->Now());
+                        if (received.size() == 3)
+                        {
+                            sim->Pause();
+                        }
+                    }));
+                if (c0->Now() < nsfx::TimePoint(nsfx::Seconds(5)))
+                {
+                    nsfx::ScheduleIn(s0, nsfx::Seconds(1), [&] { send(); });
+                }
+            };
+            nsfx::ScheduleNow(s0, [&] { send(); });
+
+            sim->RunUntil(nsfx::TimePoint(nsfx::MilliSeconds(2500)));
+            NSFX_TEST_EXPECT_EQ(clock->Now(),
+                                nsfx::TimePoint(nsfx::MilliSeconds(2500)));
+            NSFX_TEST_EXPECT_EQ(c0->Now(),
+                                nsfx::TimePoint(nsfx::MilliSeconds(2500)));
+            NSFX_TEST_EXPECT_EQ(c1->Now(),
+                                nsfx::TimePoint(nsfx::MilliSeconds(2500)));
+            NSFX_TEST_ASSERT_EQ(received.size(), 2);
+            NSFX_TEST_EXPECT_EQ(received[0], nsfx::TimePoint(nsfx::Seconds(1)));
+            NSFX_TEST_EXPECT_EQ(received[1], nsfx::TimePoint(nsfx::Seconds(2)));
+
+            // Paused by the 3rd event at 3s.
+            sim->Run();
+            NSFX_TEST_ASSERT_EQ(received.size(), 3);
+            NSFX_TEST_EXPECT_EQ(c1->Now(), nsfx::TimePoint(nsfx::Seconds(3)));
+
+            sim->Run();
+            NSFX_TEST_ASSERT_EQ(received.size(), 6);
+            NSFX_TEST_EXPECT_EQ(received[5], nsfx::TimePoint(nsfx::Seconds(6)));
+            NSFX_TEST_EXPECT_EQ(clock->Now(), nsfx::TimePoint(nsfx::Seconds(6)));
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Exception)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::IParallelSimulator> simulator =
+                nsfx::CreateObject<nsfx::IParallelSimulator>(
+                    "edu.uestc.nsfx.ParallelSimulator");
+            simulator->SetNumThreads(4);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                simulator->AddPartition(
+                    nsfx::CreateObject<nsfx::IScheduler>(
+                        "edu.uestc.nsfx.HeapScheduler"));
+                nsfx::ScheduleNow(simulator->GetScheduler(i), [] {});
+            }
+            // An exception thrown by an event is rethrown by Run().
+            nsfx::ScheduleNow(simulator->GetScheduler(2), [] {
+                BOOST_THROW_EXCEPTION(nsfx::Unexpected());
+            });
+            try
+            {
+                Ptr<nsfx::ISimulator>(simulator)->Run();
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::Unexpected& )
+            {
+                // Should come here.
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        try
+        {
+            uint32_t maxThreads = std::thread::hardware_concurrency();
+            for (uint32_t n = 1; n <= 8 && n <= maxThreads; n *= 2)
+            {
+                double secs = 0;
+                std::vector<Node> nodes = RunRing(64, n, 2000, &secs);
+                size_t total = 0;
+                for (size_t i = 0; i < nodes.size(); ++i)
+                {
+                    total += nodes[i].fired_.size();
+                }
+                std::cout << n << " threads: "
+                          << static_cast<uint64_t>(total / secs)
+                          << " events per second." << std::endl;
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
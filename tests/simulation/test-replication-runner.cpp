@@ -0,0 +1,235 @@
+/**
+ * @file
+ *
+ * @brief Test ReplicationRunner.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/replication-runner.h>
+#include <nsfx/simulation/calendar-scheduler.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <cmath>
+#include <chrono>
+
+
+NSFX_TEST_SUITE(ReplicationRunner)
+{
+    using nsfx::Ptr;
+
+    /**
+     * @brief Each replication samples `n` uniform numbers in `[0, 1)`.
+     */
+    void Scenario(nsfx::Replication& r, size_t n)/*{{{*/
+    {
+        Ptr<nsfx::ISummary> summary = r.CreateSummary("u");
+        Ptr<nsfx::IProbeEventSink> sink(summary);
+        Ptr<nsfx::IRandom> random = r.GetRandom();
+        for (size_t i = 0; i < n; ++i)
+        {
+            r.GetScheduler()->ScheduleAt(
+                nsfx::TimePoint(nsfx::MicroSeconds(i)),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=] {
+                    sink->Fire(random->GenerateUniformDouble(0, 1));
+                }));
+        }
+        // A result without samples.
+        r.CreateSummary("empty");
+    }/*}}}*/
+
+    NSFX_TEST_CASE(ReplicationSummary)/*{{{*/
+    {
+        nsfx::ReplicationSummary s;
+        NSFX_TEST_EXPECT((std::isnan)(s.Mean()));
+        s.Add(1);
+        NSFX_TEST_EXPECT((std::isnan)(s.GetHalfWidth()));
+        s.Add(2);
+        s.Add(std::numeric_limits<double>::quiet_NaN());
+        s.Add(3);
+        NSFX_TEST_EXPECT_EQ(s.GetNumReplications(), 3);
+        NSFX_TEST_EXPECT_EQ(s.GetNumExcluded(), 1);
+        NSFX_TEST_EXPECT_AC(s.Mean(), 2.0, 1e-12);
+        NSFX_TEST_EXPECT_AC(s.Stddev(), 1.0, 1e-12);
+        // t(0.975, 2) = 4.302652729911275
+        NSFX_TEST_EXPECT_AC(s.GetHalfWidth(0.95),
+                            4.302652729911275 / std::sqrt(3.0), 1e-9);
+        try
+        {
+            s.GetHalfWidth(1);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Run)/*{{{*/
+    {
+        nsfx::ReplicationRunner runner;
+        runner.SetNumReplications(40);
+        runner.SetNumThreads(4);
+        runner.SetSeed(7);
+        runner.Run([] (nsfx::Replication& r) { Scenario(r, 1000); });
+        const nsfx::ReplicationSummary& u = runner.GetSummary("u");
+        NSFX_TEST_EXPECT_EQ(u.GetNumReplications(), 40);
+        NSFX_TEST_EXPECT_AC(u.Mean(), 0.5, 0.01);
+        double h = u.GetHalfWidth(0.99);
+        NSFX_TEST_EXPECT_GT(h, 0);
+        NSFX_TEST_EXPECT_LT(std::abs(u.Mean() - 0.5), h);
+        const nsfx::ReplicationSummary& empty = runner.GetSummary("empty");
+        NSFX_TEST_EXPECT_EQ(empty.GetNumReplications(), 0);
+        NSFX_TEST_EXPECT_EQ(empty.GetNumExcluded(), 40);
+        NSFX_TEST_EXPECT_EQ(runner.GetSummaryNames().size(), 2);
+
+        // The replications are independent.
+        nsfx::vector<double> values = u.GetValues();
+        for (size_t i = 1; i < values.size(); ++i)
+        {
+            NSFX_TEST_EXPECT_NE(values[i], values[0]);
+        }
+
+        // The results do not depend on the number of threads, or the
+        // scheduler.
+        runner.SetNumThreads(1);
+        runner.SetScheduler("edu.uestc.nsfx.CalendarScheduler");
+        runner.Run([] (nsfx::Replication& r) { Scenario(r, 1000); });
+        NSFX_TEST_EXPECT(runner.GetSummary("u").GetValues() == values);
+
+        try
+        {
+            runner.GetSummary("none");
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(CreateObject)/*{{{*/
+    {
+        // The scenarios build the models via the class registry.
+        nsfx::ReplicationRunner runner;
+        runner.SetNumReplications(40);
+        runner.SetNumThreads(4);
+        runner.Run([] (nsfx::Replication& r) {
+            Ptr<nsfx::ISummary> total = nsfx::CreateObject<nsfx::ISummary>(
+                "edu.uestc.nsfx.Summary");
+            r.AddSummary("total", total);
+            Ptr<nsfx::IProbeEventSink> sink(total);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                Ptr<nsfx::ISummary> summary = nsfx::CreateObject<nsfx::ISummary>(
+                    "edu.uestc.nsfx.Summary");
+                Ptr<nsfx::IProbeEventSink>(summary)->Fire(1);
+                r.GetScheduler()->ScheduleAt(
+                    nsfx::TimePoint(nsfx::MicroSeconds(i)),
+                    nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=] {
+                        sink->Fire(summary->Sum());
+                    }));
+            }
+        });
+        const nsfx::ReplicationSummary& total = runner.GetSummary("total");
+        NSFX_TEST_EXPECT_EQ(total.GetNumReplications(), 40);
+        NSFX_TEST_EXPECT_EQ(total.Mean(), 1);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Duration)/*{{{*/
+    {
+        nsfx::ReplicationRunner runner;
+        runner.SetNumReplications(3);
+        runner.SetDuration(nsfx::MicroSeconds(9));
+        runner.Run([] (nsfx::Replication& r) {
+            Scenario(r, 100);
+            // Count the events that are fired.
+            Ptr<nsfx::ISummary> count = r.CreateSummary("count");
+            Ptr<nsfx::IProbeEventSink> sink(count);
+            r.GetScheduler()->ScheduleAt(
+                nsfx::TimePoint(nsfx::MicroSeconds(9)),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=] {
+                    sink->Fire(1);
+                }));
+            r.GetScheduler()->ScheduleAt(
+                nsfx::TimePoint(nsfx::MicroSeconds(10)),
+                nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [=] {
+                    sink->Fire(2);
+                }));
+        });
+        NSFX_TEST_EXPECT_EQ(runner.GetSummary("count").Mean(), 1);
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Exception)/*{{{*/
+    {
+        nsfx::ReplicationRunner runner;
+        runner.SetNumReplications(10);
+        runner.SetNumThreads(3);
+        try
+        {
+            runner.Run([] (nsfx::Replication& r) {
+                if (r.GetIndex() == 5)
+                {
+                    BOOST_THROW_EXCEPTION(nsfx::Unexpected());
+                }
+                Scenario(r, 10);
+            });
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::Unexpected& )
+        {
+            // Should come here.
+        }
+        try
+        {
+            runner.Run(nsfx::ReplicationRunner::Scenario());
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidPointer& )
+        {
+            // Should come here.
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        const size_t numReplications = 64;
+        const size_t numEvents = 20000;
+        nsfx::ReplicationRunner runner;
+        runner.SetNumReplications(numReplications);
+        double seconds[2];
+        size_t threads[2] = { 1, 0 };
+        for (size_t k = 0; k < 2; ++k)
+        {
+            runner.SetNumThreads(threads[k]);
+            auto t0 = std::chrono::steady_clock::now();
+            runner.Run([=] (nsfx::Replication& r) { Scenario(r, numEvents); });
+            auto t1 = std::chrono::steady_clock::now();
+            seconds[k] = std::chrono::duration<double>(t1 - t0).count();
+        }
+        NSFX_TEST_MESSAGE() << numReplications << " replications: "
+                            << seconds[0] << " s on 1 thread, "
+                            << seconds[1] << " s on "
+                            << std::thread::hardware_concurrency()
+                            << " threads.";
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
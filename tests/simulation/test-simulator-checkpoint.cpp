@@ -0,0 +1,333 @@
+/**
+ * @file
+ *
+ * @brief Test the checkpoints of Simulator.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/simulation/list-scheduler.h>
+#include <nsfx/simulation/set-scheduler.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/calendar-scheduler.h>
+#include <nsfx/simulation/dary-heap-scheduler.h>
+#include <nsfx/simulation/event-checkpoint.h>
+#include <nsfx/random/pseudo-random-generator.h>
+#include <nsfx/component/checkpoint.h>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+NSFX_TEST_SUITE(SimulatorCheckpoint)
+{
+    using nsfx::Ptr;
+
+    static const char* schedulers[] = {
+        "edu.uestc.nsfx.ListScheduler",
+        "edu.uestc.nsfx.SetScheduler",
+        "edu.uestc.nsfx.HeapScheduler",
+        "edu.uestc.nsfx.CalendarScheduler",
+        "edu.uestc.nsfx.DaryHeapScheduler",
+    };
+
+    struct Record/*{{{*/
+    {
+        Record(int64_t t, uint32_t stream, double u) :
+            t_(t), stream_(stream), u_(u)
+        {}
+
+        bool operator==(const Record& rhs) const
+        {
+            return t_ == rhs.t_ && stream_ == rhs.stream_ && u_ == rhs.u_;
+        }
+
+        int64_t  t_;
+        uint32_t stream_;
+        double   u_;
+    };/*}}}*/
+
+    struct Model;
+
+    struct IModel : virtual nsfx::IObject/*{{{*/
+    {
+        virtual ~IModel(void) {}
+        virtual Model* GetModel(void) = 0;
+    };/*}}}*/
+
+    NSFX_DEFINE_CLASS_UID(IModel, "edu.uestc.nsfx.test.IModel");
+
+    struct Model : IModel/*{{{*/
+    {
+        explicit Model(const char* cid)
+        {
+            simulator_ = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            scheduler_ = nsfx::CreateObject<nsfx::IScheduler>(cid);
+            Ptr<nsfx::ISchedulerUser>(simulator_)->Use(scheduler_);
+            Ptr<nsfx::IClockUser>(scheduler_)->Use(
+                Ptr<nsfx::IClock>(simulator_));
+            clock_ = simulator_;
+            rng_ = nsfx::CreateObject<nsfx::IRandomDoubleGenerator>(
+                "edu.uestc.nsfx.Xoshiro256Plus01Engine");
+        }
+
+        virtual ~Model(void) {}
+
+        virtual Model* GetModel(void) NSFX_OVERRIDE
+        {
+            return this;
+        }
+
+        void Add(nsfx::Checkpoint& checkpoint)
+        {
+            checkpoint.Add("simulator",
+                           Ptr<nsfx::ICheckpointable>(simulator_));
+            checkpoint.Add("rng", Ptr<nsfx::ICheckpointable>(rng_));
+        }
+
+        Ptr<nsfx::ISimulator> simulator_;
+        Ptr<nsfx::IScheduler> scheduler_;
+        Ptr<nsfx::IClock> clock_;
+        Ptr<nsfx::IRandomDoubleGenerator> rng_;
+        std::vector<Record> trace_;
+
+        NSFX_INTERFACE_MAP_BEGIN(Model)
+            NSFX_INTERFACE_ENTRY(IModel)
+        NSFX_INTERFACE_MAP_END()
+    };/*}}}*/
+
+    /**
+     * @brief An arrival of a stream that schedules the next arrival.
+     */
+    struct Arrival :/*{{{*/
+        nsfx::IEventSink<>,
+        nsfx::IClassIdentity,
+        nsfx::ICheckpointable
+    {
+        Arrival(void) :
+            model_(nullptr), stream_(0), n_(0)
+        {}
+
+        Arrival(Model* model, uint32_t stream, uint32_t n) :
+            model_(model), stream_(stream), n_(n)
+        {}
+
+        virtual ~Arrival(void) {}
+
+        virtual void Fire(void) NSFX_OVERRIDE
+        {
+            double u = model_->rng_->Generate();
+            model_->trace_.push_back(Record(
+                model_->clock_->Now().GetDuration().GetCount(), stream_, u));
+            if (n_ + 1 < 100)
+            {
+                // The small delays lead to many events at the same time.
+                model_->scheduler_->ScheduleIn(
+                    nsfx::MicroSeconds(static_cast<int64_t>(u * 10)),
+                    Ptr<nsfx::IEventSink<>>(new nsfx::Object<Arrival>(
+                        model_, stream_, n_ + 1)));
+            }
+        }
+
+        virtual nsfx::Uid GetClassUid(void) NSFX_OVERRIDE
+        {
+            return "edu.uestc.nsfx.test.Arrival";
+        }
+
+        virtual void SaveCheckpoint(nsfx::CheckpointWriter& writer) NSFX_OVERRIDE
+        {
+            writer.WriteUint32(stream_);
+            writer.WriteUint32(n_);
+        }
+
+        virtual void RestoreCheckpoint(nsfx::CheckpointReader& reader) NSFX_OVERRIDE
+        {
+            model_ = Ptr<IModel>(reader.GetContext())->GetModel();
+            stream_ = reader.ReadUint32();
+            n_ = reader.ReadUint32();
+        }
+
+        Model* model_;
+        uint32_t stream_;
+        uint32_t n_;
+
+        NSFX_INTERFACE_MAP_BEGIN(Arrival)
+            NSFX_INTERFACE_ENTRY(nsfx::IEventSink<>)
+            NSFX_INTERFACE_ENTRY(nsfx::IClassIdentity)
+            NSFX_INTERFACE_ENTRY(nsfx::ICheckpointable)
+        NSFX_INTERFACE_MAP_END()
+    };/*}}}*/
+
+    NSFX_REGISTER_CLASS(Arrival, "edu.uestc.nsfx.test.Arrival");
+
+    NSFX_TEST_CASE(Engine)/*{{{*/
+    {
+        Ptr<nsfx::IRandomUInt32Generator> rng =
+            nsfx::CreateObject<nsfx::IRandomUInt32Generator>(
+                "edu.uestc.nsfx.Mt19937Engine");
+        rng->Generate();
+        nsfx::Checkpoint checkpoint;
+        checkpoint.Add("rng", Ptr<nsfx::ICheckpointable>(rng));
+        std::stringstream ss;
+        checkpoint.Save(ss);
+        std::vector<uint32_t> v1;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            v1.push_back(rng->Generate());
+        }
+        checkpoint.Restore(ss);
+        std::vector<uint32_t> v2;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            v2.push_back(rng->Generate());
+        }
+        NSFX_TEST_EXPECT(v1 == v2);
+
+        // Restore the state of a different engine.
+        Ptr<nsfx::ICheckpointable> other =
+            nsfx::CreateObject<nsfx::ICheckpointable>(
+                "edu.uestc.nsfx.Xoshiro128StarstarEngine");
+        nsfx::Checkpoint checkpoint2;
+        checkpoint2.Add("rng", other);
+        std::stringstream is(ss.str());
+        try
+        {
+            checkpoint2.Restore(is);
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::BadCheckpoint& )
+        {
+            // Should come here.
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Resume)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            Ptr<Model> m1(new nsfx::Object<Model>(schedulers[i]));
+            for (uint32_t s = 0; s < 5; ++s)
+            {
+                m1->scheduler_->ScheduleNow(Ptr<nsfx::IEventSink<>>(
+                    new nsfx::Object<Arrival>(m1.Get(), s, 0)));
+            }
+            m1->simulator_->RunUntil(nsfx::TimePoint(nsfx::MicroSeconds(200)));
+            NSFX_TEST_ASSERT(m1->scheduler_->GetNumEvents());
+
+            std::stringstream ss;
+            nsfx::Checkpoint c1;
+            m1->Add(c1);
+            c1.Save(ss);
+
+            // Continue the simulation.
+            m1->trace_.clear();
+            m1->simulator_->Run();
+
+            // Resume the simulation from the checkpoint.
+            Ptr<Model> m2(new nsfx::Object<Model>(schedulers[i]));
+            nsfx::Checkpoint c2;
+            m2->Add(c2);
+            c2.Restore(ss, Ptr<nsfx::IObject>(m2));
+            NSFX_TEST_EXPECT(m2->clock_->Now() ==
+                             nsfx::TimePoint(nsfx::MicroSeconds(200)));
+            m2->simulator_->Run();
+
+            NSFX_TEST_EXPECT(!m1->trace_.empty());
+            NSFX_TEST_EXPECT_EQ(m1->trace_.size(), m2->trace_.size());
+            NSFX_TEST_EXPECT(m1->trace_ == m2->trace_);
+            NSFX_TEST_EXPECT(m1->clock_->Now() == m2->clock_->Now());
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Exception)/*{{{*/
+    {
+        for (size_t i = 0; i < sizeof (schedulers) / sizeof (schedulers[0]); ++i)
+        {
+            Ptr<Model> m(new nsfx::Object<Model>(schedulers[i]));
+            Ptr<nsfx::ICheckpointable> simulator(m->simulator_);
+            // A callable cannot be checkpointed.
+            Ptr<nsfx::ICallableScheduler>(m->scheduler_)->ScheduleNow([] {});
+            std::stringstream ss;
+            {
+                nsfx::CheckpointWriter writer(ss);
+                try
+                {
+                    simulator->SaveCheckpoint(writer);
+                    NSFX_TEST_EXPECT(false);
+                }
+                catch (nsfx::IllegalMethodCall& )
+                {
+                    // Should come here.
+                }
+            }
+            m->simulator_->Run();
+            // Cannot restore into a scheduler that has pending events.
+            ss.str("");
+            {
+                nsfx::CheckpointWriter writer(ss);
+                simulator->SaveCheckpoint(writer);
+            }
+            m->scheduler_->ScheduleNow(Ptr<nsfx::IEventSink<>>(
+                new nsfx::Object<Arrival>(m.Get(), 0, 0)));
+            try
+            {
+                nsfx::CheckpointReader reader(ss, Ptr<nsfx::IObject>(m));
+                simulator->RestoreCheckpoint(reader);
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::IllegalMethodCall& )
+            {
+                // Should come here.
+            }
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(NotAnEventSink)/*{{{*/
+    {
+        // An event whose class is checkpointable, but is not an event sink.
+        std::stringstream ss;
+        {
+            nsfx::CheckpointWriter writer(ss);
+            writer.WriteUint64(1); // The next event id.
+            writer.WriteUint64(1); // The number of events.
+            writer.WriteInt64(0);
+            writer.WriteUint64(0);
+            writer.WriteString("edu.uestc.nsfx.Xoshiro256Plus01Engine");
+        }
+        size_t numInserted = 0;
+        try
+        {
+            nsfx::CheckpointReader reader(ss);
+            nsfx::RestoreEvents(reader,
+                [&] (const nsfx::TimePoint& , nsfx::event_id_t ,
+                     Ptr<nsfx::IEventSink<>>&& ) { ++numInserted; });
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::BadCheckpoint& )
+        {
+            // Should come here.
+        }
+        NSFX_TEST_EXPECT_EQ(numInserted, 0);
+    }/*}}}*/
+
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
+
@@ -16,8 +16,12 @@
 #include <nsfx/test.h>
 #include <nsfx/simulation/simulator.h>
 #include <nsfx/simulation/set-scheduler.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/dary-heap-scheduler.h>
+#include <nsfx/simulation/calendar-scheduler.h>
 #include <nsfx/event/event-sink.h>
 #include <iostream>
+#include <vector>
 
 NSFX_TEST_SUITE(Simulator)
 {
@@ -245,6 +249,95 @@ NSFX_TEST_SUITE(Simulator)
             NSFX_TEST_EXPECT(false) << e.what() << std::endl;
         }
     }
+    NSFX_TEST_CASE(Batch)
+    {
+        // The schedulers that provide IBatchScheduler must fire the events
+        // in the same way as the ones that do not.
+        try
+        {
+            const char* cids[] = {
+                "edu.uestc.nsfx.SetScheduler",
+                "edu.uestc.nsfx.HeapScheduler",
+                "edu.uestc.nsfx.DaryHeapScheduler",
+                "edu.uestc.nsfx.CalendarScheduler",
+            };
+            std::vector<int> expected;
+            for (size_t k = 0; k < sizeof (cids) / sizeof (cids[0]); ++k)
+            {
+                nsfx::Ptr<nsfx::IScheduler> scheduler =
+                    nsfx::CreateObject<nsfx::IScheduler>(cids[k]);
+                nsfx::Ptr<nsfx::ISimulator>  simulator =
+                    nsfx::CreateObject<nsfx::ISimulator>(
+                        "edu.uestc.nsfx.Simulator");
+                nsfx::Ptr<nsfx::IClock>  clock(simulator);
+                nsfx::Ptr<nsfx::ISchedulerUser>(simulator)->Use(scheduler);
+                nsfx::Ptr<nsfx::IClockUser>(scheduler)->Use(clock);
+
+                std::vector<int> fired;
+                nsfx::Ptr<nsfx::IEventHandle> h[3][5];
+                for (int i = 0; i < 3; ++i)
+                {
+                    nsfx::TimePoint t(nsfx::Seconds(i + 1));
+                    for (int j = 0; j < 5; ++j)
+                    {
+                        int tag = (i + 1) * 10 + j;
+                        if (tag == 11)
+                        {
+                            // Cancel a later event at the same time,
+                            // schedule an event at the same time,
+                            // and pause the simulator.
+                            h[i][j] = nsfx::ScheduleAt(scheduler, t, [&] {
+                                fired.push_back(11);
+                                h[0][3]->Cancel();
+                                nsfx::ScheduleNow(scheduler, [&] {
+                                    fired.push_back(15);
+                                });
+                                simulator->Pause();
+                            });
+                        }
+                        else
+                        {
+                            h[i][j] = nsfx::ScheduleAt(scheduler, t, [&, tag] {
+                                fired.push_back(tag);
+                            });
+                        }
+                    }
+                }
+                NSFX_TEST_ASSERT_EQ(scheduler->GetNumEvents(), 15);
+
+                simulator->Run();
+                NSFX_TEST_EXPECT_EQ(clock->Now(), nsfx::TimePoint(nsfx::Seconds(1)));
+                NSFX_TEST_EXPECT_EQ(fired.size(), 2);
+                NSFX_TEST_EXPECT_EQ(scheduler->GetNumEvents(), 13);
+
+                simulator->RunUntil(nsfx::TimePoint(nsfx::MilliSeconds(2500)));
+                NSFX_TEST_EXPECT_EQ(clock->Now(),
+                                    nsfx::TimePoint(nsfx::MilliSeconds(2500)));
+                NSFX_TEST_EXPECT_EQ(scheduler->GetNumEvents(), 5);
+
+                simulator->Run();
+                NSFX_TEST_EXPECT_EQ(clock->Now(), nsfx::TimePoint(nsfx::Seconds(3)));
+                NSFX_TEST_EXPECT_EQ(scheduler->GetNumEvents(), 0);
+
+                if (k == 0)
+                {
+                    int tags[] = { 10, 11, 12, 14, 15,
+                                   20, 21, 22, 23, 24,
+                                   30, 31, 32, 33, 34 };
+                    expected.assign(tags, tags + sizeof (tags) / sizeof (tags[0]));
+                }
+                NSFX_TEST_EXPECT(fired == expected) << cids[k];
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+        catch (std::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << e.what() << std::endl;
+        }
+    }
 }
 
 
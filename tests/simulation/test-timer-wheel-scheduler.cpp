@@ -0,0 +1,490 @@
+/**
+ * @file
+ *
+ * @brief Test TimerWheelScheduler.
+ *
+ * @version 1.0
+ * @author  Wei Tang <gauchyler@uestc.edu.cn>
+ * @date    2026-10-16
+ *
+ * @copyright Copyright (c) 2026.
+ *   National Key Laboratory of Science and Technology on Communications,
+ *   University of Electronic Science and Technology of China.
+ *   All rights reserved.
+ */
+
+#include <nsfx/test.h>
+#include <nsfx/simulation/timer-wheel-scheduler.h>
+#include <nsfx/simulation/heap-scheduler.h>
+#include <nsfx/simulation/simulator.h>
+#include <nsfx/event/event-sink.h>
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <random>
+#include <chrono>
+
+
+NSFX_TEST_SUITE(TimerWheelScheduler)
+{
+    using nsfx::Ptr;
+
+    static nsfx::TimePoint clk;
+    struct Clock : nsfx::IClock/*{{{*/
+    {
+        virtual ~Clock() {}
+
+        virtual nsfx::TimePoint Now() NSFX_OVERRIDE
+        {
+            return clk;
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Clock)
+            NSFX_INTERFACE_ENTRY(nsfx::IClock)
+        NSFX_INTERFACE_MAP_END()
+
+    };/*}}}*/
+    typedef nsfx::Object<Clock>  ClockClass;
+
+    static std::vector<int> fired;
+    struct Sink : nsfx::IEventSink<> /*{{{*/
+    {
+        Sink(int tag) : tag_(tag) {}
+
+        virtual ~Sink(void) {}
+
+        virtual void Fire(void) NSFX_OVERRIDE
+        {
+            fired.push_back(tag_);
+        }
+
+        NSFX_INTERFACE_MAP_BEGIN(Sink)
+            NSFX_INTERFACE_ENTRY(nsfx::IEventSink<>)
+        NSFX_INTERFACE_MAP_END()
+
+    private:
+        int tag_;
+    };/*}}}*/
+    typedef nsfx::Object<Sink>  SinkClass;
+
+    Ptr<nsfx::IScheduler> CreateHeap(void)
+    {
+        Ptr<nsfx::IScheduler> sch = nsfx::CreateObject<nsfx::IScheduler>(
+            "edu.uestc.nsfx.HeapScheduler");
+        Ptr<nsfx::IClockUser>(sch)->Use(Ptr<nsfx::IClock>(new ClockClass));
+        return sch;
+    }
+
+    Ptr<nsfx::IScheduler> CreateWheel(const nsfx::Duration& resolution)
+    {
+        Ptr<nsfx::IScheduler> sch = nsfx::CreateObject<nsfx::IScheduler>(
+            "edu.uestc.nsfx.TimerWheelScheduler");
+        Ptr<nsfx::ITimerWheel>(sch)->SetResolution(resolution);
+        Ptr<nsfx::IClockUser>(sch)->Use(Ptr<nsfx::IClock>(new ClockClass));
+        Ptr<nsfx::ISchedulerUser>(sch)->Use(CreateHeap());
+        return sch;
+    }
+
+    /**
+     * @brief Fire the events until the scheduler is empty.
+     */
+    void FireAll(Ptr<nsfx::IScheduler> sch)
+    {
+        while (sch->GetNumEvents())
+        {
+            Ptr<nsfx::IEventHandle> next = sch->GetNextEvent();
+            NSFX_TEST_ASSERT(next);
+            NSFX_TEST_ASSERT(clk <= next->GetTimePoint());
+            clk = next->GetTimePoint();
+            sch->FireAndRemoveNextEvent();
+        }
+        NSFX_TEST_EXPECT(!sch->GetNextEvent());
+    }
+
+    NSFX_TEST_CASE(Uninitialized)/*{{{*/
+    {
+        Ptr<nsfx::IScheduler> sch = nsfx::CreateObject<nsfx::IScheduler>(
+            "edu.uestc.nsfx.TimerWheelScheduler");
+        Ptr<nsfx::IClockUser>(sch)->Use(Ptr<nsfx::IClock>(new ClockClass));
+        try
+        {
+            sch->ScheduleNow(Ptr<nsfx::IEventSink<>>(new SinkClass(0)));
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::Uninitialized& )
+        {
+            // Should come here.
+        }
+        try
+        {
+            Ptr<nsfx::ITimerWheel>(sch)->SetResolution(nsfx::Duration());
+            NSFX_TEST_EXPECT(false);
+        }
+        catch (nsfx::InvalidArgument& )
+        {
+            // Should come here.
+        }
+        NSFX_TEST_EXPECT(Ptr<nsfx::ITimerWheel>(sch)->GetResolution() ==
+                         nsfx::MilliSeconds(1));
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Order)/*{{{*/
+    {
+        // The events are fired in the same order as HeapScheduler.
+        try
+        {
+            std::vector<int> expected;
+            std::vector<int> actual;
+            for (int k = 0; k < 2; ++k)
+            {
+                clk = nsfx::TimePoint();
+                fired.clear();
+                Ptr<nsfx::IScheduler> sch = k ? CreateWheel(nsfx::MilliSeconds(1))
+                                              : CreateHeap();
+                std::mt19937 g;
+                std::uniform_int_distribution<int> near(0, 100000);
+                std::uniform_int_distribution<int> far(0, 100);
+                std::vector<Ptr<nsfx::IEventHandle>> handles;
+                for (int i = 0; i < 20000; ++i)
+                {
+                    // Within a tick, in the wheels, and beyond the wheels.
+                    nsfx::Duration dt = (i % 10) ? nsfx::Duration(nsfx::MicroSeconds(near(g) * 10))
+                                                 : nsfx::Duration(nsfx::Hours(4 + far(g)));
+                    if (i % 7 == 0)
+                    {
+                        dt = nsfx::NanoSeconds(near(g) % 1000);
+                    }
+                    handles.push_back(sch->ScheduleIn(
+                        dt, Ptr<nsfx::IEventSink<>>(new SinkClass(i))));
+                }
+                // Fire a part of the events, and schedule more events.
+                // The tick events of the wheels are not counted.
+                while (fired.size() < 5000)
+                {
+                    size_t n = fired.size();
+                    clk = sch->GetNextEvent()->GetTimePoint();
+                    sch->FireAndRemoveNextEvent();
+                    if (fired.size() > n)
+                    {
+                        int i = static_cast<int>(n);
+                        sch->ScheduleIn(nsfx::MilliSeconds(i % 300),
+                                        Ptr<nsfx::IEventSink<>>(new SinkClass(-i)));
+                    }
+                }
+                for (size_t i = 0; i < handles.size(); i += 3)
+                {
+                    handles[i]->Cancel();
+                    NSFX_TEST_EXPECT(!handles[i]->IsPending());
+                }
+                FireAll(sch);
+                (k ? actual : expected).swap(fired);
+            }
+            NSFX_TEST_ASSERT_EQ(expected.size(), actual.size());
+            NSFX_TEST_EXPECT(expected == actual);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Cancel)/*{{{*/
+    {
+        try
+        {
+            clk = nsfx::TimePoint();
+            fired.clear();
+            Ptr<nsfx::IScheduler> sch = CreateWheel(nsfx::MilliSeconds(1));
+            Ptr<nsfx::ITimerWheel> wheel(sch);
+            Ptr<nsfx::IEventHandle> h0 = sch->ScheduleAt(
+                nsfx::TimePoint(nsfx::MilliSeconds(10)),
+                Ptr<nsfx::IEventSink<>>(new SinkClass(0)));
+            Ptr<nsfx::IEventHandle> h1 = sch->ScheduleAt(
+                nsfx::TimePoint(nsfx::MicroSeconds(10500)),
+                Ptr<nsfx::IEventSink<>>(new SinkClass(1)));
+            Ptr<nsfx::IEventHandle> h2 = sch->ScheduleAt(
+                nsfx::TimePoint(nsfx::Seconds(100)),
+                Ptr<nsfx::IEventSink<>>(new SinkClass(2)));
+            NSFX_TEST_EXPECT_EQ(wheel->GetNumTimers(), 3);
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 3);
+            NSFX_TEST_EXPECT(h0->IsPending());
+            NSFX_TEST_EXPECT(h0->GetTimePoint() ==
+                             nsfx::TimePoint(nsfx::MilliSeconds(10)));
+            // Cancel an event in the wheels.
+            h2->Cancel();
+            NSFX_TEST_EXPECT(!h2->IsPending());
+            NSFX_TEST_EXPECT_EQ(wheel->GetNumTimers(), 2);
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 2);
+
+            // The events are moved into the backing scheduler, and the
+            // handle of the event is returned rather than the tick event.
+            Ptr<nsfx::IEventHandle> next = sch->GetNextEvent();
+            NSFX_TEST_EXPECT(next == h0);
+            NSFX_TEST_EXPECT_EQ(wheel->GetNumTimers(), 0);
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 2);
+            NSFX_TEST_EXPECT(fired.empty());
+            NSFX_TEST_EXPECT(h0->IsPending());
+
+            // Cancel the next event in the backing scheduler.
+            next->Cancel();
+            NSFX_TEST_EXPECT(!h0->IsPending());
+            NSFX_TEST_EXPECT(sch->GetNextEvent() == h1);
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 1);
+            FireAll(sch);
+            NSFX_TEST_ASSERT_EQ(fired.size(), 1);
+            NSFX_TEST_EXPECT_EQ(fired[0], 1);
+            NSFX_TEST_EXPECT(!h1->IsPending());
+            NSFX_TEST_EXPECT(clk == nsfx::TimePoint(nsfx::MicroSeconds(10500)));
+
+            // The tick event is removed when the wheels become empty.
+            Ptr<nsfx::IEventHandle> h3 = sch->ScheduleIn(
+                nsfx::Seconds(1), Ptr<nsfx::IEventSink<>>(new SinkClass(3)));
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 1);
+            h3->Cancel();
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 0);
+            NSFX_TEST_EXPECT(!sch->GetNextEvent());
+
+            // Cannot change the resolution when there are events in the wheels.
+            sch->ScheduleIn(nsfx::Seconds(1),
+                            Ptr<nsfx::IEventSink<>>(new SinkClass(4)));
+            try
+            {
+                wheel->SetResolution(nsfx::MicroSeconds(1));
+                NSFX_TEST_EXPECT(false);
+            }
+            catch (nsfx::IllegalMethodCall& )
+            {
+                // Should come here.
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(CancelMoved)/*{{{*/
+    {
+        // The events behind the next event are cancelled after they are
+        // moved out of the wheels.
+        try
+        {
+            clk = nsfx::TimePoint();
+            fired.clear();
+            Ptr<nsfx::IScheduler> sch = CreateWheel(nsfx::MilliSeconds(1));
+            Ptr<nsfx::IEventHandle> h[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                h[i] = sch->ScheduleAt(
+                    nsfx::TimePoint(nsfx::MicroSeconds(10000 + i * 200)),
+                    Ptr<nsfx::IEventSink<>>(new SinkClass(i)));
+            }
+            NSFX_TEST_EXPECT(sch->GetNextEvent() == h[0]);
+            h[1]->Cancel();
+            h[3]->Cancel();
+            NSFX_TEST_EXPECT(!h[1]->IsPending());
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 2);
+            NSFX_TEST_EXPECT(sch->GetNextEvent() == h[0]);
+            FireAll(sch);
+            NSFX_TEST_ASSERT_EQ(fired.size(), 2);
+            NSFX_TEST_EXPECT_EQ(fired[0], 0);
+            NSFX_TEST_EXPECT_EQ(fired[1], 2);
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 0);
+            NSFX_TEST_EXPECT(clk == nsfx::TimePoint(nsfx::MicroSeconds(10400)));
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(CancelNext)/*{{{*/
+    {
+        // The next event is cancelled via the handle from GetNextEvent().
+        try
+        {
+            clk = nsfx::TimePoint();
+            fired.clear();
+            Ptr<nsfx::IScheduler> sch = CreateWheel(nsfx::MilliSeconds(1));
+            for (int i = 0; i < 10; ++i)
+            {
+                sch->ScheduleAt(nsfx::TimePoint(nsfx::MilliSeconds(5 + i * 100)),
+                                Ptr<nsfx::IEventSink<>>(new SinkClass(i)));
+            }
+            for (int i = 0; i < 10; i += 2)
+            {
+                Ptr<nsfx::IEventHandle> next = sch->GetNextEvent();
+                NSFX_TEST_ASSERT(next);
+                NSFX_TEST_EXPECT(next->GetTimePoint() ==
+                                 nsfx::TimePoint(nsfx::MilliSeconds(5 + i * 100)));
+                next->Cancel();
+                next = sch->GetNextEvent();
+                clk = next->GetTimePoint();
+                sch->FireAndRemoveNextEvent();
+            }
+            NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 0);
+            NSFX_TEST_ASSERT_EQ(fired.size(), 5);
+            for (int i = 0; i < 5; ++i)
+            {
+                NSFX_TEST_EXPECT_EQ(fired[i], 2 * i + 1);
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Callable)/*{{{*/
+    {
+        try
+        {
+            clk = nsfx::TimePoint();
+            fired.clear();
+            Ptr<nsfx::IScheduler> sch = CreateWheel(nsfx::MilliSeconds(1));
+            Ptr<nsfx::ICallableScheduler> callables(sch);
+            callables->ScheduleIn(nsfx::MilliSeconds(20),
+                                 [] { fired.push_back(2); });
+            callables->ScheduleIn(nsfx::MicroSeconds(100),
+                                 [] { fired.push_back(1); });
+            callables->ScheduleIn(nsfx::Hours(5000),
+                                 [] { fired.push_back(3); });
+            FireAll(sch);
+            NSFX_TEST_ASSERT_EQ(fired.size(), 3);
+            NSFX_TEST_EXPECT_EQ(fired[0], 1);
+            NSFX_TEST_EXPECT_EQ(fired[1], 2);
+            NSFX_TEST_EXPECT_EQ(fired[2], 3);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Simulator)/*{{{*/
+    {
+        try
+        {
+            Ptr<nsfx::ISimulator> simulator = nsfx::CreateObject<nsfx::ISimulator>(
+                "edu.uestc.nsfx.Simulator");
+            Ptr<nsfx::IClock> clock(simulator);
+            Ptr<nsfx::IScheduler> wheel = nsfx::CreateObject<nsfx::IScheduler>(
+                "edu.uestc.nsfx.TimerWheelScheduler");
+            Ptr<nsfx::IScheduler> heap = nsfx::CreateObject<nsfx::IScheduler>(
+                "edu.uestc.nsfx.HeapScheduler");
+            Ptr<nsfx::IClockUser>(heap)->Use(clock);
+            Ptr<nsfx::IClockUser>(wheel)->Use(clock);
+            Ptr<nsfx::ISchedulerUser>(wheel)->Use(heap);
+            Ptr<nsfx::ISchedulerUser>(simulator)->Use(wheel);
+
+            // A retransmission timer that is cancelled by every ack.
+            std::vector<nsfx::TimePoint> acks;
+            Ptr<nsfx::IEventHandle> rto;
+            nsfx::IScheduler* sch = wheel.Get();
+            std::function<void(void)> ack = [&] {
+                acks.push_back(clock->Now());
+                if (rto)
+                {
+                    rto->Cancel();
+                }
+                rto = sch->ScheduleIn(
+                    nsfx::MilliSeconds(200),
+                    nsfx::CreateEventSink<nsfx::IEventSink<>>(nullptr, [&] {
+                        acks.push_back(nsfx::TimePoint());
+                    }));
+                if (acks.size() < 10)
+                {
+                    sch->ScheduleIn(nsfx::MicroSeconds(12345),
+                                    nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                                        nullptr, [&] { ack(); }));
+                }
+                else
+                {
+                    rto->Cancel();
+                }
+            };
+            sch->ScheduleNow(nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                                 nullptr, [&] { ack(); }));
+            simulator->Run();
+            NSFX_TEST_ASSERT_EQ(acks.size(), 10);
+            for (size_t i = 0; i < acks.size(); ++i)
+            {
+                NSFX_TEST_EXPECT(acks[i] == nsfx::TimePoint(
+                                     nsfx::MicroSeconds(12345) * i));
+            }
+            // The simulation ends at the last ack, since the cancelled timers
+            // leave no events behind.
+            NSFX_TEST_EXPECT(clock->Now() == acks.back());
+            NSFX_TEST_EXPECT_EQ(wheel->GetNumEvents(), 0);
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+
+    NSFX_TEST_CASE(Performance)/*{{{*/
+    {
+        // A TCP-like pattern: every ack cancels the retransmission timer of
+        // its flow, and arms the timer again.
+        try
+        {
+            const size_t numFlows = 100000;
+            const size_t numAcks = 1000000;
+            for (int k = 0; k < 2; ++k)
+            {
+                clk = nsfx::TimePoint();
+                Ptr<nsfx::IScheduler> sch = k ? CreateWheel(nsfx::MilliSeconds(1))
+                                              : CreateHeap();
+                std::mt19937 g;
+                std::uniform_int_distribution<int> rtt(10000, 100000);
+                size_t counter = 0;
+                std::vector<Ptr<nsfx::IEventHandle>> rto(numFlows);
+                std::vector<Ptr<nsfx::IEventSink<>>> acks(numFlows);
+                Ptr<nsfx::IEventSink<>> timeout(new SinkClass(0));
+                nsfx::IScheduler* s = sch.Get();
+                for (size_t i = 0; i < numFlows; ++i)
+                {
+                    acks[i] = nsfx::CreateEventSink<nsfx::IEventSink<>>(
+                        nullptr, [&, i, s] {
+                            ++counter;
+                            rto[i]->Cancel();
+                            rto[i] = s->ScheduleIn(nsfx::MilliSeconds(200),
+                                                   timeout);
+                            s->ScheduleIn(nsfx::MicroSeconds(rtt(g)), acks[i]);
+                        });
+                    rto[i] = sch->ScheduleIn(nsfx::MilliSeconds(200), timeout);
+                    sch->ScheduleIn(nsfx::MicroSeconds(rtt(g)), acks[i]);
+                }
+                fired.clear();
+                auto t0 = std::chrono::steady_clock::now();
+                while (counter < numAcks)
+                {
+                    clk = sch->GetNextEvent()->GetTimePoint();
+                    sch->FireAndRemoveNextEvent();
+                }
+                auto t1 = std::chrono::steady_clock::now();
+                double secs = std::chrono::duration<double>(t1 - t0).count();
+                std::cout << (k ? "TimerWheelScheduler: " : "HeapScheduler: ")
+                          << static_cast<uint64_t>(numAcks / secs)
+                          << " acks per second." << std::endl;
+                // No retransmission timer expires.
+                NSFX_TEST_EXPECT(fired.empty());
+                NSFX_TEST_EXPECT_EQ(sch->GetNumEvents(), 2 * numFlows);
+            }
+        }
+        catch (boost::exception& e)
+        {
+            NSFX_TEST_EXPECT(false) << diagnostic_information(e) << std::endl;
+        }
+    }/*}}}*/
+}
+
+
+int main(void)
+{
+    nsfx::test::runner::GetLogger()->AddStreamSink(std::cerr);
+    nsfx::test::runner::Run();
+
+    return 0;
+}
@@ -269,43 +269,43 @@ public:
     ////////////////////////////////////////
     // Buffer I/O.
 public:
-    template<bool zcAware>
-    void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void Write(Iterator& it) const
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.Write(bytes_ + B::offset, B::size);
     }
 
-    template<bool zcAware>
-    void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void WriteL(Iterator& it) const
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.WriteL(bytes_ + B::offset, B::size);
     }
 
-    template<bool zcAware>
-    void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void WriteB(Iterator& it) const
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.WriteB(bytes_ + B::offset, B::size);
     }
 
-    template<bool readOnly, bool zcAware>
-    void Read(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void Read(Iterator& it)
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.Read(bytes_ + B::offset, B::size);
     }
 
-    template<bool readOnly, bool zcAware>
-    void ReadL(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void ReadL(Iterator& it)
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.ReadL(bytes_ + B::offset, B::size);
     }
 
-    template<bool readOnly, bool zcAware>
-    void ReadB(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void ReadB(Iterator& it)
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.ReadB(bytes_ + B::offset, B::size);
@@ -353,44 +353,50 @@ operator<<(std::basic_ostream<Char, Traits>& os,
 
 ////////////////////////////////////////
 // Buffer I/O.
-template<bool zcAware, size_t bits>
-void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const CircularSequenceNumber<bits>& sn)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it,
+      const CircularSequenceNumber<bits>& sn)
 {
     sn.Write(it);
 }
 
-template<bool zcAware, size_t bits>
-void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const CircularSequenceNumber<bits>& sn)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it,
+       const CircularSequenceNumber<bits>& sn)
 {
     sn.WriteL(it);
 }
 
-template<bool zcAware, size_t bits>
-void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const CircularSequenceNumber<bits>& sn)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it,
+       const CircularSequenceNumber<bits>& sn)
 {
     sn.WriteB(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits>
-void Read(BasicBufferIterator<readOnly, zcAware>& it,
-           CircularSequenceNumber<bits>* sn)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it,
+     CircularSequenceNumber<bits>* sn)
 {
     sn->Read(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits>
-void ReadL(BasicBufferIterator<readOnly, zcAware>& it,
-           CircularSequenceNumber<bits>* sn)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it,
+      CircularSequenceNumber<bits>* sn)
 {
     sn->ReadL(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits>
-void ReadB(BasicBufferIterator<readOnly, zcAware>& it,
-           CircularSequenceNumber<bits>* sn)
+template<class Iterator, size_t bits>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it,
+      CircularSequenceNumber<bits>* sn)
 {
     sn->ReadB(it);
 }
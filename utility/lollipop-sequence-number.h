@@ -332,43 +332,43 @@ public:
     ////////////////////////////////////////
     // Buffer I/O.
 public:
-    template<bool zcAware>
-    void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void Write(Iterator& it) const
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.Write(bytes_ + B::offset, B::size);
     }
 
-    template<bool zcAware>
-    void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void WriteL(Iterator& it) const
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.WriteL(bytes_ + B::offset, B::size);
     }
 
-    template<bool zcAware>
-    void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it) const
+    template<class Iterator>
+    void WriteB(Iterator& it) const
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.WriteB(bytes_ + B::offset, B::size);
     }
 
-    template<bool readOnly, bool zcAware>
-    void Read(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void Read(Iterator& it)
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.Read(bytes_ + B::offset, B::size);
     }
 
-    template<bool readOnly, bool zcAware>
-    void ReadL(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void ReadL(Iterator& it)
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.ReadL(bytes_ + B::offset, B::size);
     }
 
-    template<bool readOnly, bool zcAware>
-    void ReadB(BasicBufferIterator<readOnly, zcAware>& it)
+    template<class Iterator>
+    void ReadB(Iterator& it)
     {
         typedef bits_endian_traits<ValueType, bits>  B;
         it.ReadB(bytes_ + B::offset, B::size);
@@ -417,44 +417,50 @@ operator<<(std::basic_ostream<Char, Traits>& os,
 
 ////////////////////////////////////////
 // Buffer I/O.
-template<bool zcAware, size_t bits, typename boost::uint_t<bits>::least start>
-void Write(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const LollipopSequenceNumber<bits, start>& sn)
+template<class Iterator, size_t bits, typename boost::uint_t<bits>::least start>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+Write(Iterator& it,
+      const LollipopSequenceNumber<bits, start>& sn)
 {
     sn.Write(it);
 }
 
-template<bool zcAware, size_t bits, typename boost::uint_t<bits>::least start>
-void WriteL(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const LollipopSequenceNumber<bits, start>& sn)
+template<class Iterator, size_t bits, typename boost::uint_t<bits>::least start>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteL(Iterator& it,
+       const LollipopSequenceNumber<bits, start>& sn)
 {
     sn.WriteL(it);
 }
 
-template<bool zcAware, size_t bits, typename boost::uint_t<bits>::least start>
-void WriteB(BasicBufferIterator</*readOnly*/false, zcAware>& it,
-           const LollipopSequenceNumber<bits, start>& sn)
+template<class Iterator, size_t bits, typename boost::uint_t<bits>::least start>
+typename std::enable_if<is_writable_buffer_iterator<Iterator>::value, void>::type
+WriteB(Iterator& it,
+       const LollipopSequenceNumber<bits, start>& sn)
 {
     sn.WriteB(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits, typename boost::uint_t<bits>::least start>
-void Read(BasicBufferIterator<readOnly, zcAware>& it,
-           LollipopSequenceNumber<bits, start>* sn)
+template<class Iterator, size_t bits, typename boost::uint_t<bits>::least start>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+Read(Iterator& it,
+     LollipopSequenceNumber<bits, start>* sn)
 {
     sn->Read(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits, typename boost::uint_t<bits>::least start>
-void ReadL(BasicBufferIterator<readOnly, zcAware>& it,
-           LollipopSequenceNumber<bits, start>* sn)
+template<class Iterator, size_t bits, typename boost::uint_t<bits>::least start>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadL(Iterator& it,
+      LollipopSequenceNumber<bits, start>* sn)
 {
     sn->ReadL(it);
 }
 
-template<bool readOnly, bool zcAware, size_t bits, typename boost::uint_t<bits>::least start>
-void ReadB(BasicBufferIterator<readOnly, zcAware>& it,
-           LollipopSequenceNumber<bits, start>* sn)
+template<class Iterator, size_t bits, typename boost::uint_t<bits>::least start>
+typename std::enable_if<is_buffer_iterator<Iterator>::value, void>::type
+ReadB(Iterator& it,
+      LollipopSequenceNumber<bits, start>* sn)
 {
     sn->ReadB(it);
 }